@@ -0,0 +1,95 @@
+#pragma once
+
+// Fixed pool of work buffers for the hardware tests.
+// The storage is a static array (.bss), so scratch memory used by a test is
+// neither malloc'ed per run nor taken from the heap memoryStressTest drains.
+// acquire() never blocks: it returns nullptr when every buffer is in use, and
+// the caller reports the test as failed (or falls back) instead of waiting.
+// WorkBuffer gives the buffer back when it goes out of scope.
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include "data_writer.h"
+
+template <size_t Size, uint8_t Count>
+class BufferPool {
+  static_assert(Count > 0 && Count <= 32, "one bit per buffer in a 32-bit mask");
+
+ public:
+  BufferPool() : used_(0), highWater_(0), acquired_(0), misses_(0) { lock_ = portMUX_INITIALIZER_UNLOCKED; }
+
+  uint8_t* acquire() {
+    uint8_t* buffer = nullptr;
+    portENTER_CRITICAL(&lock_);
+    for (uint8_t i = 0; i < Count; ++i) {
+      if ((used_ & (1UL << i)) == 0) {
+        used_ |= 1UL << i;
+        buffer = storage_[i];
+        ++acquired_;
+        const uint8_t inUse = __builtin_popcount(used_);
+        highWater_ = inUse > highWater_ ? inUse : highWater_;
+        break;
+      }
+    }
+    if (buffer == nullptr) {
+      ++misses_;
+    }
+    portEXIT_CRITICAL(&lock_);
+    return buffer;
+  }
+
+  void release(uint8_t* buffer) {
+    if (buffer == nullptr || buffer < storage_[0]) {
+      return;
+    }
+    const size_t offset = static_cast<size_t>(buffer - storage_[0]);
+    if (offset % Size != 0 || offset / Size >= Count) {
+      return;
+    }
+    portENTER_CRITICAL(&lock_);
+    used_ &= ~(1UL << (offset / Size));
+    portEXIT_CRITICAL(&lock_);
+  }
+
+  static constexpr size_t bufferSize() { return Size; }
+
+  void writeJson(DataWriter& out) const {
+    out.field("buffer_size", static_cast<uint32_t>(Size));
+    out.field("count", Count);
+    out.field("in_use", static_cast<uint8_t>(__builtin_popcount(used_)));
+    out.field("high_water", highWater_);
+    out.field("acquired", acquired_);
+    out.field("misses", misses_);
+  }
+
+ private:
+  alignas(16) uint8_t storage_[Count][Size];
+  portMUX_TYPE lock_;
+  volatile uint32_t used_;
+  uint8_t highWater_;
+  uint32_t acquired_;
+  uint32_t misses_;  // acquire() found every buffer taken
+};
+
+// Scoped buffer from a BufferPool; test with operator bool before use
+template <typename Pool>
+class WorkBuffer {
+ public:
+  explicit WorkBuffer(Pool& pool) : pool_(pool), data_(pool.acquire()) {}
+  ~WorkBuffer() { pool_.release(data_); }
+  WorkBuffer(const WorkBuffer&) = delete;
+  WorkBuffer& operator=(const WorkBuffer&) = delete;
+
+  explicit operator bool() const { return data_ != nullptr; }
+  uint8_t* data() const { return data_; }
+  static constexpr size_t size() { return Pool::bufferSize(); }
+
+  template <typename T>
+  T* as() const {
+    return reinterpret_cast<T*>(data_);
+  }
+
+ private:
+  Pool& pool_;
+  uint8_t* data_;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+// Streaming CBOR (RFC 8949) writer with the same document API as JsonWriter.
+// Objects and arrays use indefinite-length encoding so nothing has to be
+// counted ahead of time. Floats are stored as float32 whenever that keeps the
+// requested number of decimals, float64 otherwise; NaN/Infinity become null to
+// match the JSON output.
+
+#include "data_writer.h"
+
+class CborWriter final : public DataWriter, public WriterBuffer {
+ public:
+  typedef WriterBuffer::FlushCallback FlushCallback;
+
+  CborWriter(char* buffer, size_t capacity, FlushCallback flush, void* context)
+      : WriterBuffer(buffer, capacity, flush, context) {}
+
+  void flush() override { flushBuffer(); }
+
+  // ---- Encoder primitives ----
+  void writeKey(const char* key) override { writeText(key, strlen(key)); }
+  void writeItem() override {}
+
+  void writeOpen(bool object) override { put(static_cast<char>(object ? 0xBF : 0x9F)); }
+  void writeClose(bool object) override {
+    (void)object;
+    put(static_cast<char>(0xFF));  // "break" ends both indefinite maps and arrays
+  }
+
+  void writeText(const char* text, size_t length) override {
+    writeHead(MAJOR_TEXT, length);
+    putRaw(text, length);
+  }
+
+  void writeFlashText(const __FlashStringHelper* text) override {
+    PGM_P p = reinterpret_cast<PGM_P>(text);
+    size_t length = strlen_P(p);
+    writeHead(MAJOR_TEXT, length);
+    for (size_t i = 0; i < length; ++i) {
+      put(static_cast<char>(pgm_read_byte(p + i)));
+    }
+  }
+
+  void writeBool(bool value) override { put(static_cast<char>(value ? 0xF5 : 0xF4)); }
+  void writeNull() override { put(static_cast<char>(0xF6)); }
+
+  void writeSigned(long long value) override {
+    if (value < 0) {
+      // Major type 1 stores -1 - n
+      writeHead(MAJOR_NEGATIVE, static_cast<unsigned long long>(-(value + 1)));
+    } else {
+      writeHead(MAJOR_UNSIGNED, static_cast<unsigned long long>(value));
+    }
+  }
+
+  void writeUnsigned(unsigned long long value) override { writeHead(MAJOR_UNSIGNED, value); }
+
+  void writeFloat(double value, uint8_t decimals) override {
+    if (isnan(value) || isinf(value)) {
+      writeNull();
+      return;
+    }
+    const float narrow = static_cast<float>(value);
+    if (fabs(static_cast<double>(narrow) - value) <= 0.5 * pow(10.0, -static_cast<int>(decimals))) {
+      uint32_t bits;
+      memcpy(&bits, &narrow, sizeof(bits));
+      put(static_cast<char>(0xFA));
+      putBigEndian(bits, 4);
+    } else {
+      uint64_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+      put(static_cast<char>(0xFB));
+      putBigEndian(bits, 8);
+    }
+  }
+
+ private:
+  static const uint8_t MAJOR_UNSIGNED = 0;
+  static const uint8_t MAJOR_NEGATIVE = 1;
+  static const uint8_t MAJOR_TEXT = 3;
+
+  // Major type in the top 3 bits, argument inline (< 24) or in 1/2/4/8 bytes
+  void writeHead(uint8_t major, unsigned long long argument) {
+    const uint8_t type = static_cast<uint8_t>(major << 5);
+    if (argument < 24) {
+      put(static_cast<char>(type | argument));
+    } else if (argument <= 0xFF) {
+      put(static_cast<char>(type | 24));
+      putBigEndian(argument, 1);
+    } else if (argument <= 0xFFFF) {
+      put(static_cast<char>(type | 25));
+      putBigEndian(argument, 2);
+    } else if (argument <= 0xFFFFFFFFULL) {
+      put(static_cast<char>(type | 26));
+      putBigEndian(argument, 4);
+    } else {
+      put(static_cast<char>(type | 27));
+      putBigEndian(argument, 8);
+    }
+  }
+
+  void putBigEndian(unsigned long long value, uint8_t bytes) {
+    while (bytes > 0) {
+      --bytes;
+      put(static_cast<char>((value >> (bytes * 8)) & 0xFF));
+    }
+  }
+};
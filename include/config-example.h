@@ -98,9 +98,28 @@
 // Enable CORS for external web clients
 #define ENABLE_CORS false
 
-// Maximum number of simultaneous web clients
+// Maximum number of simultaneous web clients (connection slots; extra
+// connections are answered 503 immediately)
 #define MAX_WEB_CLIENTS 4
 
+// Stack buffer used to stream JSON API responses (bytes per chunk)
+#define JSON_STREAM_BUFFER_SIZE 1024
+
+// Server-Sent Events (/api/events): simultaneous streams, allowed push rate
+// per client (?rate= is clamped to the minimum), idle keep-alive comment and
+// refresh period of the I2C environmental sensors while a stream subscribes
+#define EVENT_STREAM_MAX_CLIENTS 3
+#define EVENT_STREAM_MIN_INTERVAL_MS 100
+#define EVENT_STREAM_DEFAULT_INTERVAL_MS 1000
+#define EVENT_STREAM_KEEPALIVE_MS 15000
+#define EVENT_STREAM_SENSOR_INTERVAL_MS 1000
+
+// Per-route latency histogram, bytes sent and heap deltas exposed on
+// /api/metrics (JSON or Prometheus). false removes the instrumentation at
+// compile time. MAX_ROUTES is the size of the static route table.
+#define ENABLE_ROUTE_METRICS true
+#define ROUTE_METRICS_MAX_ROUTES 96
+
 // ========== EXPORT CONFIGURATION ==========
 // Enable automatic export generation after boot
 #define ENABLE_AUTO_EXPORT false
@@ -112,17 +131,152 @@
 #define ENABLE_CSV_EXPORT true
 
 // ========== PERFORMANCE TUNING ==========
-// Task stack sizes (bytes)
-#define BUILTIN_LED_TASK_STACK 2048
-#define NEOPIXEL_TASK_STACK 2048
-#define OLED_TASK_STACK 4096
-#define RGB_LED_TASK_STACK 2048
-#define BUZZER_TASK_STACK 2048
-
 // Task priorities (0 = lowest, higher numbers = higher priority)
 #define HARDWARE_TEST_TASK_PRIORITY 1
 #define WEB_SERVER_TASK_PRIORITY 2
 
+// Background telemetry sampler: refresh period of the snapshot served by
+// /api/status, /api/overview, /api/system-info, /api/wifi-info and /api/memory*
+#define TELEMETRY_SAMPLE_PERIOD_MS 2000
+#define TELEMETRY_TASK_STACK 4096
+#define TELEMETRY_TASK_PRIORITY 1
+
+// Background job scheduler (/api/jobs, /api/suite and every hardware test):
+// worker tasks created once at boot and spread over both cores (run at
+// HARDWARE_TEST_TASK_PRIORITY), stack of each worker, and number of jobs kept
+// with their result (oldest finished job is recycled first; keep it above the
+// 14 tests of a full suite)
+#define JOB_WORKER_COUNT 4
+#define JOB_WORKER_STACK 6144
+#define JOB_STORE_SIZE 24
+// Worker stacks in PSRAM (needs CONFIG_SPIRAM_ALLOW_STACK_EXTERNAL_MEMORY and a
+// PSRAM board). Keep false if a test writes flash or uses DMA from the stack.
+#define JOB_STACK_IN_PSRAM false
+// Scratch buffers shared by the tests, statically allocated (one per worker)
+#define WORK_BUFFER_SIZE 4096
+#define WORK_BUFFER_COUNT 4
+
+// Stack profile (/api/stacks): every task records its deepest stack use, kept
+// in NVS. At boot the job workers and the telemetry sampler get
+// peak + max(MARGIN_PERCENT %, MIN_MARGIN) bytes, rounded to 256 and clamped
+// to [MIN_STACK, MAX_STACK], once MIN_SAMPLES runs were seen (the workers
+// once every job type was). The *_STACK values above are used until then.
+// ENABLE_STACK_PROFILE false: measured and reported only, nothing saved or applied.
+#define ENABLE_STACK_PROFILE true
+#define STACK_PROFILE_MARGIN_PERCENT 25
+#define STACK_PROFILE_MIN_MARGIN 512
+#define STACK_PROFILE_MIN_SAMPLES 3
+#define STACK_PROFILE_MIN_STACK 2048
+#define STACK_PROFILE_MAX_STACK 16384
+#define STACK_PROFILE_SAVE_INTERVAL_MS 60000
+#define TELEMETRY_STACK_IN_PSRAM false
+
+// Core placement (/api/cores). loop() serves HTTP and drives the display and
+// the NeoPixel heartbeat; it runs on ARDUINO_RUNNING_CORE (core 1 by default,
+// change it with -DARDUINO_RUNNING_CORE=0 in build_flags). The telemetry
+// sampler is pinned to TELEMETRY_CORE (-1: no affinity). Job workers exist on
+// both cores; new jobs start on:
+//   CORE_PLACEMENT_MEASURED false: the cores of CORE_PLACEMENT_FIXED_JOB_CORES
+//     (bit 0 = core 0, bit 1 = core 1)
+//   CORE_PLACEMENT_MEASURED true: the per-core load is measured every
+//     CORE_PLACEMENT_INTERVAL_MS; when the non-job load of one core exceeds the
+//     other's by IMBALANCE_PERCENT points, jobs only start on the quieter core
+// Single-core chips ignore these settings.
+#define CORE_PLACEMENT_MEASURED true
+#define CORE_PLACEMENT_FIXED_JOB_CORES 0x3
+#define CORE_PLACEMENT_INTERVAL_MS 1000
+#define CORE_PLACEMENT_IMBALANCE_PERCENT 30
+#define TELEMETRY_CORE 0
+
+// Main loop (/api/loop). loop() sleeps until a subsystem has work: a watcher
+// task (HTTP_WATCHER_STACK, WEB_SERVER_TASK_PRIORITY) wakes it for HTTP
+// requests, buttons wake it from their interrupt, jobs when they finish, and
+// software timers at each deadline: housekeeping every MAIN_LOOP_TICK_MS (job
+// timeouts, core placement, stack profile), the serial summary every
+// MAIN_LOOP_REPORT_MS and one NeoPixel heartbeat frame every
+// NEOPIXEL_HEARTBEAT_FRAME_MS. MAIN_LOOP_POLL_MS > 0 restores the former
+// polling loop (every subsystem every N ms, the old value was 10) to compare.
+#define MAIN_LOOP_POLL_MS 0
+#define MAIN_LOOP_TICK_MS 1000
+#define MAIN_LOOP_REPORT_MS 30000
+#define NEOPIXEL_HEARTBEAT_FRAME_MS 40
+#define HTTP_WATCHER_STACK 3072
+
+// Responsiveness monitor (/api/jitter, "Responsiveness" section of the exports).
+// A loop() pass longer than JITTER_STALL_MS, or a wake-up served that late, is
+// logged as a stall with the handler or route that was running and the active
+// jobs. The last JITTER_STALL_LOG stalls are kept.
+#define JITTER_STALL_MS 100
+#define JITTER_STALL_LOG 8
+
+// CPU benchmark suite (/api/benchmark). Each kernel runs CPU_BENCH_WARMUP
+// untimed passes then CPU_BENCH_ITERATIONS timed ones (median, p95, CV), alone
+// on each core then on both cores at once. One static task per core
+// (CPU_BENCH_TASK_STACK bytes) runs the kernels at CPU_BENCH_TASK_PRIORITY:
+// above loopTask, the HTTP watcher and the job workers (1-2), so they do not
+// preempt a timed pass, and below lwIP, the event loop, esp_timer and Wi-Fi (18-23).
+#define CPU_BENCH_WARMUP 3
+#define CPU_BENCH_ITERATIONS 31
+#define CPU_BENCH_TASK_STACK 3072
+#define CPU_BENCH_TASK_PRIORITY 5
+
+// Memory hierarchy curve (/api/benchmark "memory_hierarchy", exports). For each
+// region the working set doubles from 1 KB up to its limit (and at most half of
+// the largest free block); every point keeps the median of MEM_BENCH_REPEATS
+// runs. Flash is the start of the running app partition, mapped as data.
+#define MEM_BENCH_REPEATS 5
+#define MEM_BENCH_SRAM_MAX (128 * 1024)
+#define MEM_BENCH_IRAM_MAX (32 * 1024)
+#define MEM_BENCH_PSRAM_MAX (4 * 1024 * 1024)
+#define MEM_BENCH_FLASH_MAX (1024 * 1024)
+
+// SD card benchmark (/api/sd-benchmark, "sd_bench" job). The card is remounted
+// at each SPI clock of SD_BENCH_CLOCKS_KHZ (kHz). A file of SD_BENCH_FILE_KB
+// (?size_kb= overrides it) is written and read with 512 B to 64 KB blocks, then
+// SD_BENCH_RANDOM_OPS random 4 KB reads and writes, then SD_BENCH_FSYNC_OPS
+// 512-byte appends, each followed by a flush.
+#define SD_BENCH_FILE_KB 256
+#define SD_BENCH_CLOCKS_KHZ 4000, 10000, 20000, 40000
+#define SD_BENCH_RANDOM_OPS 64
+#define SD_BENCH_FSYNC_OPS 32
+
+// I2C bus benchmark (/api/i2c-benchmark, "i2c_bench" job). I2C_CLOCK_HZ is the
+// SCL clock used by the firmware (OLED, AHT20/BMP280); ?apply=1 replaces it
+// until reboot with the fastest clock of I2C_BENCH_CLOCKS_HZ at which every
+// device found (up to I2C_BENCH_MAX_DEVICES) completed I2C_BENCH_OPS register
+// reads and burst transfers without NACK or error.
+#define I2C_CLOCK_HZ 400000
+#define I2C_BENCH_CLOCKS_HZ 100000, 400000, 1000000
+#define I2C_BENCH_OPS 64
+#define I2C_BENCH_MAX_DEVICES 8
+
+// Display benchmark (/api/display-benchmark, "display_bench" job). Each TFT
+// driver (ILI9341 and ST7789) runs at every SPI clock of DISPLAY_BENCH_SPI_HZ and
+// rotation of DISPLAY_BENCH_ROTATIONS; the OLED at every clock of
+// I2C_BENCH_CLOCKS_HZ. Each measure is the median of DISPLAY_BENCH_FRAMES
+// samples; frames are pushed in strips of DISPLAY_BENCH_STRIP_ROWS lines. A run
+// reaching DISPLAY_BENCH_TARGET_FPS can drive a live dashboard.
+#define DISPLAY_BENCH_SPI_HZ 10000000, 20000000, 40000000, 80000000
+#define DISPLAY_BENCH_ROTATIONS 0, 1
+#define DISPLAY_BENCH_FRAMES 5
+#define DISPLAY_BENCH_STRIP_ROWS 16
+#define DISPLAY_BENCH_TARGET_FPS 10
+
+// Network throughput (/api/net/download, /api/net/upload, tools/net_bench.py).
+// A download sends NET_BENCH_DEFAULT_BYTES when ?bytes= is missing, never more
+// than NET_BENCH_MAX_BYTES, from one static NET_BENCH_CHUNK buffer (a multiple
+// of 256). A download is sent by its own task (NET_DOWNLOAD_STACK bytes), one at
+// a time, so loop() keeps serving HTTP, streams and job timeouts meanwhile.
+// The TCP echo service for round-trip times listens on NET_ECHO_PORT
+// (0: disabled) and drops a client silent for NET_ECHO_IDLE_MS.
+#define NET_BENCH_DEFAULT_BYTES (1024UL * 1024UL)
+#define NET_BENCH_MAX_BYTES (64UL * 1024UL * 1024UL)
+#define NET_BENCH_CHUNK 4096
+#define NET_ECHO_PORT 7007
+#define NET_ECHO_STACK 3072
+#define NET_DOWNLOAD_STACK 3072
+#define NET_ECHO_IDLE_MS 10000
+
 // ========== WATCHDOG CONFIGURATION ==========
 // Task watchdog timeout (seconds)
 #define TASK_WATCHDOG_TIMEOUT_S 10
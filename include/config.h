@@ -76,6 +76,18 @@
 #define WEB_SERVER_PORT 80
 #define ENABLE_CORS false
 #define MAX_WEB_CLIENTS 4
+#define JSON_STREAM_BUFFER_SIZE 1024
+
+// --- Event stream Common ---
+#define EVENT_STREAM_MAX_CLIENTS 3
+#define EVENT_STREAM_MIN_INTERVAL_MS 100
+#define EVENT_STREAM_DEFAULT_INTERVAL_MS 1000
+#define EVENT_STREAM_KEEPALIVE_MS 15000
+#define EVENT_STREAM_SENSOR_INTERVAL_MS 1000
+
+// --- Route metrics Common ---
+#define ENABLE_ROUTE_METRICS true
+#define ROUTE_METRICS_MAX_ROUTES 96
 
 #define ENABLE_AUTO_EXPORT false
 #define AUTO_EXPORT_DELAY_SECONDS 30
@@ -84,15 +96,93 @@
 #define ENABLE_CSV_EXPORT true
 
 // --- Performance Common ---
-#define BUILTIN_LED_TASK_STACK 2048
-#define NEOPIXEL_TASK_STACK 2048
-#define OLED_TASK_STACK 4096
-#define RGB_LED_TASK_STACK 2048
-#define BUZZER_TASK_STACK 2048
-
 #define HARDWARE_TEST_TASK_PRIORITY 1
 #define WEB_SERVER_TASK_PRIORITY 2
 
+// --- Telemetry sampler Common ---
+#define TELEMETRY_SAMPLE_PERIOD_MS 2000
+#define TELEMETRY_TASK_STACK 4096
+#define TELEMETRY_TASK_PRIORITY 1
+
+// --- Job scheduler Common ---
+#define JOB_WORKER_COUNT 4
+#define JOB_WORKER_STACK 6144
+#define JOB_STORE_SIZE 24
+#define JOB_STACK_IN_PSRAM false
+#define WORK_BUFFER_SIZE 4096
+#define WORK_BUFFER_COUNT 4
+
+// --- Stack profile Common ---
+#define ENABLE_STACK_PROFILE true
+#define STACK_PROFILE_MARGIN_PERCENT 25
+#define STACK_PROFILE_MIN_MARGIN 512
+#define STACK_PROFILE_MIN_SAMPLES 3
+#define STACK_PROFILE_MIN_STACK 2048
+#define STACK_PROFILE_MAX_STACK 16384
+#define STACK_PROFILE_SAVE_INTERVAL_MS 60000
+#define TELEMETRY_STACK_IN_PSRAM false
+
+// --- Core placement Common ---
+// loop() (serveur HTTP, affichage, NeoPixel) tourne sur ARDUINO_RUNNING_CORE
+#define CORE_PLACEMENT_MEASURED true
+#define CORE_PLACEMENT_FIXED_JOB_CORES 0x3
+#define CORE_PLACEMENT_INTERVAL_MS 1000
+#define CORE_PLACEMENT_IMBALANCE_PERCENT 30
+#define TELEMETRY_CORE 0
+
+// --- Main loop Common ---
+// 0 : loop() réveillé par événements ; N > 0 : ancien mode, tout est scruté toutes les N ms
+#define MAIN_LOOP_POLL_MS 0
+#define MAIN_LOOP_TICK_MS 1000
+#define MAIN_LOOP_REPORT_MS 30000
+#define NEOPIXEL_HEARTBEAT_FRAME_MS 40
+#define HTTP_WATCHER_STACK 3072
+
+// --- Jitter monitor Common ---
+#define JITTER_STALL_MS 100
+#define JITTER_STALL_LOG 8
+
+// --- CPU benchmark Common ---
+#define CPU_BENCH_WARMUP 3
+#define CPU_BENCH_ITERATIONS 31
+#define CPU_BENCH_TASK_STACK 3072
+#define CPU_BENCH_TASK_PRIORITY 5
+
+// --- Memory benchmark Common ---
+#define MEM_BENCH_REPEATS 5
+#define MEM_BENCH_SRAM_MAX (128 * 1024)
+#define MEM_BENCH_IRAM_MAX (32 * 1024)
+#define MEM_BENCH_PSRAM_MAX (4 * 1024 * 1024)
+#define MEM_BENCH_FLASH_MAX (1024 * 1024)
+
+// --- SD benchmark Common ---
+#define SD_BENCH_FILE_KB 256
+#define SD_BENCH_CLOCKS_KHZ 4000, 10000, 20000, 40000
+#define SD_BENCH_RANDOM_OPS 64
+#define SD_BENCH_FSYNC_OPS 32
+
+// --- I2C benchmark Common ---
+#define I2C_CLOCK_HZ 400000
+#define I2C_BENCH_CLOCKS_HZ 100000, 400000, 1000000
+#define I2C_BENCH_OPS 64
+#define I2C_BENCH_MAX_DEVICES 8
+
+// --- Display benchmark Common ---
+#define DISPLAY_BENCH_SPI_HZ 10000000, 20000000, 40000000, 80000000
+#define DISPLAY_BENCH_ROTATIONS 0, 1
+#define DISPLAY_BENCH_FRAMES 5
+#define DISPLAY_BENCH_STRIP_ROWS 16
+#define DISPLAY_BENCH_TARGET_FPS 10
+
+// --- Network throughput Common ---
+#define NET_BENCH_DEFAULT_BYTES (1024UL * 1024UL)
+#define NET_BENCH_MAX_BYTES (64UL * 1024UL * 1024UL)
+#define NET_BENCH_CHUNK 4096
+#define NET_ECHO_PORT 7007
+#define NET_ECHO_STACK 3072
+#define NET_DOWNLOAD_STACK 3072
+#define NET_ECHO_IDLE_MS 10000
+
 #define TASK_WATCHDOG_TIMEOUT_S 10
 #define DISABLE_IDLE_TASK_WDT true
 
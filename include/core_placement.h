@@ -0,0 +1,178 @@
+#pragma once
+
+// Per-core CPU load and core placement of the job workers.
+// A FreeRTOS tick hook on each core looks at the task running there at every
+// tick (1 kHz) and counts it as idle, job worker, loop task (HTTP server,
+// display, NeoPixel heartbeat) or other (Wi-Fi/lwIP, telemetry sampler,
+// timers). This gives the same split as vTaskGetRunTimeStats() over a window
+// of a second without CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS, which the
+// Arduino SDK build does not enable.
+// Tasks keep the core they were created on (no affinity change on IDF 4.4),
+// so the measured policy acts on what can move: the cores allowed to start
+// queued jobs. When the background load (loop + other) of one core exceeds the
+// other's by imbalancePercent, new jobs only start on the quieter core; both
+// cores are used again once the gap falls under half the threshold.
+
+#include <Arduino.h>
+#include <esp_freertos_hooks.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+enum CoreLoadBucket : uint8_t { CORE_IDLE, CORE_JOBS, CORE_LOOP, CORE_OTHER, CORE_BUCKET_COUNT };
+
+inline const char* coreLoadBucketName(uint8_t bucket) {
+  static const char* const NAMES[CORE_BUCKET_COUNT] = {"idle", "jobs", "loop", "other"};
+  return bucket < CORE_BUCKET_COUNT ? NAMES[bucket] : "unknown";
+}
+
+struct CoreLoad {
+  uint32_t ticks;  // samples in the window, 0 when the core is not monitored
+  uint8_t percent[CORE_BUCKET_COUNT];
+
+  uint8_t busy() const { return ticks > 0 ? 100 - percent[CORE_IDLE] : 0; }
+  // Load the jobs do not control: what a test started on this core competes with
+  uint8_t background() const { return percent[CORE_LOOP] + percent[CORE_OTHER]; }
+};
+
+class CoreLoadMonitor {
+ public:
+  static const uint8_t MAX_CORES = 2;
+  static const uint8_t MAX_JOB_TASKS = 8;
+
+  CoreLoadMonitor() : loopTask_(nullptr), jobTaskCount_(0), cores_(0) {
+    memset(idleTasks_, 0, sizeof(idleTasks_));
+    memset(jobTasks_, 0, sizeof(jobTasks_));
+    memset(const_cast<uint32_t*>(&counts_[0][0]), 0, sizeof(counts_));
+    memset(last_, 0, sizeof(last_));
+  }
+
+  // Before begin(): the hooks read the list without locking
+  void addJobTask(TaskHandle_t task) {
+    if (task != nullptr && jobTaskCount_ < MAX_JOB_TASKS) {
+      jobTasks_[jobTaskCount_++] = task;
+    }
+  }
+
+  // Registers one tick hook per core. Single instance (the hooks are plain functions).
+  bool begin(TaskHandle_t loopTask) {
+    if (instance_ != nullptr) {
+      return false;
+    }
+    instance_ = this;
+    loopTask_ = loopTask;
+    cores_ = portNUM_PROCESSORS < MAX_CORES ? portNUM_PROCESSORS : MAX_CORES;
+    for (uint8_t core = 0; core < cores_; ++core) {
+      idleTasks_[core] = xTaskGetIdleTaskHandleForCPU(core);
+      if (esp_register_freertos_tick_hook_for_cpu(core == 0 ? tick0 : tick1, core) != ESP_OK) {
+        cores_ = core;
+        break;
+      }
+    }
+    return cores_ > 0;
+  }
+
+  uint8_t cores() const { return cores_; }
+
+  // Split of each core since the previous call (called from loop())
+  void sample(CoreLoad (&out)[MAX_CORES]) {
+    memset(out, 0, sizeof(out));
+    for (uint8_t core = 0; core < cores_; ++core) {
+      uint32_t delta[CORE_BUCKET_COUNT];
+      uint32_t total = 0;
+      for (uint8_t bucket = 0; bucket < CORE_BUCKET_COUNT; ++bucket) {
+        const uint32_t now = counts_[core][bucket];
+        delta[bucket] = now - last_[core][bucket];
+        last_[core][bucket] = now;
+        total += delta[bucket];
+      }
+      out[core].ticks = total;
+      for (uint8_t bucket = 0; total > 0 && bucket < CORE_BUCKET_COUNT; ++bucket) {
+        out[core].percent[bucket] = static_cast<uint8_t>((delta[bucket] * 100 + total / 2) / total);
+      }
+    }
+  }
+
+ private:
+  static void IRAM_ATTR tick0() { instance_->count(0); }
+  static void IRAM_ATTR tick1() { instance_->count(1); }
+
+  // Tick interrupt of this core: the current task is the one running on it
+  void IRAM_ATTR count(uint8_t core) {
+    const TaskHandle_t current = xTaskGetCurrentTaskHandle();
+    uint8_t bucket = CORE_OTHER;
+    if (current == idleTasks_[core]) {
+      bucket = CORE_IDLE;
+    } else if (current == loopTask_) {
+      bucket = CORE_LOOP;
+    } else {
+      for (uint8_t i = 0; i < jobTaskCount_; ++i) {
+        if (current == jobTasks_[i]) {
+          bucket = CORE_JOBS;
+          break;
+        }
+      }
+    }
+    counts_[core][bucket] = counts_[core][bucket] + 1;
+  }
+
+  static inline CoreLoadMonitor* instance_ = nullptr;
+
+  TaskHandle_t idleTasks_[MAX_CORES];
+  TaskHandle_t loopTask_;
+  TaskHandle_t jobTasks_[MAX_JOB_TASKS];
+  uint8_t jobTaskCount_;
+  uint8_t cores_;
+  volatile uint32_t counts_[MAX_CORES][CORE_BUCKET_COUNT];  // written by the tick hook of each core only
+  uint32_t last_[MAX_CORES][CORE_BUCKET_COUNT];
+};
+
+enum CorePlacementMode : uint8_t { PLACEMENT_FIXED, PLACEMENT_MEASURED };
+
+inline const char* corePlacementModeName(CorePlacementMode mode) {
+  return mode == PLACEMENT_MEASURED ? "measured" : "fixed";
+}
+
+// Chooses the cores allowed to start jobs (bit n = core n)
+class CorePlacement {
+ public:
+  CorePlacement(CorePlacementMode mode, uint8_t fixedMask, uint8_t imbalancePercent)
+      : mode_(mode), fixedMask_(fixedMask), imbalance_(imbalancePercent), mask_(fixedMask), changes_(0) {}
+
+  CorePlacementMode mode() const { return mode_; }
+  void setMode(CorePlacementMode mode) { mode_ = mode; }
+  uint8_t mask() const { return mask_; }
+  uint32_t changes() const { return changes_; }
+
+  // New mask from one window of loads; workerCores: cores that have workers
+  uint8_t update(const CoreLoad* loads, uint8_t cores, uint8_t workerCores) {
+    uint8_t next = fixedMask_ & workerCores;
+    if (mode_ == PLACEMENT_MEASURED && cores >= 2 && (workerCores & 0x3) == 0x3) {
+      next = mask_ & 0x3;
+      if (loads[0].ticks > 0 && loads[1].ticks > 0) {
+        const int gap = static_cast<int>(loads[0].background()) - static_cast<int>(loads[1].background());
+        if (gap >= imbalance_) {
+          next = 0x2;
+        } else if (-gap >= imbalance_) {
+          next = 0x1;
+        } else if (abs(gap) < imbalance_ / 2) {
+          next = 0x3;
+        }
+      }
+    }
+    if (next == 0) {
+      next = workerCores;
+    }
+    if (next != mask_) {
+      mask_ = next;
+      ++changes_;
+    }
+    return mask_;
+  }
+
+ private:
+  CorePlacementMode mode_;
+  uint8_t fixedMask_;
+  uint8_t imbalance_;
+  uint8_t mask_;
+  uint32_t changes_;
+};
@@ -0,0 +1,284 @@
+#pragma once
+
+// Runs the kernels of cpu_benchmark.h on each core alone, then on both cores
+// at once. One task per core is created by the first begin() (static TCB,
+// stack allocated once) and sleeps on its task notification. run() wakes the
+// tasks of the requested cores; they meet at an event group barrier so that
+// dual-core passes overlap, time the kernel with the cycle counter of their
+// own core (ESP.getCycleCount()) and set their done bit. The caller blocks on
+// the done bits, which leaves its own task notifications (job cancellation)
+// untouched. On timeout run() raises an abort flag, opens the barrier and
+// waits again for the done bits: a task that acknowledges has not written its
+// stats. A task that still does not answer is deleted and its core retired
+// until reboot (its static TCB and stack are never reused), so no bench task
+// is left writing stats_ once run() has returned.
+// The tasks run at the priority given to begin() (CPU_BENCH_TASK_PRIORITY):
+// above loopTask, the HTTP watcher and the job workers, so those do not
+// preempt a timed pass, and below the Wi-Fi, lwIP and esp_timer tasks.
+// Stats are kept per kernel, mode and core; /api/benchmark converts cycles to
+// microseconds with the CPU frequency of the run.
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <freertos/task.h>
+#include "cpu_benchmark.h"
+#include "data_writer.h"
+
+template <uint16_t Iterations>
+class CpuBenchSuite {
+ public:
+  static const uint8_t MAX_CORES = 2;
+  enum Mode : uint8_t { SINGLE = 0, DUAL = 1 };
+
+  CpuBenchSuite(uint16_t warmup, uint32_t stackBytes)
+      : warmup_(warmup), stackBytes_(stackBytes), group_(nullptr), kernel_(0), mode_(SINGLE), readyBits_(0),
+        abort_(false) {
+    memset(handles_, 0, sizeof(handles_));
+    memset(retired_, 0, sizeof(retired_));
+    memset(stats_, 0, sizeof(stats_));
+    clear();
+  }
+
+  uint8_t cores() const { return portNUM_PROCESSORS < MAX_CORES ? portNUM_PROCESSORS : MAX_CORES; }
+  uint16_t warmup() const { return warmup_; }
+  uint16_t iterations() const { return Iterations; }
+
+  // Creates the missing per-core tasks; false when a stack or task could not be
+  // created, or when a core was retired after a task that did not stop
+  bool begin(UBaseType_t priority) {
+    if (group_ == nullptr) {
+      group_ = xEventGroupCreateStatic(&groupBuffer_);
+    }
+    for (uint8_t core = 0; core < cores(); ++core) {
+      if (retired_[core]) {
+        return false;
+      }
+      if (handles_[core] != nullptr) {
+        continue;
+      }
+      StackType_t* stack =
+          static_cast<StackType_t*>(heap_caps_malloc(stackBytes_, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+      if (stack == nullptr) {
+        return false;
+      }
+      slots_[core].owner = this;
+      slots_[core].core = core;
+      handles_[core] = xTaskCreateStaticPinnedToCore(benchTask, core == 0 ? "CpuBench0" : "CpuBench1", stackBytes_,
+                                                     &slots_[core], priority, stack, &tcbs_[core], core);
+    }
+    return true;
+  }
+
+  // Forgets the previous results before a new suite
+  void clear() {
+    valid_ = false;
+    mhz_ = 0;
+    durationMs_ = 0;
+  }
+
+  // Times one kernel on every core of coreMask at the same time; false on timeout
+  bool run(uint8_t kernel, Mode mode, uint8_t coreMask, uint32_t timeoutMs) {
+    if (group_ == nullptr || kernel >= CPU_KERNEL_COUNT) {
+      return false;
+    }
+    EventBits_t done = 0;
+    kernel_ = kernel;
+    mode_ = mode;
+    readyBits_ = coreMask;
+    abort_ = false;
+    xEventGroupClearBits(group_, ALL_BITS);
+    for (uint8_t core = 0; core < cores(); ++core) {
+      if ((coreMask & (1 << core)) != 0 && handles_[core] != nullptr) {
+        done |= doneBit(core);
+      }
+    }
+    if (done == 0 || done != static_cast<EventBits_t>(coreMask) << DONE_SHIFT) {
+      return false;
+    }
+    for (uint8_t core = 0; core < cores(); ++core) {
+      if ((coreMask & (1 << core)) != 0) {
+        xTaskNotifyGive(handles_[core]);
+      }
+    }
+    EventBits_t bits = xEventGroupWaitBits(group_, done, pdTRUE, pdTRUE, pdMS_TO_TICKS(timeoutMs));
+    if ((bits & done) == done) {
+      return true;
+    }
+    // Timeout: the late tasks skip (or drop) their measurement and acknowledge
+    abort_ = true;
+    xEventGroupSetBits(group_, coreMask);  // releases a task still waiting at the barrier
+    bits |= xEventGroupWaitBits(group_, done & ~bits, pdTRUE, pdTRUE, pdMS_TO_TICKS(ABORT_WAIT_MS));
+    for (uint8_t core = 0; core < cores(); ++core) {
+      if ((done & ~bits & doneBit(core)) != 0) {
+        retire(core);
+      }
+    }
+    return false;
+  }
+
+  // End of a complete suite
+  void finish(uint32_t mhz, uint32_t durationMs) {
+    mhz_ = mhz;
+    durationMs_ = durationMs;
+    valid_ = true;
+  }
+
+  bool valid() const { return valid_; }
+
+  const CpuKernelStats& stats(uint8_t kernel, Mode mode, uint8_t core) const {
+    return stats_[kernel < CPU_KERNEL_COUNT ? kernel : 0][mode][core < MAX_CORES ? core : 0];
+  }
+
+  float toUs(uint32_t cycles) const { return mhz_ > 0 ? static_cast<float>(cycles) / mhz_ : 0.0f; }
+
+  float medianUs(uint8_t kernel, Mode mode, uint8_t core) const { return toUs(stats(kernel, mode, core).medianCycles); }
+
+  // Sum of the single-core medians of every kernel on that core
+  float totalUs(uint8_t core) const {
+    float total = 0;
+    for (uint8_t kernel = 0; kernel < CPU_KERNEL_COUNT; ++kernel) {
+      total += medianUs(kernel, SINGLE, core);
+    }
+    return total;
+  }
+
+  // Nominal operations per microsecond over the kernels that count their work
+  float score(uint8_t core) const {
+    float work = 0;
+    float us = 0;
+    for (uint8_t kernel = 0; kernel < CPU_KERNEL_COUNT; ++kernel) {
+      if (CPU_KERNELS[kernel].work > 0) {
+        work += CPU_KERNELS[kernel].work;
+        us += medianUs(kernel, SINGLE, core);
+      }
+    }
+    return us > 0 ? work / us : 0.0f;
+  }
+
+  // Combined throughput of the dual-core run relative to the fastest single core (2.0: perfect)
+  float dualScaling(uint8_t kernel) const {
+    if (cores() < 2) {
+      return 0.0f;
+    }
+    uint32_t best = 0;
+    for (uint8_t core = 0; core < cores(); ++core) {
+      const uint32_t single = stats(kernel, SINGLE, core).medianCycles;
+      best = best == 0 || (single > 0 && single < best) ? single : best;
+    }
+    float scaling = 0;
+    for (uint8_t core = 0; core < cores(); ++core) {
+      const uint32_t dual = stats(kernel, DUAL, core).medianCycles;
+      scaling += dual > 0 ? static_cast<float>(best) / dual : 0.0f;
+    }
+    return scaling;
+  }
+
+  // {"mhz","warmup","iterations","cores","duration_ms","kernels":[{"name","unit","work","single":[...],"dual":[...],"dual_scaling"}]}
+  void writeJson(DataWriter& out) const {
+    out.field("mhz", mhz_);
+    out.field("warmup", warmup_);
+    out.field("iterations", Iterations);
+    out.field("cores", cores());
+    out.field("duration_ms", durationMs_);
+    out.beginArray("kernels");
+    for (uint8_t kernel = 0; kernel < CPU_KERNEL_COUNT; ++kernel) {
+      const CpuKernel& info = CPU_KERNELS[kernel];
+      out.beginObject();
+      out.field("name", info.name);
+      out.field("unit", info.unit);
+      out.field("work", info.work);
+      writeRuns(out, "single", kernel, SINGLE);
+      if (cores() > 1) {
+        writeRuns(out, "dual", kernel, DUAL);
+        out.fieldFloat("dual_scaling", dualScaling(kernel), 2);
+      }
+      out.endObject();
+    }
+    out.endArray();
+  }
+
+ private:
+  static const uint8_t DONE_SHIFT = 4;
+  static const EventBits_t ALL_BITS = 0xFF;  // ready bits 0-3, done bits 4-7
+  static const uint32_t ABORT_WAIT_MS = 1000;  // longer than a kernel pass on a core that is not starved
+
+  struct Slot {
+    CpuBenchSuite* owner;
+    uint8_t core;
+  };
+
+  static EventBits_t doneBit(uint8_t core) { return 1UL << (DONE_SHIFT + core); }
+
+  static uint32_t cycleCount() { return ESP.getCycleCount(); }
+
+  static void benchTask(void* arg) {
+    Slot* slot = static_cast<Slot*>(arg);
+    CpuBenchSuite* suite = slot->owner;
+    for (;;) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      // Barrier: in dual mode both cores start the kernel together
+      xEventGroupSync(suite->group_, 1UL << slot->core, suite->readyBits_, portMAX_DELAY);
+      if (!suite->abort_) {
+        const CpuKernelStats stats = measureCpuKernel(CPU_KERNELS[suite->kernel_], suite->warmup_, Iterations,
+                                                      suite->samples_[slot->core], cycleCount);
+        if (!suite->abort_) {  // run() gave up meanwhile: keep the previous stats
+          suite->stats_[suite->kernel_][suite->mode_][slot->core] = stats;
+        }
+      }
+      xEventGroupSetBits(suite->group_, doneBit(slot->core));
+    }
+  }
+
+  // Task that did not acknowledge the abort: it cannot be trusted with stats_
+  // any more. Its TCB and stack stay allocated (the deletion of a task running
+  // on the other core completes later, in the idle task).
+  void retire(uint8_t core) {
+    vTaskDelete(handles_[core]);
+    handles_[core] = nullptr;
+    retired_[core] = true;
+  }
+
+  void writeRuns(DataWriter& out, const char* name, uint8_t kernel, Mode mode) const {
+    const CpuKernel& info = CPU_KERNELS[kernel];
+    out.beginArray(name);
+    for (uint8_t core = 0; core < cores(); ++core) {
+      const CpuKernelStats& run = stats(kernel, mode, core);
+      out.beginObject();
+      out.field("core", core);
+      out.fieldFloat("median_us", toUs(run.medianCycles), 2);
+      out.fieldFloat("p95_us", toUs(run.p95Cycles), 2);
+      out.fieldFloat("min_us", toUs(run.minCycles), 2);
+      out.fieldFloat("cv_percent", run.cvPercent, 2);
+      if (info.work > 0 && run.medianCycles > 0) {
+        out.fieldFloat("rate", info.work / toUs(run.medianCycles), 2);
+      }
+      out.endObject();
+    }
+    out.endArray();
+  }
+
+  uint16_t warmup_;
+  uint32_t stackBytes_;
+  EventGroupHandle_t group_;
+  StaticEventGroup_t groupBuffer_;
+  TaskHandle_t handles_[MAX_CORES];
+  bool retired_[MAX_CORES];
+  StaticTask_t tcbs_[MAX_CORES];
+  Slot slots_[MAX_CORES];
+
+  // Written by run() before the tasks are notified
+  volatile uint8_t kernel_;
+  volatile Mode mode_;
+  volatile EventBits_t readyBits_;
+  volatile bool abort_;  // set by run() on timeout
+
+  // Each core task writes its own samples and stats
+  uint32_t samples_[MAX_CORES][Iterations];
+  CpuKernelStats stats_[CPU_KERNEL_COUNT][2][MAX_CORES];
+
+  bool valid_;
+  uint32_t mhz_;
+  uint32_t durationMs_;
+};
@@ -0,0 +1,412 @@
+#pragma once
+
+// CPU benchmark kernels.
+// Each kernel does a fixed amount of work per pass and returns a checksum that
+// the caller folds into a volatile sink, so the compiler cannot drop the work:
+//   int_alu   add/xor/shift/rotate chain on 32-bit integers
+//   float32   polynomial evaluation in float (hardware FPU on the ESP32)
+//   float64   the same in double (software on Xtensa and RISC-V)
+//   mul_div   32-bit multiply, divide and remainder
+//   branch    data-dependent branches on a xorshift sequence
+//   list      CoreMark-style linked list: reverse, find, merge sort
+//   matrix    CoreMark-style 16-bit matrices: scale, multiply, bit extraction
+//   state     CoreMark-style state machine classifying numeric tokens
+//   crc32     bitwise CRC-32 over a 256-byte buffer
+// measureCpuKernel() runs warm-up passes (caches, branch history) and then
+// timed passes with a cycle counter, and reduces them to median, p95 and
+// coefficient of variation. Nothing here depends on Arduino or FreeRTOS: the
+// same kernels build for the host (env:native_bench) as a reference.
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// ---- Kernels (one pass each) ----
+
+inline uint32_t cpuKernelIntAlu(uint32_t seed) {
+  uint32_t a = seed;
+  uint32_t b = seed ^ 0x9E3779B9u;
+  uint32_t c = 0x7F4A7C15u;
+  for (uint32_t i = 0; i < 4096; ++i) {
+    a += b ^ i;
+    b = ((b << 5) | (b >> 27)) ^ a;
+    c -= a >> 3;
+    c ^= b + i;
+  }
+  return a ^ b ^ c;
+}
+
+inline uint32_t cpuKernelFloat32(uint32_t seed) {
+  float x = static_cast<float>(seed & 0xFF) * (1.0f / 256.0f);
+  float sum = 0.0f;
+  for (uint32_t i = 0; i < 2048; ++i) {
+    sum += ((0.25f * x + 0.5f) * x - 0.125f) * x + 1.0f;
+    x = x * 0.999f + 0.0007f;  // stays in [0, 1)
+  }
+  uint32_t bits;
+  memcpy(&bits, &sum, sizeof(bits));
+  return bits;
+}
+
+inline uint32_t cpuKernelFloat64(uint32_t seed) {
+  double x = static_cast<double>(seed & 0xFF) * (1.0 / 256.0);
+  double sum = 0.0;
+  for (uint32_t i = 0; i < 512; ++i) {
+    sum += ((0.25 * x + 0.5) * x - 0.125) * x + 1.0;
+    x = x * 0.999 + 0.0007;
+  }
+  uint64_t bits;
+  memcpy(&bits, &sum, sizeof(bits));
+  return static_cast<uint32_t>(bits ^ (bits >> 32));
+}
+
+inline uint32_t cpuKernelMulDiv(uint32_t seed) {
+  uint32_t a = seed | 1;
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < 1024; ++i) {
+    a = a * 1664525u + 1013904223u;
+    const uint32_t divisor = (i & 0xFF) + 3;  // not a constant: a real divide
+    acc += a / divisor;
+    acc ^= a % divisor;
+  }
+  return acc;
+}
+
+inline uint32_t cpuKernelBranch(uint32_t seed) {
+  uint32_t x = seed | 1;
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < 4096; ++i) {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    if (x & 1) {
+      count += 3;
+    } else {
+      count ^= x;
+    }
+    if ((x & 0x30) == 0x10) {
+      count += x >> 24;
+    } else if (x & 0x100) {
+      count -= 7;
+    }
+    if (count & 0x80) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+struct CpuListNode {
+  CpuListNode* next;
+  int16_t value;
+  int16_t index;
+};
+
+// Bottom-up merge sort of a singly linked list, by value or by index
+inline CpuListNode* cpuListSort(CpuListNode* list, bool byValue) {
+  for (uint32_t size = 1;; size *= 2) {
+    CpuListNode* p = list;
+    CpuListNode* tail = nullptr;
+    uint32_t merges = 0;
+    list = nullptr;
+    while (p != nullptr) {
+      ++merges;
+      CpuListNode* q = p;
+      uint32_t pSize = 0;
+      for (uint32_t i = 0; i < size && q != nullptr; ++i) {
+        ++pSize;
+        q = q->next;
+      }
+      uint32_t qSize = size;
+      while (pSize > 0 || (qSize > 0 && q != nullptr)) {
+        CpuListNode* e;
+        if (pSize == 0) {
+          e = q;
+          q = q->next;
+          --qSize;
+        } else if (qSize == 0 || q == nullptr ||
+                   (byValue ? p->value <= q->value : p->index <= q->index)) {
+          e = p;
+          p = p->next;
+          --pSize;
+        } else {
+          e = q;
+          q = q->next;
+          --qSize;
+        }
+        if (tail != nullptr) {
+          tail->next = e;
+        } else {
+          list = e;
+        }
+        tail = e;
+      }
+      p = q;
+    }
+    tail->next = nullptr;
+    if (merges <= 1) {
+      return list;
+    }
+  }
+}
+
+inline uint32_t cpuKernelList(uint32_t seed) {
+  static const uint8_t NODES = 64;
+  CpuListNode nodes[NODES];
+  uint32_t x = seed | 1;
+  for (uint8_t i = 0; i < NODES; ++i) {
+    x = x * 1103515245u + 12345u;
+    nodes[i].value = static_cast<int16_t>((x >> 16) & 0x7FFF);
+    nodes[i].index = i;
+    nodes[i].next = i + 1 < NODES ? &nodes[i + 1] : nullptr;
+  }
+  CpuListNode* head = &nodes[0];
+  uint32_t check = 0;
+  for (uint8_t round = 0; round < 4; ++round) {
+    CpuListNode* reversed = nullptr;
+    while (head != nullptr) {
+      CpuListNode* next = head->next;
+      head->next = reversed;
+      reversed = head;
+      head = next;
+    }
+    head = reversed;
+    for (uint8_t k = 0; k < 8; ++k) {
+      const int16_t wanted = nodes[(k * 7 + round) % NODES].value;
+      const CpuListNode* found = head;
+      while (found != nullptr && found->value != wanted) {
+        found = found->next;
+      }
+      check += found != nullptr ? static_cast<uint32_t>(found->index) : 0xFFFFu;
+    }
+    head = cpuListSort(head, (round & 1) == 0);
+    check = check * 31 + static_cast<uint32_t>(head->value);
+  }
+  return check;
+}
+
+inline uint32_t cpuKernelMatrix(uint32_t seed) {
+  static const uint8_t N = 12;
+  int16_t a[N][N];
+  int16_t b[N][N];
+  int32_t c[N][N];
+  uint32_t x = seed | 1;
+  for (uint8_t i = 0; i < N; ++i) {
+    for (uint8_t j = 0; j < N; ++j) {
+      x = x * 1103515245u + 12345u;
+      a[i][j] = static_cast<int16_t>((x >> 16) & 0xFF);
+      b[i][j] = static_cast<int16_t>(((x >> 8) & 0xFF) - 128);
+    }
+  }
+  const int16_t scale = static_cast<int16_t>((seed & 0xF) | 1);
+  uint32_t check = 0;
+  for (uint8_t i = 0; i < N; ++i) {
+    for (uint8_t j = 0; j < N; ++j) {
+      check += static_cast<uint32_t>(a[i][j] * scale);
+    }
+  }
+  for (uint8_t i = 0; i < N; ++i) {
+    for (uint8_t j = 0; j < N; ++j) {
+      int32_t sum = 0;
+      for (uint8_t k = 0; k < N; ++k) {
+        sum += a[i][k] * b[k][j];
+      }
+      c[i][j] = sum;
+    }
+  }
+  for (uint8_t i = 0; i < N; ++i) {
+    for (uint8_t j = 0; j < N; ++j) {
+      int32_t sum = 0;
+      for (uint8_t k = 0; k < N; ++k) {
+        const int32_t product = a[i][k] * b[k][j];
+        sum += ((product >> 2) & 0xF) * ((product >> 5) & 0x7F);
+      }
+      check ^= static_cast<uint32_t>(c[i][j] + sum);
+      check = (check << 1) | (check >> 31);
+    }
+  }
+  return check;
+}
+
+enum CpuTokenState : uint8_t {
+  TOKEN_START,
+  TOKEN_INVALID,
+  TOKEN_SIGN,
+  TOKEN_INT,
+  TOKEN_FLOAT,
+  TOKEN_E,
+  TOKEN_EXPONENT_SIGN,
+  TOKEN_SCIENTIFIC,
+  TOKEN_STATES
+};
+
+// Consumes one comma-separated token; returns its final state
+inline CpuTokenState cpuNextToken(const char*& p, uint32_t& transitions) {
+  CpuTokenState state = TOKEN_START;
+  for (; *p != '\0' && *p != ','; ++p) {
+    const char ch = *p;
+    const bool digit = ch >= '0' && ch <= '9';
+    const CpuTokenState previous = state;
+    switch (state) {
+      case TOKEN_START:
+        state = digit ? TOKEN_INT : (ch == '+' || ch == '-') ? TOKEN_SIGN : ch == '.' ? TOKEN_FLOAT : TOKEN_INVALID;
+        break;
+      case TOKEN_SIGN:
+        state = digit ? TOKEN_INT : ch == '.' ? TOKEN_FLOAT : TOKEN_INVALID;
+        break;
+      case TOKEN_INT:
+        state = digit ? TOKEN_INT : ch == '.' ? TOKEN_FLOAT : TOKEN_INVALID;
+        break;
+      case TOKEN_FLOAT:
+        state = digit ? TOKEN_FLOAT : (ch == 'e' || ch == 'E') ? TOKEN_E : TOKEN_INVALID;
+        break;
+      case TOKEN_E:
+        state = (ch == '+' || ch == '-') ? TOKEN_EXPONENT_SIGN : TOKEN_INVALID;
+        break;
+      case TOKEN_EXPONENT_SIGN:
+      case TOKEN_SCIENTIFIC:
+        state = digit ? TOKEN_SCIENTIFIC : TOKEN_INVALID;
+        break;
+      default:
+        break;
+    }
+    transitions += state != previous ? 1 : 0;
+  }
+  if (*p == ',') {
+    ++p;
+  }
+  return state;
+}
+
+inline uint32_t cpuKernelState(uint32_t seed) {
+  static const char* const TOKENS[] = {"5012",     "1234",     "-874",     "+122",     "35.54400", ".1234500",
+                                       "-110.700", "+0.64400", "5.500e+3", "-.123e-2", "-87e+832", "+0.6e-12",
+                                       "T0.3e-1F", "-T.T++Tq", "1T3.4e4z", "34.0e-T^"};
+  char input[256];
+  size_t length = 0;
+  uint32_t x = seed | 1;
+  for (;;) {
+    x = x * 1103515245u + 12345u;
+    const char* token = TOKENS[(x >> 16) & 0xF];
+    const size_t tokenLength = strlen(token);
+    if (length + tokenLength + 2 > sizeof(input)) {
+      break;
+    }
+    memcpy(input + length, token, tokenLength);
+    length += tokenLength;
+    input[length++] = ',';
+  }
+  input[length] = '\0';
+
+  uint32_t finals[TOKEN_STATES] = {0};
+  uint32_t transitions = 0;
+  for (uint8_t round = 0; round < 4; ++round) {
+    for (const char* p = input; *p != '\0';) {
+      ++finals[cpuNextToken(p, transitions)];
+    }
+    for (size_t i = round; i < length; i += round + 3) {
+      input[i] ^= 1;  // corrupts some characters: '5' <-> '4', ',' <-> '-', ...
+    }
+  }
+  uint32_t check = transitions;
+  for (uint8_t state = 0; state < TOKEN_STATES; ++state) {
+    check = check * 33 + finals[state];
+  }
+  return check;
+}
+
+inline uint32_t cpuKernelCrc32(uint32_t seed) {
+  uint8_t data[256];
+  uint32_t x = seed | 1;
+  for (size_t i = 0; i < sizeof(data); ++i) {
+    x = x * 1103515245u + 12345u;
+    data[i] = static_cast<uint8_t>(x >> 16);
+  }
+  uint32_t crc = 0xFFFFFFFFu;
+  for (uint8_t b : data) {
+    crc ^= b;
+    for (uint8_t bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+struct CpuKernel {
+  const char* name;
+  uint32_t (*run)(uint32_t seed);
+  uint32_t work;     // units of work per pass (nominal operation count), 0: time only
+  const char* unit;  // work per microsecond
+};
+
+inline const CpuKernel CPU_KERNELS[] = {
+  {"int_alu", cpuKernelIntAlu, 4096 * 10, "Mops/s"},
+  {"float32", cpuKernelFloat32, 2048 * 9, "MFLOPS"},
+  {"float64", cpuKernelFloat64, 512 * 9, "MFLOPS"},
+  {"mul_div", cpuKernelMulDiv, 1024 * 3, "Mops/s"},
+  {"branch", cpuKernelBranch, 4096 * 4, "Mbranch/s"},
+  {"list", cpuKernelList, 0, nullptr},
+  {"matrix", cpuKernelMatrix, 2 * 12 * 12 * 12, "MMAC/s"},
+  {"state", cpuKernelState, 0, nullptr},
+  {"crc32", cpuKernelCrc32, 256, "MB/s"},
+};
+static const uint8_t CPU_KERNEL_COUNT = sizeof(CPU_KERNELS) / sizeof(CPU_KERNELS[0]);
+
+// ---- Measurement ----
+
+struct CpuKernelStats {
+  uint32_t medianCycles;
+  uint32_t p95Cycles;
+  uint32_t minCycles;
+  float cvPercent;  // standard deviation / mean of the timed passes
+  uint16_t samples;
+};
+
+// Sorts samples in place (insertion sort: a few dozen values)
+inline CpuKernelStats summarizeCycles(uint32_t* samples, uint16_t count) {
+  CpuKernelStats stats = {0, 0, 0, 0.0f, count};
+  if (count == 0) {
+    return stats;
+  }
+  for (uint16_t i = 1; i < count; ++i) {
+    const uint32_t value = samples[i];
+    uint16_t j = i;
+    for (; j > 0 && samples[j - 1] > value; --j) {
+      samples[j] = samples[j - 1];
+    }
+    samples[j] = value;
+  }
+  double sum = 0.0;
+  for (uint16_t i = 0; i < count; ++i) {
+    sum += samples[i];
+  }
+  const double mean = sum / count;
+  double squares = 0.0;
+  for (uint16_t i = 0; i < count; ++i) {
+    squares += (samples[i] - mean) * (samples[i] - mean);
+  }
+  stats.minCycles = samples[0];
+  stats.medianCycles = count % 2 == 1 ? samples[count / 2]
+                                      : static_cast<uint32_t>((static_cast<uint64_t>(samples[count / 2 - 1]) +
+                                                               samples[count / 2]) / 2);
+  stats.p95Cycles = samples[(count * 95 + 99) / 100 - 1];  // nearest rank
+  stats.cvPercent = count > 1 && mean > 0.0 ? static_cast<float>(sqrt(squares / (count - 1)) / mean * 100.0) : 0.0f;
+  return stats;
+}
+
+// cycles(): 32-bit cycle counter of the calling core. samples: room for iterations values.
+template <typename CycleCounter>
+CpuKernelStats measureCpuKernel(const CpuKernel& kernel, uint16_t warmup, uint16_t iterations, uint32_t* samples,
+                                CycleCounter cycles) {
+  static volatile uint32_t sink;
+  for (uint16_t i = 0; i < warmup; ++i) {
+    sink = sink + kernel.run(i);
+  }
+  for (uint16_t i = 0; i < iterations; ++i) {
+    const uint32_t start = cycles();
+    const uint32_t check = kernel.run(warmup + i);  // seed varies: no hoisting out of the loop
+    samples[i] = cycles() - start;
+    sink = sink + check;
+  }
+  return summarizeCycles(samples, iterations);
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+// Format-independent structured writer shared by the JSON and CBOR encoders.
+// Handlers describe a document once (objects, arrays, typed fields); each
+// encoder only implements the primitives below. Adding a field therefore adds
+// it to every encoding.
+
+#include <Arduino.h>
+#include <type_traits>
+
+class DataWriter {
+ public:
+  virtual ~DataWriter() {}
+
+  // ---- Containers ----
+  void beginObject() { writeItem(); writeOpen(true); }
+  void beginObject(const char* key) { writeKey(key); writeOpen(true); }
+  void endObject() { writeClose(true); }
+
+  void beginArray() { writeItem(); writeOpen(false); }
+  void beginArray(const char* key) { writeKey(key); writeOpen(false); }
+  void endArray() { writeClose(false); }
+
+  // ---- Object members ----
+  void field(const char* key, const char* value) { writeKey(key); value ? writeText(value, strlen(value)) : writeNull(); }
+  void field(const char* key, const String& value) { writeKey(key); writeText(value.c_str(), value.length()); }
+  void field(const char* key, const __FlashStringHelper* value) { writeKey(key); value ? writeFlashText(value) : writeNull(); }
+  void field(const char* key, bool value) { writeKey(key); writeBool(value); }
+
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type
+  field(const char* key, T value) {
+    writeKey(key);
+    writeInteger(value);
+  }
+
+  void fieldFloat(const char* key, double value, uint8_t decimals = 2) { writeKey(key); writeFloat(value, decimals); }
+  void fieldNull(const char* key) { writeKey(key); writeNull(); }
+
+  // ---- Array elements ----
+  void value(const char* v) { writeItem(); v ? writeText(v, strlen(v)) : writeNull(); }
+  void value(const String& v) { writeItem(); writeText(v.c_str(), v.length()); }
+  void value(bool v) { writeItem(); writeBool(v); }
+
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type
+  value(T v) {
+    writeItem();
+    writeInteger(v);
+  }
+
+  void valueFloat(double v, uint8_t decimals = 2) { writeItem(); writeFloat(v, decimals); }
+
+  // ---- Output control ----
+  virtual void flush() = 0;
+
+  // ---- Encoder primitives ----
+  // writeKey() precedes an object member value, writeItem() an array element
+  // (or the root value). decimals is the precision the value is meaningful to.
+  virtual void writeKey(const char* key) = 0;
+  virtual void writeItem() = 0;
+  virtual void writeOpen(bool object) = 0;
+  virtual void writeClose(bool object) = 0;
+  virtual void writeText(const char* text, size_t length) = 0;
+  virtual void writeFlashText(const __FlashStringHelper* text) = 0;
+  virtual void writeBool(bool value) = 0;
+  virtual void writeNull() = 0;
+  virtual void writeSigned(long long value) = 0;
+  virtual void writeUnsigned(unsigned long long value) = 0;
+  virtual void writeFloat(double value, uint8_t decimals) = 0;
+
+ private:
+  template <typename T>
+  typename std::enable_if<std::is_signed<T>::value>::type writeInteger(T v) {
+    writeSigned(static_cast<long long>(v));
+  }
+
+  template <typename T>
+  typename std::enable_if<!std::is_signed<T>::value>::type writeInteger(T v) {
+    writeUnsigned(static_cast<unsigned long long>(v));
+  }
+};
+
+// Fixed caller-owned buffer handed to a flush callback when full
+// (e.g. WebServer::sendContent). Shared by the concrete encoders.
+class WriterBuffer {
+ public:
+  typedef void (*FlushCallback)(const char* data, size_t length, void* context);
+
+  WriterBuffer(char* buffer, size_t capacity, FlushCallback flush, void* context)
+      : buffer_(buffer), capacity_(capacity), length_(0), flushed_(0), flush_(flush), context_(context) {}
+
+  // Bytes not yet handed to the flush callback
+  const char* pending() const { return buffer_; }
+  size_t pendingLength() const { return length_; }
+  // Total bytes produced so far (flushed + pending)
+  size_t bytesWritten() const { return flushed_ + length_; }
+  bool hasFlushed() const { return flushed_ > 0; }
+
+ protected:
+  void flushBuffer() {
+    if (length_ > 0 && flush_ != nullptr) {
+      flush_(buffer_, length_, context_);
+    }
+    flushed_ += length_;
+    length_ = 0;
+  }
+
+  void put(char c) {
+    if (length_ >= capacity_) {
+      flushBuffer();
+    }
+    buffer_[length_++] = c;
+  }
+
+  void putRaw(const char* data, size_t len) {
+    while (len > 0) {
+      if (length_ >= capacity_) {
+        flushBuffer();
+      }
+      size_t room = capacity_ - length_;
+      size_t chunk = len < room ? len : room;
+      memcpy(buffer_ + length_, data, chunk);
+      length_ += chunk;
+      data += chunk;
+      len -= chunk;
+    }
+  }
+
+ private:
+  char* buffer_;
+  size_t capacity_;
+  size_t length_;
+  size_t flushed_;
+  FlushCallback flush_;
+  void* context_;
+};
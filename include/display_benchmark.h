@@ -0,0 +1,275 @@
+#pragma once
+
+// Display rendering benchmark, run by the "display_bench" job.
+// TFT (Adafruit_SPITFT: ILI9341 or ST7789), once per driver, SPI clock and
+// rotation, each measure the median of `frames` samples timed with esp_timer:
+//   fill    fillScreen(), full screen of one color (Mpixel/s)
+//   push    a full frame sent with writePixels() from a strip buffer, as a
+//           frame-buffered dashboard would: bytes/s, fps, and the share of the
+//           raw SPI rate (clock / 8) actually reached
+//   rects   RECTS_PER_SAMPLE fillRect() of RECT_SIZE pixels at random places
+//   text    TEXT_LINES lines of TEXT_COLUMNS size-2 characters drawn opaque
+//           (foreground and background), the flicker-free way to refresh values
+// OLED (U8g2 full buffer over I2C), once per bus clock:
+//   render  clearBuffer() and drawing into the buffer (CPU only)
+//   send    sendBuffer(), the whole buffer over I2C
+// SPI writes are blind: a clock above what the panel accepts shows as garbage
+// on screen, not in the numbers. Only the driver matching the panel (`active`)
+// draws a meaningful picture.
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "cpu_benchmark.h"
+#include "data_writer.h"
+
+static const uint8_t DISPLAY_BENCH_MAX_FRAMES = 15;
+
+template <uint8_t MaxTftRuns, uint8_t MaxOledRuns>
+class DisplayBenchmark {
+ public:
+  static const uint16_t RECT_SIZE = 32;
+  static const uint8_t RECTS_PER_SAMPLE = 64;
+  static const uint8_t TEXT_LINES = 8;
+  static const uint8_t TEXT_COLUMNS = 20;
+
+  struct TftRun {
+    const char* driver;
+    bool active;  // driver of the attached panel
+    uint32_t spiHz;
+    uint8_t rotation;
+    uint16_t width;
+    uint16_t height;
+    uint32_t fillUs;  // medians per sample
+    uint32_t pushUs;
+    uint32_t rectsUs;
+    uint32_t textUs;
+  };
+
+  struct OledRun {
+    uint32_t i2cHz;
+    uint16_t bufferBytes;
+    uint32_t renderUs;
+    uint32_t sendUs;
+  };
+
+  DisplayBenchmark(uint8_t frames, uint8_t targetFps)
+      : frames_(frames == 0 ? 1 : (frames > DISPLAY_BENCH_MAX_FRAMES ? DISPLAY_BENCH_MAX_FRAMES : frames)),
+        targetFps_(targetFps), startMs_(0), durationMs_(0), tftCount_(0), oledCount_(0), valid_(false) {}
+
+  // Forgets the previous results
+  void begin() {
+    tftCount_ = 0;
+    oledCount_ = 0;
+    durationMs_ = 0;
+    startMs_ = millis();
+    valid_ = false;
+  }
+
+  // panel: initialized, SPI clock already set. strip: stripPixels pixels, at
+  // least one line of the widest side. false when stopped or out of slots.
+  template <typename Panel>
+  bool runTft(Panel& panel, const char* driver, bool active, uint32_t spiHz, uint8_t rotation, uint16_t* strip,
+              uint32_t stripPixels, bool (*stopping)()) {
+    if (tftCount_ >= MaxTftRuns) {
+      return false;
+    }
+    panel.setRotation(rotation);
+    TftRun& run = tftRuns_[tftCount_++];
+    run.driver = driver;
+    run.active = active;
+    run.spiHz = spiHz;
+    run.rotation = rotation;
+    run.width = panel.width();
+    run.height = panel.height();
+    run.fillUs = run.pushUs = run.rectsUs = run.textUs = 0;
+    uint32_t samples[DISPLAY_BENCH_MAX_FRAMES];
+
+    for (uint8_t i = 0; i < frames_; ++i) {
+      const int64_t start = esp_timer_get_time();
+      panel.fillScreen((i & 1) != 0 ? 0xFFFF : 0x001F);
+      samples[i] = elapsedSince(start);
+    }
+    run.fillUs = summarizeCycles(samples, frames_).medianCycles;
+    if (stopping()) {
+      return false;
+    }
+
+    const uint32_t rows = stripPixels / run.width;
+    for (uint8_t i = 0; i < frames_ && rows > 0; ++i) {
+      for (uint32_t p = 0; p < rows * run.width; ++p) {
+        strip[p] = static_cast<uint16_t>(p * 37 + i * 2011);
+      }
+      const int64_t start = esp_timer_get_time();
+      panel.startWrite();
+      panel.setAddrWindow(0, 0, run.width, run.height);
+      for (uint32_t y = 0; y < run.height; y += rows) {
+        const uint32_t count = (run.height - y < rows ? run.height - y : rows) * run.width;
+        panel.writePixels(strip, count, true);
+      }
+      panel.endWrite();
+      samples[i] = elapsedSince(start);
+    }
+    run.pushUs = rows > 0 ? summarizeCycles(samples, frames_).medianCycles : 0;
+    if (stopping()) {
+      return false;
+    }
+
+    uint32_t x = 0x2545F491u ^ spiHz ^ rotation;
+    for (uint8_t i = 0; i < frames_; ++i) {
+      const int64_t start = esp_timer_get_time();
+      for (uint8_t r = 0; r < RECTS_PER_SAMPLE; ++r) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        panel.fillRect(x % (run.width - RECT_SIZE), (x >> 16) % (run.height - RECT_SIZE), RECT_SIZE, RECT_SIZE,
+                       static_cast<uint16_t>(x));
+      }
+      samples[i] = elapsedSince(start);
+    }
+    run.rectsUs = summarizeCycles(samples, frames_).medianCycles;
+    if (stopping()) {
+      return false;
+    }
+
+    static const char TEXT[TEXT_COLUMNS + 1] = "T=23.4C H=51% 1013hP";
+    panel.setTextWrap(false);
+    panel.setTextSize(2);
+    for (uint8_t i = 0; i < frames_; ++i) {
+      panel.setTextColor((i & 1) != 0 ? 0x07E0 : 0xFFFF, 0x0000);
+      const int64_t start = esp_timer_get_time();
+      for (uint8_t line = 0; line < TEXT_LINES; ++line) {
+        panel.setCursor(0, line * 16);
+        panel.print(TEXT);
+      }
+      samples[i] = elapsedSince(start);
+    }
+    run.textUs = summarizeCycles(samples, frames_).medianCycles;
+    panel.fillScreen(0x0000);
+    return !stopping();
+  }
+
+  // oled: U8g2 with a full buffer, already begun; font: a 6x10 U8g2 font.
+  // Sets the bus clock itself, the caller restores its own afterwards.
+  template <typename Oled>
+  bool runOled(Oled& oled, const uint8_t* font, uint32_t i2cHz) {
+    if (oledCount_ >= MaxOledRuns) {
+      return false;
+    }
+    OledRun& run = oledRuns_[oledCount_++];
+    run.i2cHz = i2cHz;
+    run.bufferBytes = static_cast<uint16_t>(oled.getBufferTileWidth() * oled.getBufferTileHeight() * 8);
+    oled.setBusClock(i2cHz);
+    uint32_t render[DISPLAY_BENCH_MAX_FRAMES];
+    uint32_t send[DISPLAY_BENCH_MAX_FRAMES];
+    for (uint8_t i = 0; i < frames_; ++i) {
+      int64_t start = esp_timer_get_time();
+      oled.clearBuffer();
+      oled.drawFrame(0, 0, oled.getDisplayWidth(), oled.getDisplayHeight());
+      oled.drawBox(2, 2, (i * 13) % (oled.getDisplayWidth() - 4) + 1, 8);
+      oled.setFont(font);
+      oled.drawStr(4, 26, "T=23.4C H=51%");
+      oled.drawStr(4, 40, "P=1013.2 hPa");
+      oled.drawStr(4, 54, i & 1 ? "RSSI -61 dBm" : "RSSI -62 dBm");
+      render[i] = elapsedSince(start);
+      start = esp_timer_get_time();
+      oled.sendBuffer();
+      send[i] = elapsedSince(start);
+    }
+    run.renderUs = summarizeCycles(render, frames_).medianCycles;
+    run.sendUs = summarizeCycles(send, frames_).medianCycles;
+    oled.clearBuffer();
+    oled.sendBuffer();
+    return true;
+  }
+
+  void finish() {
+    durationMs_ = millis() - startMs_;
+    valid_ = true;
+  }
+
+  bool valid() const { return valid_; }
+  uint8_t tftCount() const { return tftCount_; }
+  uint8_t oledCount() const { return oledCount_; }
+  const TftRun& tftRun(uint8_t index) const { return tftRuns_[index < MaxTftRuns ? index : 0]; }
+
+  static float fps(uint32_t frameUs) { return frameUs > 0 ? 1e6f / frameUs : 0.0f; }
+
+  // Fastest full-frame push of the attached panel (nullptr: none measured)
+  const TftRun* bestTft() const {
+    const TftRun* best = nullptr;
+    for (uint8_t i = 0; i < tftCount_; ++i) {
+      const TftRun& run = tftRuns_[i];
+      if (run.active && run.pushUs > 0 && (best == nullptr || run.pushUs < best->pushUs)) {
+        best = &run;
+      }
+    }
+    return best;
+  }
+
+  void writeJson(DataWriter& out) const {
+    out.field("frames", frames_);
+    out.field("target_fps", targetFps_);
+    out.field("duration_ms", durationMs_);
+    out.beginArray("tft");
+    for (uint8_t i = 0; i < tftCount_; ++i) {
+      const TftRun& run = tftRuns_[i];
+      const float pixels = static_cast<float>(run.width) * run.height;
+      out.beginObject();
+      out.field("driver", run.driver);
+      out.field("active", run.active);
+      out.field("spi_khz", run.spiHz / 1000);
+      out.field("rotation", run.rotation);
+      out.field("width", run.width);
+      out.field("height", run.height);
+      out.field("fill_us", run.fillUs);
+      out.fieldFloat("fill_mpixels_per_s", run.fillUs > 0 ? pixels / run.fillUs : 0.0f, 3);
+      out.field("push_us", run.pushUs);
+      out.fieldFloat("push_bytes_per_s", run.pushUs > 0 ? pixels * 2 * 1e6f / run.pushUs : 0.0f, 0);
+      out.fieldFloat("bus_efficiency_percent",
+                     run.pushUs > 0 && run.spiHz > 0 ? pixels * 2 * 8 * 100 / (run.spiHz / 1e6f) / run.pushUs : 0.0f,
+                     1);
+      out.fieldFloat("fps", fps(run.pushUs), 1);
+      out.fieldFloat("rects_per_s", run.rectsUs > 0 ? RECTS_PER_SAMPLE * 1e6f / run.rectsUs : 0.0f, 0);
+      out.fieldFloat("chars_per_s", run.textUs > 0 ? TEXT_LINES * TEXT_COLUMNS * 1e6f / run.textUs : 0.0f, 0);
+      out.field("dashboard", fps(run.pushUs) >= targetFps_);
+      out.endObject();
+    }
+    out.endArray();
+    const TftRun* best = bestTft();
+    if (best != nullptr) {
+      out.beginObject("tft_best");
+      out.field("driver", best->driver);
+      out.field("spi_khz", best->spiHz / 1000);
+      out.field("rotation", best->rotation);
+      out.fieldFloat("fps", fps(best->pushUs), 1);
+      out.endObject();
+    }
+    out.beginArray("oled");
+    for (uint8_t i = 0; i < oledCount_; ++i) {
+      const OledRun& run = oledRuns_[i];
+      out.beginObject();
+      out.field("i2c_khz", run.i2cHz / 1000);
+      out.field("buffer_bytes", run.bufferBytes);
+      out.field("render_us", run.renderUs);
+      out.field("send_us", run.sendUs);
+      out.fieldFloat("send_bytes_per_s", run.sendUs > 0 ? run.bufferBytes * 1e6f / run.sendUs : 0.0f, 0);
+      out.fieldFloat("fps", fps(run.renderUs + run.sendUs), 1);
+      out.field("dashboard", fps(run.renderUs + run.sendUs) >= targetFps_);
+      out.endObject();
+    }
+    out.endArray();
+  }
+
+ private:
+  static uint32_t elapsedSince(int64_t start) { return static_cast<uint32_t>(esp_timer_get_time() - start); }
+
+  uint8_t frames_;
+  uint8_t targetFps_;
+  unsigned long startMs_;
+  unsigned long durationMs_;
+  uint8_t tftCount_;
+  uint8_t oledCount_;
+  bool valid_;
+  TftRun tftRuns_[MaxTftRuns];
+  OledRun oledRuns_[MaxOledRuns];
+};
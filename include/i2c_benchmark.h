@@ -0,0 +1,357 @@
+#pragma once
+
+// I2C bus benchmark, run once per SCL clock by the "i2c_bench" job.
+// The bus is scanned at the slowest clock; each device found is then
+// identified (AHT20 at 0x38, BMP280/BME280 by its chip id, the OLED at its
+// configured address) and exercised with `ops` transactions of two kinds:
+//   register   one register read: AHT20 status byte, BMP280 chip id, one
+//              SSD1306 NOP command; address probe only for unknown devices
+//   burst      one multi-byte transfer: AHT20 7-byte frame, the 24 bytes of
+//              BMP280 calibration, 16 SSD1306 NOP commands (nothing for
+//              unknown devices: a read could pop a FIFO)
+// Every transaction is timed with esp_timer. NACKs (address or data), other
+// errors (bus error, timeout, short read) and data mismatches (chip id, or
+// calibration bytes different from the first read) are counted per device,
+// clock and kind.
+// The Wire API does not expose SCL, so clock stretching is inferred: the
+// difference between the fastest burst and the fastest register transaction
+// is 9 SCL periods per extra byte, free of the driver overhead they share.
+// An effective clock below STRETCH_RATIO of the nominal one means the device
+// holds SCL low (or the pull-ups are too weak for the rising edges).
+// A clock is reliable when every device completed all its transactions
+// without NACK, error or mismatch; the recommendation is the fastest one.
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <esp_timer.h>
+#include "data_writer.h"
+
+static const uint8_t I2C_BENCH_AHT20_ADDRESS = 0x38;
+static const uint8_t I2C_BENCH_BMP280_ADDRESSES[] = {0x76, 0x77};
+static const uint8_t I2C_BENCH_BMP280_REG_ID = 0xD0;
+static const uint8_t I2C_BENCH_BMP280_REG_CALIB = 0x88;
+
+enum I2cDeviceKind : uint8_t { I2C_DEVICE_GENERIC, I2C_DEVICE_AHT20, I2C_DEVICE_BMP280, I2C_DEVICE_SSD1306 };
+
+template <uint8_t MaxDevices, uint8_t MaxClocks>
+class I2cBenchmark {
+ public:
+  static const uint8_t BURST_BYTES = 24;  // largest burst (BMP280 calibration), fits the 32-byte FIFO
+  static const uint8_t OLED_BURST_COMMANDS = 16;
+  static constexpr float STRETCH_RATIO = 0.8f;
+
+  enum Kind : uint8_t { OP_REGISTER, OP_BURST, OP_KINDS };
+
+  struct OpStats {
+    uint16_t ops;
+    uint16_t nacks;       // address or data not acknowledged
+    uint16_t errors;      // bus error, timeout, short read
+    uint16_t mismatches;  // unexpected data
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t totalUs;
+  };
+
+  struct Device {
+    uint8_t address;
+    I2cDeviceKind kind;
+    bool hasReference;
+    uint8_t reference[BURST_BYTES];  // first BMP280 calibration read
+    OpStats stats[MaxClocks][OP_KINDS];
+  };
+
+  struct ClockResult {
+    uint32_t hz;
+    uint32_t actualHz;  // Wire.getClock() once set
+    bool complete;
+  };
+
+  explicit I2cBenchmark(uint16_t ops)
+      : ops_(ops), startMs_(0), durationMs_(0), deviceCount_(0), clockCount_(0), valid_(false) {}
+
+  // Scans the bus at its current clock and identifies the devices; forgets the previous results
+  uint8_t discover(TwoWire& wire, uint8_t oledAddress) {
+    deviceCount_ = 0;
+    clockCount_ = 0;
+    durationMs_ = 0;
+    startMs_ = millis();
+    valid_ = false;
+    for (uint8_t address = 1; address < 127 && deviceCount_ < MaxDevices; ++address) {
+      wire.beginTransmission(address);
+      if (wire.endTransmission() != 0) {
+        continue;
+      }
+      Device& device = devices_[deviceCount_++];
+      memset(&device, 0, sizeof(device));
+      device.address = address;
+      device.kind = identify(wire, address, oledAddress);
+    }
+    return deviceCount_;
+  }
+
+  // Bus already set to hz. false when stopped.
+  bool runClock(TwoWire& wire, uint32_t hz, bool (*stopping)()) {
+    if (clockCount_ >= MaxClocks) {
+      return false;
+    }
+    const uint8_t index = clockCount_++;
+    ClockResult& clock = clocks_[index];
+    clock.hz = hz;
+    clock.actualHz = wire.getClock();
+    clock.complete = false;
+    for (uint8_t i = 0; i < deviceCount_; ++i) {
+      Device& device = devices_[i];
+      for (uint8_t kind = 0; kind < OP_KINDS; ++kind) {
+        OpStats& stats = device.stats[index][kind];
+        memset(&stats, 0, sizeof(stats));
+        if (kind == OP_BURST && device.kind == I2C_DEVICE_GENERIC) {
+          continue;
+        }
+        for (uint16_t op = 0; op < ops_; ++op) {
+          if ((op & 15) == 0 && stopping()) {
+            return false;
+          }
+          transaction(wire, device, static_cast<Kind>(kind), stats);
+        }
+      }
+    }
+    clock.complete = true;
+    return true;
+  }
+
+  void finish() {
+    durationMs_ = millis() - startMs_;
+    valid_ = true;
+  }
+
+  bool valid() const { return valid_; }
+  uint8_t deviceCount() const { return deviceCount_; }
+  uint8_t clockCount() const { return clockCount_; }
+
+  bool reliable(uint8_t clock) const {
+    if (clock >= clockCount_ || !clocks_[clock].complete) {
+      return false;
+    }
+    for (uint8_t i = 0; i < deviceCount_; ++i) {
+      for (uint8_t kind = 0; kind < OP_KINDS; ++kind) {
+        const OpStats& stats = devices_[i].stats[clock][kind];
+        if (stats.nacks + stats.errors + stats.mismatches > 0) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  // Fastest reliable clock in Hz, 0 without device or reliable clock
+  uint32_t recommendedHz() const {
+    uint32_t best = 0;
+    for (uint8_t clock = 0; deviceCount_ > 0 && clock < clockCount_; ++clock) {
+      if (reliable(clock) && clocks_[clock].hz > best) {
+        best = clocks_[clock].hz;
+      }
+    }
+    return best;
+  }
+
+  // SCL clock seen by the payload of one device, in Hz (0: no burst or not measurable)
+  float effectiveHz(uint8_t device, uint8_t clock) const {
+    const Device& info = devices_[device];
+    const OpStats& reg = info.stats[clock][OP_REGISTER];
+    const OpStats& burst = info.stats[clock][OP_BURST];
+    const uint8_t extraBytes = wireBytes(info.kind, OP_BURST) - wireBytes(info.kind, OP_REGISTER);
+    if (info.kind == I2C_DEVICE_GENERIC || reg.ops == 0 || burst.ops == 0 || burst.minUs <= reg.minUs) {
+      return 0.0f;
+    }
+    return 9.0f * extraBytes * 1e6f / (burst.minUs - reg.minUs);
+  }
+
+  bool stretching(uint8_t device, uint8_t clock) const {
+    const float effective = effectiveHz(device, clock);
+    return effective > 0 && effective < STRETCH_RATIO * clocks_[clock].hz;
+  }
+
+  void writeJson(DataWriter& out, uint32_t currentHz) const {
+    static const char* const KIND_NAMES[] = {"generic", "aht20", "bmp280", "ssd1306"};
+    out.field("ops", ops_);
+    out.field("duration_ms", durationMs_);
+    out.field("current_khz", currentHz / 1000);
+    out.field("recommended_khz", recommendedHz() / 1000);
+    out.beginArray("clocks");
+    for (uint8_t clock = 0; clock < clockCount_; ++clock) {
+      out.beginObject();
+      out.field("khz", clocks_[clock].hz / 1000);
+      out.field("actual_khz", clocks_[clock].actualHz / 1000);
+      out.field("complete", clocks_[clock].complete);
+      out.field("reliable", reliable(clock));
+      out.endObject();
+    }
+    out.endArray();
+    out.beginArray("devices");
+    for (uint8_t i = 0; i < deviceCount_; ++i) {
+      const Device& device = devices_[i];
+      char address[6];
+      snprintf(address, sizeof(address), "0x%02X", device.address);
+      out.beginObject();
+      out.field("address", address);
+      out.field("kind", KIND_NAMES[device.kind]);
+      out.beginArray("clocks");
+      for (uint8_t clock = 0; clock < clockCount_; ++clock) {
+        out.beginObject();
+        out.field("khz", clocks_[clock].hz / 1000);
+        writeStats(out, "register", device, clock, OP_REGISTER);
+        if (device.kind != I2C_DEVICE_GENERIC) {
+          writeStats(out, "burst", device, clock, OP_BURST);
+          out.fieldFloat("effective_khz", effectiveHz(i, clock) / 1000.0f, 1);
+          out.field("stretching", stretching(i, clock));
+        }
+        out.endObject();
+      }
+      out.endArray();
+      out.endObject();
+    }
+    out.endArray();
+  }
+
+ private:
+  // Bytes on the wire per transaction, address bytes included
+  static uint8_t wireBytes(I2cDeviceKind kind, Kind op) {
+    static const uint8_t BYTES[][OP_KINDS] = {{1, 0}, {2, 8}, {4, 3 + BURST_BYTES}, {3, 2 + OLED_BURST_COMMANDS}};
+    return BYTES[kind][op];
+  }
+
+  // Useful bytes per transaction (throughput)
+  static uint8_t payloadBytes(I2cDeviceKind kind, Kind op) {
+    static const uint8_t BYTES[][OP_KINDS] = {{0, 0}, {1, 7}, {1, BURST_BYTES}, {1, OLED_BURST_COMMANDS}};
+    return BYTES[kind][op];
+  }
+
+  static bool bmp280Id(uint8_t id) { return id == 0x56 || id == 0x57 || id == 0x58 || id == 0x60; }
+
+  static I2cDeviceKind identify(TwoWire& wire, uint8_t address, uint8_t oledAddress) {
+    if (address == oledAddress) {
+      return I2C_DEVICE_SSD1306;
+    }
+    if (address == I2C_BENCH_AHT20_ADDRESS) {
+      return I2C_DEVICE_AHT20;
+    }
+    for (uint8_t candidate : I2C_BENCH_BMP280_ADDRESSES) {
+      if (address != candidate) {
+        continue;
+      }
+      uint8_t id = 0;
+      if (readRegisters(wire, address, I2C_BENCH_BMP280_REG_ID, &id, 1) == 0 && bmp280Id(id)) {
+        return I2C_DEVICE_BMP280;
+      }
+    }
+    return I2C_DEVICE_GENERIC;
+  }
+
+  // 0, an endTransmission() code, or 4 on a short read
+  static uint8_t readRegisters(TwoWire& wire, uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+    wire.beginTransmission(address);
+    wire.write(reg);
+    const uint8_t status = wire.endTransmission(false);
+    if (status != 0) {
+      return status;
+    }
+    return readBytes(wire, address, data, length);
+  }
+
+  static uint8_t readBytes(TwoWire& wire, uint8_t address, uint8_t* data, uint8_t length) {
+    if (wire.requestFrom(address, length) != length) {
+      return 4;
+    }
+    for (uint8_t i = 0; i < length; ++i) {
+      data[i] = static_cast<uint8_t>(wire.read());
+    }
+    return 0;
+  }
+
+  static uint8_t writeCommands(TwoWire& wire, uint8_t address, uint8_t count) {
+    wire.beginTransmission(address);
+    wire.write(static_cast<uint8_t>(0x00));  // control byte: command stream
+    for (uint8_t i = 0; i < count; ++i) {
+      wire.write(static_cast<uint8_t>(0xE3));  // NOP
+    }
+    return wire.endTransmission();
+  }
+
+  void transaction(TwoWire& wire, Device& device, Kind kind, OpStats& stats) {
+    uint8_t data[BURST_BYTES];
+    uint8_t status = 0;
+    bool match = true;
+    const int64_t start = esp_timer_get_time();
+    switch (device.kind) {
+      case I2C_DEVICE_AHT20:
+        status = readBytes(wire, device.address, data, kind == OP_REGISTER ? 1 : 7);
+        break;
+      case I2C_DEVICE_BMP280:
+        if (kind == OP_REGISTER) {
+          status = readRegisters(wire, device.address, I2C_BENCH_BMP280_REG_ID, data, 1);
+          match = bmp280Id(data[0]);
+        } else {
+          status = readRegisters(wire, device.address, I2C_BENCH_BMP280_REG_CALIB, data, BURST_BYTES);
+          match = !device.hasReference || memcmp(data, device.reference, BURST_BYTES) == 0;
+        }
+        break;
+      case I2C_DEVICE_SSD1306:
+        status = writeCommands(wire, device.address, kind == OP_REGISTER ? 1 : OLED_BURST_COMMANDS);
+        break;
+      default:
+        wire.beginTransmission(device.address);
+        status = wire.endTransmission();
+        break;
+    }
+    const uint32_t elapsed = static_cast<uint32_t>(esp_timer_get_time() - start);
+
+    ++stats.ops;
+    if (status == 2 || status == 3) {
+      ++stats.nacks;
+      return;
+    }
+    if (status != 0) {
+      ++stats.errors;
+      return;
+    }
+    if (!match) {
+      ++stats.mismatches;
+    } else if (device.kind == I2C_DEVICE_BMP280 && kind == OP_BURST && !device.hasReference) {
+      memcpy(device.reference, data, BURST_BYTES);
+      device.hasReference = true;
+    }
+    // Only successful transactions are timed: a NACK ends early
+    stats.minUs = stats.totalUs == 0 || elapsed < stats.minUs ? elapsed : stats.minUs;
+    stats.maxUs = elapsed > stats.maxUs ? elapsed : stats.maxUs;
+    stats.totalUs += elapsed > 0 ? elapsed : 1;
+  }
+
+  void writeStats(DataWriter& out, const char* name, const Device& device, uint8_t clock, Kind kind) const {
+    const OpStats& stats = device.stats[clock][kind];
+    const uint16_t failed = stats.nacks + stats.errors + stats.mismatches;
+    const uint16_t timed = stats.ops - stats.nacks - stats.errors;
+    out.beginObject(name);
+    out.field("ops", stats.ops);
+    out.field("nacks", stats.nacks);
+    out.field("errors", stats.errors);
+    out.field("mismatches", stats.mismatches);
+    out.fieldFloat("error_rate_percent", stats.ops > 0 ? 100.0f * failed / stats.ops : 0.0f, 2);
+    out.field("min_us", stats.minUs);
+    out.fieldFloat("avg_us", timed > 0 ? static_cast<float>(stats.totalUs) / timed : 0.0f, 1);
+    out.field("max_us", stats.maxUs);
+    if (payloadBytes(device.kind, kind) > 1 && stats.totalUs > 0) {
+      out.fieldFloat("bytes_per_s", static_cast<float>(payloadBytes(device.kind, kind) * 1e6 * timed / stats.totalUs),
+                     0);
+    }
+    out.endObject();
+  }
+
+  uint16_t ops_;
+  unsigned long startMs_;
+  unsigned long durationMs_;
+  uint8_t deviceCount_;
+  uint8_t clockCount_;
+  bool valid_;
+  Device devices_[MaxDevices];
+  ClockResult clocks_[MaxClocks];
+};
@@ -0,0 +1,328 @@
+#pragma once
+
+// Responsiveness monitor: when is the device starving?
+// Every loop() pass, every unit of work inside it and every FreeRTOS tick is
+// timestamped with esp_timer and counted in a log2 histogram (bucket i holds
+// [2^i, 2^(i+1)) us, bucket 0 also holds 0):
+//   loop period   interval between two loop() wakes
+//   handler       duration of each phase of a pass (HTTP requests, streams,
+//                 buttons, ...), so a handler that blocks shows up here
+//   ISR latency   delay between a signal (interrupt, timer, other task) and
+//                 the loop() wake that serves it
+//   tick          interval between two tick interrupts of each core; a late
+//                 tick means interrupts were masked on that core
+// A pass longer than stallMs ("busy": a handler held the loop), or a signal
+// served more than stallMs late while the previous pass was short ("starved":
+// other tasks kept loop() off its core), is logged with the slowest phase, the
+// request URI when it was an HTTP request, and the jobs running at that time.
+// Recording is a few integer operations; nothing allocates.
+
+#include <Arduino.h>
+#include <esp_freertos_hooks.h>
+#include <esp_timer.h>
+#include "data_writer.h"
+
+class LogHistogram {
+ public:
+  static const uint8_t BUCKETS = 24;  // the last one holds everything from 2^23 us (8.4 s)
+
+  LogHistogram() { reset(); }
+
+  void reset() {
+    memset(const_cast<uint32_t*>(buckets_), 0, sizeof(buckets_));
+    count_ = 0;
+    sumUs_ = 0;
+    maxUs_ = 0;
+  }
+
+  void IRAM_ATTR record(uint32_t us) {
+    const uint8_t bucket = us < 2 ? 0 : static_cast<uint8_t>(31 - __builtin_clz(us));
+    ++buckets_[bucket < BUCKETS ? bucket : BUCKETS - 1];
+    ++count_;
+    sumUs_ += us;
+    maxUs_ = us > maxUs_ ? us : maxUs_;
+  }
+
+  uint32_t count() const { return count_; }
+  uint32_t maxUs() const { return maxUs_; }
+  uint32_t meanUs() const { return count_ > 0 ? static_cast<uint32_t>(sumUs_ / count_) : 0; }
+
+  // Upper bound of the bucket holding the given fraction of the samples (capped at the max)
+  uint32_t percentileUs(uint16_t perMille) const {
+    const uint32_t rank = (static_cast<uint64_t>(count_) * perMille + 999) / 1000;
+    uint32_t seen = 0;
+    for (uint8_t bucket = 0; bucket < BUCKETS && rank > 0; ++bucket) {
+      seen += buckets_[bucket];
+      if (seen >= rank) {
+        const uint32_t bound = (2UL << bucket) - 1;
+        return bucket + 1 < BUCKETS && bound < maxUs_ ? bound : maxUs_;
+      }
+    }
+    return maxUs_;
+  }
+
+  // {"count","mean","p50","p99","max","log2_buckets":[...]} up to the last non-empty bucket
+  void writeJson(DataWriter& out) const {
+    out.field("count", count_);
+    out.field("mean", meanUs());
+    out.field("p50", percentileUs(500));
+    out.field("p99", percentileUs(990));
+    out.field("max", maxUs_);
+    uint8_t used = BUCKETS;
+    while (used > 0 && buckets_[used - 1] == 0) {
+      --used;
+    }
+    out.beginArray("log2_buckets");
+    for (uint8_t bucket = 0; bucket < used; ++bucket) {
+      out.value(buckets_[bucket]);
+    }
+    out.endArray();
+  }
+
+ private:
+  volatile uint32_t buckets_[BUCKETS];
+  uint32_t count_;
+  uint64_t sumUs_;
+  uint32_t maxUs_;
+};
+
+template <uint8_t MaxStalls>
+class JitterMonitor {
+ public:
+  static const uint8_t MAX_CORES = 2;
+  static const uint8_t ACTIVITY_LENGTH = 40;
+  static const uint8_t JOBS_LENGTH = 48;
+
+  struct Stall {
+    uint32_t uptimeMs;  // end of the stall
+    uint32_t durationUs;
+    bool starved;       // loop() waiting for its core, not running a handler
+    char activity[ACTIVITY_LENGTH];
+    char jobs[JOBS_LENGTH];
+  };
+
+  // Writes the running jobs ("gps,rotary") into out
+  typedef void (*JobsDescriber)(char* out, size_t size);
+
+  explicit JitterMonitor(uint32_t stallMs)
+      : stallUs_(stallMs * 1000),
+        describeJobs_(nullptr),
+        cores_(0),
+        phaseStartUs_(0),
+        phase_(nullptr),
+        passUs_(0),
+        slowestUs_(0),
+        slowestRequestUs_(0) {
+    slowest_[0] = '\0';
+    request_[0] = '\0';
+    memset(lastTickUs_, 0, sizeof(lastTickUs_));
+    memset(const_cast<uint32_t*>(lateTicks_), 0, sizeof(lateTicks_));
+    reset();
+  }
+
+  void setJobsDescriber(JobsDescriber describe) { describeJobs_ = describe; }
+
+  // One tick hook per core. Single instance (the hooks are plain functions).
+  bool beginTicks() {
+    if (instance_ != nullptr) {
+      return false;
+    }
+    instance_ = this;
+    cores_ = portNUM_PROCESSORS < MAX_CORES ? portNUM_PROCESSORS : MAX_CORES;
+    for (uint8_t core = 0; core < cores_; ++core) {
+      if (esp_register_freertos_tick_hook_for_cpu(core == 0 ? tick0 : tick1, core) != ESP_OK) {
+        cores_ = core;
+        break;
+      }
+    }
+    return cores_ > 0;
+  }
+
+  // loop() woke up (wakeUs from esp_timer_get_time())
+  void beginPass(int64_t wakeUs) {
+    if (lastWakeUs_ != 0) {
+      loopPeriod_.record(static_cast<uint32_t>(wakeUs - lastWakeUs_));
+    }
+    lastWakeUs_ = wakeUs;
+    phaseStartUs_ = wakeUs;
+    phase_ = nullptr;
+    slowestUs_ = 0;
+    slowest_[0] = '\0';
+  }
+
+  // Start of a named unit of work inside the pass; ends the previous one
+  void phase(const char* name) {
+    const int64_t now = esp_timer_get_time();
+    closePhase(now);
+    phase_ = name;
+    phaseStartUs_ = now;
+    slowestRequestUs_ = 0;
+    request_[0] = '\0';
+  }
+
+  // HTTP request served during the current phase: the slowest one names it
+  void request(const char* uri, uint32_t elapsedUs) {
+    if (elapsedUs >= slowestRequestUs_) {
+      slowestRequestUs_ = elapsedUs;
+      strlcpy(request_, uri, sizeof(request_));
+    }
+  }
+
+  // Signal served by this pass (source: its name)
+  void latency(const char* source, uint32_t latencyUs) {
+    isrLatency_.record(latencyUs);
+    if (latencyUs > stallUs_ && passUs_ <= stallUs_) {
+      record(latencyUs, true, source);
+    }
+  }
+
+  // End of the pass; returns true when it was logged as a stall
+  bool endPass() {
+    const int64_t now = esp_timer_get_time();
+    closePhase(now);
+    passUs_ = static_cast<uint32_t>(now - lastWakeUs_);
+    if (passUs_ <= stallUs_) {
+      return false;
+    }
+    record(passUs_, false, slowest_);
+    return true;
+  }
+
+  void reset() {
+    startUs_ = esp_timer_get_time();
+    lastWakeUs_ = 0;
+    loopPeriod_.reset();
+    handler_.reset();
+    isrLatency_.reset();
+    for (uint8_t core = 0; core < MAX_CORES; ++core) {
+      ticks_[core].reset();
+      lateTicks_[core] = 0;
+    }
+    stallCount_ = 0;
+    memset(stalls_, 0, sizeof(stalls_));
+  }
+
+  uint32_t stallCount() const { return stallCount_; }
+  uint32_t stallMs() const { return stallUs_ / 1000; }
+  const LogHistogram& loopPeriod() const { return loopPeriod_; }
+  const LogHistogram& handler() const { return handler_; }
+  const LogHistogram& isrLatency() const { return isrLatency_; }
+  const LogHistogram& ticks(uint8_t core) const { return ticks_[core < MAX_CORES ? core : 0]; }
+  uint32_t lateTicks(uint8_t core) const { return lateTicks_[core < MAX_CORES ? core : 0]; }
+  uint8_t cores() const { return cores_; }
+
+  // Most recent stall, nullptr if none
+  const Stall* lastStall() const {
+    return stallCount_ > 0 ? &stalls_[(stallCount_ - 1) % MaxStalls] : nullptr;
+  }
+
+  void writeJson(DataWriter& out) const {
+    out.field("stall_threshold_ms", stallMs());
+    out.field("window_ms", static_cast<uint32_t>((esp_timer_get_time() - startUs_) / 1000));
+    out.beginObject("loop_period_us");
+    loopPeriod_.writeJson(out);
+    out.endObject();
+    out.beginObject("handler_us");
+    handler_.writeJson(out);
+    out.endObject();
+    out.beginObject("isr_latency_us");
+    isrLatency_.writeJson(out);
+    out.endObject();
+    out.beginArray("tick_us");
+    for (uint8_t core = 0; core < cores_; ++core) {
+      out.beginObject();
+      out.field("core", core);
+      out.field("late", lateTicks_[core]);
+      ticks_[core].writeJson(out);
+      out.endObject();
+    }
+    out.endArray();
+    out.field("stalls_total", stallCount_);
+    out.beginArray("stalls");  // most recent first
+    const uint32_t kept = stallCount_ < MaxStalls ? stallCount_ : MaxStalls;
+    for (uint32_t i = 0; i < kept; ++i) {
+      const Stall& stall = stalls_[(stallCount_ - 1 - i) % MaxStalls];
+      out.beginObject();
+      out.field("uptime_ms", stall.uptimeMs);
+      out.field("duration_ms", stall.durationUs / 1000);
+      out.field("kind", stall.starved ? "starved" : "busy");
+      out.field("activity", stall.activity);
+      out.field("jobs", stall.jobs);
+      out.endObject();
+    }
+    out.endArray();
+  }
+
+ private:
+  static void IRAM_ATTR tick0() { instance_->tick(0); }
+  static void IRAM_ATTR tick1() { instance_->tick(1); }
+
+  void IRAM_ATTR tick(uint8_t core) {
+    const int64_t now = esp_timer_get_time();
+    if (lastTickUs_[core] != 0) {
+      const uint32_t interval = static_cast<uint32_t>(now - lastTickUs_[core]);
+      ticks_[core].record(interval);
+      if (interval > 2 * portTICK_PERIOD_MS * 1000) {
+        ++lateTicks_[core];  // at least one tick was missed
+      }
+    }
+    lastTickUs_[core] = now;
+  }
+
+  void closePhase(int64_t now) {
+    if (phase_ == nullptr) {
+      return;
+    }
+    const uint32_t elapsed = static_cast<uint32_t>(now - phaseStartUs_);
+    handler_.record(elapsed);
+    if (elapsed >= slowestUs_) {
+      slowestUs_ = elapsed;
+      if (request_[0] != '\0') {
+        snprintf(slowest_, sizeof(slowest_), "%s %s", phase_, request_);
+      } else {
+        strlcpy(slowest_, phase_, sizeof(slowest_));
+      }
+    }
+    phase_ = nullptr;
+  }
+
+  void record(uint32_t durationUs, bool starved, const char* activity) {
+    Stall& stall = stalls_[stallCount_ % MaxStalls];
+    stall.uptimeMs = millis();
+    stall.durationUs = durationUs;
+    stall.starved = starved;
+    strlcpy(stall.activity, activity, sizeof(stall.activity));
+    stall.jobs[0] = '\0';
+    if (describeJobs_ != nullptr) {
+      describeJobs_(stall.jobs, sizeof(stall.jobs));
+    }
+    ++stallCount_;
+  }
+
+  static inline JitterMonitor* instance_ = nullptr;
+
+  uint32_t stallUs_;
+  JobsDescriber describeJobs_;
+  uint8_t cores_;
+  int64_t startUs_;
+
+  // Written by loop() only
+  int64_t lastWakeUs_;
+  int64_t phaseStartUs_;
+  const char* phase_;
+  uint32_t passUs_;  // duration of the previous pass
+  uint32_t slowestUs_;
+  char slowest_[ACTIVITY_LENGTH];
+  uint32_t slowestRequestUs_;
+  char request_[ACTIVITY_LENGTH];
+  LogHistogram loopPeriod_;
+  LogHistogram handler_;
+  LogHistogram isrLatency_;
+  Stall stalls_[MaxStalls];
+  uint32_t stallCount_;
+
+  // Written by the tick hook of each core only
+  int64_t lastTickUs_[MAX_CORES];
+  LogHistogram ticks_[MAX_CORES];
+  volatile uint32_t lateTicks_[MAX_CORES];
+};
@@ -0,0 +1,581 @@
+#pragma once
+
+// Background job scheduler.
+// A fixed pool of worker tasks is created once at boot (xTaskCreateStatic:
+// TCBs inside the scheduler, all stacks in one block allocated at boot) and fed
+// from a bounded priority queue, so running a test neither creates a FreeRTOS
+// task nor allocates memory. Every job has an id, a state, a progress value, an optional timeout
+// and a short result text kept in the job store until the slot is recycled
+// (oldest finished job first).
+// Cancellation and timeouts are cooperative: the routine sees
+// JobContext::stopRequested() turn true (cancel request or deadline of its
+// type reached) and is expected to return early. JobContext::sleep() replaces
+// delay() in routines: cancel() and checkTimeouts() notify the worker, so the
+// wait ends within a tick instead of at the end of the delay. Routines that
+// never check still run to completion, but their job is reported as cancelled
+// or timed out. current() gives the context of the calling worker to code
+// that does not receive it (test helpers shared with the HTTP handlers).
+// Each job claims shared peripherals (an opaque bitmask defined by the caller)
+// and GPIOs. A queued job is only started when none of its claims is held by
+// a job still executing, so independent tests run side by side on the workers
+// while conflicting ones are serialized. busyResources() lets the code running
+// outside the jobs (HTTP handlers, streams) leave a claimed peripheral alone.
+// The free part of a worker stack is repainted before each job, so the stack
+// depth reached by the routine is known when it returns (Job::stackPeak).
+// Workers wait on the semaphore of their core. setAllowedCores() restricts
+// which cores start new jobs (core placement, see core_placement.h); a job
+// already running on a core that gets excluded is not moved.
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "stack_profiler.h"
+
+enum JobState : uint8_t {
+  JOB_QUEUED,
+  JOB_RUNNING,
+  JOB_DONE,
+  JOB_FAILED,
+  JOB_CANCELLED,
+  JOB_TIMED_OUT
+};
+
+inline const char* jobStateName(JobState state) {
+  switch (state) {
+    case JOB_QUEUED: return "queued";
+    case JOB_RUNNING: return "running";
+    case JOB_DONE: return "done";
+    case JOB_FAILED: return "failed";
+    case JOB_CANCELLED: return "cancelled";
+    case JOB_TIMED_OUT: return "timed_out";
+  }
+  return "unknown";
+}
+
+inline bool jobFinished(JobState state) { return state != JOB_QUEUED && state != JOB_RUNNING; }
+
+class JobContext;
+typedef void (*JobRoutine)(JobContext& job);
+
+// Static description of a kind of job (one per hardware test)
+struct JobType {
+  const char* name;    // API identifier
+  JobRoutine routine;
+  uint8_t priority;    // higher runs first, FIFO within a priority
+  uint32_t timeoutMs;  // 0 = no timeout
+  uint32_t resources;  // shared peripherals (bus, LEDC channel, UART...)
+  uint64_t (*pins)();  // GPIO bitmask, read at submit time (pins are configurable); may be nullptr
+};
+
+struct Job {
+  static const uint8_t RESULT_LENGTH = 96;
+
+  uint32_t id;  // 0 = free slot
+  const JobType* type;
+  JobState state;
+  uint8_t priority;
+  uint8_t progress;  // percent
+  bool cancelRequested;
+  bool deadlineSeen;  // the routine was told to stop by the deadline (stopRequested() at 0 ms left)
+  bool success;
+  bool attached;  // a worker is still executing the routine (even after a timeout)
+  int8_t core;    // core of the worker that ran it, -1 before start
+  int8_t worker;  // index of that worker, -1 before start
+  uint32_t resources;
+  uint64_t pins;
+  uint32_t finishSeq;  // value of finishCount() when the job finished (or its routine returned after a timeout)
+  uint16_t stackPeak;  // worker stack bytes used while the routine ran, 0 until it returns
+  unsigned long submittedMs;
+  unsigned long startedMs;
+  unsigned long finishedMs;
+  char result[RESULT_LENGTH];
+};
+
+// Handle given to a running routine
+class JobContext {
+ public:
+  JobContext(Job& job, SemaphoreHandle_t lock) : job_(job), lock_(lock) {}
+
+  uint32_t id() const { return job_.id; }
+  bool cancelled() const { return reinterpret_cast<volatile const bool&>(job_.cancelRequested); }
+
+  // Time left before the timeout of the job type (UINT32_MAX without timeout)
+  uint32_t remainingMs() const {
+    if (job_.type->timeoutMs == 0) {
+      return UINT32_MAX;
+    }
+    const unsigned long elapsed = millis() - job_.startedMs;
+    return elapsed < job_.type->timeoutMs ? job_.type->timeoutMs - elapsed : 0;
+  }
+
+  bool stopRequested() const {
+    if (cancelled()) {
+      return true;
+    }
+    if (remainingMs() == 0) {
+      reinterpret_cast<volatile bool&>(job_.deadlineSeen) = true;
+      return true;
+    }
+    return false;
+  }
+
+  // delay() that ends early on cancel or deadline; false when the routine must stop
+  bool sleep(uint32_t ms) {
+    const unsigned long start = millis();
+    while (!stopRequested()) {
+      const uint32_t elapsed = millis() - start;
+      if (elapsed >= ms) {
+        return true;
+      }
+      const uint32_t left = ms - elapsed < remainingMs() ? ms - elapsed : remainingMs();
+      const TickType_t ticks = pdMS_TO_TICKS(left);
+      ulTaskNotifyTake(pdTRUE, ticks > 0 ? ticks : 1);  // given by cancel() / checkTimeouts()
+    }
+    return false;
+  }
+
+  void setProgress(uint8_t percent) { reinterpret_cast<volatile uint8_t&>(job_.progress) = percent > 100 ? 100 : percent; }
+
+  void setResult(const char* text, bool success) {
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    strlcpy(job_.result, text != nullptr ? text : "", sizeof(job_.result));
+    job_.success = success;
+    xSemaphoreGive(lock_);
+  }
+
+ private:
+  Job& job_;
+  SemaphoreHandle_t lock_;
+};
+
+template <uint8_t Workers, uint8_t Slots>
+class JobScheduler {
+ public:
+  enum SubmitStatus { SUBMITTED, ALREADY_ACTIVE, STORE_FULL };
+  static const uint8_t CORE_SLOTS = 2;
+
+  JobScheduler()
+      : lock_(nullptr), onFinish_(nullptr), nextId_(1), finishCount_(0), stackSize_(0), stacksInPsram_(false),
+        workerCores_(0), allowedCores_(0), stacks_(nullptr) {
+    memset(jobs_, 0, sizeof(jobs_));
+    memset(pending_, 0, sizeof(pending_));
+    memset(handles_, 0, sizeof(handles_));
+    memset(contexts_, 0, sizeof(contexts_));
+  }
+
+  // Creates the worker tasks, worker i pinned to firstCore + i % coreCount
+  // (or unpinned with tskNO_AFFINITY); returns the number actually started.
+  // psramStacks: see allocateStack() for the restrictions.
+  uint8_t begin(uint32_t stackSize, UBaseType_t priority, BaseType_t firstCore, uint8_t coreCount = 1,
+                bool psramStacks = false) {
+    lock_ = xSemaphoreCreateMutex();
+    if (lock_ == nullptr) {
+      return 0;
+    }
+    for (SemaphoreHandle_t& pending : pending_) {
+      pending = xSemaphoreCreateCounting(Slots, 0);
+      if (pending == nullptr) {
+        return 0;
+      }
+    }
+    stackSize_ = (stackSize + 15) & ~15UL;  // keeps every stack of the block aligned
+    stacks_ = allocateStack(static_cast<size_t>(stackSize_) * Workers, psramStacks, &stacksInPsram_);
+    if (stacks_ == nullptr) {
+      return 0;
+    }
+    uint8_t started = 0;
+    for (uint8_t i = 0; i < Workers; ++i) {
+      char name[16];
+      snprintf(name, sizeof(name), "JobWorker%u", static_cast<unsigned>(i));
+      const BaseType_t core = firstCore == tskNO_AFFINITY ? tskNO_AFFINITY : firstCore + i % (coreCount > 0 ? coreCount : 1);
+      workers_[i].owner = this;
+      workers_[i].index = i;
+      workers_[i].slot = core == tskNO_AFFINITY ? 0 : static_cast<uint8_t>(core % CORE_SLOTS);
+      handles_[i] = xTaskCreateStaticPinnedToCore(workerTask, name, stackSize_, &workers_[i], priority,
+                                                  stacks_ + i * stackSize_, &tcbs_[i], core);
+      if (handles_[i] != nullptr) {
+        workerCores_ |= 1U << workers_[i].slot;
+        ++started;
+      }
+    }
+    allowedCores_ = workerCores_;
+    return started;
+  }
+
+  // A job of the same type already queued or running is not duplicated:
+  // its id is returned with ALREADY_ACTIVE.
+  SubmitStatus submit(const JobType& type, uint32_t& id, int priorityOverride = -1) {
+    id = 0;
+    if (lock_ == nullptr) {
+      return STORE_FULL;
+    }
+    const uint64_t pins = type.pins != nullptr ? type.pins() : 0;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    Job* slot = nullptr;
+    Job* oldestFinished = nullptr;
+    for (Job& job : jobs_) {
+      if (job.id == 0) {
+        slot = slot != nullptr ? slot : &job;
+      } else if (!jobFinished(job.state) || job.attached) {
+        if (job.type == &type) {
+          id = job.id;
+          xSemaphoreGive(lock_);
+          return ALREADY_ACTIVE;
+        }
+      } else if (oldestFinished == nullptr || job.finishedMs - oldestFinished->finishedMs > 0x7FFFFFFFUL) {
+        oldestFinished = &job;  // wrap-safe "finished earlier"
+      }
+    }
+    if (slot == nullptr) {
+      slot = oldestFinished;
+    }
+    if (slot == nullptr) {
+      xSemaphoreGive(lock_);
+      return STORE_FULL;
+    }
+
+    memset(slot, 0, sizeof(*slot));
+    slot->id = nextId_++;
+    if (nextId_ == 0) {
+      nextId_ = 1;
+    }
+    slot->type = &type;
+    slot->state = JOB_QUEUED;
+    slot->priority = priorityOverride >= 0 ? static_cast<uint8_t>(priorityOverride) : type.priority;
+    slot->core = -1;
+    slot->worker = -1;
+    slot->resources = type.resources;
+    slot->pins = pins;
+    slot->submittedMs = millis();
+    id = slot->id;
+    xSemaphoreGive(lock_);
+    wakeWorkers(allowedCores(), 1);
+    return SUBMITTED;
+  }
+
+  // Queued jobs are dropped immediately, running ones are asked to stop (and
+  // their worker woken if it sleeps in JobContext::sleep()).
+  // Returns false for unknown or already finished jobs.
+  bool cancel(uint32_t id) {
+    bool accepted = false;
+    if (lock_ == nullptr) {
+      return false;
+    }
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    Job* job = find(id);
+    if (job != nullptr && !jobFinished(job->state)) {
+      job->cancelRequested = true;
+      if (job->state == JOB_QUEUED) {
+        finishLocked(*job, JOB_CANCELLED);
+      } else {
+        notifyWorker(*job);
+      }
+      accepted = true;
+    }
+    xSemaphoreGive(lock_);
+    return accepted;
+  }
+
+  // Consistent copy of one job
+  bool get(uint32_t id, Job& out) const {
+    if (lock_ == nullptr) {
+      return false;
+    }
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    const Job* job = find(id);
+    if (job != nullptr) {
+      out = *job;
+    }
+    xSemaphoreGive(lock_);
+    return job != nullptr;
+  }
+
+  // Calls fn(const Job&) with a copy of every stored job, newest id last.
+  // The lock is not held while fn runs (it may write to the network).
+  template <typename Fn>
+  void forEach(Fn fn) const {
+    if (lock_ == nullptr) {
+      return;
+    }
+    uint32_t after = 0;
+    for (;;) {
+      Job copy;
+      copy.id = 0;
+      xSemaphoreTake(lock_, portMAX_DELAY);
+      for (const Job& job : jobs_) {
+        if (job.id > after && (copy.id == 0 || job.id < copy.id)) {
+          copy = job;
+        }
+      }
+      xSemaphoreGive(lock_);
+      if (copy.id == 0) {
+        return;
+      }
+      after = copy.id;
+      fn(copy);
+    }
+  }
+
+  // Marks running jobs past their deadline as timed out (called from loop())
+  void checkTimeouts() {
+    if (lock_ == nullptr) {
+      return;
+    }
+    const unsigned long now = millis();
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (Job& job : jobs_) {
+      if (job.id != 0 && job.state == JOB_RUNNING && job.type->timeoutMs > 0 &&
+          now - job.startedMs > job.type->timeoutMs) {
+        job.cancelRequested = true;
+        finishLocked(job, JOB_TIMED_OUT);
+        notifyWorker(job);
+      }
+    }
+    xSemaphoreGive(lock_);
+  }
+
+  // Resources claimed by the routines still executing (including timed-out
+  // ones that have not returned): code outside the jobs checks it before
+  // touching a shared peripheral
+  uint32_t busyResources() const {
+    uint32_t busy = 0;
+    if (lock_ == nullptr) {
+      return 0;
+    }
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (const Job& job : jobs_) {
+      if (job.id != 0 && job.attached) {
+        busy |= job.resources;
+      }
+    }
+    xSemaphoreGive(lock_);
+    return busy;
+  }
+
+  // Id of the queued or running job of this type (including a timed-out one
+  // whose routine has not returned yet), 0 if none
+  uint32_t activeJob(const JobType& type) const {
+    uint32_t id = 0;
+    if (lock_ == nullptr) {
+      return 0;
+    }
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (const Job& job : jobs_) {
+      if (job.id != 0 && job.type == &type && (!jobFinished(job.state) || job.attached)) {
+        id = job.id;
+      }
+    }
+    xSemaphoreGive(lock_);
+    return id;
+  }
+
+  // Context of the job run by the calling task, nullptr outside a worker routine
+  JobContext* current() const {
+    const TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    for (uint8_t i = 0; i < Workers; ++i) {
+      if (handles_[i] == self) {
+        return contexts_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  uint32_t stackSize() const { return stackSize_; }
+  bool stacksInPsram() const { return stacksInPsram_; }
+
+  // Worker task i (nullptr if it could not be created)
+  TaskHandle_t workerHandle(uint8_t i) const { return i < Workers ? handles_[i] : nullptr; }
+
+  // Bit n set: a worker runs on core n (bit 0 for unpinned workers)
+  uint8_t workerCores() const { return workerCores_; }
+  uint8_t allowedCores() const { return reinterpret_cast<const volatile uint8_t&>(allowedCores_); }
+
+  // Cores allowed to start queued jobs. Bits without a worker are ignored, and
+  // an empty result falls back to every worker core so the queue never stalls.
+  void setAllowedCores(uint8_t mask) {
+    mask &= workerCores_;
+    if (mask == 0) {
+      mask = workerCores_;
+    }
+    const uint8_t added = mask & ~allowedCores_;
+    reinterpret_cast<volatile uint8_t&>(allowedCores_) = mask;
+    if (added != 0) {
+      wakeWorkers(added, queuedJobs());  // their tokens went to the other core
+    }
+  }
+
+  // hook() runs each time finishCount() moves, in the task that finished the job
+  void setFinishHook(void (*hook)()) { onFinish_ = hook; }
+
+  // Incremented each time a job finishes; compare with Job::finishSeq to find the new ones
+  uint32_t finishCount() const { return reinterpret_cast<const volatile uint32_t&>(finishCount_); }
+
+  uint8_t activeJobs() const {
+    uint8_t count = 0;
+    if (lock_ == nullptr) {
+      return 0;
+    }
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (const Job& job : jobs_) {
+      count += (job.id != 0 && !jobFinished(job.state)) ? 1 : 0;
+    }
+    xSemaphoreGive(lock_);
+    return count;
+  }
+
+ private:
+  static void workerTask(void* parameters) {
+    const Worker* worker = static_cast<const Worker*>(parameters);
+    JobScheduler* self = worker->owner;
+    const uint8_t slot = worker->slot;
+    for (;;) {
+      xSemaphoreTake(self->pending_[slot], portMAX_DELAY);
+      if ((self->allowedCores() & (1U << slot)) == 0) {
+        continue;  // core excluded since the token was given
+      }
+      Job* job = self->takeNext(worker->index);
+      if (job == nullptr) {
+        continue;  // cancelled while queued
+      }
+      JobContext context(*job, self->lock_);
+      ulTaskNotifyTake(pdTRUE, 0);  // drops a wake-up meant for the previous job
+      self->contexts_[worker->index] = &context;
+      repaintFreeStack();
+      job->type->routine(context);
+      self->contexts_[worker->index] = nullptr;
+      self->complete(*job, stackPeakBytes(nullptr, self->stackSize_));
+    }
+  }
+
+  // Highest priority queued job whose claims are all free. A job blocked by a
+  // conflict stays queued; complete() wakes a worker again when claims are released.
+  Job* takeNext(uint8_t worker) {
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    uint32_t busyResources = 0;
+    uint64_t busyPins = 0;
+    for (const Job& job : jobs_) {
+      if (job.id != 0 && job.attached) {
+        busyResources |= job.resources;
+        busyPins |= job.pins;
+      }
+    }
+    Job* next = nullptr;
+    for (Job& job : jobs_) {
+      if (job.id != 0 && job.state == JOB_QUEUED && (job.resources & busyResources) == 0 && (job.pins & busyPins) == 0 &&
+          (next == nullptr || job.priority > next->priority || (job.priority == next->priority && job.id < next->id))) {
+        next = &job;
+      }
+    }
+    if (next != nullptr) {
+      next->state = JOB_RUNNING;
+      next->attached = true;
+      next->core = static_cast<int8_t>(xPortGetCoreID());
+      next->worker = static_cast<int8_t>(worker);
+      next->startedMs = millis();
+    }
+    xSemaphoreGive(lock_);
+    return next;
+  }
+
+  void complete(Job& job, uint32_t stackPeak) {
+    uint8_t queued = 0;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    job.attached = false;
+    job.stackPeak = stackPeak > 0xFFFF ? 0xFFFF : static_cast<uint16_t>(stackPeak);
+    if (job.state == JOB_RUNNING) {  // not already timed out
+      if (job.cancelRequested) {
+        finishLocked(job, JOB_CANCELLED);
+      } else if (!job.success && job.deadlineSeen) {
+        finishLocked(job, JOB_TIMED_OUT);  // stopped at its deadline before checkTimeouts() saw it
+      } else {
+        job.progress = 100;
+        finishLocked(job, job.success ? JOB_DONE : JOB_FAILED);
+      }
+    } else {
+      job.finishSeq = nextFinishSeq();  // the late result is now final
+    }
+    for (const Job& other : jobs_) {
+      queued += (other.id != 0 && other.state == JOB_QUEUED) ? 1 : 0;
+    }
+    xSemaphoreGive(lock_);
+    // Claims released: give the queued jobs another chance (extra wake-ups are harmless)
+    wakeWorkers(allowedCores(), queued);
+  }
+
+  // Ends a JobContext::sleep() of the routine running the job (lock_ held)
+  void notifyWorker(const Job& job) {
+    if (job.attached && job.worker >= 0 && handles_[job.worker] != nullptr) {
+      xTaskNotifyGive(handles_[job.worker]);
+    }
+  }
+
+  // count tokens on the semaphore of each core in mask
+  void wakeWorkers(uint8_t mask, uint8_t count) {
+    for (uint8_t core = 0; core < CORE_SLOTS; ++core) {
+      if ((mask & (1U << core)) == 0) {
+        continue;
+      }
+      for (uint8_t i = 0; i < count && xSemaphoreGive(pending_[core]) == pdTRUE; ++i) {
+      }
+    }
+  }
+
+  uint8_t queuedJobs() const {
+    uint8_t queued = 0;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    for (const Job& job : jobs_) {
+      queued += (job.id != 0 && job.state == JOB_QUEUED) ? 1 : 0;
+    }
+    xSemaphoreGive(lock_);
+    return queued;
+  }
+
+
+  void finishLocked(Job& job, JobState state) {
+    job.state = state;
+    job.finishedMs = millis();
+    job.finishSeq = nextFinishSeq();
+  }
+
+  // Called with lock_ held: the hook must not block or call back into the scheduler
+  uint32_t nextFinishSeq() {
+    ++finishCount_;
+    if (onFinish_ != nullptr) {
+      onFinish_();
+    }
+    return finishCount_;
+  }
+
+  Job* find(uint32_t id) {
+    for (Job& job : jobs_) {
+      if (id != 0 && job.id == id) {
+        return &job;
+      }
+    }
+    return nullptr;
+  }
+  const Job* find(uint32_t id) const { return const_cast<JobScheduler*>(this)->find(id); }
+
+  struct Worker {
+    JobScheduler* owner;
+    uint8_t index;
+    uint8_t slot;  // index in pending_: pinned core, 0 when unpinned
+  };
+
+  Job jobs_[Slots];
+  SemaphoreHandle_t lock_;
+  void (*onFinish_)();
+  SemaphoreHandle_t pending_[CORE_SLOTS];  // one wake-up semaphore per core
+  uint32_t nextId_;
+  uint32_t finishCount_;
+  uint32_t stackSize_;
+  bool stacksInPsram_;
+  uint8_t workerCores_;
+  uint8_t allowedCores_;
+  StackType_t* stacks_;  // Workers * stackSize_ bytes, allocated once by begin()
+  StaticTask_t tcbs_[Workers];
+  TaskHandle_t handles_[Workers];
+  JobContext* contexts_[Workers];  // routine running on worker i (read by that worker only)
+  Worker workers_[Workers];
+};
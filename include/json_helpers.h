@@ -1,31 +1,72 @@
 #pragma once
 
 #include <Arduino.h>
+#include <type_traits>
 
+// Typed field for sendJsonResponse()/sendActionResponse(): the value is handed
+// to DataWriter as-is, no String is built to format it. Text values are
+// borrowed, so a spec must not outlive the call it is passed to (temporaries
+// such as server.arg() live until the end of that call).
 struct JsonFieldSpec {
+  enum Kind : uint8_t { TEXT, FLASH_TEXT, BOOL, SIGNED, UNSIGNED, FLOAT };
+
   const char* key;
-  String value;
-  bool raw;
+  Kind kind;
+  uint8_t decimals;  // FLOAT only
+  union {
+    const char* text;
+    const __FlashStringHelper* flashText;
+    bool boolean;
+    long long signedValue;
+    unsigned long long unsignedValue;
+    double floatValue;
+  };
 };
 
-inline JsonFieldSpec jsonStringField(const char* key, const String& value) {
-  return {key, value, false};
+inline JsonFieldSpec jsonStringField(const char* key, const char* value) {
+  JsonFieldSpec field{key, JsonFieldSpec::TEXT, 0, {}};
+  field.text = value ? value : "";
+  return field;
 }
 
-inline JsonFieldSpec jsonStringField(const char* key, const char* value) {
-  return {key, value ? String(value) : String(), false};
+inline JsonFieldSpec jsonStringField(const char* key, const String& value) {
+  return jsonStringField(key, value.c_str());
 }
 
-inline JsonFieldSpec jsonBoolField(const char* key, bool value) {
-  return {key, value ? String(F("true")) : String(F("false")), true};
+inline JsonFieldSpec jsonStringField(const char* key, const __FlashStringHelper* value) {
+  if (value == nullptr) {
+    return jsonStringField(key, "");
+  }
+  JsonFieldSpec field{key, JsonFieldSpec::FLASH_TEXT, 0, {}};
+  field.flashText = value;
+  return field;
 }
 
-template <typename T>
-inline JsonFieldSpec jsonNumberField(const char* key, T value) {
-  return {key, String(value), true};
+inline JsonFieldSpec jsonBoolField(const char* key, bool value) {
+  JsonFieldSpec field{key, JsonFieldSpec::BOOL, 0, {}};
+  field.boolean = value;
+  return field;
 }
 
 inline JsonFieldSpec jsonFloatField(const char* key, double value, uint8_t decimals = 2) {
-  return {key, String(value, static_cast<unsigned int>(decimals)), true};
+  JsonFieldSpec field{key, JsonFieldSpec::FLOAT, decimals, {}};
+  field.floatValue = value;
+  return field;
 }
 
+template <typename T>
+inline JsonFieldSpec jsonNumberField(const char* key, T value) {
+  static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                "jsonNumberField expects an integer or floating-point value");
+  if constexpr (std::is_floating_point<T>::value) {
+    return jsonFloatField(key, value);  // same 2 decimals as String(float)
+  } else if constexpr (std::is_signed<T>::value) {
+    JsonFieldSpec field{key, JsonFieldSpec::SIGNED, 0, {}};
+    field.signedValue = static_cast<long long>(value);
+    return field;
+  } else {
+    JsonFieldSpec field{key, JsonFieldSpec::UNSIGNED, 0, {}};
+    field.unsignedValue = static_cast<unsigned long long>(value);
+    return field;
+  }
+}
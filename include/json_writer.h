@@ -0,0 +1,136 @@
+#pragma once
+
+// Streaming JSON writer backed by a fixed caller-owned buffer.
+// Values are escaped directly into the buffer; when it fills up the content is
+// handed to a flush callback (e.g. WebServer::sendContent) and writing resumes
+// at the start. No Arduino String is created while serializing.
+
+#include "data_writer.h"
+
+class JsonWriter final : public DataWriter, public WriterBuffer {
+ public:
+  typedef WriterBuffer::FlushCallback FlushCallback;
+
+  static const uint8_t MAX_DEPTH = 31;
+
+  JsonWriter(char* buffer, size_t capacity, FlushCallback flush, void* context)
+      : WriterBuffer(buffer, capacity, flush, context), depth_(0), hasItems_(0) {}
+
+  // Pre-serialized JSON fragment, copied verbatim
+  void fieldRaw(const char* key, const char* json) { writeKey(key); raw(json); }
+
+  // ---- Unstructured bytes (framing around a document, e.g. SSE "data: ") ----
+  void raw(const char* text) { putRaw(text, strlen(text)); }
+  void raw(const char* data, size_t length) { putRaw(data, length); }
+
+  void flush() override { flushBuffer(); }
+
+  // ---- Encoder primitives ----
+  void writeKey(const char* key) override {
+    writeItem();
+    writeText(key, strlen(key));
+    put(':');
+  }
+
+  void writeItem() override {
+    uint32_t bit = 1UL << depth_;
+    if (hasItems_ & bit) {
+      put(',');
+    }
+    hasItems_ |= bit;
+  }
+
+  void writeOpen(bool object) override {
+    put(object ? '{' : '[');
+    if (depth_ < MAX_DEPTH) {
+      ++depth_;
+    }
+    hasItems_ &= ~(1UL << depth_);
+  }
+
+  void writeClose(bool object) override {
+    put(object ? '}' : ']');
+    if (depth_ > 0) {
+      --depth_;
+    }
+  }
+
+  void writeText(const char* text, size_t len) override {
+    put('"');
+    for (size_t i = 0; i < len; ++i) {
+      writeEscaped(text[i]);
+    }
+    put('"');
+  }
+
+  void writeFlashText(const __FlashStringHelper* text) override {
+    PGM_P p = reinterpret_cast<PGM_P>(text);
+    put('"');
+    for (char c = pgm_read_byte(p); c != '\0'; c = pgm_read_byte(++p)) {
+      writeEscaped(c);
+    }
+    put('"');
+  }
+
+  void writeBool(bool value) override { raw(value ? "true" : "false"); }
+  void writeNull() override { raw("null"); }
+
+  void writeSigned(long long v) override {
+    if (v < 0) {
+      put('-');
+      writeUnsigned(static_cast<unsigned long long>(0) - static_cast<unsigned long long>(v));
+    } else {
+      writeUnsigned(static_cast<unsigned long long>(v));
+    }
+  }
+
+  void writeUnsigned(unsigned long long v) override {
+    char digits[20];
+    size_t n = 0;
+    do {
+      digits[n++] = static_cast<char>('0' + (v % 10));
+      v /= 10;
+    } while (v != 0);
+    while (n > 0) {
+      put(digits[--n]);
+    }
+  }
+
+  void writeFloat(double v, uint8_t decimals) override {
+    if (isnan(v) || isinf(v)) {
+      writeNull();  // JSON has no NaN/Infinity
+      return;
+    }
+    char tmp[32];
+    int len = snprintf(tmp, sizeof(tmp), "%.*f", static_cast<int>(decimals), v);
+    if (len > 0) {
+      putRaw(tmp, static_cast<size_t>(len) < sizeof(tmp) ? static_cast<size_t>(len) : sizeof(tmp) - 1);
+    }
+  }
+
+ private:
+  void writeEscaped(char c) {
+    switch (c) {
+      case '"': put('\\'); put('"'); break;
+      case '\\': put('\\'); put('\\'); break;
+      case '\n': put('\\'); put('n'); break;
+      case '\r': put('\\'); put('r'); break;
+      case '\t': put('\\'); put('t'); break;
+      case '\b': put('\\'); put('b'); break;
+      case '\f': put('\\'); put('f'); break;
+      default:
+        if (static_cast<uint8_t>(c) < 0x20) {
+          static const char hex[] = "0123456789abcdef";
+          putRaw("\\u00", 4);
+          put(hex[(c >> 4) & 0x0F]);
+          put(hex[c & 0x0F]);
+        } else {
+          put(c);
+        }
+        break;
+    }
+  }
+
+  uint8_t depth_;
+  uint32_t hasItems_;
+};
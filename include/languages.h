@@ -64,6 +64,7 @@ class TextField {
   X(sdk_version, "SDK Version", "Version du SDK") \
   X(idf_version, "ESP-IDF Version", "Version d'ESP-IDF") \
   X(uptime, "Uptime", "Uptime") \
+  X(system_section, "System", "Système") \
   X(cpu_temp, "CPU Temperature", "Température du CPU") \
   X(memory_details, "Detailed Memory", "Mémoire détaillée") \
   X(flash_memory, "Flash Memory", "Mémoire flash") \
@@ -216,6 +217,20 @@ class TextField {
   X(cpu_perf_score, "CPU Performance Score", "Score de performance CPU") \
   X(memory_benchmark, "Memory Benchmark", "Benchmark mémoire") \
   X(memory_bandwidth, "Memory Bandwidth", "Bande passante mémoire") \
+  X(memory_hierarchy, "Memory Hierarchy", "Hiérarchie mémoire") \
+  X(read_bandwidth, "Read bandwidth", "Débit en lecture") \
+  X(write_bandwidth, "Write bandwidth", "Débit en écriture") \
+  X(copy_bandwidth, "Copy bandwidth", "Débit de copie") \
+  X(access_latency, "Random access latency", "Latence d'accès aléatoire") \
+  X(responsiveness, "Responsiveness", "Réactivité") \
+  X(loop_period, "Loop period", "Période de la boucle") \
+  X(handler_duration, "Handler duration", "Durée des handlers") \
+  X(isr_loop_latency, "ISR to loop latency", "Latence ISR vers boucle") \
+  X(tick_interval_max, "Tick interval max", "Intervalle de tick max") \
+  X(late_ticks, "Late ticks", "Ticks en retard") \
+  X(stall_threshold, "Stall threshold", "Seuil de blocage") \
+  X(stalls, "Stalls", "Blocages") \
+  X(last_stall, "Last stall", "Dernier blocage") \
   X(run_benchmarks, "Run Benchmarks", "Lancer les benchmarks") \
   X(iterations_label, "Iterations", "Itérations") \
   X(allocations_label, "Allocations", "Allocations") \
@@ -226,6 +241,7 @@ class TextField {
   X(stop_stress, "Stop Test", "Arrêter le stress test") \
   X(test_duration, "Test Duration", "Durée du test") \
   X(test_in_progress, "Test in progress...", "Test en cours...") \
+  X(test_cancelled, "Test cancelled", "Test annulé") \
   X(gpio_test_complete, "GPIO test completed", "Terminé - {count} GPIO testés") \
   X(stress_running, "Stress test running...", "⚠️ Test en cours... Patientez") \
   X(export_intro, "Export diagnostic reports in various formats", "Téléchargez les rapports de diagnostic dans le format souhaité.") \
@@ -433,6 +449,7 @@ class TextField {
   X(gps_fix_type, "Fix Type", "Type de Fix") \
   X(gps_speed, "Speed", "Vitesse") \
   X(gps_course, "Course", "Cap") \
+  X(gps_date_time, "Date/Time", "Date/Heure") \
   X(gps_status, "GPS Status", "Statut GPS") \
   X(test_gps, "Test GPS", "Tester le GPS") \
   X(refresh_gps, "Refresh GPS", "Rafraîchir GPS") \
@@ -0,0 +1,254 @@
+#pragma once
+
+// Event-driven main loop.
+// loop() blocks on a FreeRTOS event group instead of polling every subsystem
+// and sleeping a fixed delay(10). Each subsystem owns one bit, set when it has
+// work: from an ISR (buttons), from another task (HTTP socket watcher, job
+// completion, Wi-Fi events) or by a software timer at its next deadline
+// (heartbeat frame, periodic report, housekeeping). wait() returns the bits
+// set since the last call and loop() runs only those subsystems.
+// With pollMs > 0 the legacy behaviour is kept for comparison: wake every
+// pollMs and report every source as pending, except the periodic timers that
+// keep their own period (arm() does nothing, every pass runs anyway).
+// Stats for /api/loop: wakes, time spent servicing (the rest of the time the
+// loop task is blocked), delay between a signal and the wake that serves it,
+// and jitter of the periodic timers (served interval vs period).
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <freertos/timers.h>
+#include "data_writer.h"
+
+template <uint8_t Sources, uint8_t MaxTimers = 8>
+class LoopEvents {
+  static_assert(Sources > 0 && Sources <= 24, "an event group carries 24 bits");
+
+ public:
+  static const EventBits_t ALL_SOURCES = (1UL << Sources) - 1;
+
+  // Called by wait() for each served signal with its source index and latency
+  typedef void (*LatencyObserver)(uint8_t source, uint32_t latencyUs);
+
+  LoopEvents() : group_(nullptr), observer_(nullptr), pollMs_(0), timerCount_(0), periodicBits_(0) {
+    memset(const_cast<uint32_t*>(signalledUs_), 0, sizeof(signalledUs_));
+    memset(timers_, 0, sizeof(timers_));
+    reset();
+  }
+
+  bool begin(uint32_t pollMs = 0) {
+    pollMs_ = pollMs;
+    group_ = xEventGroupCreate();
+    return group_ != nullptr;
+  }
+
+  // Switches to polling (pollMs > 0) or back to waiting for the bits
+  void setPollMs(uint32_t pollMs) { pollMs_ = pollMs; }
+  bool polling() const { return pollMs_ > 0; }
+  void setLatencyObserver(LatencyObserver observer) { observer_ = observer; }
+  uint32_t pollMs() const { return pollMs_; }
+
+  // From any task
+  void signal(EventBits_t bits) {
+    if (group_ == nullptr) {
+      return;
+    }
+    stamp(bits);
+    xEventGroupSetBits(group_, bits);
+  }
+
+  // From an interrupt handler (the bits are set by the timer daemon task)
+  void IRAM_ATTR signalFromISR(EventBits_t bits) {
+    if (group_ == nullptr) {
+      return;
+    }
+    stamp(bits);
+    BaseType_t woken = pdFALSE;
+    xEventGroupSetBitsFromISR(group_, bits, &woken);
+    if (woken == pdTRUE) {
+      portYIELD_FROM_ISR();
+    }
+  }
+
+  // Software timer that sets bits when it expires. A periodic timer starts now
+  // and its served intervals count in the jitter; a one-shot one waits for arm().
+  TimerHandle_t addTimer(const char* name, EventBits_t bits, uint32_t periodMs, bool periodic) {
+    if (timerCount_ >= MaxTimers) {
+      return nullptr;
+    }
+    TimerSlot& slot = timers_[timerCount_];
+    slot.owner = this;
+    slot.bits = bits;
+    slot.periodUs = periodic ? periodMs * 1000ULL : 0;
+    slot.handle = xTimerCreate(name, ticks(periodMs), periodic ? pdTRUE : pdFALSE, &slot, timerCallback);
+    if (slot.handle == nullptr) {
+      return nullptr;
+    }
+    ++timerCount_;
+    if (periodic) {
+      periodicBits_ |= bits;
+      xTimerStart(slot.handle, pdMS_TO_TICKS(10));
+    }
+    return slot.handle;
+  }
+
+  // (Re)starts a one-shot timer delayMs from now; 0 stops it
+  void arm(TimerHandle_t timer, uint32_t delayMs) {
+    if (timer == nullptr || pollMs_ > 0) {
+      return;
+    }
+    if (delayMs == 0) {
+      xTimerStop(timer, pdMS_TO_TICKS(10));
+    } else {
+      xTimerChangePeriod(timer, ticks(delayMs), pdMS_TO_TICKS(10));  // also starts it
+    }
+  }
+
+  // Blocks until a source is signalled; returns (and clears) the pending bits
+  EventBits_t wait() {
+    EventBits_t bits = 0;
+    if (group_ == nullptr) {
+      delay(10);
+      return ALL_SOURCES;
+    }
+    if (pollMs_ > 0) {
+      vTaskDelay(pdMS_TO_TICKS(pollMs_));
+      bits = xEventGroupClearBits(group_, ALL_SOURCES) | (ALL_SOURCES & ~periodicBits_);  // value before clearing
+    } else {
+      bits = xEventGroupWaitBits(group_, ALL_SOURCES, pdTRUE, pdFALSE, portMAX_DELAY);
+    }
+    bits &= ALL_SOURCES;
+    wakeUs_ = esp_timer_get_time();
+    ++wakes_;
+    for (uint8_t source = 0; source < Sources; ++source) {
+      const EventBits_t bit = 1UL << source;
+      if ((bits & bit) == 0) {
+        continue;
+      }
+      ++sourceWakes_[source];
+      const uint32_t since = signalledUs_[source];
+      if (since != 0) {
+        signalledUs_[source] = 0;
+        const uint32_t latency = static_cast<uint32_t>(wakeUs_) - since;
+        latencySumUs_ += latency;
+        ++latencyCount_;
+        latencyMaxUs_ = latency > latencyMaxUs_ ? latency : latencyMaxUs_;
+        if (observer_ != nullptr) {
+          observer_(source, latency);
+        }
+      }
+    }
+    for (uint8_t i = 0; i < timerCount_; ++i) {
+      TimerSlot& slot = timers_[i];
+      if (slot.periodUs == 0 || (bits & slot.bits) == 0) {
+        continue;
+      }
+      if (slot.lastServedUs != 0) {
+        const uint32_t interval = static_cast<uint32_t>(wakeUs_ - slot.lastServedUs);
+        const uint32_t jitter = interval > slot.periodUs ? interval - slot.periodUs : slot.periodUs - interval;
+        jitterSumUs_ += jitter;
+        ++jitterCount_;
+        jitterMaxUs_ = jitter > jitterMaxUs_ ? jitter : jitterMaxUs_;
+      }
+      slot.lastServedUs = wakeUs_;
+    }
+    return bits;
+  }
+
+  // End of the loop() pass that followed wait()
+  void serviced() { busyUs_ += esp_timer_get_time() - wakeUs_; }
+
+  void reset() {
+    startUs_ = esp_timer_get_time();
+    wakeUs_ = startUs_;
+    wakes_ = 0;
+    busyUs_ = 0;
+    latencySumUs_ = 0;
+    latencyCount_ = 0;
+    latencyMaxUs_ = 0;
+    jitterSumUs_ = 0;
+    jitterCount_ = 0;
+    jitterMaxUs_ = 0;
+    memset(sourceWakes_, 0, sizeof(sourceWakes_));
+    for (TimerSlot& slot : timers_) {
+      slot.lastServedUs = 0;
+    }
+  }
+
+  // names[i]: name of bit i
+  void writeJson(DataWriter& out, const char* const* names) const {
+    const int64_t elapsedUs = esp_timer_get_time() - startUs_;
+    out.field("mode", pollMs_ > 0 ? "polling" : "events");
+    out.field("poll_ms", pollMs_);
+    out.field("window_ms", static_cast<uint32_t>(elapsedUs / 1000));
+    out.field("wakes", wakes_);
+    out.fieldFloat("wakes_per_s", elapsedUs > 0 ? wakes_ * 1e6 / elapsedUs : 0.0, 1);
+    out.fieldFloat("busy_percent", elapsedUs > 0 ? busyUs_ * 100.0 / elapsedUs : 0.0, 2);
+    out.beginObject("latency_us");
+    out.field("mean", latencyCount_ > 0 ? static_cast<uint32_t>(latencySumUs_ / latencyCount_) : 0);
+    out.field("max", latencyMaxUs_);
+    out.field("samples", latencyCount_);
+    out.endObject();
+    out.beginObject("jitter_us");
+    out.field("mean", jitterCount_ > 0 ? static_cast<uint32_t>(jitterSumUs_ / jitterCount_) : 0);
+    out.field("max", jitterMaxUs_);
+    out.field("samples", jitterCount_);
+    out.endObject();
+    out.beginObject("sources");
+    for (uint8_t source = 0; source < Sources; ++source) {
+      out.field(names[source], sourceWakes_[source]);
+    }
+    out.endObject();
+  }
+
+ private:
+  struct TimerSlot {
+    LoopEvents* owner;
+    TimerHandle_t handle;
+    EventBits_t bits;
+    uint32_t periodUs;  // 0 for one-shot timers
+    int64_t lastServedUs;
+  };
+
+  static TickType_t ticks(uint32_t ms) {
+    const TickType_t t = pdMS_TO_TICKS(ms);
+    return t > 0 ? t : 1;
+  }
+
+  static void timerCallback(TimerHandle_t timer) {
+    TimerSlot* slot = static_cast<TimerSlot*>(pvTimerGetTimerID(timer));
+    slot->owner->signal(slot->bits);
+  }
+
+  // First signal time of each source not served yet (0 = none pending)
+  void IRAM_ATTR stamp(EventBits_t bits) {
+    const uint32_t now = static_cast<uint32_t>(esp_timer_get_time()) | 1;
+    for (uint8_t source = 0; source < Sources; ++source) {
+      if ((bits & (1UL << source)) != 0 && signalledUs_[source] == 0) {
+        signalledUs_[source] = now;
+      }
+    }
+  }
+
+  EventGroupHandle_t group_;
+  LatencyObserver observer_;
+  uint32_t pollMs_;
+  volatile uint32_t signalledUs_[Sources];
+  TimerSlot timers_[MaxTimers];
+  uint8_t timerCount_;
+  EventBits_t periodicBits_;
+
+  // Written by loop() only
+  int64_t startUs_;
+  int64_t wakeUs_;
+  uint32_t wakes_;
+  int64_t busyUs_;
+  uint64_t latencySumUs_;
+  uint32_t latencyCount_;
+  uint32_t latencyMaxUs_;
+  uint64_t jitterSumUs_;
+  uint32_t jitterCount_;
+  uint32_t jitterMaxUs_;
+  uint32_t sourceWakes_[Sources];
+};
@@ -0,0 +1,196 @@
+#pragma once
+
+// Memory hierarchy benchmark: bandwidth and latency against working-set size.
+// For one buffer (internal SRAM, IRAM, PSRAM or flash mapped as data) and a
+// working set of `bytes` at its start:
+//   read      32-bit loads summed over the working set, 4 accumulators
+//   write     32-bit stores over the working set
+//   copy      first half copied onto the second half (MB/s copied)
+//   latency   dependent loads, one per MEM_BENCH_LINE bytes, in random order:
+//             a random cyclic pointer chain (Sattolo) in writable memory, a
+//             full-period index sequence that also depends on each loaded word
+//             in read-only memory (adds a multiply-add per load)
+// Every operation runs once untimed (caches warm, as in steady state), then
+// `repeats` timed runs of at least MEM_BENCH_MIN_RUN_BYTES each; the median run
+// is kept. Loads and stores are 32-bit only, so IRAM (word access only on the
+// ESP32) can be measured too. Doubling the working set from 1 KB traces a curve
+// whose steps show the cache sizes and the PSRAM/flash penalties.
+// Nothing here depends on Arduino: the kernels build for the host as well.
+
+#include <stdint.h>
+#include "cpu_benchmark.h"
+
+static const uint32_t MEM_BENCH_LINE = 64;  // bytes between two latency probes
+static const uint32_t MEM_BENCH_MIN_RUN_BYTES = 64 * 1024;
+static const uint8_t MEM_BENCH_MAX_REPEATS = 15;
+
+struct MemoryPoint {
+  uint32_t bytes;   // working set
+  float readMBps;
+  float writeMBps;  // 0 in read-only memory
+  float copyMBps;   // 0 in read-only memory
+  float latencyNs;  // per dependent load
+};
+
+// Results for one memory region, one point per working-set size
+template <uint8_t MaxPoints>
+struct MemoryCurve {
+  const char* name;
+  bool writable;
+  uint32_t maxBytes;  // largest working set measured (0: region unavailable)
+  uint8_t count;
+  MemoryPoint points[MaxPoints];
+};
+
+// ---- Kernels ----
+
+inline uint32_t memReadWords(const uint32_t* data, uint32_t words) {
+  uint32_t a = 0, b = 0, c = 0, d = 0;
+  uint32_t i = 0;
+  for (; i + 4 <= words; i += 4) {
+    a += data[i];
+    b += data[i + 1];
+    c += data[i + 2];
+    d += data[i + 3];
+  }
+  for (; i < words; ++i) {
+    a += data[i];
+  }
+  return a + b + c + d;
+}
+
+// No memset()/memcpy(): the byte accesses of their tails would fault in IRAM
+__attribute__((optimize("no-tree-loop-distribute-patterns")))
+inline void memWriteWords(uint32_t* data, uint32_t words, uint32_t value) {
+  for (uint32_t i = 0; i < words; ++i) {
+    data[i] = value;
+  }
+}
+
+__attribute__((optimize("no-tree-loop-distribute-patterns")))
+inline void memCopyWords(uint32_t* __restrict dst, const uint32_t* __restrict src, uint32_t words) {
+  uint32_t i = 0;
+  for (; i + 4 <= words; i += 4) {
+    dst[i] = src[i];
+    dst[i + 1] = src[i + 1];
+    dst[i + 2] = src[i + 2];
+    dst[i + 3] = src[i + 3];
+  }
+  for (; i < words; ++i) {
+    dst[i] = src[i];
+  }
+}
+
+// Writes a random single cycle through `slots` slots MEM_BENCH_LINE bytes
+// apart: the first word of each slot holds the word index of the next one
+inline void memBuildChain(uint32_t* data, uint32_t slots, uint32_t seed) {
+  const uint32_t stride = MEM_BENCH_LINE / sizeof(uint32_t);
+  for (uint32_t i = 0; i < slots; ++i) {
+    data[i * stride] = i;
+  }
+  uint32_t x = seed | 1;
+  for (uint32_t i = slots - 1; i > 0; --i) {  // Sattolo: j < i gives one cycle
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    const uint32_t j = x % i;
+    const uint32_t swap = data[i * stride];
+    data[i * stride] = data[j * stride];
+    data[j * stride] = swap;
+  }
+  for (uint32_t i = 0; i < slots; ++i) {
+    data[i * stride] *= stride;
+  }
+}
+
+inline uint32_t memChaseChain(const uint32_t* data, uint32_t steps) {
+  uint32_t index = 0;
+  for (uint32_t i = 0; i < steps; ++i) {
+    index = data[index];
+  }
+  return index;
+}
+
+// slots: power of two. zero must be 0 but unknown to the compiler, so that
+// every index waits for the previous load.
+inline uint32_t memChaseIndexed(const uint32_t* data, uint32_t slots, uint32_t steps, uint32_t zero) {
+  const uint32_t stride = MEM_BENCH_LINE / sizeof(uint32_t);
+  uint32_t slot = 0;
+  for (uint32_t i = 0; i < steps; ++i) {
+    slot = (slot * 1664525u + 1013904223u + (data[slot * stride] & zero)) & (slots - 1);
+  }
+  return slot;
+}
+
+// ---- Measurement ----
+
+// buffer: 4-byte aligned, at least `bytes` (a power of two, >= 2 * MEM_BENCH_LINE).
+// cycles(): 32-bit cycle counter, ticksPerUs of them per microsecond.
+template <typename CycleCounter>
+MemoryPoint measureMemoryPoint(uint32_t* buffer, uint32_t bytes, bool writable, uint8_t repeats,
+                               uint32_t ticksPerUs, CycleCounter cycles) {
+  static volatile uint32_t sink;
+  static volatile uint32_t zero = 0;
+  repeats = repeats == 0 ? 1 : (repeats > MEM_BENCH_MAX_REPEATS ? MEM_BENCH_MAX_REPEATS : repeats);
+  const uint32_t words = bytes / sizeof(uint32_t);
+  const uint32_t passes = bytes >= MEM_BENCH_MIN_RUN_BYTES ? 1 : MEM_BENCH_MIN_RUN_BYTES / bytes;
+  const uint32_t slots = bytes / MEM_BENCH_LINE;
+  const uint32_t steps = slots < 4096 ? 4096 : slots;
+  uint32_t samples[MEM_BENCH_MAX_REPEATS];
+  MemoryPoint point = {bytes, 0.0f, 0.0f, 0.0f, 0.0f};
+
+  // MB/s (bytes per microsecond) from the median run
+  auto rate = [&](uint64_t moved) {
+    const uint32_t median = summarizeCycles(samples, repeats).medianCycles;
+    return median > 0 ? static_cast<float>(static_cast<double>(moved) * ticksPerUs / median) : 0.0f;
+  };
+
+  if (writable) {
+    for (uint8_t run = 0; run <= repeats; ++run) {  // run 0: warm-up
+      const uint32_t start = cycles();
+      for (uint32_t pass = 0; pass < passes; ++pass) {
+        memWriteWords(buffer, words, run + pass);
+      }
+      if (run > 0) {
+        samples[run - 1] = cycles() - start;
+      }
+    }
+    point.writeMBps = rate(static_cast<uint64_t>(bytes) * passes);
+  }
+
+  for (uint8_t run = 0; run <= repeats; ++run) {
+    const uint32_t start = cycles();
+    for (uint32_t pass = 0; pass < passes; ++pass) {
+      sink = sink + memReadWords(buffer, words);
+    }
+    if (run > 0) {
+      samples[run - 1] = cycles() - start;
+    }
+  }
+  point.readMBps = rate(static_cast<uint64_t>(bytes) * passes);
+
+  if (writable) {
+    for (uint8_t run = 0; run <= repeats; ++run) {
+      const uint32_t start = cycles();
+      for (uint32_t pass = 0; pass < passes; ++pass) {
+        memCopyWords(buffer + words / 2, buffer, words / 2);
+      }
+      if (run > 0) {
+        samples[run - 1] = cycles() - start;
+      }
+    }
+    point.copyMBps = rate(static_cast<uint64_t>(bytes / 2) * passes);
+    memBuildChain(buffer, slots, bytes);
+  }
+
+  for (uint8_t run = 0; run <= repeats; ++run) {
+    const uint32_t start = cycles();
+    sink = sink + (writable ? memChaseChain(buffer, steps) : memChaseIndexed(buffer, slots, steps, zero));
+    if (run > 0) {
+      samples[run - 1] = cycles() - start;
+    }
+  }
+  const uint32_t median = summarizeCycles(samples, repeats).medianCycles;
+  point.latencyNs = ticksPerUs > 0 ? static_cast<float>(median * 1000.0 / ticksPerUs / steps) : 0.0f;
+  return point;
+}
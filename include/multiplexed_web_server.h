@@ -0,0 +1,243 @@
+#pragma once
+
+// WebServer front end that multiplexes several TCP connections.
+// The stock WebServer::handleClient() adopts one client at a time and keeps it
+// for up to HTTP_MAX_DATA_WAIT (5 s) while waiting for the request line, so an
+// idle or preconnected socket blocks everyone else. This class keeps up to
+// MaxClients accepted sockets in slots and dispatches only the ones whose
+// request has actually arrived. Connections beyond the limit are answered with
+// 503 immediately. Routes, args and send() are the regular WebServer API.
+// The listening socket is opened here (WiFiServer does not expose it) so that
+// an optional watcher task can block in select() on it and on the open slots,
+// and tell the caller when handleClient() has something to do.
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include <WiFi.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <lwip/sockets.h>
+
+template <uint8_t MaxClients>
+class MultiplexedWebServer : public WebServer {
+ public:
+  typedef void (*ReadyCallback)();
+  // Called after each request with its URI and the time spent parsing and handling it
+  typedef void (*ServedCallback)(const char* uri, uint32_t elapsedUs);
+
+  explicit MultiplexedWebServer(int port)
+      : WebServer(port), port_(port), listenFd_(-1), next_(0), rejected_(0), ready_(nullptr), served_(nullptr),
+        armed_(nullptr), watcher_(nullptr) {}
+
+  void begin() {
+    close();
+    listenFd_ = lwip_socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd_ < 0) {
+      return;
+    }
+    int enable = 1;
+    lwip_setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port_);
+    if (lwip_bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        lwip_listen(listenFd_, MaxClients) != 0) {
+      lwip_close(listenFd_);
+      listenFd_ = -1;
+      return;
+    }
+    lwip_fcntl(listenFd_, F_SETFL, lwip_fcntl(listenFd_, F_GETFL, 0) | O_NONBLOCK);
+  }
+
+  void close() {
+    if (listenFd_ >= 0) {
+      lwip_close(listenFd_);
+      listenFd_ = -1;
+    }
+    WebServer::close();
+  }
+
+  // Starts the watcher task: ready() is called (from that task) when a
+  // connection or a request is pending, or an idle slot has expired. The
+  // watcher then waits for rearm(), so handleClient() must only run between
+  // ready() and rearm(): the slots are read by the watcher the rest of the time.
+  bool startWatcher(ReadyCallback ready, uint32_t stackSize, UBaseType_t priority, BaseType_t core) {
+    ready_ = ready;
+    armed_ = xSemaphoreCreateBinary();
+    if (armed_ == nullptr) {
+      return false;
+    }
+    xSemaphoreGive(armed_);
+    return xTaskCreatePinnedToCore(watcherLoop, "HttpWatcher", stackSize, this, priority, &watcher_, core) == pdPASS;
+  }
+
+  void rearm() {
+    if (armed_ != nullptr) {
+      xSemaphoreGive(armed_);
+    }
+  }
+
+  TaskHandle_t watcherTask() const { return watcher_; }
+
+  void onServed(ServedCallback served) { served_ = served; }
+
+  void handleClient() override {
+    acceptPending();
+
+    // One pass over the slots: every connection with a pending request is served
+    // (round robin start so a busy client cannot starve the others)
+    for (uint8_t n = 0; n < MaxClients; ++n) {
+      Slot& slot = slots_[next_];
+      next_ = static_cast<uint8_t>((next_ + 1) % MaxClients);
+      if (!slot.inUse) {
+        continue;
+      }
+      if (!slot.client.connected()) {
+        release(slot);
+      } else if (slot.client.available()) {
+        serve(slot);
+      } else if (millis() - slot.acceptedMs > HTTP_MAX_DATA_WAIT) {
+        release(slot);
+      }
+    }
+  }
+
+  uint8_t activeClients() const {
+    uint8_t count = 0;
+    for (const Slot& slot : slots_) {
+      count += slot.inUse ? 1 : 0;
+    }
+    return count;
+  }
+
+  uint32_t rejectedClients() const { return rejected_; }
+
+ private:
+  struct Slot {
+    WiFiClient client;
+    unsigned long acceptedMs = 0;
+    bool inUse = false;
+  };
+
+  void acceptPending() {
+    while (listenFd_ >= 0) {
+      const int fd = lwip_accept(listenFd_, nullptr, nullptr);
+      if (fd < 0) {
+        return;
+      }
+      WiFiClient incoming(fd);
+      Slot* freeSlot = nullptr;
+      for (Slot& slot : slots_) {
+        if (!slot.inUse) {
+          freeSlot = &slot;
+          break;
+        }
+      }
+      if (freeSlot == nullptr) {
+        ++rejected_;
+        incoming.print(F("HTTP/1.1 503 Service Unavailable\r\n"
+                         "Retry-After: 1\r\n"
+                         "Content-Length: 0\r\n"
+                         "Connection: close\r\n\r\n"));
+        incoming.stop();
+        continue;
+      }
+      incoming.setNoDelay(true);
+      freeSlot->client = incoming;
+      freeSlot->acceptedMs = millis();
+      freeSlot->inUse = true;
+    }
+  }
+
+  // Same sequence as WebServer::handleClient() for a client whose data is ready
+  void serve(Slot& slot) {
+    const int64_t startUs = esp_timer_get_time();
+    _currentClient = slot.client;
+    _currentStatus = HC_WAIT_READ;
+    _statusChange = millis();
+    if (_parseRequest(_currentClient)) {
+      _currentClient.setTimeout(HTTP_MAX_SEND_WAIT / 1000);
+      _contentLength = CONTENT_LENGTH_NOT_SET;
+      _handleRequest();
+      if (served_ != nullptr) {
+        served_(_currentUri.c_str(), static_cast<uint32_t>(esp_timer_get_time() - startUs));
+      }
+    }
+    // Responses carry "Connection: close": the slot is done once answered.
+    // stop() only drops this reference, a handler that kept a copy of the
+    // client (event stream) keeps the socket open.
+    _currentClient = WiFiClient();
+    _currentStatus = HC_NONE;
+    release(slot);
+  }
+
+  void release(Slot& slot) {
+    slot.client.stop();
+    slot.inUse = false;
+  }
+
+  // Listening socket and open slots; returns the highest fd. waitMs: until the
+  // oldest idle slot expires (expiring = true), or IDLE_WATCH_MS.
+  int readSet(fd_set& fds, uint32_t& waitMs, bool& expiring) const {
+    static const uint32_t IDLE_WATCH_MS = 1000;
+    FD_ZERO(&fds);
+    int maxFd = listenFd_;
+    if (listenFd_ >= 0) {
+      FD_SET(listenFd_, &fds);
+    }
+    waitMs = IDLE_WATCH_MS;
+    expiring = false;
+    const unsigned long now = millis();
+    for (const Slot& slot : slots_) {
+      const int fd = slot.inUse ? slot.client.fd() : -1;
+      if (fd < 0) {
+        continue;
+      }
+      FD_SET(fd, &fds);
+      maxFd = fd > maxFd ? fd : maxFd;
+      const unsigned long age = now - slot.acceptedMs;
+      const uint32_t left = age <= HTTP_MAX_DATA_WAIT ? HTTP_MAX_DATA_WAIT - age + 1 : 0;  // handleClient() drops it past the limit
+      if (left <= waitMs) {
+        waitMs = left;
+        expiring = true;
+      }
+    }
+    return maxFd;
+  }
+
+  static void watcherLoop(void* parameters) {
+    MultiplexedWebServer* self = static_cast<MultiplexedWebServer*>(parameters);
+    for (;;) {
+      xSemaphoreTake(self->armed_, portMAX_DELAY);
+      for (;;) {
+        fd_set fds;
+        uint32_t waitMs = 0;
+        bool expiring = false;
+        const int maxFd = self->readSet(fds, waitMs, expiring);
+        timeval timeout = {static_cast<time_t>(waitMs / 1000), static_cast<suseconds_t>((waitMs % 1000) * 1000)};
+        const int result = lwip_select(maxFd + 1, &fds, nullptr, nullptr, &timeout);
+        if (result < 0) {
+          vTaskDelay(pdMS_TO_TICKS(10));  // a slot closed meanwhile (EBADF): handleClient() sorts it out
+        }
+        if (result != 0 || expiring) {
+          break;
+        }
+      }
+      self->ready_();
+    }
+  }
+
+  uint16_t port_;
+  int listenFd_;
+  Slot slots_[MaxClients];
+  uint8_t next_;
+  uint32_t rejected_;
+  ReadyCallback ready_;
+  ServedCallback served_;
+  SemaphoreHandle_t armed_;
+  TaskHandle_t watcher_;
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+// Network throughput test helpers, shared by the firmware (/api/net/*, TCP
+// echo task) and the native stand-in server (src/host/net_server_host.cpp).
+// Only BSD sockets and plain C++: lwIP on the board, the host stack on Linux.
+//   download  netStreamPattern() sends N bytes from one fixed chunk filled by
+//             netFillPattern(): byte n of the stream is n & 0xFF whatever the
+//             partial writes, so nothing is generated or allocated per request
+//             and the client can check every byte
+//   upload    the body is read into a fixed buffer and dropped, only counted
+//             and timed (NetTransfer)
+//   echo      NetEchoServer: one client at a time, every byte sent back at
+//             once (TCP_NODELAY) for round-trip time measurements
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(ARDUINO)
+#include <lwip/sockets.h>
+#define NET_SOCKET_CALL(name) lwip_##name
+#else
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#define NET_SOCKET_CALL(name) ::name
+#endif
+
+static const size_t NET_PATTERN_PERIOD = 256;
+
+// length: a multiple of NET_PATTERN_PERIOD
+inline void netFillPattern(uint8_t* buffer, size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    buffer[i] = static_cast<uint8_t>(i);
+  }
+}
+
+// write(data, length) returns the bytes accepted, 0 on error. Returns the bytes sent.
+template <typename Write>
+uint64_t netStreamPattern(Write write, uint64_t bytes, const uint8_t* chunk, size_t chunkSize) {
+  uint64_t sent = 0;
+  while (sent < bytes) {
+    const size_t offset = static_cast<size_t>(sent % NET_PATTERN_PERIOD);  // keeps the pattern after a partial write
+    const uint64_t left = bytes - sent;
+    const size_t length = left < chunkSize - offset ? static_cast<size_t>(left) : chunkSize - offset;
+    const size_t written = write(chunk + offset, length);
+    if (written == 0) {
+      break;
+    }
+    sent += written;
+  }
+  return sent;
+}
+
+inline float netMbps(uint64_t bytes, int64_t us) {
+  return us > 0 ? static_cast<float>(static_cast<double>(bytes) * 8 / us) : 0.0f;
+}
+
+// One timed transfer, as seen by the server
+struct NetTransfer {
+  uint64_t expected;  // Content-Length / bytes requested
+  uint64_t bytes;
+  int64_t startUs;
+  int64_t us;
+  bool complete;
+
+  void start(uint64_t expectedBytes, int64_t nowUs) {
+    expected = expectedBytes;
+    bytes = 0;
+    startUs = nowUs;
+    us = 0;
+    complete = false;
+  }
+
+  void finish(int64_t nowUs) {
+    us = nowUs - startUs;
+    complete = bytes == expected;
+  }
+
+  float mbps() const { return netMbps(bytes, us); }
+};
+
+class NetEchoServer {
+ public:
+  NetEchoServer() : listenFd_(-1), port_(0), sessions_(0), bytes_(0) {}
+
+  bool begin(uint16_t port) {
+    listenFd_ = NET_SOCKET_CALL(socket)(AF_INET, SOCK_STREAM, 0);
+    if (listenFd_ < 0) {
+      return false;
+    }
+    int enable = 1;
+    NET_SOCKET_CALL(setsockopt)(listenFd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+    if (NET_SOCKET_CALL(bind)(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        NET_SOCKET_CALL(listen)(listenFd_, 1) != 0) {
+      NET_SOCKET_CALL(close)(listenFd_);
+      listenFd_ = -1;
+      return false;
+    }
+    port_ = port;
+    return true;
+  }
+
+  bool listening() const { return listenFd_ >= 0; }
+  uint16_t port() const { return listenFd_ >= 0 ? port_ : 0; }
+  uint32_t sessions() const { return sessions_; }
+  uint64_t bytes() const { return bytes_; }
+
+  // Blocks until a client connects, then echoes until it closes or stays
+  // silent for idleMs. false when not listening.
+  bool serveOne(uint8_t* buffer, size_t size, uint32_t idleMs) {
+    const int fd = NET_SOCKET_CALL(accept)(listenFd_, nullptr, nullptr);
+    if (fd < 0) {
+      return false;
+    }
+    int enable = 1;
+    NET_SOCKET_CALL(setsockopt)(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    timeval timeout = {static_cast<time_t>(idleMs / 1000), static_cast<suseconds_t>((idleMs % 1000) * 1000)};
+    NET_SOCKET_CALL(setsockopt)(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    ++sessions_;
+    for (;;) {
+      const ssize_t received = NET_SOCKET_CALL(recv)(fd, buffer, size, 0);
+      if (received <= 0 || !sendAll(fd, buffer, static_cast<size_t>(received))) {
+        break;
+      }
+      bytes_ += static_cast<uint64_t>(received);
+    }
+    NET_SOCKET_CALL(close)(fd);
+    return true;
+  }
+
+  static bool sendAll(int fd, const uint8_t* data, size_t length) {
+    while (length > 0) {
+      const ssize_t sent = NET_SOCKET_CALL(send)(fd, data, length, NET_SEND_FLAGS);
+      if (sent <= 0) {
+        return false;
+      }
+      data += sent;
+      length -= static_cast<size_t>(sent);
+    }
+    return true;
+  }
+
+ private:
+#if defined(MSG_NOSIGNAL)
+  static const int NET_SEND_FLAGS = MSG_NOSIGNAL;  // a closed peer is an error, not SIGPIPE
+#else
+  static const int NET_SEND_FLAGS = 0;
+#endif
+
+  int listenFd_;
+  uint16_t port_;
+  uint32_t sessions_;
+  uint64_t bytes_;
+};
@@ -0,0 +1,322 @@
+#pragma once
+
+// Format-independent diagnostic report.
+// A report is an ordered list of sections holding typed fields. The content is
+// described once (writeDiagnosticReport() in main.cpp) through ReportBuilder;
+// each ReportRenderer turns the fields into one format as they are produced.
+// Renderers write into a ReportSink, a fixed buffer flushed chunk by chunk, so
+// memory use does not depend on the size of the report.
+
+#include "data_writer.h"
+#include "languages.h"
+
+// Human label: translated text plus an optional qualifier, e.g. "Free (PSRAM)"
+struct ReportLabel {
+  ReportLabel(const __FlashStringHelper* text, const char* detail = nullptr) : text(text), detail(detail) {}
+  ReportLabel(const TextField& text, const char* detail = nullptr) : text(text.get()), detail(detail) {}
+
+  const __FlashStringHelper* text;
+  const char* detail;
+};
+
+struct ReportField {
+  enum Type : uint8_t { TEXT, FLAG, SIGNED, UNSIGNED, DECIMAL, DURATION_MS, MISSING };
+
+  const char* key;  // structured formats
+  ReportLabel label;  // human formats
+  const char* unit;   // human formats, may be nullptr
+  Type type;
+  const char* text;
+  size_t textLength;
+  const __FlashStringHelper* display;  // human text replacing the value (flags, status codes)
+  long long signedValue;
+  unsigned long long unsignedValue;
+  double decimalValue;
+  uint8_t decimals;
+  bool flag;
+
+  ReportField(const char* key, const ReportLabel& label, Type type)
+      : key(key), label(label), unit(nullptr), type(type), text(nullptr), textLength(0), display(nullptr),
+        signedValue(0), unsignedValue(0), decimalValue(0.0), decimals(0), flag(false) {}
+};
+
+class ReportRenderer {
+ public:
+  virtual ~ReportRenderer() {}
+  virtual void beginSection(const char* key, const __FlashStringHelper* title) = 0;
+  virtual void field(const ReportField& field) = 0;
+  virtual void endSection() = 0;
+};
+
+// Typed front end used by the report description
+class ReportBuilder {
+ public:
+  explicit ReportBuilder(ReportRenderer& renderer) : renderer_(renderer) {}
+
+  void beginSection(const char* key, const __FlashStringHelper* title) { renderer_.beginSection(key, title); }
+  void beginSection(const char* key, const TextField& title) { renderer_.beginSection(key, title.get()); }
+  void endSection() { renderer_.endSection(); }
+
+  void text(const char* key, const ReportLabel& label, const char* value,
+            const __FlashStringHelper* display = nullptr) {
+    ReportField field(key, label, ReportField::TEXT);
+    field.text = value != nullptr ? value : "";
+    field.textLength = strlen(field.text);
+    field.display = display;
+    renderer_.field(field);
+  }
+  void text(const char* key, const ReportLabel& label, const String& value) {
+    ReportField field(key, label, ReportField::TEXT);
+    field.text = value.c_str();
+    field.textLength = value.length();
+    renderer_.field(field);
+  }
+
+  void flag(const char* key, const ReportLabel& label, bool value, const __FlashStringHelper* onText,
+            const __FlashStringHelper* offText) {
+    ReportField field(key, label, ReportField::FLAG);
+    field.flag = value;
+    field.display = value ? onText : offText;
+    renderer_.field(field);
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type
+  number(const char* key, const ReportLabel& label, T value, const char* unit = nullptr) {
+    ReportField field(key, label, std::is_signed<T>::value ? ReportField::SIGNED : ReportField::UNSIGNED);
+    field.signedValue = static_cast<long long>(value);
+    field.unsignedValue = static_cast<unsigned long long>(value);
+    field.unit = unit;
+    renderer_.field(field);
+  }
+
+  void decimal(const char* key, const ReportLabel& label, double value, uint8_t decimals, const char* unit = nullptr) {
+    ReportField field(key, label, ReportField::DECIMAL);
+    field.decimalValue = value;
+    field.decimals = decimals;
+    field.unit = unit;
+    renderer_.field(field);
+  }
+
+  // Sensor value that may be absent: null in structured formats, N/A otherwise
+  void optionalDecimal(const char* key, const ReportLabel& label, double value, bool present, uint8_t decimals,
+                       const char* unit = nullptr) {
+    if (present) {
+      decimal(key, label, value, decimals, unit);
+    } else {
+      renderer_.field(ReportField(key, label, ReportField::MISSING));
+    }
+  }
+
+  void duration(const char* key, const ReportLabel& label, unsigned long milliseconds) {
+    ReportField field(key, label, ReportField::DURATION_MS);
+    field.unsignedValue = milliseconds;
+    renderer_.field(field);
+  }
+
+ private:
+  ReportRenderer& renderer_;
+};
+
+// Fixed output buffer handed to a flush callback (chunked HTTP response)
+class ReportSink : public WriterBuffer {
+ public:
+  ReportSink(char* buffer, size_t capacity, FlushCallback flush, void* context)
+      : WriterBuffer(buffer, capacity, flush, context) {}
+
+  void flush() { flushBuffer(); }
+  void write(char c) { put(c); }
+  void write(const char* text) { putRaw(text, strlen(text)); }
+  void write(const char* text, size_t length) { putRaw(text, length); }
+  void write(const String& text) { putRaw(text.c_str(), text.length()); }
+  void write(const __FlashStringHelper* text) {
+    PGM_P p = reinterpret_cast<PGM_P>(text);
+    for (char c = pgm_read_byte(p); c != '\0'; c = pgm_read_byte(++p)) {
+      put(c);
+    }
+  }
+};
+
+// ---- Structured formats (JSON/CBOR through DataWriter) ----
+class DataReportRenderer final : public ReportRenderer {
+ public:
+  explicit DataReportRenderer(DataWriter& out) : out_(out) {}
+
+  void beginSection(const char* key, const __FlashStringHelper* title) override {
+    (void)title;
+    out_.beginObject(key);
+  }
+  void endSection() override { out_.endObject(); }
+
+  void field(const ReportField& field) override {
+    out_.writeKey(field.key);
+    switch (field.type) {
+      case ReportField::TEXT: out_.writeText(field.text, field.textLength); break;
+      case ReportField::FLAG: out_.writeBool(field.flag); break;
+      case ReportField::SIGNED: out_.writeSigned(field.signedValue); break;
+      case ReportField::UNSIGNED:
+      case ReportField::DURATION_MS: out_.writeUnsigned(field.unsignedValue); break;
+      case ReportField::DECIMAL: out_.writeFloat(field.decimalValue, field.decimals); break;
+      case ReportField::MISSING: out_.writeNull(); break;
+    }
+  }
+
+ private:
+  DataWriter& out_;
+};
+
+// ---- Human formats: shared value formatting, per-format escaping ----
+class HumanReportRenderer : public ReportRenderer {
+ protected:
+  explicit HumanReportRenderer(ReportSink& out) : out_(out) {}
+
+  // Escaping hook, called for every character of labels and values
+  virtual void writeChar(char c) { out_.write(c); }
+
+  void writeText(const char* text, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+      writeChar(text[i]);
+    }
+  }
+  void writeText(const char* text) { writeText(text, strlen(text)); }
+  void writeText(const __FlashStringHelper* text) {
+    PGM_P p = reinterpret_cast<PGM_P>(text);
+    for (char c = pgm_read_byte(p); c != '\0'; c = pgm_read_byte(++p)) {
+      writeChar(c);
+    }
+  }
+
+  void writeLabel(const ReportLabel& label) {
+    writeText(label.text);
+    if (label.detail != nullptr) {
+      writeText(" (");
+      writeText(label.detail);
+      writeChar(')');
+    }
+  }
+
+  void writeValue(const ReportField& field) {
+    if (field.display != nullptr) {
+      writeText(field.display);
+      return;
+    }
+    char number[32];
+    switch (field.type) {
+      case ReportField::TEXT:
+        writeText(field.text, field.textLength);
+        return;
+      case ReportField::FLAG:
+        writeText(field.flag ? "true" : "false");
+        return;
+      case ReportField::SIGNED:
+        snprintf(number, sizeof(number), "%lld", field.signedValue);
+        break;
+      case ReportField::UNSIGNED:
+        snprintf(number, sizeof(number), "%llu", field.unsignedValue);
+        break;
+      case ReportField::DECIMAL:
+        snprintf(number, sizeof(number), "%.*f", static_cast<int>(field.decimals), field.decimalValue);
+        break;
+      case ReportField::DURATION_MS: {
+        const unsigned long minutes = static_cast<unsigned long>(field.unsignedValue / 60000ULL);
+        snprintf(number, sizeof(number), "%lud %luh %lum", minutes / 1440, (minutes / 60) % 24, minutes % 60);
+        break;
+      }
+      case ReportField::MISSING:
+        writeText("N/A");
+        return;
+    }
+    writeText(number);
+    if (field.unit != nullptr) {
+      writeChar(' ');
+      writeText(field.unit);
+    }
+  }
+
+  ReportSink& out_;
+};
+
+// "=== Title ===" blocks of "Label: value" lines
+class TextReportRenderer final : public HumanReportRenderer {
+ public:
+  explicit TextReportRenderer(ReportSink& out) : HumanReportRenderer(out) {}
+
+  void beginSection(const char* key, const __FlashStringHelper* title) override {
+    (void)key;
+    out_.write("=== ");
+    writeText(title);
+    out_.write(" ===\r\n");
+  }
+  void field(const ReportField& field) override {
+    writeLabel(field.label);
+    out_.write(": ");
+    writeValue(field);
+    out_.write("\r\n");
+  }
+  void endSection() override { out_.write("\r\n"); }
+};
+
+// One "section","label","value" row per field; every cell is quoted
+class CsvReportRenderer final : public HumanReportRenderer {
+ public:
+  explicit CsvReportRenderer(ReportSink& out) : HumanReportRenderer(out), title_(nullptr) {}
+
+  void beginSection(const char* key, const __FlashStringHelper* title) override {
+    (void)key;
+    title_ = title;
+  }
+  void field(const ReportField& field) override {
+    out_.write('"');
+    writeText(title_);
+    out_.write("\",\"");
+    writeLabel(field.label);
+    out_.write("\",\"");
+    writeValue(field);
+    out_.write("\"\r\n");
+  }
+  void endSection() override {}
+
+ protected:
+  void writeChar(char c) override {
+    if (c == '"') {
+      out_.write('"');  // RFC 4180: quotes are doubled inside a quoted cell
+    }
+    out_.write(c);
+  }
+
+ private:
+  const __FlashStringHelper* title_;
+};
+
+// <div class='section'> with a two-column table per section (printable page)
+class HtmlReportRenderer final : public HumanReportRenderer {
+ public:
+  explicit HtmlReportRenderer(ReportSink& out) : HumanReportRenderer(out) {}
+
+  void beginSection(const char* key, const __FlashStringHelper* title) override {
+    (void)key;
+    out_.write("<div class='section'><h2>");
+    writeText(title);
+    out_.write("</h2><table>");
+  }
+  void field(const ReportField& field) override {
+    out_.write("<tr><td><b>");
+    writeLabel(field.label);
+    out_.write("</b></td><td>");
+    writeValue(field);
+    out_.write("</td></tr>");
+  }
+  void endSection() override { out_.write("</table></div>"); }
+
+ protected:
+  void writeChar(char c) override {
+    switch (c) {
+      case '&': out_.write("&amp;"); break;
+      case '<': out_.write("&lt;"); break;
+      case '>': out_.write("&gt;"); break;
+      case '"': out_.write("&quot;"); break;
+      case '\'': out_.write("&#39;"); break;
+      default: out_.write(c); break;
+    }
+  }
+};
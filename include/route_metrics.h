@@ -0,0 +1,266 @@
+#pragma once
+
+// Per-route cost accounting for the web server.
+// InstrumentedWebServer wraps every handler registered with on() and records,
+// per route: call count, a latency histogram (esp_timer, microseconds), bytes
+// written to the client, and the change in free internal heap and largest free
+// block across the handler. The table is fixed-size and filled at registration, so
+// recording a request allocates nothing. Disable ENABLE_ROUTE_METRICS to drop
+// the wrapper entirely.
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include "data_writer.h"
+
+template <uint8_t MaxRoutes>
+class RouteMetrics {
+ public:
+  // Upper bounds of the latency buckets; one extra bucket holds everything slower
+  static constexpr uint8_t BUCKET_COUNT = 12;
+  static constexpr uint32_t BUCKET_LIMITS_US[BUCKET_COUNT] = {
+      100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000};
+
+  struct Route {
+    const char* uri;
+    uint32_t calls;
+    uint32_t buckets[BUCKET_COUNT + 1];
+    uint64_t totalUs;
+    uint32_t maxUs;
+    uint64_t bytesSent;
+    int64_t heapDeltaSum;          // free heap after - before, summed
+    int32_t heapDeltaMin;          // worst single call
+    int64_t largestBlockDeltaSum;  // same for the largest free block
+    int32_t largestBlockDeltaMin;
+  };
+
+  struct Sample {
+    int64_t startUs;
+    uint32_t freeHeap;
+    uint32_t largestBlock;
+  };
+
+  RouteMetrics() : count_(0) { memset(routes_, 0, sizeof(routes_)); }
+
+  // uri must stay valid for the server lifetime (routes use string literals).
+  // Returns -1 when the table is full: the route then runs uninstrumented.
+  int16_t add(const char* uri) {
+    for (uint8_t i = 0; i < count_; ++i) {
+      if (strcmp(routes_[i].uri, uri) == 0) {
+        return i;  // same path registered for another method
+      }
+    }
+    if (count_ >= MaxRoutes) {
+      return -1;
+    }
+    routes_[count_].uri = uri;
+    return count_++;
+  }
+
+  static Sample begin() {
+    Sample sample;
+    sample.freeHeap = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    sample.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    sample.startUs = esp_timer_get_time();  // last, so the heap queries are not timed
+    return sample;
+  }
+
+  void end(int16_t index, const Sample& sample, size_t bytesSent) {
+    const uint32_t elapsedUs = static_cast<uint32_t>(esp_timer_get_time() - sample.startUs);
+    const int32_t heapDelta = static_cast<int32_t>(heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)) -
+                              static_cast<int32_t>(sample.freeHeap);
+    const int32_t blockDelta =
+        static_cast<int32_t>(heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)) -
+        static_cast<int32_t>(sample.largestBlock);
+
+    Route& route = routes_[index];
+    uint8_t bucket = 0;
+    while (bucket < BUCKET_COUNT && elapsedUs > BUCKET_LIMITS_US[bucket]) {
+      ++bucket;
+    }
+    ++route.buckets[bucket];
+    if (route.calls == 0 || heapDelta < route.heapDeltaMin) {
+      route.heapDeltaMin = heapDelta;
+    }
+    if (route.calls == 0 || blockDelta < route.largestBlockDeltaMin) {
+      route.largestBlockDeltaMin = blockDelta;
+    }
+    ++route.calls;
+    route.totalUs += elapsedUs;
+    if (elapsedUs > route.maxUs) {
+      route.maxUs = elapsedUs;
+    }
+    route.bytesSent += bytesSent;
+    route.heapDeltaSum += heapDelta;
+    route.largestBlockDeltaSum += blockDelta;
+  }
+
+  uint8_t routeCount() const { return count_; }
+
+  // {"bucket_limits_us":[...],"routes":[...]} members, routes never called are skipped
+  void writeJson(DataWriter& out) const {
+    out.beginArray("bucket_limits_us");
+    for (uint8_t b = 0; b < BUCKET_COUNT; ++b) {
+      out.value(BUCKET_LIMITS_US[b]);
+    }
+    out.endArray();
+    out.field("registered_routes", count_);
+    out.beginArray("routes");
+    for (uint8_t i = 0; i < count_; ++i) {
+      const Route& route = routes_[i];
+      if (route.calls == 0) {
+        continue;
+      }
+      out.beginObject();
+      out.field("uri", route.uri);
+      out.field("calls", route.calls);
+      out.field("total_us", route.totalUs);
+      out.field("avg_us", route.totalUs / route.calls);
+      out.field("max_us", route.maxUs);
+      out.beginArray("histogram");
+      for (uint8_t b = 0; b <= BUCKET_COUNT; ++b) {
+        out.value(route.buckets[b]);
+      }
+      out.endArray();
+      out.field("bytes_sent", route.bytesSent);
+      out.field("heap_delta_sum", route.heapDeltaSum);
+      out.field("heap_delta_min", route.heapDeltaMin);
+      out.field("largest_block_delta_sum", route.largestBlockDeltaSum);
+      out.field("largest_block_delta_min", route.largestBlockDeltaMin);
+      out.endObject();
+    }
+    out.endArray();
+  }
+
+  // Prometheus text exposition format 0.0.4. Sink needs raw(const char*, size_t).
+  template <typename Sink>
+  void writePrometheus(Sink& out) const {
+    char line[192];
+    auto emit = [&](int length) {
+      if (length > 0) {
+        out.raw(line, static_cast<size_t>(length) < sizeof(line) ? static_cast<size_t>(length) : sizeof(line) - 1);
+      }
+    };
+
+    emit(snprintf(line, sizeof(line),
+                  "# HELP esp32diag_http_request_duration_seconds Handler execution time per route\n"
+                  "# TYPE esp32diag_http_request_duration_seconds histogram\n"));
+    for (uint8_t i = 0; i < count_; ++i) {
+      const Route& route = routes_[i];
+      if (route.calls == 0) {
+        continue;
+      }
+      uint32_t cumulative = 0;
+      for (uint8_t b = 0; b < BUCKET_COUNT; ++b) {
+        cumulative += route.buckets[b];
+        emit(snprintf(line, sizeof(line), "esp32diag_http_request_duration_seconds_bucket{route=\"%s\",le=\"%g\"} %u\n",
+                      route.uri, BUCKET_LIMITS_US[b] / 1e6, static_cast<unsigned>(cumulative)));
+      }
+      emit(snprintf(line, sizeof(line), "esp32diag_http_request_duration_seconds_bucket{route=\"%s\",le=\"+Inf\"} %u\n",
+                    route.uri, static_cast<unsigned>(route.calls)));
+      emit(snprintf(line, sizeof(line), "esp32diag_http_request_duration_seconds_sum{route=\"%s\"} %.6f\n", route.uri,
+                    route.totalUs / 1e6));
+      emit(snprintf(line, sizeof(line), "esp32diag_http_request_duration_seconds_count{route=\"%s\"} %u\n", route.uri,
+                    static_cast<unsigned>(route.calls)));
+    }
+
+    writeRouteFamily(out, line, sizeof(line), "esp32diag_http_response_bytes_total", "counter",
+                     "Bytes written to the client per route, headers included", [](const Route& r) { return static_cast<long long>(r.bytesSent); });
+    writeRouteFamily(out, line, sizeof(line), "esp32diag_http_request_duration_max_microseconds", "gauge",
+                     "Slowest call per route in microseconds", [](const Route& r) { return static_cast<long long>(r.maxUs); });
+    writeRouteFamily(out, line, sizeof(line), "esp32diag_http_heap_delta_bytes_sum", "gauge",
+                     "Sum of free internal heap change across calls", [](const Route& r) { return static_cast<long long>(r.heapDeltaSum); });
+    writeRouteFamily(out, line, sizeof(line), "esp32diag_http_heap_delta_bytes_min", "gauge",
+                     "Largest single free heap drop", [](const Route& r) { return static_cast<long long>(r.heapDeltaMin); });
+    writeRouteFamily(out, line, sizeof(line), "esp32diag_http_largest_block_delta_bytes_sum", "gauge",
+                     "Sum of largest free block change across calls",
+                     [](const Route& r) { return static_cast<long long>(r.largestBlockDeltaSum); });
+    writeRouteFamily(out, line, sizeof(line), "esp32diag_http_largest_block_delta_bytes_min", "gauge",
+                     "Largest single largest-free-block drop",
+                     [](const Route& r) { return static_cast<long long>(r.largestBlockDeltaMin); });
+  }
+
+ private:
+  template <typename Sink, typename Getter>
+  void writeRouteFamily(Sink& out, char* line, size_t size, const char* name, const char* type, const char* help,
+                          Getter get) const {
+    int length = snprintf(line, size, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+    if (length > 0) {
+      out.raw(line, static_cast<size_t>(length) < size ? static_cast<size_t>(length) : size - 1);
+    }
+    for (uint8_t i = 0; i < count_; ++i) {
+      const Route& route = routes_[i];
+      if (route.calls == 0) {
+        continue;
+      }
+      length = snprintf(line, size, "%s{route=\"%s\"} %lld\n", name, route.uri, get(route));
+      if (length > 0) {
+        out.raw(line, static_cast<size_t>(length) < size ? static_cast<size_t>(length) : size - 1);
+      }
+    }
+  }
+
+  Route routes_[MaxRoutes];
+  uint8_t count_;
+};
+
+// Server wrapper: handlers registered through on() are timed, and every byte the
+// WebServer writes to the client (status line, headers, chunk framing, body) is
+// added to the current route. Counting happens in the _currentClientWrite()
+// hooks, so send(), send_P() and sendContent() are all covered. Writes that
+// bypass them are not seen: streamFile(), and anything written on
+// server.client() directly (raw downloads, the SSE handshake). Handlers doing
+// so report those bytes with addSentBytes(). SSE events pushed from the loop
+// after the handler has returned belong to no route and are not counted.
+template <typename Server, uint8_t MaxRoutes>
+class InstrumentedWebServer : public Server {
+ public:
+  typedef RouteMetrics<MaxRoutes> Metrics;
+
+  explicit InstrumentedWebServer(int port) : Server(port), bytesSent_(0) {}
+
+  // Pattern routes (UriBraces, UriRegex) go straight to the server: not timed
+  using Server::on;
+  void on(const char* uri, WebServer::THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+  void on(const char* uri, HTTPMethod method, WebServer::THandlerFunction handler) {
+    Server::on(uri, method, instrument(uri, handler));
+  }
+  void on(const char* uri, HTTPMethod method, WebServer::THandlerFunction handler, WebServer::THandlerFunction upload) {
+    Server::on(uri, method, instrument(uri, handler), upload);
+  }
+
+  // Bytes a handler wrote on server.client() itself
+  void addSentBytes(size_t bytes) { bytesSent_ += bytes; }
+
+  const Metrics& metrics() const { return metrics_; }
+
+ protected:
+  size_t _currentClientWrite(const char* data, size_t length) override {
+    const size_t written = Server::_currentClientWrite(data, length);
+    bytesSent_ += written;
+    return written;
+  }
+  size_t _currentClientWrite_P(PGM_P data, size_t length) override {
+    const size_t written = Server::_currentClientWrite_P(data, length);
+    bytesSent_ += written;
+    return written;
+  }
+
+ private:
+  WebServer::THandlerFunction instrument(const char* uri, WebServer::THandlerFunction handler) {
+    const int16_t index = metrics_.add(uri);
+    if (index < 0) {
+      return handler;
+    }
+    return [this, index, handler]() {
+      bytesSent_ = 0;
+      const typename Metrics::Sample sample = Metrics::begin();
+      handler();
+      metrics_.end(index, sample, bytesSent_);
+    };
+  }
+
+  Metrics metrics_;
+  size_t bytesSent_;
+};
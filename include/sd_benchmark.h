@@ -0,0 +1,381 @@
+#pragma once
+
+// SD card storage benchmark, run once per SPI clock by the "sd_bench" job.
+// On one file of fileBytes:
+//   sequential   the whole file written (then closed) and read back with each
+//                block size of SD_BENCH_BLOCKS, in MB/s
+//   random 4 KB  reads, then writes, at random 4 KB-aligned offsets, in IOPS
+//   fsync        512-byte appends each followed by flush() (fflush + fsync),
+//                which is what a data logger pays per record
+// Every single operation (block write/read, random access, flush) is timed
+// with esp_timer and counted in a log2 histogram per kind, so the tail
+// latency shows next to the averages. Results keep the card type and size
+// reported by initSD() for comparison between cards.
+// save() keeps a summary of the last complete run in NVS (largest block
+// sequential rates, random IOPS and fsync p99 per clock), so boards and cards
+// can be compared after a reboot without running the benchmark again. Like
+// every NVS write it must not run on a PSRAM stack: the firmware saves from loop().
+
+#include <Arduino.h>
+#include <FS.h>
+#include <Preferences.h>
+#include <esp_timer.h>
+#include "data_writer.h"
+#include "jitter_monitor.h"
+
+static const uint32_t SD_BENCH_BLOCKS[] = {512, 4096, 16384, 65536};
+static const uint8_t SD_BENCH_BLOCK_COUNT = sizeof(SD_BENCH_BLOCKS) / sizeof(SD_BENCH_BLOCKS[0]);
+
+template <uint8_t MaxClocks>
+class SdBenchmark {
+ public:
+  static const uint32_t RANDOM_BLOCK = 4096;
+  static const uint32_t FSYNC_BLOCK = 512;
+
+  enum Kind : uint8_t { OP_WRITE, OP_READ, OP_RANDOM_READ, OP_RANDOM_WRITE, OP_FSYNC, OP_KINDS };
+
+  struct ClockResult {
+    uint32_t khz;
+    bool mounted;
+    bool complete;  // false: I/O error, the values stop there
+    float writeMBps[SD_BENCH_BLOCK_COUNT];  // 0: block larger than the buffer
+    float readMBps[SD_BENCH_BLOCK_COUNT];
+    float randomReadIops;
+    float randomWriteIops;
+    LogHistogram latency[OP_KINDS];
+  };
+
+  SdBenchmark(uint16_t randomOps, uint16_t fsyncOps)
+      : randomOps_(randomOps), fsyncOps_(fsyncOps), cardSizeMb_(0), fileBytes_(0), startMs_(0), durationMs_(0),
+        count_(0),
+        valid_(false),
+        hasSaved_(false) {
+    cardType_[0] = '\0';
+    memset(&saved_, 0, sizeof(saved_));
+  }
+
+  // Called before the clocks are run: forgets the previous results
+  void begin(const char* cardType, uint64_t cardSizeMb, uint32_t fileBytes) {
+    strlcpy(cardType_, cardType != nullptr ? cardType : "", sizeof(cardType_));
+    cardSizeMb_ = cardSizeMb;
+    fileBytes_ = fileBytes;
+    count_ = 0;
+    durationMs_ = 0;
+    startMs_ = millis();
+    valid_ = false;
+  }
+
+  // Card not mounted at that clock: recorded as such
+  void skipClock(uint32_t khz) {
+    ClockResult* result = addClock(khz);
+    if (result != nullptr) {
+      result->mounted = false;
+    }
+  }
+
+  // fs mounted at khz; buffer of bufferSize bytes. false when stopped or on an I/O error.
+  bool runClock(fs::FS& fs, const char* path, uint32_t khz, uint8_t* buffer, uint32_t bufferSize,
+                bool (*stopping)()) {
+    ClockResult* result = addClock(khz);
+    if (result == nullptr) {
+      return false;
+    }
+    result->mounted = true;
+    for (uint32_t i = 0; i < bufferSize; ++i) {
+      buffer[i] = static_cast<uint8_t>(i * 31 + khz);
+    }
+    for (uint8_t block = 0; block < SD_BENCH_BLOCK_COUNT; ++block) {
+      const uint32_t size = SD_BENCH_BLOCKS[block];
+      if (size > bufferSize || size > fileBytes_) {
+        continue;
+      }
+      if (stopping() || !sequential(fs, path, true, size, buffer, *result, result->writeMBps[block]) ||
+          !sequential(fs, path, false, size, buffer, *result, result->readMBps[block])) {
+        return false;
+      }
+    }
+    if (stopping() || !randomAccess(fs, path, false, buffer, *result, result->randomReadIops) ||
+        !randomAccess(fs, path, true, buffer, *result, result->randomWriteIops) || stopping()) {
+      return false;
+    }
+    result->complete = appendAndSync(fs, path, buffer, *result);
+    return result->complete;
+  }
+
+  void finish() {
+    durationMs_ = millis() - startMs_;
+    valid_ = true;
+  }
+
+  bool valid() const { return valid_; }
+  bool hasSaved() const { return hasSaved_; }
+  uint8_t count() const { return count_; }
+  const ClockResult& clock(uint8_t index) const { return clocks_[index < MaxClocks ? index : 0]; }
+
+  // Summary of the current results written to NVS with the firmware version that measured them
+  bool save(const char* firmware) {
+    if (!valid_) {
+      return false;
+    }
+    Saved record;
+    memset(&record, 0, sizeof(record));
+    record.format = SAVED_FORMAT;
+    strlcpy(record.firmware, firmware, sizeof(record.firmware));
+    memcpy(record.cardType, cardType_, sizeof(record.cardType));
+    record.cardSizeMb = static_cast<uint32_t>(cardSizeMb_);
+    record.fileBytes = fileBytes_;
+    record.durationMs = durationMs_;
+    record.count = count_;
+    for (uint8_t i = 0; i < count_; ++i) {
+      const ClockResult& result = clocks_[i];
+      SavedClock& clock = record.clocks[i];
+      clock.khz = result.khz;
+      clock.mounted = result.mounted;
+      clock.complete = result.complete;
+      for (uint8_t block = 0; block < SD_BENCH_BLOCK_COUNT; ++block) {
+        if (result.writeMBps[block] > 0.0f) {
+          clock.block = SD_BENCH_BLOCKS[block];
+          clock.writeMBps = result.writeMBps[block];
+          clock.readMBps = result.readMBps[block];
+        }
+      }
+      clock.randomReadIops = result.randomReadIops;
+      clock.randomWriteIops = result.randomWriteIops;
+      clock.fsyncP99Us = result.latency[OP_FSYNC].percentileUs(990);
+    }
+    Preferences prefs;
+    if (!prefs.begin(NAMESPACE, false)) {
+      return false;
+    }
+    const bool ok = prefs.putBytes(KEY, &record, sizeof(record)) == sizeof(record);
+    prefs.end();
+    if (ok) {
+      saved_ = record;
+      hasSaved_ = true;
+    }
+    return ok;
+  }
+
+  // Reads the summary saved by an earlier run; ignored when its layout differs (other clock list)
+  void loadSaved() {
+    Preferences prefs;
+    if (!prefs.begin(NAMESPACE, true)) {
+      return;
+    }
+    Saved record;
+    const bool found = prefs.isKey(KEY) && prefs.getBytesLength(KEY) == sizeof(record) &&
+                       prefs.getBytes(KEY, &record, sizeof(record)) == sizeof(record);
+    prefs.end();
+    if (found && record.format == SAVED_FORMAT && record.count <= MaxClocks) {
+      record.firmware[sizeof(record.firmware) - 1] = '\0';
+      record.cardType[sizeof(record.cardType) - 1] = '\0';
+      saved_ = record;
+      hasSaved_ = true;
+    }
+  }
+
+  // {"firmware","card_type","card_size_mb","file_bytes","duration_ms","clocks":[...]} of the saved run
+  void writeSavedJson(DataWriter& out) const {
+    out.field("firmware", saved_.firmware);
+    out.field("card_type", saved_.cardType);
+    out.field("card_size_mb", saved_.cardSizeMb);
+    out.field("file_bytes", saved_.fileBytes);
+    out.field("duration_ms", saved_.durationMs);
+    out.beginArray("clocks");
+    for (uint8_t i = 0; i < saved_.count; ++i) {
+      const SavedClock& clock = saved_.clocks[i];
+      out.beginObject();
+      out.field("khz", clock.khz);
+      out.field("mounted", clock.mounted != 0);
+      if (clock.mounted != 0) {
+        out.field("complete", clock.complete != 0);
+        out.field("block", clock.block);
+        out.fieldFloat("write_mbps", clock.writeMBps, 3);
+        out.fieldFloat("read_mbps", clock.readMBps, 3);
+        out.fieldFloat("random_read_iops", clock.randomReadIops, 1);
+        out.fieldFloat("random_write_iops", clock.randomWriteIops, 1);
+        out.field("fsync_p99_us", clock.fsyncP99Us);
+      }
+      out.endObject();
+    }
+    out.endArray();
+  }
+
+  void writeJson(DataWriter& out) const {
+    static const char* const KIND_NAMES[OP_KINDS] = {"write", "read", "random_read", "random_write", "fsync"};
+    out.field("card_type", cardType_);
+    out.field("card_size_mb", cardSizeMb_);
+    out.field("file_bytes", fileBytes_);
+    out.field("random_block", RANDOM_BLOCK);
+    out.field("random_ops", randomOps_);
+    out.field("fsync_ops", fsyncOps_);
+    out.field("duration_ms", durationMs_);
+    out.beginArray("clocks");
+    for (uint8_t i = 0; i < count_; ++i) {
+      const ClockResult& result = clocks_[i];
+      out.beginObject();
+      out.field("khz", result.khz);
+      out.field("mounted", result.mounted);
+      if (result.mounted) {
+        out.field("complete", result.complete);
+        out.beginArray("sequential");
+        for (uint8_t block = 0; block < SD_BENCH_BLOCK_COUNT; ++block) {
+          if (result.writeMBps[block] <= 0.0f) {
+            continue;
+          }
+          out.beginObject();
+          out.field("block", SD_BENCH_BLOCKS[block]);
+          out.fieldFloat("write_mbps", result.writeMBps[block], 3);
+          out.fieldFloat("read_mbps", result.readMBps[block], 3);
+          out.endObject();
+        }
+        out.endArray();
+        out.fieldFloat("random_read_iops", result.randomReadIops, 1);
+        out.fieldFloat("random_write_iops", result.randomWriteIops, 1);
+        out.beginObject("latency_us");
+        for (uint8_t kind = 0; kind < OP_KINDS; ++kind) {
+          out.beginObject(KIND_NAMES[kind]);
+          result.latency[kind].writeJson(out);
+          out.endObject();
+        }
+        out.endObject();
+      }
+      out.endObject();
+    }
+    out.endArray();
+  }
+
+ private:
+  static constexpr const char* NAMESPACE = "sdbench";
+  static constexpr const char* KEY = "last";
+  static const uint8_t SAVED_FORMAT = 1;
+
+  struct SavedClock {
+    uint32_t khz;
+    uint8_t mounted;
+    uint8_t complete;
+    uint32_t block;  // largest block measured
+    float writeMBps;
+    float readMBps;
+    float randomReadIops;
+    float randomWriteIops;
+    uint32_t fsyncP99Us;
+  };
+
+  struct Saved {
+    uint8_t format;
+    uint8_t count;
+    char firmware[16];
+    char cardType[12];
+    uint32_t cardSizeMb;
+    uint32_t fileBytes;
+    uint32_t durationMs;
+    SavedClock clocks[MaxClocks];
+  };
+
+  ClockResult* addClock(uint32_t khz) {
+    if (count_ >= MaxClocks) {
+      return nullptr;
+    }
+    ClockResult& result = clocks_[count_++];
+    result.khz = khz;
+    result.mounted = false;
+    result.complete = false;
+    memset(result.writeMBps, 0, sizeof(result.writeMBps));
+    memset(result.readMBps, 0, sizeof(result.readMBps));
+    result.randomReadIops = 0;
+    result.randomWriteIops = 0;
+    for (LogHistogram& histogram : result.latency) {
+      histogram.reset();
+    }
+    return &result;
+  }
+
+  // Whole file in blocks of `size`; the rate includes open and close (flush)
+  bool sequential(fs::FS& fs, const char* path, bool write, uint32_t size, uint8_t* buffer, ClockResult& result,
+                  float& mbps) {
+    const int64_t start = esp_timer_get_time();
+    File file = fs.open(path, write ? FILE_WRITE : FILE_READ);
+    if (!file) {
+      return false;
+    }
+    LogHistogram& latency = result.latency[write ? OP_WRITE : OP_READ];
+    uint32_t done = 0;
+    while (done < fileBytes_) {
+      const int64_t opStart = esp_timer_get_time();
+      const size_t moved = write ? file.write(buffer, size) : file.read(buffer, size);
+      latency.record(static_cast<uint32_t>(esp_timer_get_time() - opStart));
+      if (moved != size) {
+        file.close();
+        return false;
+      }
+      done += size;
+    }
+    file.close();
+    const int64_t elapsed = esp_timer_get_time() - start;
+    mbps = elapsed > 0 ? static_cast<float>(static_cast<double>(done) / elapsed) : 0.0f;
+    return true;
+  }
+
+  bool randomAccess(fs::FS& fs, const char* path, bool write, uint8_t* buffer, ClockResult& result, float& iops) {
+    const uint32_t blocks = fileBytes_ / RANDOM_BLOCK;
+    if (blocks == 0) {
+      return true;
+    }
+    File file = fs.open(path, write ? "r+" : FILE_READ);
+    if (!file) {
+      return false;
+    }
+    LogHistogram& latency = result.latency[write ? OP_RANDOM_WRITE : OP_RANDOM_READ];
+    uint32_t x = 0x9E3779B9u ^ result.khz;
+    const int64_t start = esp_timer_get_time();
+    for (uint16_t op = 0; op < randomOps_; ++op) {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      const int64_t opStart = esp_timer_get_time();
+      const bool ok = file.seek((x % blocks) * RANDOM_BLOCK) &&
+                      (write ? file.write(buffer, RANDOM_BLOCK) : file.read(buffer, RANDOM_BLOCK)) == RANDOM_BLOCK;
+      latency.record(static_cast<uint32_t>(esp_timer_get_time() - opStart));
+      if (!ok) {
+        file.close();
+        return false;
+      }
+    }
+    file.close();  // writes: the last dirty sectors reach the card here
+    const int64_t elapsed = esp_timer_get_time() - start;
+    iops = elapsed > 0 ? static_cast<float>(randomOps_ * 1e6 / elapsed) : 0.0f;
+    return true;
+  }
+
+  bool appendAndSync(fs::FS& fs, const char* path, uint8_t* buffer, ClockResult& result) {
+    File file = fs.open(path, FILE_APPEND);
+    if (!file) {
+      return false;
+    }
+    for (uint16_t op = 0; op < fsyncOps_; ++op) {
+      if (file.write(buffer, FSYNC_BLOCK) != FSYNC_BLOCK) {
+        file.close();
+        return false;
+      }
+      const int64_t opStart = esp_timer_get_time();
+      file.flush();
+      result.latency[OP_FSYNC].record(static_cast<uint32_t>(esp_timer_get_time() - opStart));
+    }
+    file.close();
+    return true;
+  }
+
+  uint16_t randomOps_;
+  uint16_t fsyncOps_;
+  char cardType_[12];
+  uint64_t cardSizeMb_;
+  uint32_t fileBytes_;
+  unsigned long startMs_;
+  unsigned long durationMs_;
+  uint8_t count_;
+  bool valid_;
+  bool hasSaved_;
+  Saved saved_;
+  ClockResult clocks_[MaxClocks];
+};
@@ -0,0 +1,299 @@
+#pragma once
+
+// Task stack profiler.
+// Every task created by the firmware reports the deepest stack use seen
+// (stack size - FreeRTOS high-water mark). Job workers repaint the unused part
+// of their stack before each job, so the mark read when the job returns
+// belongs to that routine alone and is recorded under its job type.
+// The profile is kept in NVS (Preferences); at the next boot each stack is
+// allocated from it: peak + safety margin, rounded, clamped, and optionally in
+// PSRAM. Until a name has enough samples its configured size is kept.
+// The profile is stored with the id of the build that measured it and is
+// dropped when another firmware boots: its routines and frames may differ.
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "data_writer.h"
+
+// Value FreeRTOS writes over a new stack (tskSTACK_FILL_BYTE) and counts in uxTaskGetStackHighWaterMark()
+static const uint8_t STACK_FILL_BYTE = 0xa5;
+
+// Refills the free stack of the calling task below the current frame, which
+// resets its high-water mark. Stacks grow down on Xtensa and RISC-V.
+inline void repaintFreeStack() {
+  static const size_t GUARD = 512;  // frames of memset() and of an interrupt taken meanwhile
+  uint8_t* start = pxTaskGetStackStart(nullptr);
+  uint8_t* frame = static_cast<uint8_t*>(__builtin_frame_address(0));
+  if (start != nullptr && frame > start + GUARD) {
+    memset(start, STACK_FILL_BYTE, static_cast<size_t>(frame - start) - GUARD);
+  }
+}
+
+inline uint32_t stackPeakBytes(TaskHandle_t task, uint32_t stackSize) {
+  const uint32_t unused = uxTaskGetStackHighWaterMark(task);  // bytes on ESP-IDF
+  return unused < stackSize ? stackSize - unused : stackSize;
+}
+
+// Stack memory for xTaskCreateStatic*(): PSRAM when requested and allowed by
+// the SDK, internal RAM otherwise (or nullptr). A PSRAM stack is only for tasks
+// that never write flash or DMA from stack buffers: it is unreachable while
+// the flash cache is disabled.
+inline StackType_t* allocateStack(size_t bytes, bool psramStack, bool* inPsram) {
+  *inPsram = false;
+#if CONFIG_SPIRAM_ALLOW_STACK_EXTERNAL_MEMORY
+  if (psramStack && psramFound()) {
+    void* stack = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (stack != nullptr) {
+      *inPsram = true;
+      return static_cast<StackType_t*>(stack);
+    }
+  }
+#else
+  (void)psramStack;
+#endif
+  return static_cast<StackType_t*>(heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+}
+
+// xTaskCreatePinnedToCore() with the stack optionally taken from PSRAM (see
+// allocateStack()). Falls back to a regular internal RAM task.
+inline bool createTask(TaskFunction_t function, const char* name, uint32_t stackSize, void* parameters,
+                       UBaseType_t priority, TaskHandle_t* handle, BaseType_t core, bool psramStack,
+                       bool* stackInPsram = nullptr) {
+  if (stackInPsram != nullptr) {
+    *stackInPsram = false;
+  }
+#if CONFIG_SPIRAM_ALLOW_STACK_EXTERNAL_MEMORY
+  if (psramStack && psramFound()) {
+    StackType_t* stack = static_cast<StackType_t*>(heap_caps_malloc(stackSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    StaticTask_t* tcb =
+        static_cast<StaticTask_t*>(heap_caps_malloc(sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    TaskHandle_t task = nullptr;
+    if (stack != nullptr && tcb != nullptr) {
+      task = xTaskCreateStaticPinnedToCore(function, name, stackSize, parameters, priority, stack, tcb, core);
+    }
+    if (task != nullptr) {
+      if (handle != nullptr) {
+        *handle = task;
+      }
+      if (stackInPsram != nullptr) {
+        *stackInPsram = true;
+      }
+      return true;
+    }
+    heap_caps_free(stack);
+    heap_caps_free(tcb);
+  }
+#else
+  (void)psramStack;
+#endif
+  return xTaskCreatePinnedToCore(function, name, stackSize, parameters, priority, handle, core) == pdPASS;
+}
+
+struct StackProfileSettings {
+  uint8_t marginPercent;
+  uint32_t minMargin;
+  uint32_t minSamples;
+  uint32_t minStack;
+  uint32_t maxStack;
+};
+
+template <uint8_t MaxEntries>
+class StackProfile {
+ public:
+  static const uint8_t NAME_LENGTH = 16;
+  static const uint8_t BUILD_ID_LENGTH = 17;  // 16 characters, e.g. the start of the ELF SHA-256
+
+  struct Entry {
+    char name[NAME_LENGTH];
+    uint32_t stackSize;  // allocated this boot, 0 for job types (they run on the worker stacks)
+    uint32_t peak;       // deepest use ever seen, kept across boots
+    uint32_t samples;
+    bool inPsram;
+  };
+
+  explicit StackProfile(const StackProfileSettings& settings)
+      : settings_(settings), count_(0), dirty_(false), discarded_(false) {
+    memset(entries_, 0, sizeof(entries_));
+    buildId_[0] = '\0';
+  }
+
+  // Reads the saved profile if it was measured by buildId; a profile from
+  // another build is ignored and overwritten at the next save()
+  void load(const char* buildId) {
+    strlcpy(buildId_, buildId, BUILD_ID_LENGTH);
+    Preferences prefs;
+    if (!prefs.begin(NAMESPACE, true)) {
+      return;
+    }
+    char savedId[BUILD_ID_LENGTH] = {0};
+    if (prefs.isKey(BUILD_KEY)) {
+      prefs.getString(BUILD_KEY, savedId, sizeof(savedId));
+    }
+    if (strcmp(savedId, buildId_) != 0) {
+      discarded_ = prefs.isKey(KEY);
+      dirty_ = discarded_;
+      prefs.end();
+      return;
+    }
+    Stored stored[MaxEntries];
+    const size_t length = prefs.getBytes(KEY, stored, sizeof(stored));
+    prefs.end();
+    for (size_t i = 0; i < length / sizeof(Stored); ++i) {
+      stored[i].name[NAME_LENGTH - 1] = '\0';
+      Entry* entry = find(stored[i].name, true);
+      if (entry != nullptr) {
+        entry->peak = stored[i].peak;
+        entry->samples = stored[i].samples;
+      }
+    }
+  }
+
+  // Called from loop() only: NVS writes must not run on a PSRAM stack
+  bool save() {
+    if (!dirty_) {
+      return true;
+    }
+    Stored stored[MaxEntries];
+    memset(stored, 0, sizeof(stored));
+    for (uint8_t i = 0; i < count_; ++i) {
+      memcpy(stored[i].name, entries_[i].name, NAME_LENGTH);
+      stored[i].peak = entries_[i].peak;
+      stored[i].samples = entries_[i].samples;
+    }
+    Preferences prefs;
+    if (!prefs.begin(NAMESPACE, false)) {
+      return false;
+    }
+    const bool ok = prefs.putBytes(KEY, stored, count_ * sizeof(Stored)) == count_ * sizeof(Stored) &&
+                    prefs.putString(BUILD_KEY, buildId_) == strlen(buildId_);
+    prefs.end();
+    dirty_ = !ok;
+    return ok;
+  }
+
+  // Forgets every measurement (sizes go back to the configured ones at the next boot)
+  void reset() {
+    for (uint8_t i = 0; i < count_; ++i) {
+      entries_[i].peak = 0;
+      entries_[i].samples = 0;
+    }
+    Preferences prefs;
+    if (prefs.begin(NAMESPACE, false)) {
+      prefs.remove(KEY);
+      prefs.end();
+    }
+    dirty_ = false;
+  }
+
+  void record(const char* name, uint32_t peakBytes) {
+    Entry* entry = find(name, true);
+    if (entry == nullptr || peakBytes == 0) {
+      return;
+    }
+    ++entry->samples;
+    if (peakBytes > entry->peak) {
+      entry->peak = peakBytes;
+      dirty_ = true;
+    } else if (entry->samples <= settings_.minSamples) {
+      dirty_ = true;  // persist until the entry is trusted
+    }
+  }
+
+  void setAllocated(const char* name, uint32_t stackSize, bool inPsram) {
+    Entry* entry = find(name, true);
+    if (entry != nullptr) {
+      entry->stackSize = stackSize;
+      entry->inPsram = inPsram;
+    }
+  }
+
+  uint32_t stackSize(const char* name) const {
+    const Entry* entry = find(name);
+    return entry != nullptr ? entry->stackSize : 0;
+  }
+
+  bool learned(const char* name) const {
+    const Entry* entry = find(name);
+    return entry != nullptr && entry->samples >= settings_.minSamples && entry->peak > 0;
+  }
+
+  // Learned peak + margin, or configuredSize while the name is not learned yet
+  uint32_t recommended(const char* name, uint32_t configuredSize) const {
+    const Entry* entry = find(name);
+    return learned(name) ? sizeFor(entry->peak) : configuredSize;
+  }
+
+  uint32_t sizeFor(uint32_t peak) const {
+    const uint32_t percent = peak * settings_.marginPercent / 100;
+    uint32_t size = peak + (percent > settings_.minMargin ? percent : settings_.minMargin);
+    size = (size + 255) & ~255UL;
+    if (size < settings_.minStack) {
+      size = settings_.minStack;
+    }
+    return size > settings_.maxStack ? settings_.maxStack : size;
+  }
+
+  // "tasks":[...] members; the size to use at the next boot comes from recommendedSize(name)
+  template <typename RecommendedSize>
+  void writeJson(DataWriter& out, RecommendedSize recommendedSize) const {
+    out.field("build_id", buildId_);
+    out.field("stale_profile_dropped", discarded_);
+    out.field("margin_percent", settings_.marginPercent);
+    out.field("min_margin", settings_.minMargin);
+    out.field("min_samples", settings_.minSamples);
+    out.beginArray("tasks");
+    for (uint8_t i = 0; i < count_; ++i) {
+      const Entry& entry = entries_[i];
+      out.beginObject();
+      out.field("name", entry.name);
+      if (entry.stackSize > 0) {
+        out.field("stack_size", entry.stackSize);
+        out.field("in_psram", entry.inPsram);
+        if (entry.peak > 0) {
+          out.field("free_min", entry.stackSize > entry.peak ? entry.stackSize - entry.peak : 0);
+        }
+      }
+      out.field("peak", entry.peak);
+      out.field("samples", entry.samples);
+      out.field("learned", learned(entry.name));
+      out.field("recommended", recommendedSize(entry.name));
+      out.endObject();
+    }
+    out.endArray();
+  }
+
+ private:
+  static constexpr const char* NAMESPACE = "stackprof";
+  static constexpr const char* KEY = "entries";
+  static constexpr const char* BUILD_KEY = "build";
+
+  struct Stored {
+    char name[NAME_LENGTH];
+    uint32_t peak;
+    uint32_t samples;
+  };
+
+  Entry* find(const char* name, bool create) {
+    for (uint8_t i = 0; i < count_; ++i) {
+      if (strncmp(entries_[i].name, name, NAME_LENGTH) == 0) {
+        return &entries_[i];
+      }
+    }
+    if (!create || count_ >= MaxEntries) {
+      return nullptr;
+    }
+    strlcpy(entries_[count_].name, name, NAME_LENGTH);
+    return &entries_[count_++];
+  }
+  const Entry* find(const char* name) const { return const_cast<StackProfile*>(this)->find(name, false); }
+
+  StackProfileSettings settings_;
+  Entry entries_[MaxEntries];
+  char buildId_[BUILD_ID_LENGTH];
+  uint8_t count_;
+  bool dirty_;
+  bool discarded_;  // a profile from another build was found at load()
+};
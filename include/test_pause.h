@@ -0,0 +1,12 @@
+#pragma once
+
+// Pauses of the hardware tests, defined in main.cpp next to the job scheduler.
+// Inside a job, testPause() ends early and returns false once the job is
+// cancelled or reaches its deadline (JobContext::sleep); the test then puts
+// its pins back at rest and reports "Test cancelled". Outside a job (direct
+// HTTP handlers) it is a plain delay() and testStopping() stays false.
+
+#include <Arduino.h>
+
+bool testPause(uint32_t ms);
+bool testStopping();
@@ -0,0 +1,1474 @@
+/*
+ * WEB_ASSETS_GZ.H - Gzip-compressed static web assets
+ * Auto-generated by tools/minify_web.py - do not edit manually.
+ */
+
+#ifndef WEB_ASSETS_GZ_H
+#define WEB_ASSETS_GZ_H
+
+#include <Arduino.h>
+#include <pgmspace.h>
+
+#define WEB_ASSET_APP_CSS_HASH "e20690069bf3da05"
+static const char WEB_ASSET_APP_CSS_ETAG[] = "\"e20690069bf3da05\"";
+static const char WEB_ASSET_APP_CSS_PLAIN_ETAG[] = "\"e20690069bf3da05-id\"";
+static const size_t WEB_ASSET_APP_CSS_GZ_LEN = 2738;
+static const uint8_t PROGMEM WEB_ASSET_APP_CSS_GZ[] = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xe5,0x5a,0x5b,0x8f,0xab,0xba,
+  0x15,0xfe,0x2b,0x48,0xa3,0xad,0x09,0x15,0x44,0x86,0x40,0xae,0xaa,0x74,0xaa,0xbe,
+  0xf4,0xbc,0xf4,0xa1,0x55,0xa5,0x56,0xd5,0x79,0x30,0x60,0x12,0x77,0x08,0x20,0x43,
+  0xe6,0xb2,0xa3,0xfc,0xf7,0xb3,0x6c,0x63,0x30,0xc6,0x61,0x32,0xfb,0x9c,0xaa,0x0f,
+  0xdd,0x97,0x99,0x70,0xc9,0xf2,0xba,0x7c,0xeb,0x6a,0xff,0xe1,0x7a,0xc6,0xec,0x48,
+  0xcb,0x3d,0x3a,0xd4,0x38,0xcb,0x68,0x79,0x84,0x4f,0x49,0xf5,0xee,0x37,0xf4,0x3b,
+  0xbf,0x48,0x2a,0x96,0x11,0xe6,0xc3,0x9d,0x5b,0x52,0x65,0x1f,0xd7,0xbc,0x2a,0x5b,
+  0x3f,0xc7,0x67,0x5a,0x7c,0xec,0x9f,0xff,0x4e,0x8e,0x15,0x71,0xfe,0xf1,0xf3,0xb3,
+  0xf7,0xb7,0x2a,0xa9,0xda,0xca,0x7b,0xfe,0x0b,0x29,0x5e,0x49,0x4b,0x53,0xec,0xfc,
+  0x95,0x5c,0xc8,0xb3,0xf7,0x27,0x46,0x71,0xe1,0x35,0xb8,0x6c,0xfc,0x86,0x30,0x9a,
+  0x1f,0x12,0x9c,0xbe,0x1c,0x59,0x75,0x29,0xb3,0xfd,0x53,0xbe,0xcd,0x71,0x9e,0x1e,
+  0xce,0xb4,0xf4,0x4f,0x84,0x1e,0x4f,0xed,0x3e,0x40,0xe8,0xf5,0xa4,0x31,0xd2,0x7d,
+  0xf2,0xdb,0xaa,0xde,0xc7,0xdb,0xfa,0xfd,0xb6,0x4c,0x61,0x7d,0x4c,0x4b,0xc2,0x80,
+  0xef,0x77,0xff,0x8d,0x66,0xed,0x69,0x1f,0x44,0x08,0xd5,0xef,0x07,0x25,0x88,0x83,
+  0x2f,0x6d,0x35,0x5e,0x08,0xe7,0x09,0x2c,0xd4,0xc9,0xc2,0x70,0x46,0x2f,0x0d,0x50,
+  0xaf,0x5e,0x09,0xcb,0x8b,0xea,0x6d,0xff,0x4a,0x1b,0x9a,0x14,0x44,0xe7,0x24,0xc5,
+  0x45,0xba,0x10,0xec,0x38,0xbe,0xc3,0x97,0x76,0x6f,0xcb,0x13,0xc1,0xf0,0xfd,0xab,
+  0x46,0xb9,0x00,0x4e,0x30,0xf3,0x8f,0x9c,0x24,0x29,0xdb,0x45,0xb0,0x8a,0x33,0x72,
+  0xf4,0x9e,0x50,0x1e,0x6c,0x42,0xec,0xa0,0x6f,0xde,0x53,0x40,0xc2,0xdd,0x2a,0x71,
+  0x80,0xd4,0x37,0xf7,0x90,0x56,0x45,0xc5,0x80,0x9f,0x3c,0xef,0x85,0x8c,0xea,0x77,
+  0x27,0x08,0x81,0xfd,0x96,0xbc,0xb7,0x3e,0x2e,0xe8,0xb1,0xdc,0xa7,0x40,0x8b,0xb0,
+  0x43,0x5d,0x35,0xb4,0xa5,0x55,0xb9,0xcf,0xe9,0x3b,0xc9,0x0e,0x5c,0x09,0xe8,0x50,
+  0x90,0xbc,0x85,0x5f,0x4c,0x70,0x89,0x0e,0xdf,0x7d,0x5a,0x66,0xe4,0x9d,0x6b,0xae,
+  0xb3,0xdb,0x09,0x67,0x20,0x12,0x72,0x80,0x67,0x67,0x05,0x84,0x1d,0x76,0x4c,0xf0,
+  0x02,0x79,0xfc,0xef,0x32,0x72,0x3d,0xe4,0x88,0x25,0xd7,0xc6,0x93,0x30,0xee,0x25,
+  0x74,0x4e,0x81,0xb4,0x33,0x60,0x80,0xec,0x97,0xbb,0x98,0x9c,0x3b,0xe5,0x02,0x0e,
+  0xda,0xb6,0x3a,0xef,0x03,0xe0,0x57,0xbc,0xf1,0x26,0xb5,0xb5,0x46,0x9c,0xb1,0x16,
+  0x98,0xf6,0x9b,0x1a,0xa7,0xc2,0x78,0xcb,0x15,0xbc,0x94,0xd1,0xa6,0x2e,0xf0,0xc7,
+  0x9e,0x96,0x5c,0x55,0x7e,0x52,0x54,0xe9,0x4b,0xbf,0xcc,0x32,0x3d,0xd1,0xda,0x6f,
+  0x3f,0x6a,0x32,0x5a,0x0e,0x56,0xd3,0x69,0xc7,0x40,0xdb,0x46,0x46,0xb1,0x24,0x14,
+  0x02,0xc2,0x1e,0x2a,0xbe,0x72,0xfb,0x01,0x14,0xfa,0x15,0xf0,0xb5,0x65,0x80,0x3d,
+  0xa9,0x45,0x5c,0x14,0xce,0x32,0x6c,0x86,0x87,0x4b,0x20,0x8b,0xc1,0xee,0xd9,0xb5,
+  0xff,0x6a,0x0c,0x4a,0xa7,0x5c,0xf9,0x3e,0x79,0x05,0x23,0x34,0xfb,0xb2,0x2a,0xc9,
+  0x6d,0x89,0xd3,0x94,0x34,0x8d,0xcf,0xaa,0xb7,0xab,0x62,0x25,0x2f,0x08,0xe8,0x00,
+  0x7e,0xf8,0x6f,0x0c,0xd7,0x7b,0xfe,0xe3,0x20,0xac,0xe7,0xd3,0x96,0x9c,0x1b,0x65,
+  0xc3,0xff,0x5c,0x9a,0x96,0xe6,0x1f,0x3e,0xc7,0x2d,0xdc,0x51,0xb7,0x8f,0xf0,0x95,
+  0xb5,0x52,0xa2,0x94,0x7b,0xcb,0xd5,0x3c,0xc8,0x10,0x2a,0x3c,0x73,0x13,0xa2,0x01,
+  0x0b,0x8c,0x14,0xb8,0xa5,0xaf,0x03,0x53,0x05,0x4e,0x48,0x71,0x35,0xac,0x31,0x3c,
+  0xa5,0xe5,0xcb,0xb5,0x83,0x1d,0x5a,0x27,0xeb,0x2c,0x92,0x40,0xcb,0x48,0x5a,0x31,
+  0x2c,0x28,0x02,0x90,0x09,0xe3,0x7a,0x95,0x4f,0xfa,0x4b,0xbf,0xca,0xf3,0x86,0xb4,
+  0x9c,0x81,0x11,0xb9,0x2f,0xab,0xad,0x21,0xf5,0xf0,0xea,0xe6,0xf6,0xd3,0x0b,0xf9,
+  0xc8,0x19,0x3e,0x93,0xc6,0xc9,0xc1,0x10,0x3f,0x97,0xd7,0x9c,0x55,0xe7,0xfe,0x0d,
+  0x74,0x10,0x36,0xcb,0x2b,0x76,0xde,0x8b,0x4f,0x20,0x2f,0xf9,0xd7,0xc2,0x0f,0x10,
+  0x77,0xc2,0xb6,0xea,0x5f,0x0c,0xec,0x2f,0x22,0xf7,0x76,0x5b,0x36,0x2d,0x6e,0x2f,
+  0x0d,0xf7,0x0d,0x88,0x45,0x6d,0xc5,0xae,0x56,0x04,0xc9,0xf0,0xc1,0xb1,0xd3,0x79,
+  0x3d,0xff,0x38,0x8e,0x12,0x31,0xfa,0xa6,0x80,0x26,0x5d,0x2e,0x86,0x57,0x70,0x49,
+  0xcf,0x52,0x77,0xf5,0xa5,0x68,0x88,0x13,0x36,0x0e,0x2d,0x73,0x5a,0x82,0xe5,0xc7,
+  0x3e,0x88,0xa4,0x9f,0xa5,0x17,0xc6,0x40,0x2d,0x7f,0xe6,0x66,0xe8,0x79,0xab,0x04,
+  0x27,0x7a,0x34,0x79,0x0a,0x50,0xb2,0xdb,0x06,0x26,0x89,0x10,0x04,0x77,0xba,0x67,
+  0x1e,0xbf,0xb1,0x42,0xca,0x77,0x83,0xb5,0x17,0x6c,0x63,0x2f,0x08,0x77,0xde,0x92,
+  0xfb,0xaf,0x22,0x9d,0xe7,0x13,0xda,0x24,0x8f,0xe0,0x8f,0x9d,0xb6,0x7c,0x66,0xd0,
+  0x0e,0x57,0x3b,0x6f,0xbd,0xe5,0xff,0x38,0x69,0xcd,0x68,0x42,0xe6,0x2b,0xc4,0x36,
+  0x1e,0xd3,0x06,0x6b,0xdc,0x62,0xed,0x0a,0x2d,0xd7,0x60,0x85,0x12,0xbf,0x8e,0xfd,
+  0x65,0xc6,0x1b,0xa2,0x3e,0x82,0x8b,0x68,0xcf,0x83,0x87,0xe1,0x5d,0x7d,0x5a,0x70,
+  0x44,0x26,0x00,0xe2,0x7e,0xd2,0x96,0x57,0x75,0x3b,0x56,0x81,0x54,0x93,0x5a,0x08,
+  0xc2,0x75,0x14,0x7a,0x61,0x10,0x7a,0xcb,0x20,0x76,0x3b,0xfb,0x0a,0x84,0x1a,0xb6,
+  0xe6,0xca,0xd0,0x43,0x34,0x98,0xad,0x81,0xcf,0x1d,0xb4,0x27,0x01,0xcf,0x0c,0x2d,
+  0xab,0x66,0xe2,0xce,0x23,0x6d,0xab,0x48,0x3f,0x0a,0xbb,0x2b,0xd7,0xa3,0x25,0x78,
+  0x19,0x87,0x0a,0x3c,0xea,0x1f,0x87,0x71,0xec,0xa9,0xff,0xcb,0xc0,0xed,0xc5,0xdd,
+  0x9f,0x78,0xd6,0xba,0xce,0xc8,0xb8,0x72,0xef,0x38,0x10,0xd0,0x76,0xc7,0x1c,0x71,
+  0x6c,0x86,0xbd,0xc1,0x35,0x1a,0xd1,0xb0,0x20,0x38,0x31,0x0f,0x37,0x73,0x2b,0x46,
+  0xae,0x45,0xd0,0xb5,0x85,0x6c,0x3c,0x08,0xcb,0x05,0x8d,0xcc,0x14,0x04,0xab,0x16,
+  0x18,0xd2,0x7d,0xf3,0x46,0xdb,0xf4,0x64,0xfa,0xac,0x40,0x90,0x25,0xc4,0x1a,0xe8,
+  0x11,0xf9,0x40,0x00,0xc1,0x12,0x33,0x35,0xf2,0x8e,0xbc,0x90,0xe1,0x53,0xb3,0xfa,
+  0xc4,0xcc,0x3c,0x28,0x0e,0x1a,0xbd,0xd4,0x35,0x61,0x29,0x6e,0xc8,0x34,0xe1,0x6d,
+  0x2d,0x01,0x5d,0xc9,0x20,0x03,0xa2,0x58,0x51,0x07,0xad,0x50,0x15,0xea,0xa3,0x8e,
+  0x0d,0x95,0x9f,0x61,0x3a,0x74,0x7f,0x03,0x66,0xc3,0xf8,0x13,0xd0,0xae,0x3a,0x06,
+  0x0d,0xd0,0x0e,0xa2,0x3c,0x00,0xc8,0xf8,0x51,0x7c,0x44,0x1a,0x5d,0x0b,0xee,0x54,
+  0x02,0x53,0xe9,0x4c,0x14,0x59,0x0f,0x22,0x7a,0xed,0xca,0xda,0x11,0x20,0xd3,0x2b,
+  0x3f,0x1c,0xc7,0x72,0x99,0x8c,0x1c,0x08,0x5d,0xcd,0x41,0x2b,0x2e,0x21,0xc8,0xdd,
+  0x96,0x2d,0x4e,0x54,0xd0,0xba,0xea,0x26,0xb5,0x7d,0x3d,0x6a,0x46,0xef,0x2b,0x41,
+  0xd4,0xd7,0xba,0x1a,0xa8,0x21,0x29,0xff,0xda,0x48,0x3e,0x6e,0x40,0xc3,0xf8,0xbc,
+  0x48,0xe8,0xf9,0xd5,0x50,0xde,0x15,0x62,0xe2,0x96,0x8e,0x1d,0x4b,0x50,0x1a,0x29,
+  0x48,0x04,0xa0,0xc8,0x34,0x68,0xb0,0xe5,0x75,0xe1,0x58,0x79,0xea,0x11,0xf7,0xca,
+  0x8e,0xd9,0xce,0xd6,0xf6,0xf0,0xb2,0x9e,0x84,0x17,0x41,0x6b,0x8d,0xa6,0x85,0x26,
+  0xac,0x25,0x30,0xb5,0xb2,0xf0,0xd1,0x2f,0xe6,0x9c,0xc2,0xeb,0xd8,0xd2,0x86,0xe8,
+  0x68,0xe4,0x6e,0x01,0xe0,0x4c,0xf3,0xb7,0xb9,0x60,0x11,0x20,0xa3,0x7c,0xdd,0x28,
+  0x37,0x1f,0x58,0x07,0xc6,0xb6,0x26,0x73,0xb1,0xce,0xdc,0x4a,0x31,0x27,0x0b,0x7c,
+  0x55,0xad,0x09,0x5c,0x4b,0x35,0x8f,0x98,0x0b,0x8c,0xaa,0x56,0xd4,0x68,0x50,0x34,
+  0x54,0xd0,0x3c,0xd0,0xac,0x07,0x07,0xbf,0x38,0xf0,0x1f,0x3e,0x30,0x5d,0x73,0xcd,
+  0x02,0x8c,0x8a,0xcb,0xb9,0x6c,0x20,0x88,0xd5,0x04,0xb7,0x0b,0xde,0xdc,0xf8,0x39,
+  0x6d,0x3d,0x68,0x56,0x00,0xa5,0x8b,0x70,0x0b,0xd2,0x78,0x41,0xce,0x5c,0x57,0x0a,
+  0xb7,0xe6,0xc9,0x51,0x50,0xe6,0x82,0x3f,0xd2,0xad,0xc8,0xf6,0x48,0x74,0x2b,0x80,
+  0xc0,0xae,0x55,0x51,0xa0,0x13,0x08,0xb4,0x45,0x24,0x09,0x3a,0x9e,0xb4,0x9a,0xaa,
+  0xa0,0x19,0x54,0x11,0x21,0xd9,0xe6,0xe8,0x53,0x04,0xde,0x43,0x99,0x67,0xd7,0x3a,
+  0xe2,0x90,0xe8,0xc5,0x99,0x45,0x20,0xf8,0x82,0xeb,0x34,0xd0,0xb9,0x91,0x45,0xb0,
+  0x44,0xa1,0x81,0x46,0x61,0x99,0xc8,0x16,0x1b,0x24,0x22,0xf9,0xc2,0xe1,0x34,0x25,
+  0x29,0xd9,0x47,0x35,0x74,0xc7,0xd1,0xb4,0xf4,0xe6,0x48,0x9a,0x03,0xad,0xad,0xe6,
+  0xff,0x5a,0x82,0x19,0xe3,0x94,0xab,0x7f,0x75,0x57,0x63,0xaf,0xb8,0xb8,0xe8,0xbd,
+  0x15,0x68,0x65,0x0b,0x0b,0x8e,0x81,0x3b,0x41,0x65,0x82,0xb3,0x23,0xb1,0x17,0xcc,
+  0xa3,0x5a,0x2b,0x9a,0x00,0xc3,0x70,0xc9,0xe5,0x76,0x6b,0xa0,0x9e,0xab,0xc7,0x12,
+  0x31,0xe3,0x66,0x2e,0x41,0x68,0xd5,0x81,0x60,0xcd,0x6f,0x2e,0xa2,0xaf,0x78,0x04,
+  0xda,0x5d,0xd5,0xfc,0x84,0xe2,0xdd,0x7a,0xbd,0x1b,0x65,0xca,0x19,0x50,0x9a,0x65,
+  0xb5,0x5c,0xf6,0x0d,0xb3,0x12,0x84,0x7f,0xc8,0xa3,0xe2,0x1d,0x41,0x89,0xf7,0x94,
+  0xed,0x36,0x1b,0xb4,0x7e,0x74,0xd9,0x30,0x82,0x35,0xe3,0xad,0x17,0x04,0xfa,0xb2,
+  0x19,0x24,0xc4,0xc7,0xa6,0x0e,0x5d,0x19,0xff,0x94,0xa5,0xe1,0x3a,0x7c,0x7c,0xd5,
+  0x51,0x9d,0xdf,0x2d,0xca,0xe1,0xf3,0xd0,0xa0,0x43,0xb8,0x03,0xfc,0xde,0xee,0x82,
+  0x24,0x7c,0x74,0xc9,0x51,0x49,0x08,0x4b,0x6a,0x05,0x51,0x20,0xaa,0xe0,0x70,0xbe,
+  0x22,0x32,0x60,0x26,0x06,0x14,0x13,0x2f,0x1c,0x17,0x42,0x5d,0x78,0xe6,0x19,0xdf,
+  0x12,0xa0,0xcc,0x96,0x58,0x2c,0x6a,0xf5,0x80,0xc9,0x88,0x25,0xdc,0x5a,0xf3,0x9b,
+  0xb5,0xd8,0x87,0xf4,0x36,0x2d,0x4a,0x87,0x31,0xd4,0x89,0x66,0x19,0x29,0x85,0x3e,
+  0xbe,0x10,0xe7,0x22,0x6b,0x9c,0x33,0xb9,0x5a,0xcd,0xc4,0xb8,0xce,0x06,0xfb,0xae,
+  0x50,0xb9,0xdf,0x3d,0xdc,0x0f,0xae,0xf7,0x34,0x21,0x08,0xfb,0x35,0x03,0x97,0x67,
+  0x1f,0xbf,0xcf,0xe4,0x4c,0x92,0xfc,0x72,0x0c,0x10,0x24,0x65,0x18,0xb8,0x43,0xf2,
+  0x6b,0x98,0x97,0xf4,0x04,0xec,0xef,0xd0,0xfb,0xaa,0xe3,0x0a,0x8a,0xd2,0x77,0xef,
+  0x50,0xfc,0x72,0x04,0x92,0x24,0x45,0x10,0xb2,0x90,0xac,0x59,0x75,0x64,0x7c,0x40,
+  0x93,0xe0,0xc7,0xd8,0x14,0x09,0xde,0x7b,0x4a,0x93,0x2c,0x26,0xc8,0xb5,0x55,0x05,
+  0xdd,0x1c,0x25,0xe4,0x79,0xce,0xc0,0xb5,0xde,0xdd,0xdb,0xdb,0x33,0x1d,0x52,0xaa,
+  0x4f,0xb4,0xfa,0x91,0x28,0x16,0xac,0x9d,0x89,0xa8,0x56,0x7b,0xb9,0x72,0x5a,0x14,
+  0xd7,0x61,0xb4,0xfc,0xcd,0xc6,0xb1,0x16,0x0d,0x44,0xc1,0xef,0x40,0xf9,0xef,0xa4,
+  0x97,0x84,0xa6,0x7e,0x42,0xbe,0x53,0xc2,0x16,0x50,0xd1,0x73,0xe2,0xcb,0xd0,0x0b,
+  0xdc,0xc3,0x8c,0x9a,0x76,0x68,0x16,0x1e,0x9f,0x55,0xa6,0x77,0x66,0x23,0x77,0x3a,
+  0x53,0x1e,0xe2,0x86,0x10,0x88,0x64,0xaa,0x9d,0x76,0x6e,0xe1,0x9d,0x90,0x9b,0x62,
+  0x96,0x7d,0xd6,0x7a,0x44,0x7a,0xeb,0xa1,0x0d,0xd8,0x03,0x39,0x91,0xfc,0xe1,0x02,
+  0xd0,0x1a,0x2b,0x82,0x99,0xa8,0xd9,0xf1,0xab,0x3a,0x4d,0x4b,0x3d,0x36,0x1b,0x01,
+  0x47,0xb3,0x91,0x99,0x42,0xcf,0x1e,0xf7,0x62,0x31,0xfa,0x2f,0x2a,0xcc,0xf5,0x30,
+  0x37,0x46,0x14,0x2a,0x52,0xf8,0xd7,0x5a,0xfa,0x55,0xaf,0x20,0x4b,0xdd,0xa9,0x74,
+  0xde,0x8d,0xbc,0x94,0x26,0x7b,0xa9,0xcc,0x51,0xe4,0x50,0x3c,0x35,0x35,0x2d,0x9d,
+  0xa0,0x71,0x24,0x0a,0xef,0xcc,0x1f,0xef,0x62,0x20,0x1a,0x4d,0xf4,0x38,0xad,0x2b,
+  0xfa,0xa6,0x45,0x7e,0x56,0xb5,0x20,0xfe,0x82,0x23,0xda,0xbd,0x89,0x39,0xdf,0xe4,
+  0xd9,0x6a,0x2d,0x9f,0xf6,0x53,0xc7,0x82,0x27,0x8f,0x71,0xdb,0xf0,0x40,0x9c,0x0a,
+  0xf2,0x38,0xdf,0xa9,0xd8,0xe2,0xda,0x32,0xfd,0x74,0x63,0xc4,0x9c,0x6a,0x8c,0x7a,
+  0x2f,0xa3,0x70,0x30,0x8b,0x90,0xc8,0x02,0x3c,0xeb,0x50,0x6a,0x34,0x81,0xdb,0xb8,
+  0x23,0x31,0x97,0x5f,0x48,0x3f,0x59,0x90,0x63,0x12,0x7b,0x4f,0x78,0x93,0xaf,0x32,
+  0xd4,0x47,0x60,0xb4,0x8e,0xf3,0x68,0x3d,0xb7,0x65,0xa3,0x57,0xa1,0x91,0xb1,0x3e,
+  0x61,0xac,0x7a,0x28,0x66,0xe7,0x04,0x34,0x1b,0xf2,0xdf,0x29,0x4e,0x71,0xbf,0xfa,
+  0x0e,0x02,0x53,0x90,0xcc,0xad,0xae,0x95,0x85,0x7c,0xf1,0x63,0x4d,0x7f,0xb4,0x55,
+  0x2d,0x0a,0xd5,0xab,0x6e,0xb6,0xe3,0x56,0x15,0x8d,0x67,0xbe,0xb2,0x75,0x15,0x2b,
+  0x89,0xd6,0xb5,0xc7,0x52,0xf4,0x20,0x96,0xc4,0x7e,0xa2,0xc2,0x54,0x3f,0xe9,0x0d,
+  0x07,0xbf,0x92,0x99,0xeb,0xeb,0x20,0xdb,0x7c,0x3a,0xee,0xdd,0x85,0x66,0xfc,0xb5,
+  0xf7,0xb9,0xf1,0xbd,0x3e,0x37,0x70,0x35,0xd1,0x1f,0x2f,0xff,0x02,0xd7,0x32,0xdf,
+  0x59,0x59,0x37,0xf7,0x04,0xf5,0xea,0xc5,0x08,0xa0,0x6a,0xcf,0xe1,0x77,0x07,0xf2,
+  0x10,0xe2,0x4d,0x20,0x0b,0x46,0x72,0x4c,0x0b,0x83,0x15,0xb5,0x45,0xf1,0xbb,0xa3,
+  0x7a,0x60,0xc5,0x40,0xf5,0x1b,0xcd,0x29,0x38,0x54,0xd3,0x8a,0xdd,0xe4,0x2e,0x78,
+  0xc7,0x22,0x7a,0xab,0xea,0xc5,0xff,0xd8,0x8b,0xfd,0xe4,0x26,0x65,0x55,0x51,0x40,
+  0xa5,0xd4,0xcd,0x05,0xdb,0x13,0x2d,0xb5,0x9b,0xa3,0x74,0xd4,0xa7,0x42,0xb5,0x7f,
+  0xcd,0xd4,0xee,0x52,0xb7,0xa4,0x39,0x99,0x19,0xed,0x08,0x8b,0xd0,0xa9,0x42,0x1a,
+  0xd2,0x42,0xda,0xff,0x6e,0xfe,0xd2,0x33,0x7d,0x1f,0x98,0xff,0x5c,0xf0,0x4d,0x72,
+  0x47,0x07,0xea,0x6a,0x32,0x11,0xe4,0x9e,0xec,0x44,0xd1,0xbd,0xcc,0x6c,0x65,0xed,
+  0xde,0x08,0x86,0x96,0xf5,0xa5,0xfd,0x37,0xdf,0x3d,0xfe,0xe3,0x73,0x79,0x39,0x27,
+  0x84,0x3d,0xff,0xe2,0xe9,0x37,0xc5,0xeb,0xc6,0x3d,0xee,0xe6,0x70,0x8b,0xff,0xc2,
+  0x8c,0x60,0xaf,0x21,0x05,0x49,0x87,0x89,0xb0,0xae,0xd9,0x87,0xc2,0x86,0xd9,0x85,
+  0xde,0x0b,0x12,0xdd,0x89,0x09,0x5a,0x9e,0x08,0xa3,0xed,0x61,0x5a,0x79,0xdd,0x4d,
+  0xda,0x9a,0x81,0xe6,0xf6,0x4e,0xb8,0x99,0x84,0xa0,0xfb,0xbc,0x4a,0x2f,0x4d,0x2f,
+  0x61,0x77,0x29,0xe5,0x94,0x17,0xd7,0xea,0xd2,0x72,0xc7,0x1a,0xb5,0xd6,0x33,0xe5,
+  0xd4,0x38,0x6d,0x9a,0x36,0x43,0x5d,0x91,0x6e,0xdb,0x6a,0xbb,0xdf,0x49,0x8e,0xac,
+  0xc7,0x78,0xa3,0xf4,0xfc,0xcb,0x15,0xa2,0x6d,0xf2,0x42,0x21,0x0c,0xd7,0x90,0x3e,
+  0xe0,0x66,0xda,0xb1,0x68,0x5e,0x0f,0x83,0xf9,0x99,0x7d,0xdb,0xf9,0x94,0xd1,0xd5,
+  0xea,0xd2,0xb0,0xb2,0x56,0x97,0x9e,0x2b,0x6b,0xf5,0x91,0x86,0x86,0x3d,0xcd,0x9d,
+  0x6e,0xdf,0xee,0xb6,0xb0,0xb1,0x31,0x6c,0x78,0xc0,0x9c,0x9f,0x6c,0x85,0x05,0x56,
+  0x0d,0x75,0xde,0x37,0x6c,0xb9,0xda,0xde,0xd9,0x2b,0x35,0x36,0x80,0x5d,0x5e,0x5a,
+  0x9e,0xc0,0x39,0xbe,0xa8,0x5b,0xb1,0xad,0xa0,0x6a,0xd9,0xc8,0xba,0x29,0xfe,0x23,
+  0xc3,0xa1,0x19,0x2d,0xcd,0xed,0x19,0xda,0x03,0x53,0x1f,0x17,0xf4,0xc2,0x99,0x3b,
+  0x93,0xe5,0xc8,0xc7,0xc3,0x7a,0x9a,0xc4,0x37,0x95,0x67,0x43,0xf7,0x41,0xa7,0xd8,
+  0xf4,0xbd,0xe9,0x74,0xab,0xf7,0x0e,0x1f,0xe7,0xea,0xbb,0x2f,0xae,0x3a,0x5b,0xfd,
+  0x3f,0xd9,0xc0,0x90,0xfd,0xbf,0xac,0xff,0xe5,0xa5,0xce,0x78,0xa1,0x3a,0x9c,0x0b,
+  0xb1,0x9c,0xb1,0x5a,0xf3,0x68,0xc2,0x06,0xbd,0xeb,0xc9,0xc1,0x91,0x9d,0xdd,0x6f,
+  0x1c,0x8c,0xda,0xd3,0x88,0x56,0x6b,0x1a,0x67,0x61,0x34,0x45,0x46,0x8d,0x7e,0xe4,
+  0x2b,0x98,0xdd,0xdc,0x33,0x2d,0x68,0x4d,0xaf,0x36,0xad,0x2c,0x9b,0x53,0xf5,0xf6,
+  0xc0,0x39,0x9b,0x65,0x5a,0x9d,0x79,0x57,0xac,0x84,0x8b,0xf1,0x3a,0x5c,0x8d,0xf7,
+  0xe4,0x8c,0xc9,0x6c,0x52,0x15,0x59,0xf7,0x42,0xfb,0x51,0x90,0x3d,0x6d,0xa1,0xe6,
+  0x4e,0x2d,0xd5,0xf7,0xb0,0xb8,0xaa,0x84,0x62,0x79,0x0e,0x4a,0x19,0x03,0xe4,0xb8,
+  0xfd,0x74,0x26,0x19,0xc5,0x8b,0x61,0xb3,0x76,0xc3,0x6d,0xe7,0x5e,0xc5,0x49,0x45,
+  0xfd,0xec,0x60,0x80,0x62,0x5e,0x7b,0xd9,0x8f,0xb7,0x91,0xb3,0xed,0x44,0xda,0x68,
+  0xbb,0x76,0x74,0xb6,0x00,0xe9,0x3d,0x4b,0x38,0xdd,0xd0,0xd1,0xf7,0xf5,0xec,0xfd,
+  0x11,0xb4,0x40,0xf2,0x70,0x0c,0xef,0x82,0x56,0xb6,0xc3,0x2c,0xfd,0xb9,0x00,0x9d,
+  0x36,0x27,0x6d,0xee,0x61,0xcb,0x9e,0x69,0x02,0x6b,0x21,0x34,0x57,0x59,0x07,0x64,
+  0xf9,0x9a,0xed,0x70,0x85,0x18,0x47,0xcd,0x8a,0x67,0x1f,0x4c,0xdd,0x3a,0xed,0x3b,
+  0x35,0x83,0x50,0x32,0x55,0x39,0x32,0x8b,0x9c,0xfe,0xfc,0xe4,0xec,0xdc,0x4f,0x9e,
+  0x93,0x00,0x75,0x78,0x7c,0xe2,0xe9,0x4d,0x25,0x1b,0x1f,0xa8,0xe8,0x8f,0x83,0x7a,
+  0x6a,0x67,0xd6,0xeb,0x66,0x5b,0x06,0xc9,0xdb,0xaf,0x49,0x63,0xe1,0xeb,0xe9,0x2a,
+  0x00,0x00,
+};
+
+#define WEB_ASSET_APP_JS_HASH "89af5998b7b67402"
+static const char WEB_ASSET_APP_JS_ETAG[] = "\"89af5998b7b67402\"";
+static const char WEB_ASSET_APP_JS_PLAIN_ETAG[] = "\"89af5998b7b67402-id\"";
+static const size_t WEB_ASSET_APP_JS_GZ_LEN = 18048;
+static const uint8_t PROGMEM WEB_ASSET_APP_JS_GZ[] = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xe5,0x7d,0x6b,0x6f,0x23,0x49,
+  0x92,0xd8,0xf7,0xfe,0x15,0x6c,0xed,0x8e,0x8a,0x3c,0x91,0x6c,0x49,0xfd,0x98,0x19,
+  0x71,0x28,0xb9,0xf5,0xe8,0x19,0xed,0xaa,0x5b,0x6d,0x51,0xbd,0xe3,0xbb,0x9e,0x06,
+  0xaf,0xc8,0x2a,0x8a,0x35,0x5d,0xac,0xaa,0xa9,0x2a,0xb6,0x46,0xa3,0x16,0x70,0x07,
+  0xdb,0x80,0x71,0xd8,0xbb,0xb5,0x6f,0xc7,0x87,0xf3,0x3d,0xb0,0x7b,0xc6,0xbd,0x6c,
+  0xc0,0xc6,0x1a,0xb0,0x8d,0xfb,0xe4,0x0f,0xe7,0x7f,0xb2,0x7f,0xc0,0xf7,0x13,0x1c,
+  0x91,0xaf,0xca,0xcc,0xca,0x7a,0x50,0xa2,0xba,0x67,0xf6,0x80,0x99,0x56,0x31,0x33,
+  0x32,0x32,0x32,0x22,0x32,0x32,0x32,0xf2,0x35,0x99,0x07,0xe3,0xd4,0x0b,0x83,0xc6,
+  0x99,0x9b,0xee,0xcd,0xe3,0xd8,0x0d,0xd2,0xd3,0xd8,0x0e,0x12,0xdf,0xc6,0xd4,0xa4,
+  0xd9,0xba,0x8c,0xdd,0x74,0x1e,0x07,0x8d,0x54,0x4a,0xdd,0xb3,0xc7,0x53,0xf7,0xed,
+  0xdb,0xfd,0x83,0x27,0x8f,0x5f,0x1c,0x9d,0x0e,0x4f,0x4f,0x1e,0x3f,0x1b,0x1c,0x3d,
+  0x3e,0x3d,0x3c,0x7e,0x36,0xe8,0x5d,0xdd,0x99,0x70,0x94,0x89,0xab,0xe0,0x22,0xa5,
+  0x9a,0x69,0xeb,0xd2,0x9b,0x34,0xd3,0xd5,0xd5,0xf4,0x22,0x72,0xc3,0x49,0x23,0xed,
+  0xf7,0xfb,0x56,0x38,0xfa,0xd2,0x1d,0xa7,0x56,0xeb,0x32,0x57,0x4b,0xff,0x98,0x64,
+  0x75,0xed,0x24,0xf1,0xce,0x82,0xe6,0xe5,0x55,0xdb,0x54,0x6b,0x3b,0x6d,0xf5,0xae,
+  0x5c,0x3f,0x71,0x0d,0x08,0xcc,0x54,0x5e,0xdd,0x19,0x03,0x44,0xda,0x90,0x52,0x87,
+  0x83,0xd3,0xe3,0x93,0xc7,0x9f,0x1e,0x0c,0x9f,0x9f,0x1c,0x3c,0x39,0xfc,0x57,0x7d,
+  0xcb,0x4d,0xa2,0xfb,0x9b,0x8e,0x67,0x9f,0x0d,0xd3,0x78,0x68,0xf5,0x44,0xbb,0x62,
+  0xd7,0x76,0x06,0x69,0x18,0xbb,0x8e,0xc2,0xaa,0xd7,0xee,0x05,0x36,0xe0,0xe2,0x92,
+  0x62,0x8e,0xed,0xf3,0xfe,0xb9,0x17,0x38,0xe1,0x79,0xd7,0x0f,0xc7,0xb6,0x8f,0x25,
+  0xec,0x33,0xb7,0x0b,0x8c,0x3e,0x4c,0xdd,0x19,0x01,0xef,0x31,0xe6,0x02,0xec,0xce,
+  0x8f,0x06,0xc7,0xcf,0xba,0x91,0x1d,0x27,0x6e,0x13,0x7e,0xb6,0xb6,0x82,0xb9,0xef,
+  0xf7,0xae,0xc6,0x76,0x3a,0x9e,0x36,0x5d,0x21,0x06,0x9a,0x2a,0x33,0x19,0x09,0x51,
+  0xe8,0x88,0x62,0x77,0xe2,0x7d,0xdd,0x06,0xfc,0x6d,0xc7,0x4e,0x6d,0x99,0xa6,0x84,
+  0xd2,0x60,0xa2,0xab,0x37,0x09,0xe3,0xa6,0xef,0xa6,0x0d,0xaf,0xcf,0xa0,0xba,0xbe,
+  0x1b,0x9c,0xa5,0xd3,0xce,0x46,0xcf,0xdb,0xee,0xaf,0xf7,0xbc,0x4e,0xa7,0xc5,0xd0,
+  0xb8,0x5f,0x7b,0x49,0xea,0x05,0x67,0x02,0x12,0xea,0x6a,0x7a,0xad,0x1e,0x08,0x96,
+  0x67,0xad,0xae,0xf2,0xaf,0x2e,0xd4,0xe5,0x7e,0x7d,0x3c,0x61,0x74,0xb5,0x40,0xde,
+  0xeb,0x59,0xee,0xdd,0x7e,0x1f,0x19,0xc1,0x11,0xc5,0xee,0x2c,0x7c,0xe3,0x12,0xfe,
+  0x70,0x08,0x90,0xec,0x1d,0x9e,0x9d,0x64,0xbc,0x6b,0x13,0x7e,0x25,0x69,0x0c,0x20,
+  0xde,0xe4,0xa2,0x49,0x9a,0xda,0x92,0x18,0x26,0x33,0x69,0xe2,0x42,0xa2,0xc2,0x24,
+  0xdf,0x06,0xcc,0xac,0x39,0xa9,0x1d,0x83,0x50,0xfa,0x98,0xf4,0xf6,0xed,0x98,0x76,
+  0x82,0x23,0xf8,0xd1,0xa3,0xd9,0x6f,0xdc,0x38,0x81,0x32,0xfd,0x26,0xd3,0x58,0x59,
+  0x91,0x86,0x3f,0x39,0x38,0x19,0xc0,0x87,0xa4,0xc4,0xab,0xab,0x26,0x80,0xd6,0x8e,
+  0x29,0xf5,0x25,0xad,0xfa,0x15,0x15,0x36,0xb0,0xef,0x2e,0xab,0x8c,0x93,0x06,0xfa,
+  0x60,0xcf,0x92,0xfe,0x4b,0x2b,0x4d,0xfa,0xd6,0xda,0xbe,0x9d,0xba,0xdd,0x20,0x3c,
+  0x6f,0xb6,0x5e,0x21,0x30,0x6d,0x03,0x05,0xe9,0x46,0xf3,0x64,0xda,0xb4,0x30,0x09,
+  0x00,0xdd,0x60,0x1c,0x3a,0xee,0x8b,0x93,0xc3,0xbd,0x70,0x16,0x85,0x01,0xb4,0x87,
+  0x02,0x23,0x2f,0x99,0x08,0x03,0x27,0x0a,0xbd,0x20,0xed,0x5b,0xf7,0xec,0xc8,0xbb,
+  0x07,0x44,0x74,0xe4,0xae,0xb3,0x63,0xad,0x31,0xbc,0x5f,0x02,0x54,0xd3,0x5a,0xb5,
+  0x84,0xae,0x12,0x5e,0x36,0x79,0xf9,0xf6,0xe5,0x18,0x7b,0xd9,0x96,0x15,0x84,0x1d,
+  0xa2,0x8a,0xd6,0x55,0xab,0x9b,0x4e,0xdd,0xa0,0x19,0xf7,0xb7,0xb1,0xa7,0xdf,0x8d,
+  0xbb,0xe1,0xeb,0x56,0x3a,0x8d,0xc3,0xf3,0x46,0xe0,0x9e,0x37,0x0e,0xe2,0x18,0x14,
+  0xcd,0x92,0x2a,0xa3,0x18,0x1b,0x13,0xdb,0xf3,0x5d,0x27,0xab,0x27,0xee,0x7e,0x99,
+  0x84,0x41,0x13,0x48,0xce,0xa8,0xa6,0x2a,0xd4,0x2f,0xee,0xb4,0x6b,0x94,0xa1,0x6b,
+  0x16,0xf4,0x57,0x5a,0x04,0x54,0xa5,0x4f,0x8b,0xad,0x31,0xde,0xf6,0xb2,0xbe,0xe0,
+  0x3a,0xfd,0x92,0xce,0x8c,0x3c,0xa6,0x50,0x2d,0x46,0xd3,0xf3,0x38,0x9c,0x79,0x09,
+  0xaa,0x69,0x12,0xfa,0x6f,0x5c,0x9e,0xdb,0xab,0xc7,0xd3,0x62,0xe1,0x50,0xaa,0x5b,
+  0x6b,0xd6,0xea,0x1b,0x33,0x00,0x57,0x0b,0xb3,0x10,0x96,0xcf,0x71,0x8a,0x30,0x05,
+  0x84,0xa5,0xf6,0x25,0x15,0x65,0x53,0x2a,0x26,0xc9,0x46,0xe6,0xfb,0x9c,0x30,0x62,
+  0xf9,0x2c,0xa9,0xd7,0xc9,0x75,0x9b,0x07,0x90,0xde,0x3c,0x82,0xde,0xee,0x1e,0x06,
+  0xa9,0x1b,0x4f,0xec,0xb1,0x7b,0xea,0x7e,0x9d,0x02,0xf6,0x22,0x52,0xd2,0x98,0x9a,
+  0x66,0xd6,0xd9,0x25,0x84,0xfd,0xa2,0x41,0x8f,0xab,0x48,0x38,0x8f,0xc7,0x6e,0x5f,
+  0x2e,0x02,0xe3,0x96,0xf4,0xeb,0x25,0x20,0x7e,0xc5,0x80,0x27,0xb6,0xef,0x8f,0xec,
+  0xf1,0x6b,0xe3,0x80,0x43,0x01,0x39,0x81,0xd4,0x8e,0x30,0xec,0x60,0x39,0xa8,0x15,
+  0xb3,0x76,0x68,0xca,0x16,0x37,0x34,0x02,0xa3,0x04,0xc2,0xd3,0xb6,0x88,0x82,0x4a,
+  0xad,0x1c,0xfb,0xae,0x1d,0x4b,0xad,0x78,0x9c,0x42,0x89,0xd1,0x3c,0x75,0x93,0xa6,
+  0xeb,0x93,0x31,0xf7,0x2e,0xfc,0xa5,0x14,0xf4,0x5c,0x9f,0x59,0x5a,0x01,0xd5,0xb4,
+  0xd0,0x80,0x76,0xbc,0x8d,0x8f,0x02,0x50,0x88,0xd2,0xfc,0x0e,0x55,0x80,0x4a,0xb0,
+  0x64,0x3e,0xa1,0x60,0x38,0x2c,0xf8,0x5d,0x5b,0x10,0x24,0x44,0x11,0x9e,0x90,0xd2,
+  0xfd,0x97,0xaf,0xa4,0xd1,0x07,0x46,0x9a,0x4f,0x14,0x70,0x36,0x0e,0xf5,0xbc,0xb5,
+  0x35,0x5e,0x32,0xb0,0x67,0x6e,0x5f,0x01,0x7a,0xe9,0xbd,0xea,0x62,0x2a,0x56,0x86,
+  0x7f,0x57,0x57,0xf1,0x5f,0x31,0xf6,0x48,0x64,0xc5,0x6e,0xe4,0x83,0xd2,0x74,0x2c,
+  0x32,0x12,0xc1,0xe8,0xc8,0xa8,0xa0,0x16,0x14,0x4b,0xb5,0x70,0x80,0x15,0xc9,0x40,
+  0xd9,0x01,0x28,0x5e,0x13,0xeb,0xea,0x6f,0x1b,0x9a,0x8c,0x19,0xad,0x96,0x32,0x28,
+  0x8f,0x43,0xdf,0x87,0xb1,0xe0,0x84,0x56,0x35,0x03,0xfd,0xd2,0xc4,0xc1,0x5c,0x84,
+  0x2c,0x3f,0xe9,0x5f,0x5e,0xf5,0xa8,0x90,0xde,0xbe,0xbd,0xab,0xb1,0x8b,0xf7,0x4f,
+  0x09,0x1c,0x45,0xbf,0x10,0xcb,0x08,0xf9,0x3a,0xcb,0x48,0x8d,0x98,0x02,0x75,0xe2,
+  0x1f,0xc2,0xc2,0xb7,0x6f,0xc5,0x67,0x39,0xff,0xee,0x12,0xfe,0x01,0x7a,0x18,0xa6,
+  0xe7,0xae,0x30,0xd2,0x68,0x71,0x33,0x0c,0xc9,0x7c,0x44,0x75,0xb7,0xb9,0xf1,0x11,
+  0x51,0x05,0xd2,0x17,0xe5,0xa6,0x90,0xbe,0x41,0x4b,0xbc,0xb1,0x7d,0x44,0x74,0x75,
+  0xa7,0xa0,0xc5,0x99,0x75,0x21,0xf6,0x57,0x52,0xf7,0x9f,0x60,0x49,0xe2,0x17,0xb8,
+  0x7e,0x5b,0xee,0xa2,0x54,0xf5,0x59,0xa5,0x04,0xe9,0x1c,0xda,0x34,0xf1,0x02,0xd7,
+  0x11,0x14,0x2f,0xbb,0x9f,0xa3,0x54,0x48,0x53,0xfa,0x4b,0xe9,0xea,0x82,0x60,0xc2,
+  0x3f,0x56,0x82,0xe0,0xbf,0x9b,0x81,0x97,0x34,0x4f,0x51,0xb3,0x2a,0xd5,0xec,0x31,
+  0x87,0x1b,0x1a,0x92,0x34,0xe5,0x92,0x2d,0xd1,0x13,0x48,0xef,0xdb,0x96,0xdc,0x5c,
+  0x45,0x9a,0x98,0xfb,0x4a,0x22,0x14,0x01,0x80,0x4c,0x41,0x96,0xa0,0x54,0xd0,0x97,
+  0x82,0xfd,0xee,0x0f,0xa8,0x92,0xa0,0xeb,0xcb,0x18,0xed,0x87,0xe7,0x6e,0xdc,0xb7,
+  0x2e,0xad,0x35,0x44,0xb9,0x66,0x5d,0xf1,0x21,0x7d,0x1e,0x45,0x52,0x46,0x37,0x0d,
+  0x5f,0x60,0xc2,0x9e,0x0d,0x9e,0x73,0x4b,0x02,0x83,0xb4,0xb1,0x8b,0xa3,0xf1,0x07,
+  0x66,0xc0,0x0f,0xac,0x1e,0x15,0x12,0xf9,0xb7,0x9b,0x44,0xbe,0x07,0x6e,0x12,0x56,
+  0xda,0xa2,0x5e,0x0f,0xd2,0xd5,0x32,0xc0,0x90,0xfa,0x2b,0x60,0x58,0xe5,0x0a,0xd4,
+  0x95,0x18,0xa2,0x98,0x9e,0xcb,0x63,0x14,0x55,0x36,0xf7,0xc0,0x27,0x6c,0x6c,0x1a,
+  0xb5,0x18,0x2d,0x87,0xc6,0x3b,0xec,0x6c,0xd0,0xab,0x61,0x20,0x2b,0x30,0xe5,0x9a,
+  0xf6,0x8b,0x82,0x94,0xe4,0x45,0x3a,0x52,0x0d,0xe5,0xd3,0x1d,0xb5,0x62,0xca,0xc4,
+  0x20,0xf2,0xf6,0xad,0xc5,0x05,0x46,0x07,0x8c,0xb2,0x42,0x7c,0x48,0x21,0x85,0x00,
+  0x0e,0xf9,0xba,0x07,0xf6,0x07,0xc5,0xcc,0x9d,0x3c,0x24,0x6d,0x8d,0x02,0xca,0x1c,
+  0xb6,0xa3,0xc8,0xbf,0x78,0x8e,0x6a,0x3a,0x0d,0x7d,0xc7,0x95,0x87,0xca,0x25,0x31,
+  0xbb,0x13,0x65,0xd8,0x7f,0xd3,0x19,0x9f,0x28,0x70,0x72,0xc3,0xdb,0x06,0x39,0xb4,
+  0xb4,0xa8,0x00,0x53,0x72,0x4d,0x04,0x40,0xcb,0xc4,0x3b,0x33,0x30,0x1f,0x13,0x68,
+  0xe6,0xdb,0xb7,0x8c,0x0f,0xf4,0x27,0x1a,0x29,0x85,0x19,0xe5,0x4e,0x10,0xf2,0x91,
+  0x16,0x14,0xd1,0x07,0x86,0x87,0x58,0x20,0x19,0x91,0xa6,0x5b,0x12,0x58,0x8f,0x0f,
+  0x4e,0xc8,0xf2,0xf2,0xea,0x72,0x7c,0xca,0xfa,0x65,0x3b,0x6b,0x00,0x21,0x8b,0x19,
+  0xdd,0x28,0x0e,0xd3,0x10,0x49,0xeb,0x4e,0xed,0xe4,0xf8,0x3c,0x80,0xf9,0x06,0x18,
+  0x92,0xf4,0xa2,0x0b,0xf3,0x74,0x9f,0xd1,0xde,0xb6,0xb8,0x04,0x09,0xab,0x18,0x22,
+  0x36,0xb9,0xbe,0x2c,0xae,0x93,0x0b,0xbe,0xad,0x96,0x60,0x71,0x93,0x9a,0x1e,0xdf,
+  0x15,0x91,0xc6,0x42,0xd4,0x72,0xd5,0x91,0xa9,0x65,0x6a,0x51,0x46,0x2d,0x2b,0xd6,
+  0x56,0x4b,0xd4,0xa2,0x56,0x38,0x9e,0x94,0xda,0x7f,0x0e,0xbe,0xe7,0x9d,0x8c,0xb7,
+  0xf2,0x60,0xac,0xeb,0xb9,0xe2,0x09,0xc8,0x71,0x37,0x79,0xd0,0x37,0xc0,0xe6,0xc6,
+  0xfe,0xcc,0x22,0x61,0x82,0xd9,0x20,0x95,0x08,0x57,0xf0,0x81,0x0c,0xcc,0x6d,0x36,
+  0xf6,0x1b,0x2a,0xa6,0xde,0x44,0x8b,0x05,0x01,0x4c,0xa3,0x64,0xd1,0x14,0x4e,0xb1,
+  0x39,0x74,0xc2,0x28,0x59,0x7f,0xa9,0xa7,0xaa,0x96,0xdf,0x09,0xc7,0x73,0x44,0xdd,
+  0xfd,0x6a,0xee,0xc6,0x17,0x03,0x17,0x7d,0xa5,0x30,0x7e,0x0c,0xfa,0x6c,0xbd,0x24,
+  0xf4,0x4b,0xb6,0xae,0x83,0xce,0x9e,0x95,0xf1,0xc6,0xf5,0x85,0x57,0x54,0x3c,0x52,
+  0x68,0xe5,0x6f,0x75,0xa0,0xd0,0x4d,0x5a,0x52,0x4a,0x8e,0xd5,0x26,0x85,0x50,0x03,
+  0x0d,0xcc,0xd3,0x66,0xdb,0x2c,0x8c,0xdb,0x2a,0x9c,0xa3,0x0b,0xe7,0xae,0xd6,0x7c,
+  0xbb,0x92,0xed,0xa8,0x36,0x3a,0xaf,0x2b,0x9d,0xa6,0x9a,0x78,0x65,0x26,0xe8,0x75,
+  0x2c,0xe2,0x36,0xf0,0xc0,0x44,0x0d,0x3d,0x13,0xec,0x19,0x1c,0xec,0xbd,0x38,0xc1,
+  0xe8,0xd5,0xf1,0xee,0xc1,0xf0,0xf4,0xf0,0xe9,0xc1,0xf1,0x8b,0xd3,0xfe,0xc6,0xc3,
+  0xf5,0x75,0x3e,0x34,0xbb,0xe3,0x79,0xec,0x3e,0xc7,0x70,0x0a,0xb0,0x6d,0xec,0xd2,
+  0x98,0x36,0x13,0xf2,0x53,0x3b,0x42,0x11,0x73,0x49,0x59,0x3b,0x18,0xee,0x81,0xc4,
+  0x26,0x8b,0x1e,0x9b,0x51,0x90,0x68,0x17,0x4e,0x37,0x27,0x52,0xec,0x7f,0xa0,0x01,
+  0xd1,0x69,0x1a,0x06,0xc0,0x4c,0x04,0x88,0xc9,0x86,0x31,0x17,0x87,0x03,0x52,0x7e,
+  0xc7,0x9c,0x0d,0xd5,0x91,0xec,0x2d,0x79,0xaa,0xc2,0x10,0xd6,0x1a,0x5a,0x8c,0x2d,
+  0x6a,0x1b,0x6b,0x24,0x59,0x64,0x56,0xa6,0xd4,0x26,0x7b,0x23,0xa6,0xa6,0xb3,0xae,
+  0x50,0xc2,0x00,0x73,0xd3,0x12,0xda,0x34,0xde,0x93,0x44,0x8f,0x2e,0x26,0xab,0x9f,
+  0x9b,0x0b,0x40,0xdb,0x47,0x2e,0x25,0xea,0x80,0x05,0xf8,0x9a,0xd3,0x30,0x49,0xdb,
+  0x14,0x49,0x7b,0x3c,0xa2,0x3e,0x12,0xa6,0x65,0x0e,0xd1,0xe8,0xae,0xac,0x09,0x39,
+  0x63,0x32,0x82,0x49,0x4f,0x9f,0x22,0x58,0xc3,0x82,0x64,0x8e,0x0a,0xd4,0xa6,0xbe,
+  0xeb,0xf4,0x61,0xa6,0x99,0xb8,0x7c,0x7a,0xeb,0x05,0xb6,0xef,0x7d,0x43,0x0c,0xcf,
+  0xdc,0x4f,0xa9,0xad,0x67,0x80,0x12,0x56,0x5e,0x34,0x8d,0x81,0x78,0xea,0x07,0x79,
+  0x33,0x37,0x9c,0xa7,0xcd,0x14,0xfe,0xc6,0x30,0x87,0x1b,0x35,0x29,0x06,0xd0,0x75,
+  0x86,0x9a,0xe4,0xf4,0xd1,0x60,0x30,0xd0,0x66,0xab,0xbf,0xcd,0xeb,0x6b,0x12,0x22,
+  0x5a,0x6d,0x53,0x87,0x90,0x0d,0x1b,0x89,0x1d,0xf6,0xd5,0xb6,0xd2,0x68,0x28,0x36,
+  0x71,0xcd,0xba,0x67,0xb5,0x2f,0x67,0xa1,0x43,0x23,0xd2,0xe3,0x30,0x4e,0x44,0x40,
+  0x5a,0xa9,0x0d,0xe9,0x6e,0xb5,0xba,0x74,0xb5,0xc0,0x40,0x47,0xb6,0x9e,0xc4,0xd7,
+  0x4e,0xa0,0x0f,0x83,0x05,0xec,0x63,0x17,0x3b,0x9c,0xd9,0x67,0x30,0x85,0xec,0xd1,
+  0xa4,0x6e,0x18,0xf8,0xa1,0xed,0xf4,0xf3,0xf8,0x33,0x00,0x17,0x63,0xb0,0x7d,0x43,
+  0x3d,0x1c,0x24,0x89,0xc7,0x7d,0xd6,0x80,0x89,0xfd,0xc6,0x83,0x2a,0xbb,0xf0,0xcf,
+  0x0e,0xd1,0x05,0x25,0xf2,0x2f,0x56,0x38,0xe2,0x18,0x1a,0xae,0x21,0xbb,0x52,0x56,
+  0x86,0xa6,0xe1,0xdc,0x77,0xa8,0xce,0x51,0x75,0x7a,0x3c,0x1e,0xbb,0x49,0xa2,0x28,
+  0x93,0xef,0x9e,0xd9,0xe3,0x0b,0x59,0xa1,0xee,0xd2,0x9c,0xb7,0x6f,0xe9,0x5f,0x60,
+  0x35,0x87,0xe1,0xd1,0x5b,0xa2,0x2d,0xf2,0x9c,0x48,0xd6,0x2b,0x9a,0x4a,0x16,0x05,
+  0x9c,0x7e,0x91,0x61,0x91,0xe4,0xc9,0x20,0x41,0xa0,0xa3,0x30,0x04,0x3d,0xca,0x74,
+  0x97,0x65,0x51,0x65,0x33,0x76,0x52,0xd6,0xea,0xaa,0x0e,0xc3,0x15,0x91,0xea,0x32,
+  0xfb,0x71,0x59,0x84,0x94,0x4a,0xee,0x2a,0x9b,0xac,0xf3,0xf6,0xaa,0x53,0x49,0xca,
+  0xcb,0x23,0x2f,0x78,0x3d,0x00,0x2a,0x67,0xa0,0x0e,0x97,0x6f,0xec,0xb8,0xe1,0x43,
+  0x42,0xd2,0xaf,0x1c,0x76,0x6c,0x52,0xba,0x83,0x54,0xc2,0x88,0x43,0x3c,0x50,0x2c,
+  0x4d,0x3d,0x50,0x82,0x43,0xf1,0x3c,0x39,0xe6,0x3e,0xc9,0xe2,0x81,0x3b,0xfc,0xa1,
+  0xc4,0xdf,0x10,0x0c,0x51,0x12,0x30,0x93,0xf3,0x21,0x55,0x6b,0x61,0xd4,0x22,0x66,
+  0x06,0xbc,0xb0,0x00,0xcd,0x26,0xf3,0xbe,0x69,0x9a,0x46,0xc9,0xd6,0xbd,0x7b,0x16,
+  0x29,0x47,0x75,0xa2,0xb0,0x1c,0xcd,0x16,0xe5,0xb2,0x62,0xf6,0xc8,0xf5,0x0f,0x9d,
+  0xe2,0x72,0x98,0xdf,0xf1,0x1c,0x46,0x1d,0xf9,0xf9,0x0c,0x7a,0x73,0x9f,0x15,0xdc,
+  0x11,0x9c,0x3d,0x13,0xd3,0xc8,0xdd,0x8b,0x43,0xa7,0xc9,0xf2,0xd9,0xc0,0x27,0xca,
+  0x7e,0x56,0x83,0x1b,0x04,0x10,0x49,0xa5,0xfa,0x6f,0xc9,0x0d,0x3c,0xc2,0xbc,0x8a,
+  0x56,0x66,0x08,0xa0,0x28,0xef,0x47,0xad,0x4b,0x52,0x68,0x0a,0xba,0xd5,0xb7,0x7e,
+  0x60,0xf5,0xc8,0xaf,0xb1,0x6f,0xa3,0xca,0x24,0x69,0xd7,0x76,0x1c,0xc0,0xe1,0x25,
+  0xf6,0x88,0xae,0xc0,0x90,0x6c,0xd5,0x3d,0xb3,0x63,0xcf,0xee,0x08,0x90,0xb6,0x85,
+  0x7a,0x49,0xbd,0x45,0xc1,0x95,0xd5,0x55,0xf1,0x59,0xe1,0x6a,0xe2,0xf4,0x2b,0x83,
+  0x95,0xa7,0xb6,0xf5,0x31,0xd0,0x2e,0x2f,0xeb,0xda,0x3c,0x61,0xdd,0xae,0xbf,0x88,
+  0xad,0xa1,0x7a,0x47,0x3a,0x4d,0x5f,0x60,0x60,0x03,0xf7,0x16,0x85,0xe9,0x65,0xcc,
+  0xa3,0x80,0x6c,0xcc,0x52,0x99,0x48,0x27,0x43,0x8b,0xf2,0x91,0x74,0x67,0x8d,0x91,
+  0xd4,0xfe,0x09,0x62,0x80,0xaf,0x99,0xf4,0x0b,0x19,0x97,0x81,0xb0,0xb1,0xc2,0x0c,
+  0xc7,0x1a,0x20,0xd4,0x11,0x8d,0xf4,0xd5,0x1d,0xa1,0xc7,0xa0,0x09,0x07,0x6f,0x70,
+  0xe9,0x0b,0x5a,0xe4,0xc2,0x38,0xd1,0xb4,0xf6,0x8f,0x9f,0xb2,0xb2,0x47,0x30,0xac,
+  0x20,0xcd,0x38,0x6e,0x5c,0xde,0xd2,0xa2,0xd9,0x15,0x1f,0x04,0x61,0x40,0x61,0xd3,
+  0x17,0x30,0xc3,0xdd,0x73,0x3b,0x0e,0x9a,0x96,0x8c,0xa8,0x31,0x0f,0xec,0x37,0xb6,
+  0xe7,0x23,0x1f,0xad,0x36,0x0e,0x3f,0x3d,0x6d,0x28,0x37,0xae,0xf9,0x31,0xec,0x60,
+  0x4b,0xe3,0x8b,0x03,0xac,0x82,0xd7,0xe0,0xd2,0x65,0x49,0xa5,0x0a,0x02,0xc5,0xd7,
+  0x25,0xdb,0xbc,0x4c,0xab,0xd5,0xde,0x58,0x5f,0x5f,0x27,0x93,0x40,0x2f,0xf0,0xd2,
+  0x67,0x30,0x40,0x9e,0x51,0x17,0xbc,0xd5,0x2b,0x30,0xc6,0x3d,0x1c,0x92,0xc1,0xe0,
+  0xc2,0xc0,0x69,0xc3,0xaf,0x24,0xb5,0x63,0x60,0xf1,0x1b,0x97,0xf0,0x3a,0xe1,0x29,
+  0x8f,0xe7,0x18,0x13,0x46,0xbe,0xd0,0x75,0x66,0x69,0x57,0x85,0x96,0x8b,0x0a,0x42,
+  0x39,0x78,0x4a,0xfc,0x1b,0xe2,0xf2,0x10,0x66,0x82,0xff,0xa6,0xe4,0xf4,0xa4,0x1f,
+  0xe8,0xec,0x08,0xa0,0x26,0x1b,0x80,0xbc,0x04,0xc4,0x1b,0xc0,0x88,0xe0,0x3a,0xab,
+  0xab,0x60,0xc4,0xdf,0x80,0x37,0x18,0xbb,0xf6,0xec,0x38,0x72,0x83,0x16,0x2d,0x8c,
+  0x94,0x32,0xca,0xaf,0xda,0x2f,0x9e,0xef,0x3f,0x3e,0x3d,0x18,0x1e,0x3e,0x3b,0x3d,
+  0x38,0xf9,0xc9,0xe3,0xa3,0x6c,0xee,0x70,0x74,0xf8,0x13,0x70,0x91,0x8e,0x9f,0x1f,
+  0xee,0x0d,0xfa,0x2f,0x61,0xa2,0x67,0xa7,0xf3,0x04,0x14,0x1c,0xd4,0x3e,0x85,0x7c,
+  0xf8,0x02,0x27,0xda,0x8e,0x2f,0x2c,0xbe,0x72,0x41,0xe0,0x4f,0x10,0xd7,0xd3,0x41,
+  0x7f,0x43,0x4c,0x31,0x68,0xf2,0xc1,0xe9,0xc9,0x6f,0x63,0xfa,0x7d,0xe0,0xf4,0x3a,
+  0xf1,0x0e,0x09,0x65,0x74,0xe1,0x82,0x18,0x55,0x91,0x26,0xa8,0x55,0x1c,0x47,0x9a,
+  0x05,0xc4,0xe3,0xd4,0x22,0x4b,0xe2,0x7a,0x9d,0x28,0x33,0x8e,0x9c,0x3c,0x48,0x07,
+  0x64,0xdb,0x52,0x48,0x1a,0xad,0xf9,0xed,0xdb,0x8c,0x0a,0xbe,0x78,0xa9,0xac,0xd9,
+  0x90,0x05,0xee,0x0c,0xbe,0x49,0x97,0xde,0x5d,0x82,0x75,0x27,0x0d,0x23,0x6f,0x8c,
+  0x1b,0x27,0x24,0x4e,0xb1,0x0d,0x0d,0x6d,0xab,0xb5,0x66,0xb5,0xbf,0x0c,0x47,0xc9,
+  0x6a,0x8c,0x34,0x33,0x18,0xc6,0x1d,0x34,0x24,0xa2,0xf1,0xb4,0xa6,0x1e,0xfd,0x03,
+  0xbe,0x5c,0x88,0x2d,0x27,0xc2,0xd4,0xb8,0x41,0x7c,0xe1,0xab,0x0c,0x30,0x73,0xfa,
+  0x2e,0x8d,0x7c,0x43,0xc7,0x9a,0xc2,0xe2,0x26,0x84,0x0b,0xca,0xbc,0x7e,0x5f,0x6a,
+  0x4e,0x77,0xef,0xe8,0x78,0x70,0xb0,0xdf,0xba,0xd4,0x65,0x21,0xf5,0x3c,0x8d,0x95,
+  0x6d,0x45,0x9c,0xe8,0xc8,0xf4,0xe4,0xd6,0xf3,0xb9,0x2d,0x61,0x0d,0x5a,0x0b,0x5a,
+  0x4f,0xce,0x0a,0x91,0xfc,0x36,0x86,0x7a,0x50,0xec,0x8e,0xeb,0xa7,0x76,0x0f,0x7d,
+  0x61,0xf2,0xd5,0x97,0xf6,0x2a,0xb9,0x5d,0xb2,0xf3,0x46,0x71,0x4b,0xb5,0xb9,0x47,
+  0x42,0x1a,0xa6,0x6e,0xe4,0x12,0xda,0xf2,0x92,0xd4,0xf4,0xea,0xed,0xdb,0xcb,0xab,
+  0x36,0x41,0xce,0x78,0x2f,0xe5,0xf5,0x09,0x82,0x5e,0x53,0x51,0x27,0x51,0xee,0xe5,
+  0xab,0x6c,0xc6,0x3e,0x09,0xc0,0xc1,0x0e,0x9a,0x04,0x9e,0x05,0x8d,0x5a,0xbd,0xa2,
+  0x26,0x5a,0x20,0x7d,0x4b,0x34,0x11,0x7e,0x90,0x06,0xc2,0xdf,0xba,0xcd,0x03,0xf9,
+  0x01,0x74,0x97,0x38,0xe1,0xab,0xab,0xf0,0xf9,0xb9,0xed,0xa5,0x48,0x1a,0xa6,0x7a,
+  0xce,0xab,0x56,0x3e,0x89,0x14,0xa0,0xe4,0x69,0xbb,0x14,0xc2,0x00,0x65,0x78,0x8a,
+  0x8d,0x62,0xcc,0x9f,0x88,0x5d,0x40,0xbe,0x47,0xbc,0x18,0x53,0xeb,0x8d,0x4c,0xe9,
+  0x03,0x4f,0x7a,0x58,0x88,0xc6,0x15,0x01,0x11,0x19,0xed,0x34,0xb6,0xb6,0x26,0x79,
+  0x31,0x70,0xa7,0x97,0x28,0x2d,0xad,0xdc,0xeb,0x13,0x4c,0x3c,0x9a,0xc9,0x90,0xe1,
+  0x96,0xb0,0x16,0xc9,0xc0,0xf5,0x2e,0xe8,0x78,0x5e,0x7b,0x03,0x67,0x7a,0xca,0xce,
+  0x34,0x50,0xcc,0xa7,0x21,0x18,0xec,0x90,0xeb,0x13,0x6d,0x64,0x3b,0x0a,0x7d,0xbf,
+  0xed,0x31,0xbb,0xf8,0x94,0xae,0xb7,0x68,0x76,0x90,0xf9,0xde,0x79,0xae,0xd0,0x14,
+  0xbe,0x46,0xe8,0x39,0x79,0x13,0x8b,0xd8,0x9b,0xca,0xa8,0xa6,0x0d,0x39,0x30,0xa4,
+  0xb8,0xf3,0x78,0x8b,0x0e,0x62,0x68,0x61,0x25,0x52,0xa4,0xf6,0xab,0x26,0xde,0x73,
+  0x32,0xc3,0xfb,0xa3,0xe3,0xdd,0xe1,0xf3,0xe3,0xa3,0x23,0xb4,0x97,0x59,0xa8,0x26,
+  0x93,0x36,0x9a,0xba,0x8c,0x0f,0xe7,0x90,0xf8,0x24,0x8c,0x7f,0x14,0x8e,0x50,0xfa,
+  0xd9,0x4e,0x3e,0xb0,0x5c,0x6c,0x3f,0x51,0x93,0x05,0xf9,0x98,0x2a,0xd2,0x79,0xb2,
+  0x14,0xc1,0x71,0xc0,0x96,0xd0,0x4e,0x80,0x52,0x31,0x4c,0xb6,0xa1,0xe3,0xb8,0xa9,
+  0xdb,0xd0,0xf4,0x0d,0xfe,0x1f,0x82,0xce,0xf5,0xb2,0xdd,0x4a,0x54,0xef,0xf8,0xfa,
+  0x28,0xf0,0xa9,0x6f,0x27,0x17,0xc1,0x98,0xb0,0x4d,0xda,0xb9,0xd8,0xb7,0x91,0x66,
+  0xb6,0xc9,0x88,0x6b,0xec,0x3c,0x19,0xce,0x63,0x5f,0x6c,0x8d,0xe9,0xe3,0x2e,0xa3,
+  0x1d,0x0a,0xc8,0x37,0x0e,0x65,0xdb,0xd8,0x12,0x98,0x3e,0xd2,0x8e,0xc1,0x25,0x89,
+  0x6d,0x68,0x26,0xab,0xab,0x89,0x50,0xff,0x5c,0x8f,0xa2,0x30,0x90,0x93,0x0b,0x14,
+  0x10,0x85,0x91,0xb8,0x8e,0x8d,0x30,0x37,0xb6,0x8f,0x38,0x7a,0x75,0x10,0xa0,0x38,
+  0x49,0xeb,0x1b,0xea,0x36,0x41,0x90,0xd3,0x09,0x99,0x22,0x36,0xb1,0xb9,0x46,0x96,
+  0x10,0x3e,0xe0,0x54,0x92,0x31,0xe6,0x6e,0xbf,0xbf,0xb9,0xbe,0xd9,0xd2,0xb7,0x51,
+  0x09,0xb5,0xe8,0xab,0x6c,0xc2,0xa2,0x34,0x45,0x53,0x0d,0x9c,0x05,0x8f,0x6d,0x98,
+  0x88,0xfa,0xc4,0x9b,0xcd,0x6d,0xe1,0x02,0x98,0x86,0xb5,0x96,0xb5,0x76,0xcd,0x6a,
+  0x48,0xe0,0xca,0xde,0xb0,0xac,0x15,0x08,0x4e,0xe7,0xbc,0x54,0x7e,0x57,0x77,0xe4,
+  0x4e,0x25,0xdc,0x06,0x07,0x54,0x80,0x3a,0x1f,0x27,0xae,0xed,0x23,0x03,0x49,0x9c,
+  0x39,0x69,0xe2,0xae,0x83,0xcc,0x63,0xa1,0x83,0x1c,0x05,0x1c,0x90,0xa2,0x87,0x81,
+  0xe3,0x81,0x28,0xb1,0x8f,0xd3,0x99,0x73,0xab,0xa7,0xf3,0x55,0xf1,0xc5,0x2e,0x61,
+  0xae,0x70,0xfe,0x82,0x39,0xa3,0xbc,0x68,0xab,0x57,0xa4,0x7e,0x74,0x40,0x1f,0xa1,
+  0xae,0xe0,0x1c,0x81,0xc6,0x91,0x93,0x0b,0x30,0x78,0xb3,0xd5,0x89,0xe7,0xfa,0x4e,
+  0xd2,0x1f,0x4f,0xbd,0xe8,0x29,0xb8,0xdd,0x60,0x53,0xa2,0xc7,0x8e,0x03,0x8d,0x4d,
+  0x58,0x58,0xdd,0xbc,0x13,0x8e,0x20,0xd3,0xf7,0xc0,0xb1,0x9e,0xa6,0x8b,0x8a,0xb5,
+  0x94,0xd4,0x77,0x18,0x4c,0xc2,0xa6,0xd3,0xa5,0x95,0xe3,0x80,0xb5,0x28,0x67,0x84,
+  0xc6,0x87,0x71,0xeb,0xb2,0xc4,0x28,0x41,0xb6,0x82,0x99,0xba,0x0b,0x66,0xd4,0x3c,
+  0xf2,0x73,0x67,0xea,0x39,0x6e,0x9e,0xad,0x39,0x1d,0xd7,0x1d,0x4c,0xb9,0xdf,0xbb,
+  0x49,0x04,0x1f,0xae,0x81,0xff,0x4c,0x4b,0x04,0x9b,0xa0,0x28,0xe7,0x14,0x2b,0xa4,
+  0x32,0x4c,0xd7,0x21,0x32,0x86,0x7e,0x77,0x98,0x95,0x5b,0xdd,0x90,0x05,0xcc,0xfb,
+  0xbc,0x50,0xab,0x03,0xbf,0x5f,0x14,0x76,0xb0,0x04,0x10,0xd5,0x38,0xa9,0x0c,0xa0,
+  0xc9,0x7e,0x28,0x33,0x42,0xa7,0x2b,0x72,0x48,0xcc,0x80,0x0f,0x2b,0x5e,0x44,0xc3,
+  0x0d,0x85,0x95,0x09,0xf5,0xc6,0xc9,0x9b,0x10,0x06,0x14,0xc3,0xd0,0x50,0x75,0x29,
+  0x04,0x13,0xa5,0xa6,0x76,0x72,0x18,0x01,0x29,0x22,0x77,0x75,0x55,0xfa,0xc1,0xa3,
+  0x4f,0xf2,0x0a,0x02,0x9d,0x5a,0xf5,0x9b,0xb4,0xbe,0xd5,0x55,0xfa,0xb7,0x2c,0x6a,
+  0xa4,0x86,0x8d,0x98,0x2f,0x43,0xa6,0xcd,0xf5,0x71,0xf1,0x48,0x92,0x12,0x4a,0x42,
+  0x07,0x24,0x62,0xb3,0x73,0xf8,0x26,0x6d,0x29,0x5d,0xfd,0xe7,0xd0,0x3d,0xf6,0x61,
+  0x98,0xc9,0x53,0x92,0xd6,0x24,0x26,0xb0,0x69,0x3d,0x2f,0x52,0xb8,0x96,0x0f,0x1c,
+  0x1e,0xca,0x93,0x63,0x34,0x66,0xda,0xca,0x14,0xc3,0x51,0xb6,0x5a,0x49,0xd6,0x70,
+  0x29,0x1f,0xe4,0x46,0x31,0xce,0x90,0x58,0x48,0x21,0xa1,0x0c,0x28,0x29,0x8f,0xf8,
+  0xb5,0xa5,0x22,0xad,0xea,0x32,0x34,0xac,0x55,0xb7,0x90,0x12,0x0b,0x6b,0x17,0x51,
+  0x5a,0x80,0xa1,0x30,0x46,0x43,0x81,0x4b,0x43,0x3e,0x42,0x48,0x4a,0xbc,0xad,0x26,
+  0x47,0x2c,0xab,0x3e,0x23,0xca,0x61,0xd5,0xf6,0x17,0xc2,0x16,0x45,0xf5,0xf4,0x86,
+  0xea,0x01,0x42,0x50,0x8f,0xa2,0x48,0x87,0x1a,0xf2,0x3f,0x3f,0xb5,0x47,0xcd,0xd4,
+  0x1e,0x3d,0xc3,0x85,0xf5,0x51,0x1a,0xd0,0xe0,0xf1,0x98,0xaa,0x7a,0x69,0x64,0xba,
+  0x0b,0xa5,0x3a,0x0c,0x30,0x17,0x93,0xe6,0x08,0xf4,0x0d,0x11,0x24,0x11,0x37,0x40,
+  0xe4,0x65,0x64,0x03,0x4d,0x6f,0x5c,0x12,0x37,0x44,0x3c,0x80,0xbd,0xd0,0x46,0x31,
+  0x7a,0xe9,0xba,0x80,0x0d,0x3e,0x32,0xfc,0xa3,0x33,0x23,0x43,0x47,0x83,0x6d,0xe0,
+  0x53,0x48,0x4d,0x6d,0xd1,0x65,0x82,0xc7,0x04,0x08,0xd2,0x77,0x49,0x10,0x44,0x61,
+  0x84,0xb6,0xec,0x57,0x06,0x4a,0x78,0xc6,0xe2,0x28,0xa5,0x2c,0x83,0x5e,0xdf,0x81,
+  0x02,0x39,0x76,0xb1,0xb2,0x0a,0xb7,0x58,0x5a,0x25,0xb3,0x80,0x07,0x80,0x72,0x75,
+  0x15,0xfe,0xc9,0x00,0xa1,0xb8,0xfc,0x53,0x63,0x89,0x98,0x70,0xd3,0x90,0x3e,0xa5,
+  0xb0,0x2f,0xc8,0xa3,0x6b,0x0e,0x28,0x80,0x15,0x6b,0x8d,0xb5,0x73,0xcd,0x5a,0x79,
+  0x45,0x23,0xdd,0x62,0xef,0xa9,0xb9,0xa1,0x4d,0x8e,0x8f,0x48,0x87,0x03,0xb7,0x2e,
+  0xf9,0x57,0xb1,0x9c,0xe4,0x03,0x38,0x30,0x7d,0x7c,0x66,0xbf,0x61,0xac,0x46,0xb3,
+  0x7d,0x3e,0x05,0xc7,0x0b,0xbe,0x56,0x57,0xc1,0xb4,0x0a,0x14,0xab,0xab,0x77,0xe5,
+  0x9f,0x5d,0xd4,0x30,0xdb,0x03,0x0b,0x69,0x09,0x4e,0xe3,0x4e,0x06,0xdc,0x5b,0x01,
+  0xf3,0x73,0xa0,0x95,0x69,0x51,0x8f,0xed,0xf4,0xd1,0xb1,0x55,0x23,0x63,0x4e,0x33,
+  0x06,0x71,0xef,0x28,0x67,0xac,0x32,0xe2,0xf5,0x98,0x23,0xd1,0x0e,0x40,0x51,0xa9,
+  0x1a,0xcc,0x0b,0x45,0xd0,0xb7,0x6f,0xc9,0x1f,0xa6,0x10,0xd4,0x09,0x46,0xf5,0xb5,
+  0x40,0xfa,0xf1,0x1b,0xcf,0x3d,0x97,0xa5,0xc8,0x75,0x29,0x00,0x5d,0x0a,0x3e,0x91,
+  0xca,0xf5,0x02,0x54,0xa4,0x26,0xa7,0xac,0x09,0x59,0xad,0x4b,0xf8,0xc7,0x10,0xdc,
+  0x18,0xc3,0xac,0xfc,0xb5,0xd5,0x16,0xa0,0x2e,0xf0,0x0d,0xf7,0x7c,0x21,0xd4,0xbe,
+  0x3b,0xb1,0x71,0x6a,0x40,0x43,0xf1,0xc0,0x88,0xbe,0x26,0x9f,0x2e,0x3b,0x90,0x42,
+  0xc8,0xc7,0x0e,0xc1,0x48,0xa3,0xfd,0x98,0x9c,0x96,0x42,0x75,0x34,0x0c,0xd7,0xa0,
+  0x5d,0x16,0xeb,0xc6,0x04,0xc3,0x65,0x66,0x92,0xf0,0x37,0xeb,0x88,0xe0,0x39,0xc3,
+  0x3c,0x01,0xc9,0x4f,0x5e,0x06,0xaf,0xb8,0x85,0xa0,0x9a,0x53,0xa4,0x86,0x42,0x9b,
+  0xbb,0x42,0xc3,0xc8,0xee,0x75,0xf2,0x83,0x2f,0x91,0x25,0x69,0xcd,0xee,0x4a,0x22,
+  0x0e,0xa0,0x13,0x94,0xaf,0xdb,0xeb,0xad,0x4b,0x56,0x3b,0xa6,0xbe,0x5c,0x7f,0xc5,
+  0xc6,0x63,0x8e,0x9d,0xb7,0x82,0xfe,0x2e,0x6c,0x78,0x9b,0xc1,0x33,0x1b,0x65,0x12,
+  0xf2,0xd5,0x95,0x69,0x76,0x24,0x5b,0x32,0xee,0x7e,0x16,0x7b,0x74,0x00,0xb9,0x47,
+  0x75,0x99,0xac,0xcb,0x90,0x98,0x41,0x4d,0xeb,0x7a,0x97,0x9b,0xd7,0x0c,0x7a,0x1c,
+  0xbb,0x92,0xa7,0x02,0x83,0x0e,0xea,0x2d,0x1a,0x60,0x0f,0xdc,0x74,0x5a,0xb4,0x27,
+  0xec,0x31,0xfe,0xea,0x5b,0xf2,0x48,0xd1,0x1b,0x77,0x61,0x64,0x72,0x03,0x67,0x0f,
+  0x7a,0x34,0xa9,0x8c,0x6c,0xd5,0xc2,0xf2,0xe0,0x92,0xc7,0x9f,0x9d,0x3e,0x3d,0xea,
+  0x5b,0x9f,0x00,0xd6,0x06,0x41,0xd0,0x5f,0x61,0xb3,0xb8,0x95,0x6d,0x39,0x11,0x99,
+  0xe0,0x05,0x67,0x90,0x78,0x0f,0x52,0xb7,0x3f,0x89,0x1a,0x49,0x7a,0xe1,0xbb,0xfd,
+  0x15,0x74,0xd4,0x3a,0xb6,0xef,0x9d,0x05,0x5b,0xb8,0xa1,0xda,0x8d,0x57,0x1a,0xc2,
+  0xf5,0x92,0x8a,0x81,0x5d,0x03,0x15,0x61,0x3f,0x31,0xb6,0xfb,0xc9,0xbd,0x88,0xe1,
+  0xb2,0x7a,0x65,0xa3,0x09,0x4e,0x7f,0xe8,0xa8,0x43,0x9a,0x86,0x9b,0xe2,0x84,0xb0,
+  0x4a,0x26,0xa4,0x92,0x44,0x0b,0x66,0x8e,0x2a,0x07,0x46,0x73,0x60,0xce,0x31,0x2b,
+  0x84,0x73,0x6a,0xa2,0x21,0x0d,0xb5,0x66,0x18,0xef,0x23,0xdf,0xbe,0xe8,0x60,0x84,
+  0xd4,0xf6,0x4b,0xeb,0xd7,0x26,0xc4,0xe0,0x24,0x24,0xed,0x04,0x24,0xe9,0x06,0xc9,
+  0x42,0x24,0xed,0xd3,0x2a,0x07,0xa4,0x46,0x98,0xdc,0x12,0x44,0x30,0xc7,0xa5,0xa8,
+  0xcc,0x64,0x26,0x90,0x83,0x1b,0x2b,0xe8,0x30,0xad,0x21,0x1c,0xd0,0x4c,0xb6,0x02,
+  0x73,0x10,0xbc,0xf1,0xe2,0x30,0x40,0xcd,0xb2,0xf9,0x5a,0x8c,0x09,0xa5,0x17,0x44,
+  0xf3,0xb4,0xe3,0xb8,0x6f,0x3c,0x70,0x6f,0xcc,0x88,0x0f,0x11,0x64,0x9f,0x42,0x14,
+  0x60,0x99,0xc1,0x60,0x1a,0x5f,0x98,0x8b,0x3f,0x25,0x79,0x05,0x05,0xa7,0x76,0xec,
+  0x9c,0xc3,0x78,0xd2,0xc1,0xdd,0x18,0x05,0xf5,0x7f,0xc6,0x60,0x4e,0x11,0xa4,0x00,
+  0xcf,0xb9,0x17,0x83,0xbd,0x49,0x0a,0x30,0x7c,0xce,0x72,0x19,0x6f,0xf8,0x4f,0x32,
+  0xeb,0x34,0xe3,0x1b,0xb9,0xc1,0x78,0x3a,0xb3,0xe3,0xd7,0x66,0x84,0xbb,0x3c,0xbb,
+  0xa0,0xb8,0xfb,0x75,0x14,0xc6,0xa9,0xb9,0xec,0x01,0xc9,0x23,0xee,0x63,0xd1,0xca,
+  0xa0,0x38,0x4a,0x5b,0xab,0x33,0x4f,0x37,0xe5,0x8e,0x49,0x26,0xe6,0x43,0xe2,0x0d,
+  0x4b,0x1d,0x96,0x6d,0x24,0xee,0xaf,0xfc,0xfa,0x2f,0x7f,0xca,0xfb,0xac,0x04,0x49,
+  0xfb,0xed,0x74,0x13,0xba,0x3f,0x64,0xb2,0x5d,0xa1,0xae,0xd6,0x99,0x8b,0xa8,0x95,
+  0x06,0x6c,0xbd,0xb3,0x91,0xa8,0xea,0xb4,0x1e,0xe1,0x38,0x35,0x1f,0x7a,0x20,0x12,
+  0x13,0xd9,0xff,0xf4,0x8b,0x6f,0xff,0x8e,0xd3,0x2d,0x00,0x33,0xaa,0x25,0xf4,0x98,
+  0xd1,0x39,0x8b,0x3d,0x07,0xc0,0x7b,0xd3,0x35,0xb5,0x6e,0x92,0xe9,0xa5,0xee,0x6c,
+  0x25,0x5f,0x46,0x67,0x59,0x7f,0x65,0x02,0xee,0xc8,0x10,0xb7,0x34,0xf9,0xbc,0xea,
+  0x2c,0x85,0xd6,0x4d,0x2c,0xa6,0x8e,0x88,0xec,0x2b,0xc3,0x12,0x34,0xdc,0xd0,0x25,
+  0xf0,0x6b,0x56,0xe3,0x93,0x24,0xb2,0x03,0x19,0x3f,0xf8,0x04,0x5e,0x42,0x58,0x41,
+  0xb1,0xf3,0xdf,0x14,0x37,0x42,0x6f,0x37,0x04,0x16,0x9e,0x29,0xaa,0x65,0x52,0x61,
+  0x63,0x56,0x34,0x1f,0xcc,0x67,0xa0,0x91,0x17,0x2c,0xc8,0x01,0x3e,0x17,0x4c,0xfb,
+  0x4c,0xb5,0x92,0x0c,0xc1,0x4b,0xfc,0x21,0xd7,0xf7,0x2f,0xb2,0x1a,0x27,0xb1,0xfb,
+  0x15,0x20,0x78,0xfa,0xd9,0x37,0x37,0x65,0x24,0x50,0x37,0x54,0xab,0xe5,0x09,0x75,
+  0xd8,0x98,0xb5,0x4d,0x6f,0xfb,0xcd,0xa8,0x9a,0xd9,0xe3,0xe1,0xb9,0x37,0xf1,0x38,
+  0x51,0xfc,0xf7,0x22,0xa2,0xb5,0xc7,0xcb,0xa5,0x69,0x1e,0x61,0xf0,0x8e,0x53,0x44,
+  0x7f,0x55,0xd2,0x83,0x8b,0x31,0x52,0x49,0x70,0x62,0x67,0x76,0xfa,0x82,0xfc,0x6e,
+  0x32,0x42,0x69,0x6e,0x4b,0x27,0x16,0xac,0x16,0x03,0x00,0x02,0x23,0x37,0xb6,0xc1,
+  0xd9,0xc4,0x4d,0xe5,0x9d,0x8f,0x3f,0xfe,0xb8,0x75,0x79,0x73,0xa1,0x23,0x56,0x59,
+  0xe6,0xf8,0xbb,0x5e,0x73,0x24,0x7a,0x24,0x7e,0x4b,0xa9,0xdd,0x34,0x7c,0xe2,0x7d,
+  0xed,0x3a,0xcd,0x0d,0xc0,0xd7,0xf8,0xc7,0x5f,0xed,0xa9,0x2d,0xbb,0xba,0x43,0xa8,
+  0x2f,0x15,0x4d,0x91,0x25,0xa2,0xa3,0xd9,0xd0,0x71,0xc1,0xd1,0xf3,0x13,0xb3,0x39,
+  0xfa,0xe3,0xff,0x23,0xd4,0x46,0x81,0x16,0x36,0x89,0x55,0x37,0xbd,0xaf,0x58,0x14,
+  0xa8,0x78,0x3a,0xa4,0x25,0xcc,0x78,0x7f,0xfe,0xb7,0xc2,0xd6,0x48,0xb0,0x0c,0xeb,
+  0xfd,0xdb,0xb2,0x74,0xe0,0x88,0xfa,0xc3,0xc4,0xfb,0xc6,0xcd,0x4c,0x11,0x4b,0xa8,
+  0xd3,0x19,0x40,0x87,0x28,0x99,0x5d,0x42,0x33,0x2e,0xaa,0xfb,0xf7,0x36,0xd6,0x1f,
+  0x7c,0xf4,0xf0,0xc3,0x47,0x2d,0x21,0xa7,0x4d,0x94,0xd3,0xd3,0xdd,0x65,0xf6,0x16,
+  0xca,0x22,0xdc,0xcf,0xa8,0x32,0x0d,0x53,0xea,0xf5,0x62,0x85,0x6e,0x2c,0xb6,0xdc,
+  0xee,0x4c,0xc9,0x49,0x22,0xd7,0x75,0x54,0x0a,0x49,0xd2,0x35,0x48,0x24,0xe5,0xa8,
+  0x51,0x36,0xd0,0x29,0x7f,0xab,0x8a,0x47,0x16,0x5a,0x03,0x94,0x69,0x6c,0xcf,0xcc,
+  0x9a,0xf7,0x77,0xbf,0xe4,0x24,0x2a,0xc0,0xb7,0xad,0x7a,0x69,0x98,0x6a,0xba,0x97,
+  0xa5,0xd4,0x33,0x15,0x48,0x65,0x87,0x14,0x52,0x95,0x11,0xd3,0xbb,0x24,0x1d,0x94,
+  0x71,0xf3,0x81,0xa6,0x89,0x3f,0x5e,0xae,0x26,0x82,0xd7,0x2e,0x24,0x0c,0xdf,0x0b,
+  0x50,0xce,0x8b,0x6a,0x84,0x63,0xf2,0xed,0xd3,0x3d,0x4f,0x32,0xcd,0xc4,0xef,0x05,
+  0xe8,0xe6,0x45,0x35,0xba,0x31,0xf9,0xf6,0xe9,0x66,0x46,0x77,0x12,0xdb,0x67,0x64,
+  0x8a,0x93,0x4a,0x6e,0x94,0x29,0xaf,0x5e,0xbb,0x72,0xe8,0xb2,0xde,0x27,0xe7,0x28,
+  0x43,0xcf,0x07,0xc5,0xfd,0x90,0xad,0xe1,0x00,0x57,0x9e,0x8f,0xd3,0x7e,0xd3,0xc4,
+  0x28,0x83,0xb2,0xb6,0x7e,0x6b,0x63,0x7d,0xbd,0x25,0xd5,0x91,0x63,0x55,0x14,0x87,
+  0x67,0x18,0xd3,0xef,0x8c,0xec,0x58,0xe5,0x96,0xc8,0x99,0x78,0xbe,0x2f,0xc9,0x8a,
+  0xa7,0xaf,0xf0,0xc9,0xfd,0xb9,0xe7,0xa4,0xd3,0x2d,0x6b,0x8d,0x11,0x07,0xcd,0xc0,
+  0xe6,0x66,0xbf,0x0c,0x6e,0x02,0x23,0x34,0xca,0x28,0xc5,0xe0,0x8d,0xc1,0xd6,0x10,
+  0x88,0x21,0xcc,0x0e,0x88,0x11,0xa9,0x1a,0xe6,0x54,0xe8,0xef,0xbe,0xb5,0x89,0x8a,
+  0xcc,0x4d,0xa4,0xd8,0x9b,0x77,0x30,0xf8,0x5d,0xcb,0xe4,0x44,0x05,0x36,0x27,0x92,
+  0x8d,0xce,0xed,0x13,0x7f,0x3d,0xbb,0x13,0x15,0x18,0x9e,0x48,0xb6,0x3c,0xb5,0x89,
+  0x57,0x7a,0x69,0x64,0xe8,0xa6,0x91,0xa1,0x9f,0x46,0xb7,0xd6,0x51,0xa3,0xf2,0x9e,
+  0x1a,0xa9,0x5d,0x35,0x2a,0xea,0xab,0xb2,0xe3,0x5b,0xdf,0xe5,0xc5,0x79,0x0f,0xcc,
+  0xc8,0xc8,0x52,0x3e,0xe6,0x9b,0x3b,0xed,0x5f,0x71,0x91,0x69,0xe0,0xb7,0x3d,0x11,
+  0x1f,0xf3,0x3d,0x06,0xc3,0x24,0xf1,0x9c,0x6c,0xee,0x2a,0xa7,0xd6,0x74,0x54,0x91,
+  0xf2,0x2e,0xc2,0xe3,0x06,0x80,0xd6,0x72,0xbd,0x3d,0x1a,0x3d,0x1c,0x46,0x78,0x93,
+  0x05,0x27,0x52,0x4e,0xab,0xe7,0xef,0x11,0x0a,0x63,0x20,0x11,0xf4,0xd6,0xd9,0x9d,
+  0xdd,0x02,0x81,0x5f,0xcd,0x6d,0xdf,0x4b,0x2f,0x34,0x12,0x59,0xea,0x22,0x7c,0x64,
+  0x45,0x86,0xaf,0xdd,0x8b,0x1d,0xc0,0x94,0x4f,0x6d,0x6d,0xa9,0x69,0x4b,0x66,0xb8,
+  0x17,0x0d,0x6d,0xba,0xbc,0x2d,0x5c,0x57,0x91,0xb2,0x48,0x3b,0xbc,0xa8,0x58,0x1b,
+  0xae,0x35,0x83,0x3c,0x8b,0xbc,0x70,0xe8,0xf1,0x48,0x59,0xc1,0x14,0xf2,0x5b,0x11,
+  0x89,0xd3,0xc0,0x6f,0xbb,0x3b,0xd1,0x21,0x0f,0x2b,0x55,0x07,0x41,0x4c,0xa9,0xa7,
+  0xa3,0x08,0x49,0x8d,0xe0,0x92,0x05,0xba,0x39,0x1e,0xc2,0x04,0xdf,0x8b,0xa6,0x30,
+  0xcb,0xf7,0x33,0xa9,0xaa,0xc9,0x0b,0xd0,0x88,0x25,0xc7,0xe1,0x3c,0x48,0xeb,0xd3,
+  0xc9,0x0d,0x2f,0xf2,0xba,0x33,0x0e,0xfd,0xf9,0x2c,0xd8,0xda,0xb8,0xd7,0xd9,0xa8,
+  0xd5,0x00,0xc7,0x4d,0xa9,0x49,0x62,0x5a,0x98,0x85,0xbc,0xf2,0x39,0x35,0x35,0x54,
+  0xb4,0x83,0x05,0xe9,0x6b,0xaa,0x2a,0x5b,0x52,0x9d,0xf6,0xf4,0xf0,0xec,0x91,0xeb,
+  0x24,0x0b,0x86,0x66,0xb1,0x5c,0xea,0x05,0x43,0x1f,0x06,0x5e,0x73,0x34,0x44,0x8c,
+  0x0c,0x12,0xa8,0x14,0x54,0x2e,0x40,0x06,0x4d,0x4a,0xc6,0x86,0x92,0x24,0x5d,0xac,
+  0x25,0xdd,0x4e,0x27,0x90,0xd5,0xbf,0x9e,0xe2,0xe7,0x22,0xa9,0x66,0x14,0x59,0xdc,
+  0x96,0xb5,0xa8,0x1b,0x79,0xc1,0x92,0x07,0x1a,0xb2,0xbb,0x4e,0xd8,0x6f,0xb6,0x45,
+  0xb0,0x8e,0x07,0xc5,0x48,0xea,0x00,0x93,0x3b,0x19,0x96,0x66,0x46,0x2b,0x4d,0x5c,
+  0x70,0x70,0x2c,0xea,0x32,0xbd,0xfc,0x1a,0x22,0xc7,0x93,0xa4,0x71,0x18,0x9c,0x69,
+  0x83,0xfc,0xc4,0x3b,0x9b,0xc7,0x2e,0xd1,0x00,0xe0,0x99,0x34,0xce,0xab,0x19,0x8c,
+  0xcf,0x04,0xc3,0xf6,0x27,0xa3,0x58,0xe0,0xac,0x2f,0x9f,0xad,0xc6,0x27,0x64,0xe5,
+  0x8b,0x5c,0x09,0xd8,0x5f,0x09,0xe6,0xb3,0x11,0x2e,0x70,0xea,0x2c,0x22,0x18,0xd8,
+  0x95,0x0e,0x2b,0x39,0x91,0xae,0x34,0x66,0x1e,0x54,0xb3,0x0e,0x7f,0x6d,0xe8,0x06,
+  0x0f,0x3e,0xd2,0x9c,0xb6,0x8f,0xd6,0xa3,0xaf,0x7b,0x11,0xf4,0x77,0x2f,0x38,0xdb,
+  0x7a,0x08,0xdf,0x33,0x3b,0x3e,0xf3,0x02,0xf2,0x39,0x0a,0x63,0xc7,0x8d,0xb7,0x36,
+  0xa2,0xaf,0x1b,0x49,0xe8,0x7b,0x4e,0xe3,0x07,0xe3,0xf1,0x98,0xa5,0x76,0x62,0xdb,
+  0xf1,0xe6,0x09,0xc2,0xad,0x80,0x26,0xd1,0xc6,0xd1,0x4d,0x2c,0x9c,0xf7,0xa3,0x34,
+  0xc0,0xed,0x03,0xd0,0x05,0x3d,0x0c,0x8c,0x2b,0xda,0x41,0xb6,0x2b,0x0d,0x29,0xd7,
+  0x8c,0x4b,0x40,0x7f,0xf6,0x9f,0xfe,0xdf,0x3f,0xfc,0x6c,0xa5,0x11,0x06,0x64,0xab,
+  0x02,0xe7,0xfc,0x2e,0x6d,0xda,0xd1,0xc1,0x7e,0xb3,0xc5,0xb9,0x26,0xa3,0xa2,0xdc,
+  0xa3,0x64,0x10,0xae,0x4b,0x9c,0xaf,0x4f,0x1c,0x59,0x41,0xc1,0xc5,0xbe,0x82,0x20,
+  0xd4,0x7f,0x95,0xe8,0x42,0x30,0x13,0x55,0x02,0x87,0x42,0x52,0x39,0xa3,0x92,0x39,
+  0xd9,0xbf,0xa5,0xd0,0x32,0xc2,0x43,0x8b,0x66,0x0e,0xfd,0x95,0x44,0x06,0x28,0xc2,
+  0x2e,0x42,0x66,0x04,0x90,0x82,0x0b,0x54,0xae,0xad,0x6a,0x01,0x17,0x6c,0xc7,0x35,
+  0x33,0xe0,0xa7,0x7f,0xa0,0xd6,0xfc,0x04,0x20,0xa5,0x96,0xc3,0xaf,0x05,0xea,0xc5,
+  0xb3,0x84,0xb8,0x48,0xaf,0x0c,0xfe,0x30,0x2a,0x0c,0x8b,0x3c,0xfc,0x3f,0xd6,0xda,
+  0x7d,0x1c,0x64,0x75,0xb3,0x82,0x0b,0x54,0xef,0xd8,0xc1,0x99,0xb6,0x6d,0x80,0x22,
+  0x99,0x4c,0x8c,0x5c,0xff,0x6f,0xff,0x51,0xab,0x7d,0x32,0xd1,0xab,0x9f,0x4c,0x94,
+  0xfa,0xf3,0x03,0xdf,0xa2,0x9e,0x5a,0xe0,0x86,0x11,0x4c,0xdf,0x0a,0xc2,0x14,0x3f,
+  0xfd,0x77,0xbc,0x7a,0x0e,0x57,0x30,0xa8,0xf1,0x6c,0x65,0x44,0x53,0x12,0xbf,0xff,
+  0xc3,0x19,0x6f,0xce,0xf2,0xc7,0x33,0xb4,0xeb,0xc4,0x4b,0x13,0xdb,0x49,0x78,0x42,
+  0x3d,0x57,0x4f,0x50,0xb6,0xa0,0xab,0x77,0xbb,0x63,0x2d,0xa7,0x4a,0x1d,0x68,0x05,
+  0xad,0xdf,0x85,0x91,0x56,0x68,0x7f,0x6e,0xa8,0x55,0xf5,0xfd,0xb6,0xc6,0x5a,0xc1,
+  0xa2,0xdc,0x40,0xab,0x2a,0xdb,0x3b,0x1d,0x69,0xf5,0xa6,0x55,0x69,0x67,0xed,0x46,
+  0x52,0x24,0xc6,0x56,0x32,0xc5,0x65,0xed,0xdc,0x60,0xed,0xdc,0x58,0x5f,0xff,0x5e,
+  0xbb,0x14,0xcf,0xdc,0xf0,0x39,0x36,0xef,0xbb,0xe4,0x50,0xe4,0x69,0x32,0xbb,0x13,
+  0x1a,0x41,0xf9,0x5e,0x64,0x07,0x40,0x0c,0xd9,0x04,0x26,0xd7,0xcc,0x6e,0x74,0x5c,
+  0x69,0x6c,0x89,0x26,0x0b,0xb8,0xa2,0xbe,0x54,0xbf,0xb1,0xb1,0xed,0x05,0xa3,0xf0,
+  0xbc,0x70,0xb0,0xca,0x9a,0x0a,0x9a,0xf5,0xdc,0x4e,0x31,0xa8,0xde,0xfc,0xc2,0x62,
+  0xc5,0xbe,0xb0,0x44,0x9b,0x59,0xca,0xbb,0x71,0xa0,0x14,0x5a,0x48,0x19,0x89,0x92,
+  0x77,0xe5,0x4b,0x29,0x44,0x60,0x19,0x89,0x86,0x25,0xb8,0x55,0xe3,0xa9,0x9d,0x14,
+  0x90,0xf1,0xb3,0x7f,0x5d,0x44,0x06,0x29,0x24,0xd1,0x41,0x7e,0x2f,0xa6,0x85,0xe3,
+  0x79,0x92,0x86,0x33,0xe8,0x51,0x7e,0x18,0x97,0xeb,0xa1,0x0c,0x59,0xa4,0x89,0xb2,
+  0x09,0x63,0x28,0x99,0x05,0xdb,0xa3,0xbf,0x98,0xed,0xfa,0xc1,0x64,0x82,0xb7,0x15,
+  0x08,0xe3,0x34,0x75,0xbd,0xb3,0x69,0xba,0xf5,0x10,0xad,0x13,0x35,0x54,0x1b,0x9b,
+  0xeb,0x99,0x49,0x0a,0xf0,0x68,0x68,0xce,0x10,0xf5,0xc6,0xf3,0x38,0x09,0xe3,0x2d,
+  0x72,0x6f,0x10,0x0e,0x58,0xd7,0xb7,0x4b,0x5a,0xe3,0x33,0xde,0xff,0xd1,0xdf,0xab,
+  0xbc,0xdf,0x23,0x4c,0x20,0x8d,0xc9,0x1b,0x25,0xc1,0x98,0x45,0x6c,0x52,0x89,0x93,
+  0x3b,0xb4,0x7d,0xbf,0xda,0xd1,0x55,0x34,0x02,0x4a,0x49,0xfa,0x20,0x23,0xaa,0xe9,
+  0xf7,0x16,0x86,0x7d,0x06,0x74,0x63,0x69,0x76,0xca,0x0e,0xef,0xa8,0x48,0xe5,0xe7,
+  0x35,0x9c,0x6e,0x08,0x23,0x5b,0x97,0xa7,0xdf,0x55,0xef,0x8e,0xde,0xd1,0xb2,0xb7,
+  0xd6,0xb3,0xf3,0x6c,0xc7,0x78,0x21,0x99,0x83,0xe7,0xd8,0x10,0x64,0x75,0xb5,0xa9,
+  0xa1,0x14,0x27,0xb4,0xb4,0xfb,0xa8,0x77,0xf0,0x10,0xce,0xd6,0xdd,0xbb,0x3a,0x98,
+  0x74,0x54,0xee,0x74,0x92,0x52,0xcc,0xe9,0x24,0x55,0x10,0xc3,0xef,0x1a,0x78,0x15,
+  0x28,0xba,0x61,0xbb,0x66,0xcc,0x0b,0x29,0x1a,0xd2,0xdd,0xb8,0x66,0xd5,0xfa,0x93,
+  0xbf,0xc1,0x21,0x8f,0x49,0x4a,0x82,0xbe,0xed,0xe8,0xed,0xf5,0x1d,0xd2,0x30,0x17,
+  0xf5,0x21,0x6c,0xbf,0x96,0x23,0x5a,0x3b,0x9a,0xeb,0x05,0x6a,0x18,0xd7,0x0b,0x16,
+  0xa1,0x96,0x16,0xcf,0xbb,0x64,0x58,0xd7,0x30,0x71,0xec,0x72,0x93,0x27,0xc0,0x24,
+  0x47,0x0d,0xdd,0x2e,0xd2,0x6c,0x44,0xdd,0x85,0x3c,0xd3,0x1e,0x49,0x56,0x70,0xec,
+  0xd7,0xc2,0x3f,0xf6,0x8b,0xf1,0x8f,0x97,0x1c,0x21,0xe7,0xdd,0x4f,0x0c,0xe4,0xe1,
+  0x22,0x1b,0x1c,0x08,0x4f,0x79,0x91,0x0e,0xdb,0xf5,0x8e,0xa8,0x78,0x5a,0x71,0x5c,
+  0x79,0xd9,0xb3,0x92,0xe5,0x49,0xb4,0xd0,0xf1,0xc6,0xd6,0x0e,0xf6,0x1f,0x2b,0x1e,
+  0xb7,0x26,0xfa,0xaa,0x89,0xc5,0x87,0xeb,0xa5,0x33,0x83,0xeb,0xab,0x49,0x39,0xd1,
+  0x7b,0x47,0x45,0x44,0xa3,0x3e,0x2d,0x46,0x34,0x0e,0x62,0xb9,0x9d,0xc7,0x5c,0x8b,
+  0x4a,0xe9,0x56,0x75,0x8b,0x06,0x02,0x3e,0xa1,0x87,0xd2,0x04,0xa9,0x27,0x02,0x93,
+  0x42,0xc2,0xc7,0xf2,0x3c,0x65,0x43,0x72,0x05,0x36,0xb3,0xd9,0x89,0xe3,0x38,0xa6,
+  0xd9,0x89,0xa5,0x5d,0x0b,0xfd,0x80,0x1e,0xe2,0x23,0x6d,0x09,0x23,0x32,0xa0,0x51,
+  0xd6,0x7c,0x61,0x59,0x6b,0xde,0x9a,0x85,0x7f,0x9a,0x1e,0x8c,0x00,0x9c,0xdc,0x1d,
+  0x8b,0x9d,0xc4,0x83,0xa1,0x60,0x8b,0x18,0xb5,0x6d,0x02,0xf8,0xc9,0x3d,0x5a,0x5c,
+  0x5a,0x24,0xa7,0x70,0x9c,0x55,0x9f,0x13,0xd2,0x1b,0xa5,0xa2,0x21,0x30,0x92,0x70,
+  0xb8,0x11,0x25,0xcd,0x7e,0xfb,0x76,0x63,0xf3,0xa3,0x96,0x10,0xd0,0xfd,0x4d,0x26,
+  0xa1,0xcd,0x87,0x8f,0xca,0x44,0xf4,0x19,0xf5,0x9e,0xca,0x2b,0xa6,0x40,0x86,0x9a,
+  0xa9,0xef,0xf5,0xf6,0xed,0xa3,0x07,0x86,0x9a,0x81,0x1e,0x63,0xcd,0x95,0x6e,0x4d,
+  0xce,0xcd,0xa6,0x4e,0x52,0xec,0xd2,0x75,0xac,0x82,0x15,0xcd,0x7f,0x93,0x9b,0x02,
+  0x1e,0x1b,0xe2,0xc9,0x1c,0x49,0xa1,0x4b,0x43,0x76,0x1c,0x31,0xbf,0x42,0xda,0x86,
+  0xcc,0xda,0x41,0xa7,0xbc,0x9d,0x34,0x8c,0xb6,0x36,0x1e,0xd2,0xc6,0x2c,0x73,0xb6,
+  0x68,0xe8,0x11,0xcd,0xcd,0x87,0x49,0x4b,0x9b,0x47,0x1e,0xd7,0x09,0x49,0x2f,0x32,
+  0x97,0x0a,0xc3,0xb4,0xd4,0xdf,0xf8,0xd9,0x2f,0x25,0x0a,0x50,0xf2,0xbb,0x50,0x42,
+  0x8a,0x49,0x67,0xe5,0x55,0x27,0xb6,0xc0,0x7a,0x33,0x67,0xc0,0x8d,0xa8,0x5b,0x52,
+  0xc0,0xdc,0x1e,0x1b,0x23,0xb6,0x10,0xa8,0x47,0xec,0x3b,0xee,0xc1,0xc6,0x13,0xf6,
+  0xcc,0xd0,0x27,0x5b,0xb1,0x1b,0xb9,0x76,0xda,0xb4,0xe7,0x69,0xd8,0x99,0x78,0x69,
+  0x1b,0x34,0x10,0x74,0xaf,0xb9,0x81,0xb1,0x8a,0xf6,0xc6,0x04,0x6f,0xfa,0x39,0xb3,
+  0x23,0x62,0x05,0x56,0xca,0x95,0x0e,0x7c,0xb1,0x30,0x70,0x74,0x99,0x51,0xdf,0x0a,
+  0x28,0x1d,0x9e,0xbb,0xfe,0x38,0x9c,0x15,0x4d,0xb3,0x7e,0x5f,0xe3,0xcf,0x00,0x8a,
+  0x80,0x4b,0xcd,0x0a,0x49,0x6e,0x75,0x0e,0xa1,0x49,0x11,0xaf,0x47,0xe1,0xc8,0x3b,
+  0x1b,0xe2,0xa0,0x57,0xd0,0x3f,0x7e,0x69,0x26,0x91,0x97,0x32,0xd2,0xc8,0x33,0x97,
+  0x47,0x24,0x62,0x23,0x3b,0xde,0x8a,0x36,0x26,0xfc,0xb5,0x99,0xcc,0xac,0x9c,0x91,
+  0xd0,0x2c,0x7b,0x79,0xa4,0x26,0x53,0x3b,0x2a,0x22,0xf3,0x17,0x7f,0x6b,0x26,0x93,
+  0x96,0x31,0x92,0x48,0xb3,0x96,0x47,0xde,0x34,0x8c,0xbd,0x6f,0xf0,0x40,0xa8,0x3f,
+  0xf4,0x61,0xea,0x51,0x40,0xe8,0xcf,0x7f,0x66,0x26,0x54,0x2f,0x6d,0x24,0x59,0x07,
+  0x5a,0x1e,0xf1,0xf8,0xc0,0x66,0x18,0xd8,0x45,0x27,0x1c,0x7e,0xfe,0xef,0xcd,0x54,
+  0x8b,0x62,0x46,0x72,0x45,0xee,0xf2,0xe8,0x9c,0x85,0x6f,0xc0,0x8b,0x18,0x26,0x5f,
+  0xcd,0xed,0xd8,0xd8,0xf7,0x5f,0x0e,0xfe,0xe5,0x2b,0x33,0xad,0x4a,0x51,0x23,0xbd,
+  0x0a,0xc4,0xf2,0x68,0xe6,0xdb,0xf8,0x86,0xb8,0xf3,0xcf,0xcc,0xde,0x3f,0x30,0x93,
+  0x2c,0x97,0x34,0x52,0x2c,0x03,0x2c,0xb1,0xa3,0x8d,0xe3,0x90,0x0c,0x61,0x45,0xb6,
+  0xeb,0xe7,0x7f,0x51,0xd0,0xdb,0xb2,0x82,0xe6,0x2e,0x97,0xe5,0x2f,0x8f,0x5a,0x72,
+  0xc1,0xd9,0x70,0x06,0x5c,0xb0,0xcf,0xcc,0x2a,0x71,0xfc,0xe3,0x02,0x95,0x50,0x8a,
+  0x1a,0x29,0x56,0x20,0x4a,0x7c,0x94,0x4a,0xbf,0x84,0x81,0x10,0xf7,0xbf,0x01,0x4e,
+  0x2d,0xa5,0xe3,0x94,0xb0,0x98,0x95,0xe1,0xc3,0xeb,0xc8,0x0f,0xc7,0xaf,0x59,0x30,
+  0xbf,0x33,0x0a,0xa1,0xb6,0xd9,0xd6,0x47,0x30,0xfc,0x4e,0xa0,0xe7,0x77,0xce,0xa9,
+  0x7f,0x38,0x0a,0x7d,0xa7,0x47,0xa2,0x54,0x5b,0x3f,0x78,0xf4,0xe8,0x43,0xd7,0xb5,
+  0x57,0x0c,0x91,0x40,0xce,0x14,0x35,0xea,0xa7,0xb4,0x86,0x10,0xc4,0xa9,0x43,0xc1,
+  0x80,0xea,0xdb,0xc2,0xd1,0xa4,0xf4,0xc5,0xe1,0x39,0xc8,0xe3,0xbe,0xe6,0x3c,0x6e,
+  0xac,0xaf,0x7f,0xb0,0xb8,0x5b,0x0f,0x0d,0x51,0x64,0x94,0xdd,0x6d,0x9c,0xa3,0xba,
+  0xa1,0x64,0x16,0x35,0x01,0x0f,0xab,0x73,0xba,0x2b,0x04,0xb1,0x5e,0xe2,0x20,0x9a,
+  0xdc,0x30,0xbc,0x39,0xa0,0x4c,0xb1,0xa0,0x23,0xe8,0xa3,0x23,0x3b,0xc9,0x8d,0x7c,
+  0xcb,0xdc,0x31,0x19,0x4f,0xb1,0x3f,0x16,0x99,0x48,0xde,0xc4,0xd0,0x28,0x15,0xf3,
+  0xc3,0x87,0x0f,0xf5,0x28,0x73,0x70,0xe6,0x26,0x4a,0x54,0x45,0x4e,0xe3,0x8b,0xcc,
+  0x16,0xbb,0x07,0x81,0x55,0xc2,0x43,0x5d,0x24,0xd0,0xd3,0xc1,0x0b,0x1f,0x1b,0xe4,
+  0xf0,0xaf,0x82,0x3b,0x08,0x87,0x7c,0x8f,0x9a,0x58,0xc0,0xce,0x92,0x32,0xcc,0xc5,
+  0x84,0xaf,0x97,0x11,0xee,0x8e,0x5f,0x0f,0xcf,0xbd,0x58,0xba,0x33,0x40,0x4e,0x93,
+  0x08,0x37,0x1c,0xdc,0x23,0xe7,0x0f,0xd2,0x49,0x9a,0x3f,0x92,0x58,0x14,0xbd,0x03,
+  0xe0,0x52,0x67,0xfa,0xe7,0xff,0x43,0xc4,0x58,0x27,0xe9,0x77,0x3e,0x70,0x07,0x34,
+  0xaa,0x71,0x3b,0x0c,0x6b,0xde,0x5a,0xd8,0x8e,0xdc,0x5a,0x39,0x57,0x82,0x4c,0x22,
+  0xa5,0xde,0x7a,0x3c,0x92,0x47,0x0c,0xc6,0x9a,0xd5,0xf8,0xba,0xc1,0x53,0xe8,0x44,
+  0x75,0xc9,0xab,0xf3,0x91,0xa7,0x74,0x06,0xfe,0xbb,0x9a,0xce,0xa7,0x87,0x83,0xe3,
+  0x2d,0x4e,0x1a,0x89,0xad,0xcc,0xbc,0x24,0xc4,0xb3,0x02,0xc7,0x83,0x43,0x2d,0x23,
+  0x24,0x9b,0xb1,0x07,0x7b,0x47,0x3f,0x56,0x33,0x92,0xb1,0xff,0x1a,0x32,0xf6,0x06,
+  0x6a,0xf2,0x18,0xcf,0x5d,0xef,0xef,0xa9,0x89,0xce,0x18,0x12,0x4f,0x06,0xa7,0x6a,
+  0x6a,0x9c,0xa4,0xb7,0x1d,0x72,0xeb,0x15,0x8d,0x4b,0x6c,0xf9,0x67,0x8f,0xad,0xf9,
+  0xd3,0x07,0x8a,0x4f,0x9f,0x9c,0x1a,0x16,0x86,0x08,0xb3,0x8a,0xe3,0x13,0xd0,0x1c,
+  0x84,0x50,0x62,0x56,0x1a,0x5b,0x59,0x60,0xa2,0xb3,0x51,0x14,0xb4,0x7a,0x24,0x47,
+  0x44,0x88,0x0c,0xca,0xeb,0x03,0x88,0x82,0xfa,0x88,0xb4,0xaa,0x62,0x64,0x4a,0x75,
+  0x44,0xb2,0xa5,0xd5,0x21,0x84,0xb9,0x3a,0xaa,0x03,0x0b,0x55,0x07,0xfa,0x52,0x5a,
+  0xd9,0xde,0xc0,0x5c,0x15,0xea,0xd5,0x42,0x15,0x81,0x0e,0x96,0x56,0xb4,0xbf,0x67,
+  0xae,0x08,0x75,0x75,0xa1,0x8a,0x50,0xaf,0x4b,0x6b,0x02,0x00,0x73,0x55,0xa4,0x03,
+  0xd4,0x54,0x8e,0x4c,0x1f,0x77,0x8f,0xca,0xab,0xdb,0x3d,0x32,0xd7,0x36,0xf2,0x17,
+  0xd5,0xc4,0xaa,0x98,0x20,0xa0,0xd6,0x43,0x82,0x8a,0xfd,0xe3,0x3b,0x3a,0x30,0x0e,
+  0xc7,0xaa,0x5b,0xbf,0x51,0x2c,0x10,0x70,0xe7,0x42,0x81,0xaa,0x7d,0x5d,0xb4,0x4a,
+  0x1e,0xc2,0xdd,0x52,0x82,0xbb,0x28,0x34,0x73,0x6c,0xf7,0x43,0x6d,0x0f,0xca,0x02,
+  0x21,0xdb,0x15,0x12,0x88,0x5d,0x61,0x01,0x5b,0x36,0x90,0xf1,0xb8,0xed,0xdb,0xb7,
+  0xeb,0xad,0xc5,0x63,0xb7,0x99,0x52,0xb0,0x65,0x1c,0xd5,0x31,0xf1,0xdd,0x49,0xca,
+  0xcc,0xde,0x7e,0x0c,0x8e,0x4f,0xbc,0x65,0x8a,0x64,0x63,0x5f,0x20,0xb9,0x79,0x7f,
+  0x57,0x6f,0xab,0xd6,0xa0,0xc3,0xa3,0xc3,0x8f,0xef,0x3f,0xd8,0x58,0x11,0xc3,0xb2,
+  0x43,0xf0,0xe0,0x82,0x24,0xcb,0xb2,0x0c,0x6d,0x62,0x59,0xa2,0x55,0x1a,0xd2,0xc1,
+  0xe9,0x87,0x1f,0x7e,0xf4,0xb1,0x09,0x27,0xcd,0x31,0xa1,0xa4,0x39,0x19,0xc6,0x3c,
+  0x7f,0x4a,0xe6,0x2a,0x9a,0x4f,0x6f,0x8f,0x5f,0x9f,0xc5,0xe1,0x3c,0x70,0xb6,0x7e,
+  0x30,0x59,0x9f,0x7c,0x34,0x99,0x98,0xe3,0xf4,0x05,0x5b,0x12,0xd0,0xa3,0x1a,0xc5,
+  0xa8,0x8b,0x81,0x74,0x32,0x47,0x4d,0xad,0xb3,0x01,0x21,0x46,0xbf,0x36,0xeb,0xd2,
+  0xa2,0xec,0x00,0xa6,0x19,0x28,0x29,0xc5,0x3e,0x6d,0xa2,0xc3,0xc9,0xd8,0x47,0xbe,
+  0xb5,0x6d,0x53,0x1f,0xf0,0x9d,0x52,0xd8,0xc2,0xc6,0x3a,0xba,0xf0,0xa4,0x2e,0xbc,
+  0x38,0x03,0xaf,0xb5,0xc9,0xd0,0xd3,0x57,0xfe,0xd2,0xa9,0x97,0xd0,0x57,0xb1,0x69,
+  0xe0,0x97,0x38,0xd9,0xe8,0x6f,0xa6,0x30,0x42,0x66,0xc0,0x47,0xee,0x1b,0xd7,0x57,
+  0x80,0x95,0x05,0xae,0x1c,0xed,0x3f,0xa1,0x4e,0x9d,0x49,0x47,0xd7,0x0d,0xd3,0xbd,
+  0x95,0x6d,0x68,0x0b,0x57,0xd8,0x7b,0x0d,0xfc,0x51,0x15,0xb8,0x4f,0x66,0xd2,0xf4,
+  0xc4,0x4c,0xee,0x7a,0x4b,0xa3,0x00,0xa7,0x6f,0x2b,0xdb,0xc7,0x4f,0x9e,0xd4,0xdd,
+  0x0b,0x54,0x5d,0xc7,0xa3,0x07,0xe6,0x4a,0x36,0x1f,0x7e,0xb0,0xbc,0x4a,0x70,0xb5,
+  0xc5,0x58,0xcb,0xc3,0xf5,0x65,0xd6,0xf2,0xf1,0xa6,0xb9,0x96,0x0f,0x97,0xd9,0x16,
+  0x90,0xad,0xb9,0x16,0x9c,0x73,0x97,0x45,0x20,0x6e,0x7d,0x17,0x1f,0x10,0x5b,0x63,
+  0x03,0x9f,0x69,0xfd,0xe6,0x54,0x99,0xb2,0xbd,0x9b,0xe5,0x1b,0x65,0x91,0x46,0x21,
+  0xfd,0x5d,0xaf,0xd1,0x60,0xc7,0xbf,0xd1,0x12,0x0d,0x9d,0xf6,0x7d,0x0f,0x56,0x68,
+  0xc8,0x1c,0x9a,0xac,0x55,0x40,0x0b,0x6b,0xac,0xce,0xa0,0x43,0xcd,0x56,0x3e,0xa0,
+  0x80,0xbc,0xe1,0x49,0x46,0x74,0xd3,0x70,0xa1,0x40,0x46,0x62,0x12,0x49,0x8d,0x0d,
+  0x62,0x19,0x5d,0xb4,0x88,0x89,0x32,0x9a,0xb3,0x34,0xda,0x6a,0x2f,0x70,0x64,0xb4,
+  0xe5,0xd6,0x37,0x34,0x64,0x4b,0xa3,0xad,0x64,0x21,0xeb,0xaf,0x8d,0x94,0x69,0x41,
+  0x60,0x05,0xd1,0xd2,0xa8,0xaa,0xbb,0xd0,0x92,0x91,0xa5,0x2f,0xae,0xa8,0xa8,0x96,
+  0x46,0x98,0xd8,0xe8,0x5b,0x63,0x8d,0x22,0x23,0x4e,0x94,0x32,0x11,0x28,0x32,0x97,
+  0x46,0x64,0x76,0xbf,0x40,0xe5,0xa2,0x44,0x46,0x23,0x2f,0x64,0x22,0x91,0xe7,0x2d,
+  0x8d,0x42,0x12,0x7e,0xaf,0x11,0xd3,0xcf,0xc8,0x23,0x25,0x4c,0xb4,0x91,0x8c,0x92,
+  0x51,0xea,0x37,0x2a,0x48,0x2a,0x6e,0x51,0xce,0xef,0xfd,0x64,0x37,0x67,0xf2,0x23,
+  0xbf,0xf5,0x4f,0x47,0xd9,0xce,0xb8,0x64,0xb8,0x05,0x6d,0xe1,0x5e,0x01,0x83,0xd3,
+  0x6f,0x3f,0x8b,0x74,0x64,0xf2,0xf1,0x28,0xfe,0x5b,0xe3,0x9a,0xe4,0x2a,0x14,0xc5,
+  0xb2,0xb6,0x36,0xa9,0x13,0xbf,0x88,0xeb,0x40,0x1e,0x45,0x1a,0x96,0x35,0xe8,0xd7,
+  0x7f,0xf2,0xbf,0x55,0xf7,0x07,0x01,0x1f,0xef,0xef,0x49,0x41,0x7d,0x05,0x47,0xf9,
+  0x18,0x8e,0xae,0x3f,0x40,0xf2,0xb8,0xad,0x41,0xbd,0x54,0xd9,0x63,0x95,0xc3,0x34,
+  0xa4,0xd4,0x71,0xe1,0xcb,0x89,0x59,0x48,0xd3,0x50,0x0b,0x7d,0x67,0x26,0xab,0x46,
+  0x0a,0x5b,0x5f,0xef,0x5c,0x5c,0x74,0x3e,0x2b,0x91,0xfc,0x1f,0xfd,0x99,0xb4,0xf7,
+  0x95,0x83,0x96,0x0a,0x9f,0x03,0x29,0x1a,0xa0,0x24,0xbe,0x4b,0x35,0xa8,0x68,0xdd,
+  0x9f,0xab,0x7a,0x10,0xcf,0x83,0xe7,0x9f,0x3f,0xc5,0x4e,0xa4,0xab,0x82,0xda,0xf4,
+  0x32,0x55,0x00,0xc8,0xdb,0x50,0x85,0x45,0xc5,0x8a,0xf1,0xf1,0x64,0x6c,0x17,0xb8,
+  0xaf,0x7f,0xf7,0x2b,0x39,0x8e,0x8e,0x70,0xa5,0x32,0xe5,0x40,0x8a,0x4c,0x95,0xc4,
+  0xe5,0xcb,0x34,0xb7,0x2f,0x8d,0x0a,0xa2,0xbc,0x5d,0xdf,0xfe,0xa1,0x2a,0xcd,0xc1,
+  0xf3,0xc3,0x01,0x00,0xeb,0xd2,0x54,0x1b,0x5d,0x26,0x4d,0x80,0x5c,0x58,0x9a,0x84,
+  0x3c,0x5d,0x9a,0x59,0x75,0x05,0xb5,0x2c,0xbd,0x63,0xb3,0xdb,0xd1,0x92,0xb4,0xd8,
+  0x0b,0xf8,0xf6,0x6f,0xb4,0xab,0xd4,0x28,0x70,0xb9,0x2e,0x10,0x10,0x55,0x13,0xb2,
+  0xa4,0xe5,0xeb,0x81,0xe1,0xd8,0x05,0x13,0x62,0x49,0xc3,0xfe,0xec,0xf7,0x34,0x3d,
+  0x48,0xe9,0x9b,0x3e,0xf9,0x8e,0x2d,0xb7,0xb8,0x74,0xe1,0x96,0x0d,0xe5,0xce,0xf8,
+  0xfe,0xc3,0x07,0x0f,0xf3,0xcb,0xf5,0xe5,0x97,0xa8,0x33,0x0e,0xe5,0xcf,0x13,0x49,
+  0x53,0xf2,0x5f,0x4a,0x96,0x56,0x85,0x37,0x30,0x95,0x68,0x0d,0x01,0xaa,0xab,0x9e,
+  0x01,0x4c,0x49,0xc9,0x4b,0xe8,0x92,0x3f,0xc3,0x53,0x8a,0x15,0x93,0x56,0x51,0x5b,
+  0x37,0x0b,0x1d,0x93,0x4f,0x23,0x2f,0x6c,0x2e,0x74,0x15,0x09,0xb9,0x2a,0xa7,0xd8,
+  0x74,0x6b,0x77,0xea,0x54,0x0e,0x4b,0x04,0x4a,0x56,0x5a,0x91,0xf0,0x6e,0x86,0x23,
+  0x32,0xfa,0xd9,0x3e,0xbb,0x8d,0xa7,0x5e,0x50,0xe3,0xb1,0xef,0x7f,0xfa,0xfc,0xf0,
+  0x58,0x3a,0x1a,0x2f,0x23,0xa9,0x36,0x5e,0x08,0x75,0x8b,0x6e,0xc9,0xa2,0x5e,0x2f,
+  0xe1,0x38,0xef,0x02,0xb2,0x14,0xca,0xd5,0x9c,0xb4,0x42,0xd7,0x40,0x92,0xb8,0x90,
+  0x06,0x66,0x57,0xc3,0x2f,0xa2,0x85,0xe4,0xfe,0x33,0xb4,0xdd,0x81,0x1b,0xd7,0xba,
+  0x2b,0x8d,0xc1,0x16,0xdc,0x1e,0xc0,0x6f,0xaf,0xc7,0x3b,0xa0,0xe2,0x30,0x2b,0x28,
+  0xa7,0x1a,0xd8,0x90,0xeb,0x76,0x84,0x31,0xec,0x71,0xea,0x0e,0xd6,0x4b,0x87,0xcb,
+  0x1b,0xaf,0xb2,0xd3,0x26,0x28,0xdb,0x17,0xa4,0xa4,0x7a,0x7b,0x18,0x08,0x39,0xe2,
+  0xca,0xb6,0x95,0xed,0xce,0x32,0xb7,0x01,0x50,0x6a,0xa4,0xbb,0xe1,0x44,0xc2,0x22,
+  0xc4,0x31,0xc6,0x51,0x3c,0x9d,0xef,0xcc,0x45,0x65,0x19,0x85,0x5e,0xb4,0x64,0xba,
+  0xce,0xec,0xd4,0x3d,0xb7,0xc5,0x4d,0x70,0xec,0xe7,0x02,0x14,0x09,0x04,0x4b,0x25,
+  0xcb,0x09,0x92,0x61,0xe2,0xc6,0x6f,0xb2,0x6b,0xf4,0xb2,0x94,0x05,0x88,0x73,0x70,
+  0x5f,0xc8,0xf2,0xf5,0x0c,0xef,0xe6,0x53,0xf4,0x0c,0x13,0x16,0x20,0x8b,0x96,0xef,
+  0x54,0xec,0xfa,0x88,0x72,0xf5,0xca,0xc3,0x94,0x48,0x78,0x47,0xb3,0x26,0x74,0xe8,
+  0x03,0x37,0x3d,0x0f,0xe3,0xd7,0x49,0x0d,0x1f,0x1b,0xe1,0x3f,0xf7,0x9e,0x78,0x92,
+  0x5b,0x25,0x63,0xa8,0x1e,0xa3,0x08,0xa3,0x6e,0xdf,0xc3,0xa6,0xf2,0xd0,0x06,0x11,
+  0x92,0x88,0xaf,0x11,0x5d,0xd7,0xc5,0x3e,0x8b,0x12,0x7c,0x24,0x62,0xee,0x17,0xec,
+  0x20,0xfc,0xf3,0x5f,0x49,0x3e,0x5d,0x06,0x5c,0x30,0x38,0x64,0x00,0x9a,0xa3,0xa2,
+  0x24,0x17,0x0f,0x0f,0x63,0x3b,0x76,0x56,0xb6,0x4b,0x06,0x0c,0xc0,0xb4,0xa4,0x71,
+  0x02,0x69,0x52,0x87,0x89,0x2c,0xa5,0x5e,0x07,0x41,0x5a,0x98,0x9c,0xd9,0x3e,0xad,
+  0xe5,0xda,0x3b,0x20,0x07,0x9f,0x7e,0x4c,0xe7,0x8e,0x2b,0x93,0xc8,0xd3,0xea,0x13,
+  0x99,0x61,0x59,0x3e,0x81,0x61,0x70,0x96,0xa7,0x90,0x27,0x2e,0x40,0x62,0x86,0x67,
+  0xe9,0x34,0xe2,0x23,0xb3,0x3a,0x89,0x3c,0xad,0x3e,0x85,0x19,0x96,0xa5,0x13,0x98,
+  0xc0,0xc0,0xe4,0xfb,0x50,0x44,0x55,0x45,0x91,0xba,0x80,0x3a,0x4a,0x98,0x96,0x4e,
+  0xe6,0xd4,0x09,0x23,0x99,0x40,0xfc,0x5d,0x9f,0x34,0x5a,0xba,0x53,0x63,0xff,0x60,
+  0xd5,0x98,0x80,0x2b,0x89,0x38,0x26,0xd4,0x5b,0x53,0xce,0x2e,0xe9,0x0a,0x6d,0xe7,
+  0xd3,0xe7,0x03,0xfa,0xbe,0x94,0xb6,0x89,0x74,0x02,0x76,0x75,0x0a,0x53,0x92,0xa4,
+  0xf0,0xac,0xa0,0xd8,0x5d,0x2a,0x40,0x17,0xbe,0x07,0x44,0x99,0x18,0x01,0x25,0x1a,
+  0x15,0x64,0x66,0x54,0x48,0x02,0xcc,0xac,0xe4,0x19,0x94,0x5e,0xbf,0x72,0xc9,0x42,
+  0x36,0xed,0x48,0xc8,0x5b,0x55,0x65,0x83,0xd3,0xf6,0x42,0x17,0x33,0x48,0x6f,0x49,
+  0x2d,0x32,0x05,0x89,0xdc,0x98,0x3c,0xf4,0x12,0x8c,0xdd,0x21,0x79,0xad,0xaa,0xe8,
+  0x1e,0x16,0x1e,0x6b,0xd5,0xe1,0x4b,0xe7,0xc5,0xe2,0xfd,0x2b,0xf5,0x8a,0x4e,0x25,
+  0xf5,0xdd,0xb8,0x1e,0xf1,0x3c,0x18,0x8a,0x7a,0x6b,0xc6,0x75,0x04,0x4b,0x93,0xcc,
+  0x01,0x51,0xf1,0xd4,0x5a,0x7f,0xd7,0xc6,0x49,0x51,0x5a,0x78,0x0c,0xdb,0xcb,0x78,
+  0x18,0x49,0xa0,0x95,0x1f,0xca,0x91,0xde,0x1f,0xab,0x63,0x0c,0xa0,0x48,0x47,0x57,
+  0x82,0xba,0xb1,0x9d,0xa5,0x3e,0xc8,0x90,0x6b,0x8c,0x9e,0x5e,0xaf,0x3d,0x50,0xea,
+  0x3d,0xb7,0x07,0x85,0x80,0x5d,0x06,0xfc,0xc7,0x30,0x76,0x65,0xd1,0x64,0xa9,0xf5,
+  0x65,0x43,0x91,0xbc,0x6f,0xd9,0xd8,0x81,0x43,0xb6,0xc3,0xe9,0xb2,0xe1,0xe9,0xf5,
+  0x65,0x43,0x5f,0xb4,0x79,0xcf,0xed,0x61,0x91,0xde,0xe2,0x50,0x75,0xad,0x96,0xe8,
+  0xe1,0xe2,0x77,0xdb,0x14,0x1e,0x23,0x67,0xdb,0xef,0xf5,0xd0,0x39,0x4b,0xae,0xf9,
+  0x2a,0x0b,0x8d,0xca,0x0a,0x5c,0xef,0xab,0x4d,0xb6,0xef,0x87,0x63,0x7a,0xe3,0x19,
+  0x7b,0x87,0x90,0x2f,0xf8,0xea,0x19,0xf5,0xc5,0x44,0x8a,0xde,0x58,0x4c,0xf5,0x06,
+  0x64,0xfe,0x40,0xe3,0x22,0xa3,0x31,0x7e,0x0e,0xe9,0xab,0x8f,0x55,0xef,0x85,0x49,
+  0xa0,0x05,0x33,0x3e,0x9a,0xa9,0x06,0x03,0xe5,0xb4,0xe2,0x81,0xf7,0xfa,0x7b,0xc1,
+  0x36,0x1f,0xaa,0x7b,0xc1,0xc8,0xf5,0x5d,0x52,0x04,0x77,0x53,0xde,0x1b,0xa6,0xcf,
+  0x2e,0x8b,0xc7,0x7d,0xbe,0xaf,0xf8,0x3e,0xdd,0xc0,0x3f,0xbd,0xaf,0xad,0x9b,0x18,
+  0xce,0x31,0xa6,0x5f,0xa7,0xc3,0x89,0xe7,0x67,0x0f,0xb4,0xb0,0xdf,0xd9,0xd3,0x30,
+  0x22,0xc2,0x4c,0x96,0x5b,0xf0,0xc4,0xf9,0xd6,0x7a,0xf7,0x63,0x77,0x96,0x1d,0x8e,
+  0x7c,0xa4,0xf9,0xb5,0xda,0x5b,0x67,0x0e,0xde,0x06,0x35,0x04,0x4e,0xa0,0xb8,0xb2,
+  0x17,0xcf,0xe4,0x64,0x71,0x5d,0xab,0xdd,0x20,0x4f,0xdb,0xaf,0xdc,0xa3,0x12,0xb8,
+  0x97,0xe2,0x9e,0xa8,0x1a,0x7e,0x8b,0x13,0x9e,0x07,0xe8,0x1e,0x0f,0xd3,0xc2,0x13,
+  0xb5,0x62,0x99,0x4d,0x86,0xa5,0x15,0xdb,0x85,0x7d,0xf1,0x86,0x0c,0xbf,0x6f,0x7f,
+  0x38,0x72,0xd4,0x00,0x3c,0xbe,0x51,0xab,0x70,0x5c,0x24,0x2c,0x8b,0xe5,0x60,0x99,
+  0xe6,0x63,0x7c,0xb4,0xcf,0x19,0xd2,0xc7,0x09,0x25,0x3b,0xa7,0x66,0x14,0xb2,0x1d,
+  0x69,0x5a,0xa9,0x5c,0x0c,0x16,0x8c,0xa4,0xe0,0x35,0xb9,0x8e,0xc0,0xb7,0xcc,0xf6,
+  0x87,0x8f,0xec,0xd1,0xe6,0x44,0xf5,0x30,0x92,0x37,0x0a,0xd7,0xf9,0xef,0x65,0x31,
+  0x1d,0x18,0x0a,0x66,0x66,0x2c,0x3d,0x5e,0xca,0x13,0x0a,0x99,0x0c,0x24,0xac,0xd4,
+  0xd9,0x07,0x2b,0x38,0x47,0x0a,0xd4,0xe4,0x32,0xc0,0xde,0x32,0x93,0x0d,0xc6,0x04,
+  0x7a,0x66,0x90,0x92,0x6e,0xfd,0xc6,0x8d,0xe5,0xb7,0x56,0x73,0x19,0xcb,0x62,0x7b,
+  0xe4,0x4c,0x34,0x25,0xcf,0x52,0xf2,0x8c,0x27,0x64,0xac,0xf0,0xa7,0xdd,0x57,0x86,
+  0x23,0xdf,0xc6,0x1b,0x35,0x6b,0xd8,0x97,0x30,0x2a,0xbc,0x98,0xee,0xef,0xe5,0x8b,
+  0xe9,0x22,0xd7,0xac,0xdb,0xf5,0xc6,0x42,0xf5,0x95,0x6a,0x7c,0xa3,0x1a,0xe7,0xfa,
+  0xfc,0xc1,0x6b,0xfc,0x36,0x0d,0x93,0x5f,0xf0,0x71,0xf2,0x8b,0x15,0x75,0x68,0xfb,
+  0x82,0x8f,0x50,0x43,0xf6,0xe8,0x0c,0x19,0xcf,0xbe,0x10,0xba,0x62,0xc8,0xd4,0x9f,
+  0x14,0x07,0xe2,0xb3,0x67,0x2c,0x38,0x41,0x2d,0x91,0xcc,0xaf,0x39,0x94,0x29,0xac,
+  0x1d,0xb8,0x8d,0xcf,0x46,0x75,0xde,0xb8,0x60,0x60,0xa5,0x13,0x68,0x06,0xa3,0x4c,
+  0x9f,0xe5,0xb4,0xeb,0xc5,0x6b,0x6f,0x7e,0xb6,0x97,0x91,0x20,0x9f,0x99,0x95,0xd3,
+  0x8c,0x91,0x72,0xcd,0xb9,0x98,0xf8,0xee,0xd7,0xc4,0x47,0x90,0x8f,0x01,0x15,0x1d,
+  0x57,0x03,0xe4,0xcf,0xbd,0xe0,0x44,0x3a,0xac,0x76,0xf2,0xe9,0xee,0xf0,0xe8,0x60,
+  0x7f,0xf8,0xfc,0xf0,0xd9,0xf0,0x04,0x4f,0xab,0xe5,0x0f,0xdf,0xa9,0xb7,0x00,0x9c,
+  0xac,0xdc,0xab,0x57,0xcb,0xa7,0x05,0xb5,0x7c,0x5a,0xa7,0x96,0x4f,0xeb,0xd6,0xb2,
+  0x5b,0x50,0xcb,0x6e,0x9d,0x5a,0x76,0xb3,0x5a,0x6a,0x85,0xb5,0xc8,0x71,0x0b,0xa8,
+  0x85,0x1e,0xd2,0xd5,0xa2,0x5b,0xca,0x79,0x8e,0xca,0x0b,0x96,0xcb,0x2e,0xc9,0xbf,
+  0xa5,0xf0,0x20,0x3a,0xe3,0x40,0x3c,0x74,0x55,0x53,0x5c,0xae,0xa4,0xb7,0xb1,0xad,
+  0x98,0x72,0x74,0x4e,0xe9,0x74,0x0b,0x3d,0x3f,0x20,0x1f,0xbc,0x21,0xac,0xc4,0xcb,
+  0x5f,0x37,0x1f,0x3e,0x6c,0xaf,0xb7,0xd7,0xf5,0xa0,0xa5,0x93,0xb9,0x83,0xce,0x75,
+  0x2e,0x47,0x36,0xd6,0xb5,0xde,0x26,0xb5,0xa9,0x75,0x9d,0x91,0x53,0x24,0x3c,0xf4,
+  0x9b,0x3b,0x13,0xb2,0x50,0xf0,0x53,0xad,0x8c,0x54,0xd7,0xd2,0x2e,0x6a,0x9e,0xbb,
+  0xd9,0x85,0xcb,0xf3,0x9a,0x97,0x1d,0x0b,0x75,0x56,0x0e,0x04,0x4e,0x26,0x7c,0x20,
+  0x5c,0x5f,0x5f,0x37,0x5c,0x3a,0xee,0x38,0x4e,0x09,0xcf,0xd9,0xff,0x2a,0x79,0xe7,
+  0x53,0x30,0x60,0x62,0x69,0x13,0x7f,0xdc,0x80,0xc0,0xfb,0xf7,0xef,0x97,0xb0,0x46,
+  0x93,0x02,0x3e,0x45,0xc1,0x47,0xca,0xb2,0xb7,0x25,0x78,0xf8,0x17,0xb4,0xf0,0xf6,
+  0xb6,0x71,0x2e,0xba,0xce,0x38,0x9a,0x7f,0xf3,0x4d,0xd1,0xfe,0x93,0x6f,0xbf,0xcd,
+  0xde,0x55,0x42,0xa8,0xf2,0x68,0x2f,0x01,0xd1,0x5e,0x63,0x12,0x49,0xef,0x69,0xa8,
+  0x62,0x14,0x48,0x0f,0x01,0x65,0x29,0x4b,0x1f,0xa6,0x28,0x6a,0xb0,0xee,0x92,0x71,
+  0xdf,0x7d,0xf1,0x3b,0xbf,0x73,0x70,0x82,0xb6,0x3d,0x67,0xd9,0xf1,0xe0,0xd4,0x75,
+  0x2c,0xf9,0x2e,0xa9,0xe6,0xfb,0x6b,0xcc,0x29,0xfd,0x26,0x63,0x5e,0xac,0x8b,0x06,
+  0x5b,0x2e,0xab,0xe4,0x62,0x37,0xae,0x0b,0x6a,0xc8,0x8d,0x3b,0x61,0xe0,0x36,0x37,
+  0xc0,0x0a,0xb5,0xef,0xaf,0x6b,0xfd,0x7a,0xe4,0xba,0x51,0xb6,0x6a,0xe1,0x46,0xd5,
+  0x3d,0x9b,0xd2,0x74,0xfb,0x9d,0xbb,0xd0,0xd5,0xfe,0x0c,0x3a,0x13,0xb4,0xd3,0x55,
+  0x0f,0x6b,0x48,0xdb,0x24,0x85,0x8f,0xcb,0x20,0x8a,0x51,0x1d,0xa2,0x96,0xef,0xd3,
+  0xe7,0xe2,0x16,0x8b,0x63,0x91,0xfe,0xc1,0x5f,0x9a,0x1b,0x26,0x65,0xaf,0x81,0xfe,
+  0xd1,0x7f,0xcf,0xde,0x0b,0x37,0x14,0x2a,0x88,0x6d,0xa9,0xb0,0x4a,0x88,0xcb,0x90,
+  0xa5,0x99,0x1e,0xf5,0x9d,0x61,0xbc,0x37,0x20,0xbe,0x18,0xba,0xc1,0x38,0x74,0x8a,
+  0xcc,0xa0,0x72,0x50,0x41,0x2d,0x20,0x26,0x7c,0x46,0xf7,0x5d,0x01,0x55,0xbd,0xf8,
+  0x7c,0xd6,0xfb,0x72,0xe6,0x29,0x25,0x8a,0x2f,0x9f,0x25,0x2d,0x6a,0x23,0x7b,0xf8,
+  0xa3,0x73,0x1e,0xc3,0x2f,0xfc,0xa7,0xf0,0xa6,0xe6,0xac,0x8a,0xe1,0xd8,0x7f,0x9d,
+  0xaf,0x18,0x53,0xeb,0x3d,0x8c,0x42,0xcb,0xec,0x01,0x12,0xc9,0xa3,0x3e,0x3e,0x7d,
+  0x7c,0xf2,0xdb,0xc3,0xbd,0xa3,0x1f,0x73,0xc3,0x5b,0xe3,0xae,0xe3,0x7b,0x85,0x37,
+  0x34,0x4b,0x64,0x39,0xa9,0x81,0x56,0x27,0x5d,0x84,0xd4,0xfd,0x34,0x4f,0xe9,0xfe,
+  0xe9,0xb2,0x09,0x4d,0xce,0x0d,0x84,0x26,0xe7,0x8b,0x10,0x3a,0x38,0xcf,0x13,0x3a,
+  0xf8,0xfc,0x5a,0x84,0x2e,0x30,0x4d,0xa1,0xe2,0x5c,0xea,0xe0,0xb6,0xac,0x2e,0x12,
+  0x26,0x9e,0x7e,0x6b,0xba,0x94,0x5c,0xb8,0x3f,0x8c,0xc2,0x75,0x44,0xf1,0x7c,0x64,
+  0x68,0xa3,0xfb,0xd0,0x9d,0x55,0x5d,0xd3,0xb7,0xbd,0x7e,0x0b,0x6d,0xa2,0xdc,0xd2,
+  0x5a,0x44,0x13,0xab,0xda,0xc3,0x8a,0x9a,0x5a,0xb3,0x89,0x77,0x4b,0x15,0x55,0x36,
+  0xc4,0x0d,0xc9,0xb6,0xf4,0x74,0xb7,0x39,0xb7,0xd2,0xaf,0xbd,0xcd,0xe9,0x26,0xa1,
+  0xc8,0x38,0xdd,0x24,0x39,0x75,0x67,0x9b,0x04,0x78,0xe1,0x19,0x99,0xc4,0xe3,0x59,
+  0x18,0x78,0x69,0x18,0x77,0xc8,0x34,0x25,0x23,0x31,0x3c,0x3b,0xf3,0x5d,0x4a,0xe4,
+  0x53,0x0a,0x01,0x7e,0x8d,0xbe,0x77,0x86,0x72,0x95,0x61,0x30,0x0f,0x6c,0xff,0xe1,
+  0xf7,0xf3,0x03,0x1b,0x2b,0x70,0x23,0xbf,0x2a,0x76,0x71,0xc6,0x44,0xf0,0x3d,0x67,
+  0x5a,0x6f,0xa6,0x8e,0x00,0x6a,0x04,0x90,0xb4,0x1a,0x93,0x28,0xca,0xa1,0xdb,0x3e,
+  0x0e,0xa7,0x7a,0x0b,0x4c,0x47,0x8b,0x6f,0x28,0xf8,0xf6,0x4f,0xb3,0x79,0x86,0x00,
+  0x2d,0x75,0x12,0x24,0x38,0x6d,0xee,0xa4,0xa6,0xbf,0xb7,0x09,0x14,0x21,0x43,0x99,
+  0x40,0xf1,0x14,0xa3,0x85,0x30,0xdc,0x92,0x87,0x07,0x4d,0x1a,0x38,0x15,0x3a,0x3d,
+  0x3d,0x7e,0x36,0xdc,0x3d,0x3e,0x3e,0x5d,0xd3,0xee,0x59,0x92,0x83,0xe4,0x1f,0x29,
+  0x41,0xf2,0x95,0xed,0x66,0x80,0x2a,0xc7,0xef,0x97,0xc3,0x17,0x58,0xf8,0xeb,0x07,
+  0x4b,0x34,0x87,0xac,0x51,0xa8,0x3e,0xae,0xd6,0x50,0x92,0x56,0x68,0x0c,0x51,0x3e,
+  0xcc,0x14,0x76,0x68,0xe9,0x02,0x83,0xc8,0xdb,0xb4,0xf9,0x91,0xfd,0xe1,0x83,0x87,
+  0xa6,0xca,0x75,0xbb,0xf8,0x5e,0x0c,0x62,0x66,0x82,0x48,0xcb,0xca,0x0c,0x10,0xde,
+  0x4b,0xb2,0x4b,0x90,0x14,0x1a,0x21,0x56,0x9c,0x0f,0x33,0xd5,0x46,0x48,0x2d,0x50,
+  0xf1,0x5c,0x51,0x59,0x17,0xdd,0xa8,0xd9,0x3f,0x37,0xea,0x74,0xce,0x0d,0x53,0xcf,
+  0xdc,0xf8,0x5e,0x75,0xcb,0x9b,0xc5,0x35,0x10,0xf5,0x06,0xbe,0xa3,0xa3,0x44,0x36,
+  0x48,0x77,0xde,0xb8,0x45,0x67,0x90,0x6a,0x17,0x73,0x06,0xbf,0x60,0x4d,0xdc,0xc0,
+  0x4b,0x1a,0xbe,0x13,0x7e,0xe1,0xf5,0x8d,0x06,0x63,0xe8,0x6f,0x98,0xc1,0x60,0xad,
+  0x2a,0xb5,0x19,0x14,0xe6,0x3b,0x68,0x30,0x36,0x6b,0x1a,0x8c,0xcd,0x3a,0x06,0x63,
+  0xd3,0x64,0x30,0x36,0xff,0x99,0x19,0x8c,0x4d,0xb3,0xc1,0xd8,0x7c,0xd7,0x06,0x63,
+  0xf3,0x37,0xc5,0x60,0x6c,0xfe,0x46,0x1a,0x8c,0xcd,0x1a,0x06,0x63,0xf3,0xfd,0x1a,
+  0x8c,0xaa,0xa8,0xeb,0x53,0xb2,0x6d,0x74,0xb1,0x20,0x29,0xdf,0x6a,0x5a,0x16,0x1d,
+  0xcd,0xf6,0xfb,0xa9,0xd0,0x05,0x61,0x51,0x06,0xa4,0xc4,0x43,0xe5,0xb4,0xd2,0x40,
+  0x68,0xe2,0x0c,0xe9,0xce,0x99,0x72,0x42,0x18,0x58,0xa9,0x11,0x64,0x30,0xea,0x3d,
+  0x0e,0x52,0x5a,0xee,0x86,0x23,0x6e,0x00,0xc3,0x59,0xee,0x45,0x54,0x92,0x34,0x4c,
+  0xc2,0x2c,0x48,0x21,0x25,0xbd,0x27,0x5b,0x9a,0xd0,0x6d,0x0e,0x78,0xd5,0x87,0xd4,
+  0x3c,0x9e,0x74,0x5b,0x21,0x53,0x5a,0xc5,0x10,0x6f,0xc2,0x56,0x6b,0x25,0x49,0xf5,
+  0x02,0x7b,0x89,0xf3,0x14,0x8b,0x67,0x36,0x79,0xb0,0x3f,0xc4,0x4b,0xb7,0x97,0x12,
+  0x7d,0xe4,0xd4,0x84,0x89,0xa7,0x13,0x18,0xf2,0xb3,0xad,0x35,0x08,0xc4,0xe2,0x2a,
+  0x81,0xc7,0x83,0xc3,0x65,0x12,0x98,0x48,0x11,0x67,0x29,0xa9,0x2e,0x81,0x83,0xb1,
+  0x12,0x6b,0x06,0x02,0x07,0xcb,0x0a,0x34,0x33,0x6a,0xc6,0x89,0x46,0xde,0x38,0xa9,
+  0x4b,0xdc,0x5e,0xa2,0x92,0xb6,0x37,0xb8,0xe5,0x78,0xed,0x60,0xff,0x16,0x17,0x22,
+  0x0b,0x6f,0x81,0x28,0xbe,0x69,0x78,0x32,0xb9,0x3f,0x16,0x4f,0x87,0x90,0x3b,0x71,
+  0x1f,0x64,0xbb,0x0a,0x26,0x93,0xf1,0xc6,0xfa,0x87,0x7c,0x9c,0xfc,0xe8,0xe1,0xa3,
+  0x07,0xeb,0x0f,0xb4,0x5b,0x89,0x1f,0x90,0x5d,0x81,0xec,0x4e,0x61,0x7a,0x71,0x4a,
+  0x43,0xba,0x4e,0x22,0x99,0xda,0xb8,0xcf,0x54,0xb9,0x55,0x42,0xbe,0x80,0x38,0x83,
+  0xdc,0xb8,0xcf,0x81,0xaf,0x79,0xcc,0xe9,0x06,0xf1,0xcb,0xc1,0xbe,0x29,0x76,0x99,
+  0xd4,0xdd,0x25,0x93,0xdc,0x6c,0xd7,0x0a,0xa5,0xe0,0xc4,0xb5,0xf5,0x0d,0x3b,0xa0,
+  0xcd,0x34,0x2e,0x0a,0x59,0x05,0x3b,0x3e,0xff,0x44,0xd2,0x7c,0x01,0x7b,0xa3,0x58,
+  0x24,0xa5,0xe6,0xf3,0x18,0xac,0x7b,0x01,0x39,0xe7,0x98,0x67,0x64,0xcd,0x5f,0xfc,
+  0xa1,0x7c,0x6f,0x8e,0x0c,0x7e,0x93,0x1d,0x44,0x74,0x1b,0x67,0x4e,0x46,0x89,0xd8,
+  0xd7,0x5c,0x7d,0x85,0x8f,0xba,0xd3,0xf9,0x3a,0xbb,0x7d,0x70,0x37,0xed,0x60,0xff,
+  0x10,0x12,0xcd,0x67,0x2e,0x6b,0x9e,0xb7,0xac,0x8e,0xd3,0x26,0xce,0x3b,0xb8,0xbd,
+  0x0e,0x2a,0x59,0xec,0x8e,0xab,0xca,0x87,0xae,0xdd,0x20,0x09,0xe3,0x05,0xd7,0xbd,
+  0x13,0x5a,0xa8,0xdc,0xa7,0xcb,0xee,0x74,0xd1,0xc0,0x0b,0x9c,0x3a,0x0e,0xa5,0x78,
+  0x75,0x4a,0x62,0xa9,0x5b,0xe7,0x4c,0xa1,0x3f,0x13,0xe8,0x82,0xe7,0xed,0xff,0x4a,
+  0xd2,0xab,0x0c,0xb8,0xd4,0xbf,0xcb,0xc0,0x14,0x17,0x4f,0x4b,0x7e,0x4f,0xce,0x99,
+  0x44,0x85,0x34,0xd9,0x55,0x53,0x97,0x3e,0xe1,0x05,0xf4,0xea,0xb6,0x9f,0xfd,0xcf,
+  0x4e,0x97,0xba,0xe7,0x07,0xf0,0x7d,0xb7,0xd6,0x44,0x25,0x86,0x22,0x3b,0x0c,0x7c,
+  0xc6,0x64,0x13,0xa3,0xb7,0xe5,0x37,0x13,0x00,0x9e,0x76,0xb5,0x53,0x44,0x22,0x86,
+  0x7b,0x18,0xeb,0xd9,0xdb,0x09,0x0f,0xe4,0x23,0x43,0xea,0x03,0x07,0x9b,0x9b,0x3a,
+  0x45,0x1b,0x1b,0x43,0x0a,0x22,0x91,0x23,0xd2,0x28,0x2d,0xe2,0x05,0x88,0x5a,0x08,
+  0x37,0x37,0xf3,0x08,0x45,0x9a,0x82,0x30,0x7b,0x2a,0xe1,0x3d,0xad,0x59,0x82,0x86,
+  0x50,0x4e,0x9a,0x86,0xfe,0x72,0x2b,0x60,0x70,0x01,0x74,0x4b,0x50,0x66,0xe1,0x01,
+  0xf6,0x1d,0x98,0x78,0xac,0x65,0x31,0x1b,0xaf,0x1a,0x42,0x37,0x78,0xe3,0x81,0x9f,
+  0x36,0x73,0xc9,0x2b,0x98,0xcc,0x80,0x16,0xd8,0xc4,0xbf,0x95,0xd8,0x61,0x2c,0x57,
+  0x6a,0x1e,0x8d,0x25,0x14,0x4b,0x59,0x0c,0x71,0x83,0x1b,0x58,0x00,0xe9,0x92,0x6e,
+  0x60,0xb1,0x41,0xc9,0xd7,0xb9,0xbe,0x70,0xa3,0x22,0xa5,0xd5,0x3b,0x71,0x89,0xf4,
+  0x90,0x52,0xe2,0xd5,0xb1,0xa5,0x5e,0x7c,0x31,0x9a,0x45,0x9b,0x1f,0xe9,0x54,0x2a,
+  0x89,0xf5,0xc9,0xa4,0xc5,0x6e,0x87,0x4e,0x3c,0x3b,0xe9,0xc6,0x36,0x9e,0x4f,0x1b,
+  0xda,0x6f,0xce,0xb2,0x5e,0xa6,0x24,0xd7,0xa7,0x15,0x0b,0x76,0x08,0xa2,0xa5,0x92,
+  0x39,0x9d,0xcf,0x3c,0xc7,0x4b,0xc5,0x2d,0x5e,0xfc,0x77,0x7d,0xc2,0x32,0x0c,0x4b,
+  0x25,0x2c,0xc2,0xf3,0xc8,0xc8,0xa5,0x69,0x64,0x67,0xe7,0xae,0xb2,0xb4,0xfa,0x04,
+  0xf2,0x52,0x4b,0x26,0x90,0xdf,0x3f,0x33,0x1c,0xdb,0xfe,0x78,0x8e,0xc7,0x64,0x9d,
+  0xec,0xac,0x72,0x2e,0x6b,0x81,0xbe,0x53,0x7a,0xaf,0xcd,0x3b,0xbc,0x9b,0xe5,0x40,
+  0xb6,0x56,0x25,0xb7,0xb4,0x00,0xd1,0xe5,0x76,0x35,0x7f,0x5b,0x8b,0x54,0xe4,0x66,
+  0xb7,0xb6,0x28,0x34,0x0a,0xe7,0x3d,0x3f,0x10,0x56,0xd2,0xa8,0x5d,0xe7,0x52,0x44,
+  0xa0,0x71,0x20,0x44,0xa9,0xd5,0xbd,0xd1,0xc5,0x38,0x46,0xf9,0xb8,0xf7,0xab,0x6c,
+  0xa0,0xfe,0xd3,0xdf,0x93,0x46,0x26,0x19,0xba,0x74,0x40,0x92,0x01,0x95,0x71,0x28,
+  0x97,0xf1,0x9e,0x7c,0x76,0x85,0x0e,0xc9,0x6b,0xd7,0xd3,0x97,0xee,0xb7,0x93,0x0a,
+  0x54,0xcf,0xfd,0xe8,0xf0,0x53,0xf0,0xdd,0x07,0x07,0xcf,0x06,0xc7,0xcb,0xdd,0xb6,
+  0x7f,0x84,0x75,0x7d,0x7f,0x77,0xed,0x13,0xf2,0x8b,0x3d,0xcc,0x4a,0xd5,0xcd,0xfb,
+  0x98,0x79,0xfd,0x2d,0xeb,0x5c,0x04,0xfa,0x1d,0xf8,0x99,0xb4,0x9e,0x9b,0x78,0x9a,
+  0xa0,0x89,0x29,0xb9,0x21,0xa9,0x6c,0xde,0xfd,0xf3,0x9f,0x49,0xe7,0x55,0x65,0xf0,
+  0xf2,0x99,0xb7,0x0a,0xab,0x4e,0xbf,0x0d,0x79,0xef,0x6b,0x0e,0xce,0x49,0x91,0x77,
+  0x95,0x2b,0x89,0xcb,0x9f,0x81,0x03,0xf6,0xd3,0x18,0x9f,0xa4,0xca,0xe6,0xe0,0x87,
+  0x83,0xd3,0xc7,0xcf,0xf6,0x0e,0x86,0xa7,0x27,0x87,0x9f,0x1a,0xbb,0x32,0x3d,0x5b,
+  0x59,0xf0,0xa8,0x34,0x69,0xd6,0x30,0x25,0x38,0x0d,0x0f,0x4a,0x67,0xd9,0xe4,0x31,
+  0xe9,0x7b,0x75,0x08,0x3c,0x18,0x4f,0x43,0x13,0x81,0x07,0x7b,0x9f,0x1d,0x5f,0x97,
+  0x40,0x97,0xe0,0x2c,0x24,0x10,0xb3,0x55,0x02,0x17,0x08,0x3a,0x30,0x89,0x7d,0x7f,
+  0x8d,0x16,0x6f,0x41,0xc9,0xcc,0xb8,0xba,0xb3,0x9a,0xa6,0xc7,0xa6,0x3e,0x5b,0x3a,
+  0x47,0x66,0x05,0xde,0xc5,0x44,0x99,0x57,0x75,0x13,0x1b,0x36,0x0b,0x31,0xaa,0x51,
+  0x6a,0xc1,0xb4,0x55,0x75,0x09,0xbe,0xd4,0x84,0x29,0x90,0x8a,0x01,0xcb,0xe7,0xbc,
+  0x27,0xf3,0xa5,0x12,0x22,0xf9,0x23,0xb9,0x8c,0xa5,0x9b,0x31,0x5a,0x83,0xea,0x91,
+  0x3c,0x3d,0x3e,0x3d,0x3c,0x7e,0x76,0x1b,0x2e,0xc9,0x53,0x52,0xdb,0xf7,0xb7,0x7b,
+  0x53,0xfa,0x8b,0x3b,0x77,0xa5,0x16,0x1b,0xba,0xb6,0x41,0x93,0xcb,0x3a,0x36,0x05,
+  0x7f,0x07,0xdd,0x9a,0x55,0x74,0xd3,0x65,0x0e,0x3b,0xb9,0x08,0xc6,0x0d,0xb1,0xd8,
+  0x41,0xcf,0x63,0x7a,0x30,0xd5,0x0c,0x8e,0x0e,0xf6,0x9b,0xad,0xcb,0xc4,0x4d,0x07,
+  0x84,0x78,0xdc,0x1d,0x44,0xd2,0x3b,0xbe,0xcb,0x97,0x70,0xac,0xf6,0xe5,0x6b,0xf7,
+  0x62,0x8b,0x32,0xca,0x0b,0xb2,0x67,0xbb,0xae,0xda,0xc1,0xdc,0xf7,0x5b,0x3d,0xd0,
+  0x8d,0x24,0x6d,0xc4,0x7d,0xfb,0xdc,0xf6,0xd2,0xc6,0xc4,0x4d,0xc7,0xd3,0xa6,0x75,
+  0xcf,0x8e,0xbc,0x7b,0x32,0x32,0xda,0x4e,0x06,0xec,0x30,0xe0,0xb8,0x8b,0x37,0xe8,
+  0x34,0x5b,0xbd,0x0a,0x0a,0x9c,0x2e,0x65,0x01,0x7c,0xb0,0xa5,0xc7,0x1d,0x8b,0x7d,
+  0x58,0x5b,0x16,0x79,0x6c,0x0b,0x70,0xe7,0x1a,0x0a,0x28,0x76,0x7d,0x2f,0x78,0x5d,
+  0xbb,0x89,0xb1,0x1d,0x24,0x33,0x2f,0x21,0xb7,0xba,0x2c,0xd6,0x3c,0x80,0x4a,0xe3,
+  0xd0,0xdf,0xb1,0x49,0xcd,0xfd,0x11,0x56,0x7b,0x83,0xe6,0xce,0xa0,0x65,0xf6,0x99,
+  0xcb,0x48,0x30,0x35,0xec,0x89,0xed,0xb8,0xef,0xbe,0x5d,0x13,0x1b,0x6f,0xe9,0xbd,
+  0xc5,0x66,0x1d,0x4f,0x26,0xef,0xbe,0x55,0xe4,0x00,0xff,0x6d,0x36,0x2a,0x78,0x0f,
+  0x6d,0x0a,0x6e,0xaf,0x49,0x74,0x34,0x50,0x4c,0x08,0xad,0x09,0x37,0x41,0xf4,0x9d,
+  0x70,0x3c,0xc7,0x98,0x4c,0xf7,0xcc,0x4d,0x0f,0x7c,0x17,0x3f,0x77,0x2f,0x0e,0x1d,
+  0xb5,0x2e,0xfa,0xe0,0x08,0x7d,0xfa,0xb8,0xf7,0x0e,0x58,0x03,0xf4,0xee,0x10,0xea,
+  0xac,0x35,0xfc,0x73,0x73,0xd6,0x94,0x5a,0x22,0x6f,0xd2,0x14,0xf9,0x32,0x6f,0xd8,
+  0xa5,0x48,0xd5,0x2c,0x22,0xcf,0x91,0x30,0x67,0x82,0xe2,0x93,0x8a,0xb7,0x2e,0xa5,
+  0x1f,0x5d,0x1c,0x63,0x61,0x34,0x4f,0x01,0x47,0x1f,0xd3,0x7b,0x57,0x57,0x39,0x81,
+  0x05,0x6e,0xb8,0x37,0x4f,0xd2,0x70,0x46,0xaf,0xb3,0xe0,0x24,0x91,0x3d,0x31,0xc5,
+  0xc4,0x60,0x29,0x84,0x10,0x72,0xe2,0xdc,0x8e,0xec,0x38,0x71,0x0f,0x83,0xb4,0x49,
+  0x10,0x40,0x43,0x47,0x09,0x8c,0x69,0x1b,0xed,0xcd,0x56,0x7b,0xe3,0x11,0x67,0xed,
+  0x59,0x01,0xd8,0x7d,0x15,0x6c,0x54,0x00,0xf6,0x90,0x83,0x49,0x12,0x01,0x82,0x22,
+  0xef,0x6b,0xd7,0x2f,0xd3,0x8c,0x76,0x32,0x9f,0xc0,0x30,0xbf,0x65,0x35,0x4e,0x3e,
+  0xdd,0x6d,0x5a,0x6b,0xf1,0x9a,0xd5,0x06,0x99,0x93,0x7f,0x47,0x6b,0x56,0x4b,0x57,
+  0x1d,0x37,0x89,0x0c,0xda,0x23,0x6a,0x22,0x34,0xed,0xc4,0x7d,0x82,0x68,0xf5,0xac,
+  0x4f,0x50,0xad,0x8e,0xe0,0xef,0x28,0xa7,0x43,0x80,0xca,0xa0,0x46,0x39,0xa2,0x2b,
+  0xbb,0x17,0x0e,0x95,0xcf,0xdc,0xf0,0x39,0x96,0x52,0x0d,0x47,0x11,0x03,0x16,0x1f,
+  0x9a,0x05,0xa6,0xda,0xe3,0xb2,0xa1,0x1d,0x6c,0x50,0x2e,0x68,0x06,0x14,0x78,0x6e,
+  0xa7,0xe0,0xf4,0x05,0xcd,0xa8,0x56,0x2b,0x16,0xeb,0xe0,0x02,0x4b,0x44,0x2b,0xd9,
+  0x61,0x7f,0x41,0x34,0xd1,0x35,0xdb,0x53,0xcb,0xec,0x49,0x92,0xa9,0x63,0xf4,0x44,
+  0x35,0x8a,0xc5,0xe3,0xfd,0x6f,0x0e,0x9d,0xb6,0xba,0x28,0x81,0x33,0x59,0xcb,0x25,
+  0x73,0x32,0x6f,0x27,0x41,0xd7,0x29,0x91,0xd6,0x1a,0xf9,0x7b,0x43,0xc6,0xde,0x8e,
+  0xd1,0x54,0x58,0x7c,0x6d,0xab,0x79,0x47,0x92,0x49,0xfd,0x2a,0x09,0xb8,0x5a,0xa7,
+  0x8c,0x01,0xdb,0x91,0xfd,0x52,0x6a,0x25,0x19,0x26,0x63,0x8d,0x3d,0xf2,0x38,0xe7,
+  0x98,0x87,0xf9,0x11,0x11,0x93,0xd8,0x86,0xb9,0x79,0x40,0xb6,0x26,0x56,0xcb,0x3a,
+  0x5c,0xc8,0x17,0x0f,0x8d,0x4e,0x78,0x41,0xf7,0x40,0x60,0xf2,0xae,0x2e,0xbe,0xa0,
+  0x5b,0x8b,0x76,0xf2,0xd4,0xae,0x4e,0x7b,0x1a,0x5f,0x5c,0x56,0xd0,0x8f,0xe5,0x76,
+  0xf0,0x1f,0x50,0x4b,0x52,0xd9,0xe2,0x4d,0xa9,0xa5,0x91,0x57,0x63,0x1b,0x6b,0x76,
+  0xab,0x1a,0x43,0xe0,0xd9,0xc5,0xc4,0x62,0xfc,0xd9,0x6a,0x58,0x6b,0x83,0x94,0x9c,
+  0x5e,0x70,0x5b,0x57,0xed,0x0c,0xa9,0x91,0x71,0x4c,0x43,0x4e,0x41,0x41,0x84,0x61,
+  0x41,0x6d,0x29,0x56,0x41,0x2c,0x75,0x4a,0x9e,0xc7,0x66,0x76,0x01,0x54,0xef,0x2e,
+  0x16,0xa9,0xc5,0x7a,0xd6,0xfe,0x61,0xec,0x7e,0x35,0xf7,0xf0,0xca,0x32,0x89,0x42,
+  0x3a,0x73,0x04,0x01,0xd7,0xc0,0xc3,0x34,0x1f,0x37,0xe7,0x33,0x94,0x8b,0x08,0x92,
+  0x15,0xd9,0x61,0x7f,0x41,0x9c,0xf4,0x72,0x94,0x17,0x27,0x87,0x7b,0xe1,0x2c,0x0a,
+  0x03,0x68,0x6d,0x93,0xb4,0xe9,0x37,0x40,0xc4,0x78,0x74,0xb6,0xb2,0x4f,0x43,0x17,
+  0xa3,0x47,0x5e,0xe8,0x21,0x70,0x7a,0x19,0xe5,0x22,0x2c,0xa5,0x67,0xcf,0xbf,0xdf,
+  0xdc,0xa2,0xe3,0x50,0x2d,0x1b,0x18,0xbb,0xfc,0x94,0x78,0xde,0xfe,0x25,0x8e,0x5d,
+  0xde,0x7d,0x06,0xfb,0x8f,0xb5,0x11,0x39,0x19,0xfb,0x15,0x45,0xf6,0x8e,0x74,0x77,
+  0x38,0x4c,0xc9,0xcd,0xe4,0xe5,0xe5,0x4e,0x18,0x94,0x56,0x98,0x84,0xf2,0xca,0x4b,
+  0x7e,0x4e,0x2f,0xd8,0x57,0x8a,0x4d,0xc9,0x85,0x21,0xe5,0xe5,0x3e,0x23,0x30,0xa2,
+  0x60,0x0d,0xd5,0x61,0xc3,0x3f,0xb2,0x0d,0xec,0xaa,0x63,0xc3,0xe0,0x8f,0xfc,0x80,
+  0xef,0xb1,0x0f,0xdf,0xa2,0xa1,0xe0,0x0b,0xb3,0x4f,0x48,0xa5,0x2d,0xb0,0xd6,0xc8,
+  0x5f,0xf8,0xcd,0x48,0xb3,0xd6,0xe8,0x47,0xa1,0x26,0x32,0x7e,0x13,0x61,0x3e,0xb7,
+  0x2f,0x70,0xcf,0x41,0x5f,0x68,0xe1,0xce,0x25,0x76,0xfa,0x2d,0xf1,0xfb,0x6a,0x8b,
+  0x4a,0x5b,0xdc,0x08,0x40,0xc2,0x75,0x5e,0x00,0x4d,0xf3,0xc0,0x74,0x15,0xaa,0xb5,
+  0x82,0x7e,0x11,0xef,0x03,0x7e,0x61,0x9c,0x36,0x9c,0x34,0x20,0xd1,0xb1,0xef,0xf6,
+  0xfb,0xd6,0x3c,0x70,0xdc,0x89,0x17,0xe0,0x6e,0x8e,0xcb,0xba,0x5a,0xd5,0x27,0xa5,
+  0x7b,0x75,0x35,0x0a,0xc1,0xc7,0xbe,0x70,0x45,0x70,0xcd,0xac,0x5c,0xc6,0x1d,0xba,
+  0xac,0x86,0xc4,0xe3,0x57,0xeb,0x12,0xff,0xed,0x7a,0xf8,0x60,0xe4,0x67,0xa7,0x4f,
+  0x8f,0x0c,0xa7,0x4d,0xe8,0x02,0x11,0x10,0x25,0x47,0x46,0x69,0x0f,0xed,0xaf,0x34,
+  0xb6,0xc4,0x22,0x3c,0x07,0x93,0xce,0xa0,0x58,0x6b,0xa4,0x35,0xe2,0x1a,0x87,0x3c,
+  0xd6,0xb1,0x5f,0x0b,0xeb,0xd8,0xd7,0xb1,0x4a,0x8d,0x06,0xd5,0xaa,0xf4,0xbe,0x48,
+  0xd3,0xb9,0x0e,0xaa,0xce,0x57,0x56,0xbc,0x75,0x99,0x7d,0x2b,0x8e,0x17,0xf8,0x31,
+  0xac,0x28,0x54,0x8a,0x62,0xaf,0xd7,0x6f,0x2b,0xa4,0xae,0x77,0x70,0xa5,0x9a,0xab,
+  0x77,0x64,0x38,0xd1,0xb1,0x3b,0x7d,0x72,0xaa,0x5a,0xcd,0x74,0x92,0xea,0xf3,0x83,
+  0x49,0xba,0xa8,0xdf,0x88,0x48,0x6a,0xbb,0x8d,0x72,0x8d,0x55,0x5e,0x23,0xc0,0x9a,
+  0x9d,0x46,0x33,0xd9,0xd7,0x70,0x19,0x29,0xa2,0xc5,0x3d,0x46,0xb5,0x15,0xd7,0x1f,
+  0x1f,0xf3,0x0d,0xb9,0xa9,0x94,0x27,0x69,0xde,0x97,0xc8,0xd7,0x72,0x13,0x57,0x02,
+  0xb1,0xd5,0xf6,0x24,0xbe,0xb3,0x8c,0xa2,0xc3,0x45,0x8d,0x0e,0x51,0xe6,0x45,0xe0,
+  0x41,0xcb,0x62,0x53,0x04,0xb8,0xf0,0x2c,0xa5,0x36,0x3e,0xe3,0xd9,0xc7,0xf2,0x32,
+  0xc7,0x83,0xc3,0xbc,0xeb,0xf1,0xba,0xb4,0x0c,0x9e,0x38,0xd4,0x03,0x08,0x49,0x69,
+  0x89,0xbd,0x81,0x06,0xef,0x8c,0x4b,0xe1,0xf7,0xf7,0x74,0xdf,0x26,0x49,0x4b,0x0b,
+  0x9c,0x0c,0x4e,0xb5,0x12,0x23,0xbf,0xb4,0xc0,0xee,0xd1,0x62,0x0e,0x10,0x14,0xb9,
+  0x8e,0xff,0x03,0xc5,0x34,0xf7,0xa7,0xae,0xaf,0x86,0x8d,0x32,0xbb,0x6a,0x4e,0xec,
+  0xbd,0x71,0xe3,0x72,0xfe,0x11,0x90,0x9a,0x2e,0x17,0x6a,0x21,0xf3,0xb8,0x18,0x6a,
+  0x18,0x0a,0xc9,0x07,0x78,0x51,0x44,0xe9,0xac,0x35,0xfc,0x83,0xbf,0x50,0x9d,0xe0,
+  0x17,0xfc,0xa1,0x3e,0xd9,0x6b,0xea,0x94,0xbd,0xc6,0xf0,0x4c,0x82,0xb1,0x99,0x04,
+  0xbe,0x40,0xb8,0x80,0x61,0x8c,0x9e,0x5a,0x82,0x0e,0x18,0xfc,0x8b,0xa1,0x4a,0x74,
+  0xe0,0x46,0x7e,0xb5,0xa7,0x66,0xf6,0xf0,0xde,0xb9,0xff,0x26,0x77,0xce,0x6b,0xbb,
+  0x6f,0x99,0xff,0x54,0xe9,0x4b,0x60,0x7d,0x08,0xa8,0xba,0x11,0x52,0x51,0xea,0x54,
+  0x99,0x1c,0x09,0x0b,0x7b,0xfe,0x16,0x97,0x52,0x03,0xfb,0xf4,0x16,0x97,0x52,0x03,
+  0x7b,0xeb,0x16,0x97,0x52,0x63,0x6f,0xb0,0x45,0xa5,0xd4,0xd8,0xdf,0xdb,0xa2,0x52,
+  0x6a,0x40,0xe7,0xd9,0x22,0x52,0xca,0x7c,0x1f,0x37,0x09,0xfd,0x39,0xf2,0xa6,0x16,
+  0xd9,0x19,0x38,0xf3,0x7d,0xf4,0xe2,0xe0,0x02,0xe9,0x49,0x4a,0x03,0x98,0x26,0x34,
+  0xbe,0x6e,0x70,0x25,0x28,0x72,0x55,0x6e,0x6e,0x9a,0x85,0x51,0x9e,0x47,0xe0,0x22,
+  0xba,0xbb,0x31,0x56,0x17,0x80,0xb4,0x7e,0x82,0x7d,0xa5,0x49,0x7a,0x4c,0x89,0x8b,
+  0x85,0xb6,0x43,0x2d,0x02,0xdd,0x4c,0x6e,0x0b,0xed,0x72,0xb9,0x21,0x00,0xda,0x00,
+  0xf6,0x3f,0x2b,0x7a,0xe4,0xbe,0x71,0xf1,0x39,0x0a,0xf8,0x97,0xab,0x49,0x02,0x3a,
+  0x58,0xd1,0xb1,0xb3,0xf2,0x03,0x02,0x2c,0x86,0x45,0x52,0x6b,0x1d,0x61,0xe5,0x88,
+  0x47,0x81,0xd1,0x9a,0x5b,0xf4,0x0f,0x73,0x1b,0x09,0x69,0x98,0x29,0xa3,0x6e,0xc9,
+  0x3f,0x94,0x66,0x53,0xf0,0x1a,0x83,0xb9,0xa8,0x7f,0x87,0xd6,0x63,0xad,0x91,0xa2,
+  0xed,0xcb,0x99,0x9b,0x4e,0x43,0x67,0xcb,0x7a,0x7e,0x0c,0xc6,0xfc,0xaa,0xb0,0xbf,
+  0xe7,0x3b,0x18,0xb8,0xaf,0x5d,0x3f,0x3c,0x6b,0x5a,0xc0,0xe0,0x46,0x86,0x1f,0x59,
+  0xde,0x48,0xc3,0x06,0xab,0x60,0xcd,0xba,0xb7,0xf9,0xf0,0x21,0xea,0x80,0xeb,0x27,
+  0xae,0x28,0x48,0x34,0xa3,0x69,0x3d,0xb1,0x3d,0x70,0x82,0x11,0x1c,0x4b,0xa9,0x88,
+  0x50,0x99,0x84,0x05,0x41,0x1d,0x12,0x8a,0xa9,0x21,0x39,0xc0,0x3f,0x88,0x20,0x05,
+  0xc5,0x33,0x20,0x71,0x4d,0xbe,0xc1,0x99,0xa6,0x18,0xe0,0x22,0x2c,0xc2,0x45,0xab,
+  0x16,0xa3,0x56,0x57,0x9d,0x6e,0x56,0x06,0x66,0x91,0x62,0x12,0xf9,0xdd,0x54,0x3e,
+  0x99,0xda,0xfa,0x3a,0xa8,0x94,0xaa,0x12,0xd3,0xd9,0x62,0x62,0xc2,0x39,0xc7,0xe3,
+  0xfd,0x3d,0xd5,0x81,0xb3,0x9d,0xf1,0xcd,0x57,0xc0,0x10,0x49,0xf9,0x8c,0x86,0x9d,
+  0x02,0xb6,0x7a,0x38,0x87,0xb1,0xf1,0xee,0x81,0xa4,0x3b,0x09,0xe3,0x03,0x1b,0x70,
+  0xc4,0x4e,0x7f,0xfb,0x72,0xf1,0x1d,0x67,0xfc,0x5a,0xc4,0xd8,0xe9,0xc2,0xa8,0x52,
+  0x71,0x2a,0x64,0x9b,0xc0,0xc5,0xf6,0x39,0x98,0xe8,0x26,0xf9,0x7e,0x13,0xfa,0x29,
+  0x74,0x86,0x6e,0x1a,0x3e,0xf1,0xbe,0x76,0x9d,0xe6,0x26,0xcc,0xa3,0x7f,0xd2,0x52,
+  0xf7,0x00,0x41,0x17,0x2e,0xd4,0x05,0x6c,0x33,0xdb,0x4c,0x04,0xe6,0x33,0x8b,0x13,
+  0x4c,0x7b,0x05,0xdc,0xad,0x9c,0xbd,0xa1,0x78,0x7c,0x1f,0x5b,0xa5,0x8a,0x88,0x2c,
+  0xc5,0x2c,0x24,0x23,0x47,0x96,0xd1,0x8f,0xc2,0xd1,0x09,0xa9,0x98,0x77,0x3e,0x7c,
+  0x38,0x97,0xae,0xa0,0xa9,0x62,0x21,0x6d,0x11,0x52,0x39,0x33,0x08,0x85,0x50,0x82,
+  0x42,0x01,0xb6,0x37,0xcf,0xba,0xf8,0x8c,0x3c,0x48,0x72,0x87,0x52,0x18,0xbe,0x06,
+  0x1f,0x82,0x7c,0x4d,0xc0,0x12,0x91,0x3d,0xb3,0x5c,0x44,0x67,0x4c,0x42,0xe4,0x86,
+  0x07,0xb9,0xe0,0xaf,0xff,0xe2,0xdf,0x36,0x8e,0x7f,0x0c,0xe5,0x7e,0xfd,0x97,0x3f,
+  0x6d,0x3c,0x79,0x7c,0x78,0x24,0x6f,0xdf,0x2a,0xe3,0x3e,0xa9,0xa7,0x92,0xfd,0x06,
+  0xce,0x91,0xbb,0x25,0x08,0xfb,0xc6,0xe1,0x2c,0x82,0xf6,0xbb,0x56,0x3b,0x76,0xc9,
+  0xf6,0x5f,0xc4,0x9e,0x6c,0xd1,0x55,0xa6,0xad,0x8c,0x21,0xbe,0x1b,0x9c,0xa5,0xd3,
+  0xab,0xab,0x22,0xb9,0xe1,0xdb,0xf6,0x9f,0x7b,0x4f,0x3c,0x55,0x68,0xe4,0xfd,0x7a,
+  0xb5,0x6a,0x4c,0x1a,0x22,0xf4,0x75,0x25,0x47,0x71,0x02,0x02,0x55,0x72,0x81,0x9b,
+  0x22,0x43,0x33,0xd1,0x05,0x20,0x3a,0x8a,0xce,0x83,0x3f,0xfd,0xa0,0x1b,0x27,0x89,
+  0xb7,0xdd,0xef,0x3c,0x5a,0xdf,0xb1,0xfe,0xe9,0x17,0xbf,0xf8,0xcf,0xd6,0x96,0x48,
+  0xfa,0x90,0x26,0xfd,0x15,0x88,0xe0,0x9f,0x7e,0xf1,0xed,0xff,0xb4,0x7a,0xf2,0x6e,
+  0x06,0xa5,0x20,0xbb,0x16,0x4b,0x2b,0xcb,0xae,0x04,0x81,0xe2,0x3f,0x70,0xc6,0xf7,
+  0x1f,0x42,0x7e,0x6e,0xef,0x28,0xa1,0x5a,0xea,0xc9,0xa6,0xed,0x9d,0x5f,0xce,0x93,
+  0xd4,0x9b,0x5c,0x90,0x8d,0x37,0x20,0x85,0xad,0x24,0x02,0x79,0x74,0x46,0xd0,0x30,
+  0xf2,0x3e,0x0b,0x3b,0xf6,0x4c,0xef,0x09,0xb1,0xd6,0xb0,0x55,0xd0,0x8f,0xad,0xb5,
+  0xa0,0x0b,0x94,0x38,0xda,0x1d,0x22,0x9f,0x24,0x33,0xdb,0xf7,0xb7,0x31,0x77,0x44,
+  0xb3,0x1b,0x6f,0xd9,0x15,0x24,0x44,0x02,0xe3,0xa9,0x0d,0xda,0x42,0x14,0x94,0xa0,
+  0x60,0xbf,0x09,0x16,0x52,0xb2,0x68,0x07,0xa6,0x7c,0x5d,0xd8,0xfd,0xe2,0xfb,0xa6,
+  0x71,0x79,0x17,0xfe,0xa2,0xfa,0x23,0x7a,0x64,0x16,0xd4,0xe4,0xec,0xce,0x4c,0xbb,
+  0x3c,0xcb,0x74,0x9c,0x30,0xae,0x52,0xc7,0x8b,0x14,0x8d,0x6b,0xc5,0x70,0x82,0x37,
+  0xbb,0x14,0x29,0xb9,0xd0,0x9d,0x2a,0x2d,0xc7,0x69,0xc3,0xe7,0x1e,0xde,0x74,0x96,
+  0x24,0xf4,0xd6,0x8b,0x8a,0x31,0x9e,0x8a,0x1d,0x20,0xad,0x8a,0x79,0x0f,0xfc,0x1b,
+  0xb8,0xe3,0xd4,0x75,0x9e,0x85,0x8e,0xdb,0x2f,0xe7,0x86,0x80,0x15,0x48,0x51,0xc2,
+  0x75,0x0a,0xce,0xe3,0xd8,0x45,0xf1,0x01,0xb8,0x28,0xeb,0x45,0x35,0x4a,0x7a,0x91,
+  0x80,0x3f,0x03,0x67,0xfb,0xdc,0xbe,0xa8,0x51,0x88,0x41,0x66,0x4d,0x0f,0x92,0x1a,
+  0xa5,0x9c,0x20,0xf3,0x85,0x50,0x6d,0x6a,0x14,0x41,0x30,0xbe,0x54,0x2e,0xb1,0x11,
+  0x1c,0x06,0xdf,0xb5,0xe3,0x53,0xdc,0xbc,0xe0,0x93,0x19,0xe2,0xe3,0x14,0xe6,0x12,
+  0xa3,0x39,0x58,0x3e,0x0d,0xb2,0xa7,0xfc,0xd4,0x9c,0x11,0x91,0xb7,0x43,0x6f,0x0e,
+  0x13,0xdc,0xdf,0x62,0x27,0x52,0x34,0x81,0x48,0x88,0x48,0xa7,0xe9,0xb2,0x6d,0x51,
+  0x12,0xa2,0xcc,0x90,0x64,0x26,0x83,0xc4,0x8e,0xb9,0x24,0x4b,0x69,0x17,0x40,0x3d,
+  0xfe,0xa5,0x51,0x8c,0xc9,0x6f,0xdf,0x5a,0x1d,0x86,0x94,0x8a,0xb8,0x14,0x25,0x03,
+  0xe9,0xd1,0xbf,0x1a,0x3a,0x2f,0x92,0x90,0x49,0xf2,0x2f,0xc5,0x28,0xc3,0xf5,0xa4,
+  0x1f,0x1a,0x6e,0x96,0x23,0x55,0xc0,0xd4,0xa4,0x14,0x39,0x87,0xe9,0xb1,0x0f,0x0d,
+  0x29,0xa4,0x4a,0x08,0xb9,0x16,0x95,0x62,0x14,0x40,0x3d,0xfe,0x55,0xa8,0x05,0xe0,
+  0x8e,0x67,0xf6,0x0c,0xb4,0x80,0x54,0x54,0xe1,0xa5,0xa2,0xe5,0x40,0x2f,0x15,0xc7,
+  0xc8,0x06,0x1a,0x84,0x2d,0xab,0x8d,0xfe,0xe9,0x1d,0xcc,0xf8,0xf4,0xf9,0x80,0x9e,
+  0x88,0x35,0x5b,0x1c,0x91,0x5d,0x61,0x6c,0xce,0xa2,0xc4,0xaa,0x15,0x5e,0x29,0xef,
+  0x52,0x80,0x86,0x99,0x52,0xea,0x36,0x0a,0x9c,0xc0,0xb3,0xea,0x92,0xc8,0x58,0x3c,
+  0x70,0x9c,0x95,0x0a,0x83,0x1a,0xa5,0x60,0xdc,0x52,0x8b,0xd9,0x7e,0x8d,0xca,0xf8,
+  0xe9,0xe6,0xcc,0x10,0xd6,0x21,0x11,0x80,0x5c,0xdf,0x87,0xc1,0x38,0x63,0xd7,0xd4,
+  0x09,0xa3,0xea,0x82,0x08,0xc5,0xe6,0x3a,0x82,0x8f,0xe5,0x1d,0x35,0x03,0xeb,0x65,
+  0xdf,0x7a,0x67,0x25,0x19,0x54,0x5f,0x25,0x20,0xd5,0x74,0xd0,0x8c,0x7e,0xbf,0x6f,
+  0x81,0xa3,0x8e,0xde,0x62,0xb1,0x09,0x61,0x62,0x2a,0x25,0x8c,0xc3,0xf4,0xd8,0x87,
+  0x46,0x12,0x17,0xe2,0x4e,0xf6,0x29,0xa6,0x08,0x8f,0xc0,0x65,0xf8,0xc7,0x5f,0x59,
+  0x5b,0xa2,0x7b,0x31,0x01,0x97,0xd7,0xc7,0x60,0x7a,0xec,0x43,0xaf,0x8f,0x8b,0x7f,
+  0x47,0xfa,0x2e,0xae,0x91,0xe9,0x46,0x69,0x8d,0x1c,0xa6,0xc7,0x3e,0xb4,0x1a,0xb9,
+  0xe6,0xec,0x64,0x9f,0xa2,0xbe,0x0d,0x74,0x8a,0x66,0x52,0x7d,0x49,0x0d,0x8e,0x72,
+  0x98,0x5e,0x62,0xe4,0x68,0xa6,0x73,0x20,0xe8,0x75,0x86,0x97,0x6b,0x5d,0x29,0x62,
+  0x01,0xd4,0xe3,0x5f,0x1a,0x6a,0x4c,0xde,0xa1,0x7f,0xa4,0x79,0xdc,0x42,0x56,0x09,
+  0x2c,0x0c,0x59,0x67,0x65,0x46,0xc9,0x38,0x2b,0x03,0x18,0x7d,0x46,0x96,0x90,0xf9,
+  0x6e,0xdd,0x59,0x59,0x66,0xbc,0x4a,0xfd,0x7b,0x8e,0xd6,0x6a,0xf5,0x4a,0x2b,0x63,
+  0x01,0x61,0xea,0x1a,0x02,0x53,0xf1,0x29,0xaa,0x86,0x98,0xce,0x5c,0x95,0x47,0x77,
+  0x31,0x8a,0xe7,0xcd,0xdc,0x70,0x9e,0x36,0x9b,0xad,0xfe,0xb6,0x62,0x65,0xdb,0xf8,
+  0x8e,0x57,0xc1,0x8a,0x52,0x41,0x9b,0xe5,0xd8,0x65,0xe9,0x02,0x52,0xc1,0x4d,0x08,
+  0x15,0x86,0x5d,0xb9,0xe9,0xa5,0x23,0x6e,0x12,0x28,0x37,0xf5,0xe4,0xd6,0x94,0x72,
+  0x9b,0xa6,0x5f,0xae,0x22,0x50,0xd2,0xab,0x4c,0xaa,0x0b,0x2b,0x57,0x9e,0x88,0xd2,
+  0x78,0xb9,0x48,0x75,0x59,0x7e,0x05,0x49,0x66,0x83,0xe7,0xb3,0xea,0x52,0xd9,0x8d,
+  0x22,0xac,0x14,0xb9,0x8f,0xa3,0xba,0x1c,0xbf,0xb6,0xa3,0xfe,0xf8,0x22,0xdf,0x9e,
+  0x41,0x8d,0xbe,0xe0,0x68,0xb9,0xe1,0x11,0x50,0x3d,0xf1,0xa9,0x1b,0x1f,0x72,0x0d,
+  0x8e,0xfd,0xc6,0xf6,0x7c,0x7c,0x8a,0x82,0x46,0x00,0xd8,0xe9,0x38,0x9e,0x88,0x7e,
+  0x05,0xc6,0x03,0x68,0x72,0x10,0xa6,0x43,0x29,0x4b,0xc2,0xac,0x0e,0x13,0x39,0xcc,
+  0x45,0x83,0x44,0x26,0xe1,0xd2,0xc6,0x48,0x60,0xbd,0xec,0x5b,0x0f,0xd6,0xd1,0xfb,
+  0x72,0x6e,0xd2,0x1e,0x09,0xb7,0xda,0xa0,0x3c,0xee,0xa2,0x16,0x71,0xad,0x2b,0x6d,
+  0x8f,0x00,0xea,0xf1,0x2f,0xad,0x2d,0xda,0x8d,0x3a,0x3b,0xb9,0x14,0x75,0x94,0xf8,
+  0xc7,0x5f,0xed,0x49,0xe3,0x04,0xd3,0xe0,0x72,0x73,0xce,0x60,0x7a,0xec,0x43,0x37,
+  0xe6,0x4c,0xbf,0x77,0xb2,0x4f,0xb5,0xc6,0x0f,0xa4,0xfa,0x84,0xee,0x97,0xd6,0x98,
+  0x41,0xf5,0xc4,0xa7,0x56,0x2b,0xef,0x1d,0x3b,0xd9,0xa7,0x5a,0xeb,0xf4,0xb9,0xfd,
+  0x9e,0xc6,0xdf,0x9a,0x23,0x98,0x62,0x22,0x2b,0xc7,0x32,0xf3,0x45,0x2f,0xb2,0xa1,
+  0xcf,0x6e,0x61,0x59,0x60,0x5c,0xab,0xb6,0xdd,0xb5,0x77,0xbc,0x28,0xf5,0x2f,0x7b,
+  0xa8,0x33,0x8c,0x40,0x65,0x83,0x5e,0x9e,0x17,0xb5,0xc7,0xbb,0x78,0x1e,0xec,0xba,
+  0xc1,0x78,0x3a,0xb3,0xe3,0xd7,0x49,0x76,0x4c,0x28,0x9a,0x97,0xdb,0x5e,0x00,0xe8,
+  0x8c,0xb0,0x9c,0xe0,0xd5,0xcc,0xad,0x18,0x1c,0x00,0x40,0x2b,0x02,0x48,0x06,0xe3,
+  0x30,0x76,0xab,0xab,0x4a,0x10,0x4c,0xae,0x6a,0x10,0xb9,0x55,0x91,0x18,0xac,0x2f,
+  0x41,0xb0,0x6c,0xee,0x91,0x56,0x0f,0x45,0xa4,0x14,0x81,0xcb,0xb4,0x80,0xad,0x5e,
+  0x97,0x17,0xa4,0x85,0x3a,0x1c,0x58,0x1a,0xc6,0xfc,0x70,0x5c,0x5d,0x27,0x01,0x63,
+  0x1b,0xfb,0x18,0xf7,0x5b,0x89,0x80,0x93,0x7a,0x30,0xcf,0x2d,0x54,0x7a,0x82,0x82,
+  0x49,0xa3,0x00,0x05,0xcb,0x2d,0x47,0x21,0x4b,0xa7,0x98,0x14,0x01,0x52,0x49,0x8f,
+  0x10,0x59,0x31,0x51,0x02,0xa4,0x1c,0x59,0x26,0xc7,0x02,0x54,0x19,0x40,0x39,0x22,
+  0x59,0xb2,0x05,0xa8,0x64,0x90,0x72,0x64,0x42,0xd0,0x05,0x98,0x44,0x7e,0x09,0x9a,
+  0x9a,0x1e,0xf8,0x88,0xf7,0x58,0x55,0x5f,0x94,0x3d,0xac,0x90,0x88,0x93,0x51,0x7a,
+  0xeb,0x80,0xb5,0xba,0xea,0x25,0x4f,0xbc,0x00,0x6f,0x47,0x26,0x59,0xad,0xf2,0xd0,
+  0x1b,0x43,0xd8,0x63,0x1f,0x7a,0xa0,0x25,0x9a,0xe3,0xc8,0xfa,0xbf,0x12,0x8b,0x2d,
+  0xf1,0xd6,0x51,0x54,0xd5,0xa1,0xb8,0x22,0xb6,0x48,0x52,0x54,0x85,0x76,0xfa,0x9a,
+  0x41,0x11,0xf9,0x34,0xb7,0xbc,0x05,0x1c,0x6d,0x8f,0x7d,0x68,0x2d,0xa0,0x28,0xea,
+  0x34,0x42,0xed,0x2a,0x05,0x8d,0x50,0xba,0x8a,0x2e,0x85,0xe7,0x6e,0x3c,0x29,0x91,
+  0x04,0x66,0x57,0x4a,0x23,0xc3,0xde,0x93,0x7f,0xe5,0xe5,0x82,0xd8,0x94,0xb5,0xc2,
+  0x46,0x18,0x25,0xf7,0xea,0x88,0x4a,0xef,0xc8,0xc5,0xf2,0xca,0x3a,0xb2,0x2e,0x34,
+  0x92,0x53,0x22,0x36,0x92,0x5f,0x29,0xb8,0x0c,0x3f,0x9f,0xec,0xd8,0x81,0xc3,0x76,
+  0x8d,0x09,0x2c,0xbf,0xb5,0xde,0xfd,0xf8,0xe1,0xfd,0x47,0x1f,0x3e,0xb8,0xbf,0xf1,
+  0xe8,0xc1,0xfa,0xa3,0xcd,0x87,0x3d,0xb9,0xa4,0xc2,0x18,0x51,0x5c,0x65,0xcc,0xd3,
+  0xdd,0x7b,0xd5,0xb2,0xd7,0x2d,0x52,0x01,0x57,0x24,0x8b,0x74,0x49,0x77,0x03,0x90,
+  0x84,0xd5,0xd5,0x6c,0x4b,0x39,0x49,0x40,0xde,0x24,0x64,0xb7,0x8c,0x55,0x11,0x96,
+  0xca,0x5c,0xc2,0xec,0x3b,0x17,0x96,0x8a,0xc9,0xf2,0x7b,0x49,0x0b,0x72,0x86,0xb0,
+  0x80,0x7e,0xc5,0x10,0xaa,0x5b,0xe1,0x09,0x86,0x7d,0x96,0x5f,0x24,0x5b,0x15,0xaa,
+  0x5c,0xc2,0x4a,0x5d,0x3d,0xf9,0x97,0xd2,0xbe,0x1c,0xd6,0x7b,0xc4,0x01,0x52,0x65,
+  0x58,0x21,0x40,0x83,0xf1,0x2e,0x60,0x40,0x66,0xbc,0x95,0xd6,0x93,0x64,0x82,0x22,
+  0x29,0x6a,0xba,0x04,0xd2,0xaa,0xf0,0xb7,0x79,0x15,0x3d,0xf1,0x99,0xf3,0xb9,0x05,
+  0x2e,0x68,0xdc,0x8f,0x77,0x59,0xeb,0x1a,0x44,0xa5,0xa4,0xcc,0x23,0xf4,0xeb,0x24,
+  0xe5,0xd2,0xb3,0xea,0xaa,0xd9,0x62,0x24,0x11,0xd4,0xa5,0xfc,0xd6,0x87,0x38,0x03,
+  0xb3,0x33,0xff,0x75,0x41,0x47,0x47,0xf1,0x68,0x17,0xf6,0x71,0xf2,0xa5,0xaf,0xe7,
+  0xde,0x18,0xa9,0xb8,0x86,0x67,0x93,0xc7,0xb3,0xb8,0x53,0x93,0xc7,0x71,0x3d,0x7f,
+  0x26,0x8f,0x67,0x51,0x57,0x46,0xc3,0x60,0x9c,0x65,0x3c,0xff,0xfc,0x29,0xce,0x8a,
+  0xd4,0x49,0x5c,0x74,0x3e,0x5b,0xce,0x24,0x0e,0x11,0x95,0x4f,0xdd,0xf8,0xd4,0x81,
+  0x1e,0x3b,0x74,0xa4,0xde,0x43,0x67,0x6d,0x52,0x9f,0xd9,0xe1,0x69,0x64,0xf9,0x50,
+  0x6e,0x1c,0x47,0x13,0xbe,0xee,0x33,0x4c,0x60,0x8f,0x8e,0xc2,0x73,0x37,0xde,0xb3,
+  0x13,0xb7,0x89,0xab,0xdf,0x63,0x1f,0x66,0xca,0x78,0xd4,0xe3,0xb5,0x1a,0x1f,0x55,
+  0x9a,0x4a,0xe6,0x8b,0x7c,0xa7,0x6c,0x3b,0x7c,0x5d,0x7b,0xc3,0x7c,0x9e,0x61,0x8b,
+  0xcc,0xf4,0x06,0xcf,0x0f,0x07,0x63,0x5b,0xbb,0x9a,0x24,0x89,0xbc,0xc5,0xb6,0xed,
+  0xe0,0xee,0x07,0xdb,0x0b,0xca,0xf6,0xb0,0x21,0x4e,0xb1,0x25,0x80,0x2d,0xfb,0xd2,
+  0x32,0x64,0x86,0x49,0x3f,0xe5,0x53,0x4b,0x18,0xb7,0x28,0x97,0x30,0x21,0x93,0x6e,
+  0x2a,0x29,0xde,0x86,0xa7,0x56,0x83,0x6b,0xe7,0xa9,0x3b,0xcb,0xc8,0x1c,0xc7,0xae,
+  0x9d,0xba,0x8c,0x52,0x5c,0x18,0x7e,0x83,0xd4,0x01,0x48,0x97,0x6c,0x02,0x79,0x66,
+  0xcf,0xdc,0xbe,0x25,0xb6,0x74,0x59,0x34,0x4b,0xb1,0x87,0x92,0xda,0x20,0x9c,0xa4,
+  0x34,0xb8,0xf1,0x0f,0x93,0xd8,0x16,0x85,0xed,0xf5,0x1d,0xfa,0x7b,0xcb,0x14,0x4d,
+  0xcb,0x78,0x60,0x47,0x91,0x1b,0x38,0x7b,0x53,0xcf,0x77,0x9a,0x58,0x5d,0x4b,0x6c,
+  0x0d,0x9e,0xda,0x64,0x07,0xc3,0x42,0x75,0x22,0x0f,0x58,0xb9,0x0a,0x19,0x83,0x7a,
+  0x82,0xb6,0x70,0xad,0x6b,0x65,0x66,0xbd,0xb8,0x88,0x66,0xcd,0x65,0x5d,0x53,0x8c,
+  0x7a,0x0d,0x51,0x97,0xd6,0xb3,0x90,0x46,0x13,0xa3,0x98,0x37,0x2c,0x6c,0x36,0xae,
+  0x22,0xa6,0x89,0x05,0x47,0xa0,0xea,0x68,0x35,0x45,0xba,0x90,0x62,0xcb,0x5b,0x8c,
+  0x58,0x28,0x6c,0x25,0xdb,0x56,0x73,0x87,0x2f,0x8a,0x4e,0x5c,0x3c,0xd8,0x4d,0xb7,
+  0x34,0xf7,0xb7,0xd9,0x86,0x6a,0xf2,0x6b,0x67,0xc7,0xb2,0x5a,0x5d,0xb6,0x2d,0xa6,
+  0x79,0xef,0xe5,0xea,0x27,0xdb,0x2b,0xd6,0xab,0x7b,0x67,0xed,0x71,0x7f,0xbb,0x79,
+  0x69,0xad,0x82,0xc5,0x58,0xb5,0x67,0x51,0xcf,0x6a,0x5b,0x9f,0xe0,0xb7,0x9f,0xe2,
+  0xe7,0x36,0x7e,0x9e,0x91,0xcf,0x15,0xfc,0xfc,0x6a,0x1e,0x92,0x1f,0x5f,0x58,0xf8,
+  0xeb,0x07,0xf7,0x3f,0xee,0x59,0x57,0x2f,0xc7,0xaf,0x5a,0x55,0x76,0x95,0x35,0xb9,
+  0xdc,0xb4,0xaa,0x6c,0x10,0x5b,0xbe,0x88,0xd7,0x42,0x99,0x55,0x66,0x6d,0x5b,0x97,
+  0x37,0xbc,0xc6,0x8f,0xbd,0x99,0x47,0x28,0xd5,0x1f,0xd2,0x63,0x91,0x9c,0xea,0x6d,
+  0x97,0x5c,0x04,0x82,0xe4,0xdc,0x3b,0xe1,0x34,0x86,0x7d,0x6d,0xcf,0xf0,0xa6,0xb7,
+  0x8f,0x0b,0x5c,0x43,0xb6,0xaf,0x94,0xdf,0x3d,0xae,0x65,0x2c,0xd8,0x58,0x99,0x48,
+  0xe2,0x73,0x6a,0x8d,0xbe,0xb9,0xff,0xf9,0xdd,0x6f,0x38,0xa1,0xb9,0x42,0xde,0xdc,
+  0x6f,0x7a,0x5a,0x28,0xee,0x0c,0xe2,0xc6,0xd2,0x66,0x86,0x8a,0x63,0x14,0xcf,0x01,
+  0xa9,0xc9,0x75,0x1a,0xac,0xd0,0x65,0x9c,0x41,0x19,0x1a,0x7d,0x77,0x0a,0x0d,0xa8,
+  0x4f,0x3f,0xbb,0xd0,0x5e,0xa2,0x5f,0x19,0x29,0x38,0xf5,0xda,0x18,0x98,0x67,0xb7,
+  0xc9,0x7e,0x4e,0x7b,0xf4,0xf0,0xc8,0x21,0x5e,0x25,0x39,0x01,0x0b,0x88,0xd2,0x4b,
+  0x9a,0xd9,0x28,0xc9,0x8e,0x1c,0xd7,0x31,0x34,0x3b,0x16,0x39,0x5e,0xc0,0x5c,0x3b,
+  0x30,0x50,0x35,0xc7,0x0b,0x1e,0xc7,0x77,0xac,0x36,0xbd,0x50,0x72,0x8b,0x2e,0x9f,
+  0xf1,0x33,0x30,0xf4,0x8f,0x3a,0x9a,0xde,0x64,0x40,0x34,0x91,0xa2,0x9c,0xbd,0x11,
+  0x54,0xe0,0x6a,0xdd,0x35,0x0e,0x49,0x92,0x0b,0x3e,0x4f,0x3e,0xdd,0xe5,0x37,0x82,
+  0x5e,0xe6,0x6e,0xf9,0x2a,0x1c,0x02,0xe3,0xb3,0xd1,0x73,0x2f,0x38,0xe1,0x07,0xde,
+  0x0c,0x37,0x7f,0x55,0x14,0xfd,0x54,0x2f,0x3a,0xaa,0x5d,0x74,0x57,0x2f,0x5a,0x70,
+  0x93,0x17,0x40,0xcb,0x77,0xc0,0xdd,0xe4,0x26,0x2f,0x44,0xb5,0xe8,0x39,0x57,0xd3,
+  0x72,0x16,0x30,0xfb,0x08,0x7a,0x9c,0xe2,0xa2,0xc8,0xb8,0xaf,0x7d,0xa4,0x81,0xb7,
+  0xb5,0xf6,0xb2,0x95,0xda,0xa2,0x6b,0xdd,0xb1,0x09,0xd8,0x88,0xf2,0xe0,0xbd,0x72,
+  0x71,0xfb,0xac,0x3d,0x2a,0x6c,0x96,0x55,0x70,0x21,0x5b,0x9d,0xfb,0xd8,0x32,0x29,
+  0xde,0xf4,0x3a,0xb6,0x65,0x08,0x91,0x3d,0x3b,0xfd,0xcd,0x37,0x30,0xd3,0x53,0x7b,
+  0x4d,0xe4,0x05,0x35,0x34,0x78,0x44,0x8a,0x3e,0xf7,0x82,0x9a,0x3a,0x4c,0xe1,0xb9,
+  0x0a,0x63,0x1d,0xd6,0x1a,0xfc,0x5b,0xb3,0xc5,0xac,0xf4,0x32,0x34,0x97,0xb6,0x59,
+  0xbf,0xcc,0x52,0x41,0x7f,0x83,0xcb,0x62,0x09,0x9e,0x05,0xee,0x89,0xd5,0x9a,0x75,
+  0x2d,0xf5,0x25,0x97,0x2e,0x85,0x81,0xdb,0x9c,0xc4,0xee,0x57,0x6d,0x3e,0x3a,0x96,
+  0x35,0x10,0x01,0x61,0xa8,0xfc,0xec,0x9b,0x5a,0x8a,0xcb,0x5b,0x05,0x55,0xec,0x60,
+  0x49,0x90,0x1c,0x45,0xb0,0xca,0xeb,0xc2,0x43,0xbb,0xbc,0xda,0x77,0x2a,0x50,0xfd,
+  0x8d,0xb9,0x85,0x54,0x98,0x3e,0x7e,0xa7,0xeb,0x2f,0xb9,0xdb,0xba,0xac,0x4c,0xf6,
+  0xee,0x9b,0x76,0xba,0x1a,0x6a,0xb4,0x67,0x49,0x3f,0x70,0xcf,0x1b,0x2f,0x4e,0x8e,
+  0x06,0xae,0x1d,0x8f,0xa7,0xcf,0x49,0x1a,0x9d,0x52,0xdc,0x7d,0x46,0x9c,0xac,0xae,
+  0x07,0xf3,0xf2,0x67,0x78,0x3c,0x17,0xdc,0x2a,0x5a,0x86,0x4d,0x9a,0x9b,0x16,0x5e,
+  0xcd,0xdd,0x26,0xdd,0x42,0x38,0x6b,0x39,0x18,0xf2,0x3e,0x5d,0x9b,0x64,0x09,0xa7,
+  0xe1,0xab,0xb9,0x1b,0x5f,0xf4,0x19,0x60,0x1a,0xb2,0x51,0xb3,0x42,0xae,0xf8,0x32,
+  0x19,0xbb,0x14,0x7b,0xad,0x49,0x30,0xb0,0x69,0xf7,0x0e,0x78,0x16,0x6b,0x24,0x01,
+  0x9c,0x8a,0x56,0x99,0x44,0x89,0x1f,0x8d,0xa4,0xa8,0xe7,0x02,0x17,0x63,0x5f,0x9f,
+  0x91,0x4b,0x31,0xb5,0x54,0xe7,0x21,0x7b,0xa4,0xed,0x66,0xdd,0x5e,0x7a,0x66,0xee,
+  0xb2,0x00,0x7d,0x45,0xb7,0x2f,0x6b,0x94,0xf1,0xb8,0x88,0x65,0xd5,0x39,0x5c,0x84,
+  0xa5,0x99,0xc1,0xb8,0x25,0x6e,0xaa,0xc7,0x5e,0xd5,0xd9,0x6c,0xbe,0xb6,0x77,0xfb,
+  0xbc,0x62,0x89,0xa3,0x4f,0x7b,0x0b,0x6f,0x07,0xb8,0xbd,0x9b,0x9b,0x3b,0xf9,0xa7,
+  0x0c,0xb7,0xf2,0xcf,0x25,0x1a,0x3c,0xf1,0xa5,0x3d,0x85,0x66,0x78,0x06,0xad,0x4e,
+  0x63,0x94,0x3d,0x5d,0xb9,0xfd,0x5c,0xdf,0x89,0xf7,0xd0,0x08,0x95,0x05,0x1b,0xc0,
+  0x54,0x02,0x17,0xee,0x08,0xd3,0xb2,0x2e,0x7d,0xad,0x21,0x2f,0xff,0x30,0xd1,0x42,
+  0x96,0x9f,0x3f,0x9f,0x54,0xd3,0x77,0x61,0x4f,0xf8,0x10,0xfd,0xbd,0xae,0x07,0x23,
+  0x3f,0x03,0x74,0x33,0x4b,0xa6,0x3c,0x68,0x74,0x59,0x58,0xc5,0x75,0xad,0x99,0xf2,
+  0x8e,0x90,0xd9,0x9e,0xc5,0x55,0x3c,0xaa,0x8c,0xae,0x99,0xec,0xd1,0x32,0x9e,0xe2,
+  0x22,0xc7,0xf5,0xd5,0x57,0xb8,0x48,0x52,0x3d,0xed,0x27,0x9f,0xa0,0xef,0xf7,0x1a,
+  0x0f,0xd6,0x3f,0x7e,0x58,0x53,0xe9,0x8b,0xf9,0xa5,0xa9,0xbd,0xae,0x01,0xd7,0x57,
+  0x7c,0xfd,0x7d,0x1b,0x7e,0xd7,0x66,0xec,0xd5,0x99,0xb6,0xf2,0x17,0x87,0x74,0xe5,
+  0xc7,0x17,0x77,0x6a,0x16,0x3f,0x20,0x8f,0xf3,0xd4,0xea,0x3b,0xd9,0x03,0x32,0x4a,
+  0xf7,0x21,0xb4,0xa2,0x98,0x3c,0x9c,0xfc,0x90,0xaa,0xad,0x35,0xfc,0x53,0xb3,0x3b,
+  0x69,0xef,0xd2,0xdc,0xd0,0x37,0xd0,0x5e,0xdb,0xb9,0x2c,0xab,0xe8,0xda,0x5e,0x82,
+  0xf6,0xbc,0x4d,0xfd,0xae,0xa5,0xb3,0xf0,0x3d,0xf4,0x2e,0x4e,0x82,0xfe,0x26,0x56,
+  0xbd,0x7e,0xc5,0xa1,0xd5,0x40,0xdd,0x78,0x56,0x77,0x58,0x29,0xe3,0x9c,0x3e,0xb6,
+  0xe4,0xf5,0xe2,0xfa,0xfd,0x4c,0x7d,0x66,0x66,0xa1,0x11,0x46,0xbc,0x87,0x53,0xb3,
+  0x9b,0xf0,0xe7,0x58,0x6e,0x34,0xc6,0x28,0x6f,0xba,0xdc,0xac,0x4b,0xa8,0x2f,0xd4,
+  0x5c,0x16,0x57,0x72,0xdd,0xee,0xa0,0x3e,0x0b,0x53,0xbf,0x33,0xa8,0x8c,0xba,0x56,
+  0x57,0xe0,0xf7,0x9b,0x21,0x22,0xb2,0x48,0x05,0x8c,0x22,0x3f,0x76,0xa4,0xb7,0x92,
+  0x1c,0x37,0x95,0x8f,0xdc,0x06,0x21,0x7b,0x60,0x27,0xdb,0xb3,0x4b,0x7e,0xee,0xda,
+  0x0e,0x2e,0xbe,0x73,0x04,0xd6,0x08,0x7f,0x77,0xce,0xed,0x98,0x2c,0xc8,0x6d,0xb1,
+  0xdf,0x9c,0xe9,0xd7,0xe8,0x85,0xdb,0x94,0xef,0xe5,0x9d,0x8c,0x5e,0x66,0xc9,0x9f,
+  0x1e,0xc2,0x2a,0x1b,0x78,0x89,0x93,0x20,0x90,0x9e,0x89,0xcf,0x5a,0x2c,0x6e,0xae,
+  0xac,0xd9,0x03,0x4b,0x84,0xa5,0xf5,0xbf,0x9c,0x0a,0x5e,0xbf,0xf7,0x0d,0xf6,0xb5,
+  0x9e,0x57,0x7e,0x8b,0x5d,0xe2,0x3c,0x85,0xfc,0x85,0x2e,0xb1,0x83,0x22,0x21,0x1e,
+  0xe3,0x5e,0xe0,0x0e,0xbb,0xc4,0x19,0x40,0xfe,0x02,0x57,0xd8,0x25,0xce,0x5e,0x62,
+  0xba,0xf6,0x3e,0xd1,0xaf,0xcd,0x24,0x6d,0xc6,0x9b,0x0e,0xd9,0x94,0xbc,0x2c,0xda,
+  0xf4,0xbb,0x74,0x29,0x53,0x44,0x84,0x09,0x67,0x7e,0x78,0x89,0x7f,0xae,0xe8,0x4d,
+  0x6b,0xf0,0x03,0xfe,0x5c,0xd1,0x8b,0xd6,0x7e,0x78,0x89,0x7f,0xae,0xf0,0x9e,0xb5,
+  0x1f,0x5e,0x8e,0x93,0xab,0xdf,0xad,0x13,0x9b,0x4a,0x9c,0xa5,0x18,0x92,0x81,0x76,
+  0xff,0x71,0xb2,0x84,0x37,0x99,0x92,0x05,0xc2,0xc3,0xc9,0xcd,0x5f,0x60,0x0a,0x6d,
+  0x67,0xb0,0xcf,0xee,0x5e,0x28,0x6b,0x09,0x5b,0x0d,0xaf,0xd7,0x80,0x3a,0x37,0x34,
+  0x00,0xb9,0x65,0x8a,0xa5,0xae,0xdb,0xc3,0x0f,0xdc,0x3d,0x21,0x16,0xa4,0xc8,0xc5,
+  0x69,0x45,0x0b,0xf7,0x35,0xec,0x0e,0xc6,0x14,0x6a,0x4c,0x6b,0x01,0x4a,0x9b,0x6e,
+  0xaf,0x2d,0x5c,0x13,0x50,0xec,0xd7,0xa8,0x0b,0xaf,0x00,0x19,0xce,0x46,0x64,0xa7,
+  0xeb,0x0d,0x6b,0x0c,0x53,0xdb,0xaf,0xd1,0x38,0x04,0x5b,0x4e,0x8d,0x2f,0x52,0xcf,
+  0xf7,0x92,0xff,0xfb,0x5f,0xaa,0x2b,0x9d,0x27,0x78,0xb5,0xbd,0xa1,0x4e,0x6d,0x51,
+  0xcd,0xa8,0xd7,0xd2,0xa1,0xb5,0xda,0xfd,0xf3,0xc4,0xb5,0x9d,0x0a,0xcd,0x4e,0x9c,
+  0x21,0xde,0x1e,0xb5,0xe8,0x85,0xbb,0xac,0x9f,0x76,0xb0,0xec,0x3b,0xea,0xac,0xb4,
+  0x49,0x9f,0xc7,0xb8,0x82,0x5d,0xd9,0xa6,0x73,0x04,0xbb,0x6e,0xa3,0x48,0xe1,0x77,
+  0xd4,0xaa,0x49,0x18,0xcf,0x6c,0x6a,0x4a,0x31,0x8e,0x4c,0xac,0x7e,0x3c,0x6b,0x92,
+  0x25,0x74,0x67,0x48,0x73,0x87,0x2c,0xd5,0x6a,0xb5,0xb0,0xeb,0xe7,0x9f,0x3f,0x30,
+  0x71,0x80,0x15,0x5d,0xa8,0xf5,0xb4,0xcc,0x3b,0x6a,0x39,0x5d,0xd9,0x85,0x7e,0x18,
+  0x5f,0x68,0xde,0x40,0xe9,0x30,0x1d,0xd3,0x12,0xb9,0x91,0xda,0x49,0xab,0xca,0xec,
+  0xeb,0xf7,0xad,0x26,0xe7,0x55,0x45,0x06,0xe7,0xa6,0x01,0x9e,0xe6,0xdd,0x78,0x90,
+  0x67,0x68,0xd8,0x40,0x4f,0x47,0x73,0x32,0x98,0x43,0x53,0x7e,0x78,0xe9,0xa4,0x30,
+  0xc4,0x9f,0xe3,0x00,0x7f,0x5e,0x6f,0x54,0xd7,0xa8,0xba,0xd1,0x12,0x30,0x41,0xa5,
+  0x2d,0x01,0x9b,0x1a,0x7d,0x9d,0x55,0x60,0x8a,0xa7,0xfe,0x22,0xb0,0xde,0xac,0x7a,
+  0xca,0x86,0x53,0x02,0x5a,0xf4,0x69,0x18,0x78,0x69,0x18,0x0f,0xd2,0x30,0xea,0x23,
+  0x71,0xbd,0x6c,0x4f,0x9e,0x1b,0x38,0x6e,0x4c,0x1b,0x8b,0xd5,0xb9,0x4d,0x71,0xf1,
+  0x61,0x14,0x26,0x07,0x7e,0x95,0x76,0x74,0x00,0xca,0x53,0x66,0x0e,0xa3,0x34,0xa8,
+  0x51,0x8c,0x3e,0xde,0xc9,0xae,0x72,0xc5,0x8a,0x5a,0xe4,0x5f,0xfd,0x18,0x2d,0x43,
+  0x8e,0x50,0x04,0x6f,0xeb,0x92,0xfc,0xd1,0xcf,0x4b,0x13,0x64,0x43,0x72,0xd2,0x96,
+  0x5d,0x2a,0xa4,0x26,0xb1,0x69,0x0e,0x4b,0xc4,0xeb,0xa6,0x6c,0x92,0xda,0xa3,0xd8,
+  0xb4,0x13,0xd2,0x2a,0x36,0x71,0x2a,0x7a,0x4b,0x9c,0x94,0x56,0x8a,0xe1,0x7d,0x5d,
+  0x9f,0xb3,0xdb,0x8e,0x73,0x65,0xf1,0x02,0x2f,0x0b,0xb7,0x62,0x82,0x51,0xf1,0x2d,
+  0xd3,0xe1,0xd9,0xf0,0xec,0xcc,0x77,0x4f,0x64,0x29,0x91,0xb5,0xad,0x4b,0xc1,0xcc,
+  0x4a,0x56,0xce,0x68,0xb1,0x0e,0xc0,0x8a,0x1b,0xf6,0x55,0x99,0x93,0x8b,0xf6,0xd5,
+  0x24,0x50,0xb0,0x02,0xd5,0x00,0x34,0xea,0x1d,0xba,0xec,0x4d,0xe1,0x06,0x7f,0x6c,
+  0x97,0xc0,0x0f,0x85,0x00,0x11,0x5e,0xda,0x8e,0x2b,0x3f,0x6c,0x6b,0x95,0x28,0x31,
+  0xdd,0x20,0x15,0x46,0xc3,0x99,0x68,0xb5,0xd5,0x62,0x3d,0x47,0xd8,0xf7,0x1c,0x2d,
+  0xbf,0xfe,0xd9,0x3f,0x64,0xa4,0xe4,0x8a,0x17,0xd1,0xe2,0xd8,0xc1,0x99,0x1b,0x57,
+  0x51,0xa3,0xb7,0x6c,0xcd,0xea,0x76,0xbb,0x96,0xbc,0x4d,0x28,0xcf,0x31,0x28,0x1f,
+  0xa7,0x2c,0x81,0x23,0xc5,0x4b,0xd1,0xb4,0x4e,0xd5,0x26,0x52,0xc7,0xd3,0xc2,0x97,
+  0x95,0x56,0x41,0xea,0x50,0xf9,0xce,0xa9,0xda,0x08,0xe8,0xe4,0x78,0xcc,0xd8,0x60,
+  0xc1,0x40,0xff,0x5c,0x66,0xc2,0x9e,0x33,0x7c,0xd2,0xbe,0xa1,0xc2,0xba,0x49,0x31,
+  0x6b,0xe9,0x96,0x56,0xb6,0x87,0x0b,0x5b,0x95,0x12,0x03,0x41,0xef,0x7d,0xd1,0x6c,
+  0xd9,0x2e,0x11,0x1f,0x65,0x97,0x4b,0x51,0x1f,0x3a,0x6d,0xd6,0x23,0xc5,0xa5,0xae,
+  0x29,0xd9,0x58,0x5e,0x48,0x87,0x28,0x28,0x2e,0x27,0x72,0xd1,0xf8,0xb0,0x0f,0x85,
+  0x88,0x6b,0x58,0x1d,0x8e,0x46,0xb6,0x3b,0x65,0xe6,0x46,0x85,0x97,0x0c,0x4e,0x89,
+  0x9d,0xc9,0xb6,0xff,0xa0,0x8a,0x52,0xa6,0x70,0x45,0xa5,0x14,0xb5,0x61,0xf8,0x6a,
+  0x67,0x0d,0x65,0x5e,0x55,0x43,0x55,0x69,0x0a,0x8a,0x12,0xee,0x6f,0x97,0xf1,0xd7,
+  0x79,0x09,0xd8,0xd6,0x2c,0xd1,0xf4,0x57,0xad,0x5a,0x3a,0x4f,0xd1,0x13,0x35,0x72,
+  0x77,0xe8,0x0f,0xdc,0x29,0x44,0x3e,0x0a,0xd5,0xb0,0x94,0x8e,0x2e,0x97,0x74,0xd6,
+  0x37,0x70,0x1c,0xc4,0xa7,0x12,0x14,0x26,0x64,0x06,0xcf,0x68,0x91,0x77,0x75,0xf8,
+  0xda,0x56,0x19,0x6b,0xca,0xdb,0x64,0x63,0xfd,0x30,0x9a,0x99,0x92,0xa1,0x89,0x25,
+  0xe4,0x2e,0xd5,0x3e,0xdf,0x96,0xa5,0x35,0xd3,0x6f,0x50,0x45,0xc2,0x2e,0x30,0xb2,
+  0xd2,0x9f,0x8e,0xac,0x14,0xc2,0x91,0xa1,0x89,0x1b,0x35,0xa5,0xa7,0x00,0xd7,0x17,
+  0x1d,0x2d,0x66,0x90,0x5e,0xae,0x72,0x10,0x5d,0x2e,0x0d,0xe5,0x56,0x40,0xe5,0xf7,
+  0x43,0x68,0x79,0xe2,0x4d,0x12,0xdb,0x40,0x39,0x51,0xd0,0xec,0xcb,0x28,0xad,0xcd,
+  0x45,0xa4,0xb5,0x79,0x3d,0x69,0x6d,0x16,0x49,0x6b,0xd3,0x20,0xad,0x4d,0x93,0xb4,
+  0x36,0xbf,0xcf,0xd2,0xda,0xac,0x92,0xd6,0xa6,0x90,0x91,0xf4,0x25,0x49,0xcb,0xbc,
+  0x71,0x12,0xa1,0xd8,0x8c,0x94,0x16,0x39,0x74,0xe4,0x15,0xa2,0x22,0x99,0x70,0xd8,
+  0x35,0x0b,0x5f,0x6c,0xc8,0xbd,0x4a,0x9c,0x9f,0xff,0xb1,0xae,0xce,0xe6,0x7f,0x6c,
+  0x00,0xf8,0xe1,0x25,0xc7,0x73,0xb5,0x8a,0xb5,0xfd,0x10,0xdf,0x77,0x28,0x99,0x00,
+  0xda,0xbe,0x1b,0xa7,0x4d,0xf9,0x22,0xfa,0x3b,0x5a,0x6c,0xe1,0x45,0x94,0x7a,0x33,
+  0xb7,0x39,0x13,0x0f,0x4f,0x24,0xfd,0xa7,0x76,0x3a,0xed,0x4e,0xfc,0x10,0x78,0x34,
+  0x63,0x3b,0xed,0xdb,0x33,0x39,0x35,0xb9,0xf7,0x08,0x92,0xa6,0x0a,0x20,0x49,0x72,
+  0xe4,0xa4,0xe9,0xbd,0xcd,0x07,0xdc,0x61,0x6d,0x40,0xbb,0xbf,0xc4,0x3b,0xac,0xa7,
+  0x1f,0x40,0xe2,0x9a,0x35,0xc5,0xef,0xd9,0x07,0x50,0x66,0xcd,0x9a,0x29,0x9e,0x4a,
+  0x32,0x0d,0xcf,0x5f,0xb0,0x8d,0xf2,0x8e,0x37,0xb6,0x53,0xb2,0x0c,0x55,0xa8,0xe9,
+  0x73,0x15,0x14,0xf8,0x4a,0xf4,0xe2,0xc8,0x4b,0xd2,0xae,0xed,0x60,0xb4,0x14,0xf0,
+  0x59,0x4a,0xbb,0xa7,0x9e,0xe3,0xe6,0x6b,0xd0,0xae,0xae,0xb9,0x56,0x85,0xb1,0x3b,
+  0x0b,0xdf,0xb8,0xbc,0xce,0xf6,0x43,0x3a,0xc6,0x6a,0x8f,0x47,0x50,0x37,0x31,0xab,
+  0x7a,0x2c,0x0e,0xf8,0x95,0x1d,0xd7,0x52,0xca,0xb0,0xf3,0x5a,0xad,0x4b,0xcf,0x54,
+  0x39,0xbd,0x4e,0x33,0x9c,0x4c,0x7c,0x2f,0x20,0xb7,0x89,0xe5,0x58,0xc2,0x20,0x02,
+  0x06,0x40,0x0f,0xcc,0x95,0xe1,0x0a,0xaa,0x50,0x89,0xca,0x14,0xf7,0x4a,0xf8,0xc4,
+  0x9e,0xd3,0x26,0xea,0x4e,0x1e,0x45,0x71,0x79,0x83,0xdd,0x62,0x27,0xd3,0xa3,0xde,
+  0xe5,0x5d,0x7c,0xe8,0x42,0x58,0x09,0xd7,0x37,0x91,0xc8,0x3c,0xe9,0xb6,0xfc,0x9a,
+  0x0a,0xab,0x46,0x29,0x80,0xf4,0xd2,0x74,0xd6,0xe0,0x9a,0xe8,0xc8,0x36,0x3a,0x42,
+  0xbd,0x38,0x91,0x41,0xb7,0xdb,0xf5,0xfb,0x56,0x38,0xfa,0xd2,0x1d,0xa7,0x96,0x9a,
+  0xd1,0x05,0x77,0x4f,0x39,0x36,0x64,0x3e,0x79,0xec,0xfa,0x6d,0xb6,0x3e,0x2c,0x4e,
+  0x26,0x2d,0x54,0x0b,0x79,0x60,0xb5,0xe6,0xe9,0x78,0x60,0x63,0xcf,0xf5,0xf3,0x4f,
+  0x8e,0x90,0x94,0xac,0x7e,0xbd,0xe2,0x9b,0xa0,0xd6,0x5a,0xd5,0x27,0xc3,0x07,0x5e,
+  0x3e,0x48,0x91,0x88,0xa3,0xab,0xc0,0x06,0x90,0xfd,0x1e,0xbd,0x2d,0x5a,0xaa,0x22,
+  0x21,0x73,0xb8,0x5c,0xef,0x39,0x71,0xf1,0x0a,0xaf,0x99,0x4b,0xde,0x82,0x48,0xb2,
+  0x88,0xcc,0xbc,0x5f,0xd2,0x63,0xb1,0x00,0x55,0x8c,0x79,0x6b,0xae,0x90,0xaa,0xd8,
+  0x40,0xa7,0x4b,0x41,0xc5,0x86,0xe0,0x92,0x77,0x29,0xe4,0x5d,0x80,0x88,0x38,0xc5,
+  0x25,0x18,0x29,0xf5,0x6e,0xbf,0xdf,0xf9,0xf8,0xe3,0x8f,0x5b,0x69,0xf1,0x9d,0x6f,
+  0xf9,0xdb,0xdd,0x78,0xe0,0x71,0x52,0x62,0x09,0x62,0x7b,0xd6,0x99,0xc4,0x2e,0x7f,
+  0x07,0x63,0xd2,0x4a,0x26,0xb9,0xcb,0x26,0x00,0xa6,0x8b,0x30,0x60,0xbb,0xc1,0xda,
+  0xaa,0x9b,0x2f,0xf0,0x2a,0x06,0x7e,0xde,0xa8,0xa2,0x9a,0x39,0x9d,0x92,0x61,0x35,
+  0xf3,0x56,0x32,0x37,0x56,0x83,0x30,0x15,0xd5,0x44,0x15,0xd5,0x88,0xe8,0x20,0xad,
+  0x2a,0x42,0x4e,0x12,0xdc,0x64,0x15,0x66,0x7b,0x5d,0x8c,0xae,0x63,0xa8,0x56,0xa9,
+  0x57,0x86,0x6b,0xfd,0xd6,0x86,0x7c,0x22,0x6c,0x03,0xa6,0x92,0x11,0x9b,0x15,0xd2,
+  0x0b,0x57,0xa0,0xf8,0x9a,0xf5,0x81,0x85,0xc9,0xca,0x1c,0x95,0x25,0xb3,0xdd,0xb2,
+  0x11,0x62,0x44,0x0a,0x22,0x23,0x09,0x25,0x92,0x89,0x34,0xd1,0x44,0x93,0x56,0x94,
+  0x13,0x4d,0x24,0xcb,0xe6,0xc1,0x47,0x0f,0x3f,0x7c,0xd4,0xd2,0xaf,0x72,0xe1,0x7c,
+  0x8b,0xe6,0x55,0x75,0x65,0xf2,0x89,0xe6,0xad,0x68,0x6e,0xae,0x8b,0x09,0xa8,0xa2,
+  0xae,0xa8,0xaa,0x2e,0x55,0x48,0x51,0xa4,0x0b,0x25,0x92,0xa5,0x12,0x95,0x89,0x25,
+  0x32,0x8b,0x25,0x2a,0x10,0x0b,0xdf,0xe8,0x5e,0xc2,0xf9,0x49,0x6c,0x9f,0x91,0xfb,
+  0xe5,0xb2,0xb0,0xc8,0xa4,0x35,0xd1,0x3a,0x9e,0x02,0xa4,0x74,0xbd,0x0f,0x14,0xff,
+  0x03,0x1f,0x27,0x38,0x73,0x8f,0xe0,0x9f,0xa6,0x0f,0xff,0xb4,0xc1,0xaf,0x6c,0x5d,
+  0x2a,0x0b,0x21,0x6e,0xda,0xc1,0x9c,0x39,0x3e,0x15,0x86,0x1f,0xf8,0x1a,0x11,0x42,
+  0x5e,0x8e,0xed,0xf1,0xd4,0xc5,0x48,0x43,0x07,0xdf,0x2e,0xc4,0x5b,0x42,0xba,0xe9,
+  0xd4,0x0d,0x9a,0x71,0x7f,0x5b,0x84,0xa5,0x68,0x0a,0xbe,0xbf,0x82,0xc3,0x9b,0xb4,
+  0x49,0x25,0x9d,0xc6,0xe1,0x79,0x03,0x8f,0x10,0x1c,0xd0,0x3b,0x07,0x79,0x1d,0x8d,
+  0xe4,0xdc,0x83,0xda,0x1b,0xb1,0xfb,0x25,0xbf,0xf7,0x1d,0x78,0x42,0xed,0x25,0x92,
+  0xd9,0x47,0xc0,0x6c,0x07,0x07,0xff,0x60,0x1c,0xea,0x02,0xb9,0xc2,0x5a,0x53,0xa4,
+  0x56,0x1b,0xff,0x95,0x76,0xe8,0x90,0x0d,0xff,0x03,0xd7,0x07,0xf4,0x61,0xfc,0xd8,
+  0xf7,0x9b,0x56,0x17,0x21,0xe8,0xac,0x41,0xbc,0x71,0x31,0xea,0x6f,0x8f,0x0c,0x03,
+  0xa6,0x0d,0x6c,0x7b,0xe3,0xe2,0x61,0x01,0x1a,0x88,0x26,0x61,0x68,0xdd,0x4d,0xe0,
+  0x40,0x6c,0xe4,0x5d,0xbc,0x66,0xe4,0xd6,0x08,0x05,0x2f,0xb5,0x85,0xec,0x52,0x23,
+  0x0d,0xc2,0x3d,0xe2,0xa4,0x4d,0x97,0xa3,0xe2,0x9a,0xf1,0x36,0x8f,0x3b,0xcc,0x1b,
+  0x25,0xf2,0x54,0x06,0x1b,0xca,0x12,0x2e,0xb1,0x54,0xca,0x82,0xca,0xd1,0x37,0x94,
+  0x52,0xf6,0x50,0xce,0x0a,0x4c,0xab,0xe8,0x6c,0x27,0xf3,0xec,0x02,0xa7,0x5f,0xdf,
+  0xa1,0x44,0x46,0x42,0x89,0x22,0xbf,0x01,0xb2,0xf8,0xb6,0x03,0xa6,0x21,0x43,0x8a,
+  0xc2,0xc9,0x0e,0x50,0xe2,0x8b,0x3b,0x98,0x0b,0x7a,0xfe,0x22,0x8a,0xf8,0x95,0x1e,
+  0x78,0x5e,0x0d,0xb8,0x60,0xf4,0xb0,0x7b,0x46,0xaf,0x18,0xb9,0xd6,0x65,0x07,0x40,
+  0xe3,0x38,0x7b,0xe4,0xe4,0x96,0xdb,0x43,0x35,0x7e,0x48,0x3d,0x30,0xe3,0xa9,0xd0,
+  0x38,0x6e,0x2d,0xda,0x12,0x90,0x7d,0x5e,0xec,0xbc,0x75,0xa0,0x17,0xf1,0xc5,0x01,
+  0x36,0x51,0xbb,0xf9,0x53,0x86,0x6e,0x10,0xa8,0xc6,0x84,0x3c,0xfb,0x85,0xa1,0x6c,
+  0x5a,0x06,0xfd,0x14,0xf8,0xef,0xff,0x03,0x1d,0x4d,0x45,0x55,0xda,0x86,0x01,0x00,
+};
+
+#define WEB_ASSET_SHELL_VERSION "3.33.4"
+
+#define WEB_ASSET_APP_HTML_EN_HASH "08aeef0921476552"
+static const char WEB_ASSET_APP_HTML_EN_ETAG[] = "\"08aeef0921476552\"";
+static const char WEB_ASSET_APP_HTML_EN_PLAIN_ETAG[] = "\"08aeef0921476552-id\"";
+static const size_t WEB_ASSET_APP_HTML_EN_GZ_LEN = 992;
+static const uint8_t PROGMEM WEB_ASSET_APP_HTML_EN_GZ[] = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x97,0xdd,0x6e,0xdb,0x36,
+  0x14,0xc7,0x5f,0x85,0xeb,0x80,0xb1,0x03,0x2a,0x2b,0x89,0xfb,0x91,0xb4,0x96,0x86,
+  0xa2,0x49,0xb1,0x00,0xed,0x1a,0x2c,0x2e,0x86,0x5d,0x19,0x14,0x45,0x5b,0x6c,0x68,
+  0x52,0x20,0x29,0x3b,0xbe,0xdb,0xb3,0xec,0xd1,0xfa,0x24,0x3d,0x14,0xa9,0x6f,0x77,
+  0x28,0x7c,0xb5,0x8b,0x24,0xe6,0xff,0x7f,0x78,0xce,0x4f,0x47,0x32,0x75,0xb2,0xf8,
+  0xe9,0xfa,0xd3,0xbb,0xe5,0xdf,0x77,0x37,0xa8,0xb0,0x5b,0x91,0x2e,0xdc,0x6f,0x24,
+  0x88,0xdc,0x24,0x98,0x49,0x0c,0x6b,0x46,0xf2,0x74,0xb1,0x65,0x96,0x20,0x5a,0x10,
+  0x6d,0x98,0x4d,0xf0,0xe7,0xe5,0xfb,0xe8,0x12,0x07,0x55,0x92,0x2d,0x4b,0xf0,0x8e,
+  0xb3,0x7d,0xa9,0xb4,0xc5,0x88,0x2a,0x69,0x99,0x84,0xa8,0x3d,0xcf,0x6d,0x91,0xe4,
+  0x6c,0xc7,0x29,0x8b,0xea,0xc5,0x33,0xc4,0x25,0xb7,0x9c,0x88,0xc8,0x50,0x22,0x58,
+  0x72,0x3e,0x3b,0x83,0x2c,0x96,0x5b,0xc1,0xd2,0x9b,0xfb,0xbb,0xf9,0x05,0xba,0xe6,
+  0x64,0x23,0x95,0xb1,0x9c,0xa2,0xdd,0x7c,0x36,0x9f,0xcf,0x9e,0x2f,0x62,0xef,0x2f,
+  0x04,0x97,0x0f,0x48,0x33,0x91,0x60,0x63,0x0f,0x82,0x99,0x82,0x31,0xa8,0x56,0x68,
+  0xb6,0x4e,0x70,0x4c,0x8d,0x89,0x49,0x59,0xce,0xe0,0xef,0x6f,0xbb,0x84,0x5d,0x9c,
+  0xbd,0xbc,0x3a,0x83,0x9f,0x6c,0x3d,0xcf,0xc9,0xd9,0x0b,0x28,0x12,0xfb,0xeb,0xc8,
+  0x54,0x7e,0x48,0x17,0x39,0xdf,0x21,0x2a,0x88,0x31,0x09,0xae,0xca,0x9c,0x58,0x16,
+  0x71,0x99,0x73,0x4a,0xac,0xd2,0x18,0xf1,0xbc,0x51,0x6f,0x3b,0x11,0x96,0x24,0xe2,
+  0xe7,0x97,0x32,0x78,0x5c,0x6e,0x70,0xfa,0x39,0x7c,0x9a,0xcd,0x66,0x8b,0x18,0x72,
+  0x0e,0x12,0xbb,0x36,0x10,0x2e,0x99,0xc6,0x03,0xd9,0x61,0xd4,0x5a,0x71,0x5e,0x57,
+  0xda,0x42,0x4c,0x54,0x5f,0x21,0x68,0xa6,0x24,0xb2,0x09,0x34,0x96,0xd8,0xca,0x74,
+  0x60,0x28,0x08,0x4a,0x42,0x23,0x98,0xc7,0xf4,0x52,0x87,0x09,0x97,0xe9,0x52,0x7c,
+  0xb7,0x97,0x28,0x42,0x83,0x1a,0xb4,0xe0,0x65,0x64,0x0f,0x65,0x48,0xe7,0x96,0x1f,
+  0x55,0xce,0x44,0x9b,0x08,0xda,0x76,0x3e,0xc0,0x27,0x94,0x32,0x63,0x22,0xad,0xf6,
+  0x23,0xdc,0x60,0x08,0x92,0xc1,0xf6,0x7e,0xbb,0xbc,0xd1,0x93,0x22,0x53,0xad,0xd7,
+  0xfc,0x31,0xc1,0xe8,0x35,0x4e,0xdf,0xd6,0x6e,0x53,0x8d,0x8c,0xb3,0xc1,0x2d,0xf7,
+  0x68,0xdb,0x5c,0x9a,0x0f,0xf5,0xca,0xdf,0xf0,0x9f,0x43,0xc2,0x10,0x58,0xc0,0x65,
+  0x26,0x38,0x68,0x86,0xd1,0x4a,0xc3,0x23,0x59,0x58,0x5b,0x9a,0xd7,0x71,0x1c,0x64,
+  0xc1,0x36,0x84,0x1e,0xbc,0xdc,0xa9,0x7d,0xee,0x36,0x83,0x0f,0x1d,0x8b,0x6e,0x15,
+  0x35,0x30,0x6f,0xf3,0x5c,0xc3,0xc6,0x25,0x7b,0x84,0x87,0x90,0x68,0x4e,0xa2,0x9c,
+  0x1b,0x92,0x09,0x06,0xfe,0x9a,0x08,0x53,0xdf,0x4e,0xab,0x95,0xdc,0xa0,0x63,0x5b,
+  0x5c,0x83,0x6b,0x17,0x3e,0x90,0xa3,0x9d,0x34,0xac,0xc4,0xe9,0xd7,0x7f,0xfe,0xed,
+  0x7a,0xe3,0xf2,0xf0,0x32,0x64,0xf1,0xcd,0x98,0xb6,0x0b,0x35,0x18,0xff,0x8b,0x4e,
+  0xb5,0xb8,0x47,0xfb,0x64,0x75,0x35,0x6a,0xd3,0x28,0xbe,0xce,0x56,0x0a,0x42,0x59,
+  0xa1,0x04,0x7c,0x6d,0x12,0x7c,0x7b,0x87,0x2a,0x49,0x76,0x84,0x0b,0x97,0x63,0x1a,
+  0x11,0x3d,0xb0,0x83,0x4b,0xb3,0xea,0x47,0xa5,0xc3,0x5d,0xdf,0x6f,0xbd,0x3b,0xf6,
+  0x22,0xb3,0xe7,0x96,0x16,0x18,0x69,0x05,0x27,0x14,0xde,0x68,0x55,0x95,0x81,0x3c,
+  0x5c,0xe5,0x07,0x88,0xaa,0xc8,0x66,0xfc,0x85,0xad,0x37,0x4f,0x9f,0x7f,0x11,0xa2,
+  0x57,0xde,0x4a,0x9b,0xdd,0xcd,0x7d,0xcd,0x2a,0x6b,0x95,0x44,0xee,0x5b,0x98,0x60,
+  0xbf,0xc0,0x83,0x94,0x99,0x95,0x6d,0x5f,0xdd,0xa9,0xbc,0x86,0xe3,0x48,0x49,0x2a,
+  0x38,0x7d,0x48,0x9e,0xc0,0x91,0x2c,0x37,0xcc,0xe5,0x7c,0xea,0x8c,0x67,0xb6,0xe0,
+  0xe6,0xd7,0x37,0x4f,0xd2,0xf7,0x7f,0x2e,0x62,0x9f,0xec,0xc7,0x2a,0x20,0x42,0x2d,
+  0xdf,0xb1,0x41,0x21,0x38,0xfe,0x8f,0x17,0x02,0xa3,0x2d,0x74,0xf3,0x47,0x57,0xa8,
+  0x39,0x33,0xc6,0x47,0x21,0xb4,0x1e,0xff,0x37,0x06,0x44,0x4c,0x29,0x2c,0xc9,0x12,
+  0xac,0x76,0x4c,0xbb,0x77,0xcb,0xa0,0xa7,0x10,0xbe,0xea,0x8c,0x96,0xd1,0x14,0x6a,
+  0xbf,0x24,0xd9,0xd3,0x6e,0x53,0x8b,0xf9,0x29,0x28,0x3f,0xd6,0x95,0x80,0xd3,0xe7,
+  0x80,0xa7,0x16,0x1e,0xb3,0x43,0x64,0xf8,0x46,0x12,0x31,0xa1,0x09,0xf6,0xaa,0xb1,
+  0xa7,0x4c,0xa3,0x04,0x2d,0xd9,0xb5,0xd7,0xd1,0x2f,0x64,0x5b,0xbe,0x41,0xf7,0xb5,
+  0x7b,0x32,0xa5,0x61,0xd2,0x28,0x6d,0x26,0x78,0xad,0x3e,0xe5,0x6a,0xac,0x16,0xe8,
+  0xde,0x0b,0x27,0x33,0x70,0x59,0x56,0x36,0xf2,0xaf,0xfd,0x29,0x49,0xed,0xae,0x5a,
+  0x77,0xca,0x33,0xdc,0xde,0x52,0xdd,0x3a,0x19,0x5d,0x7b,0xf9,0x64,0xb6,0x2d,0xdb,
+  0x2a,0x7d,0x98,0x40,0x35,0xf2,0x94,0x26,0x38,0x2d,0xc6,0xc7,0x7a,0x7d,0x72,0x7d,
+  0x18,0xa0,0xf2,0x3d,0xd1,0x2c,0xb2,0xcc,0xd8,0x69,0x73,0x1a,0x7b,0x15,0xec,0x29,
+  0xcf,0x28,0x41,0xcb,0xf5,0x7b,0xd0,0xd1,0xd2,0xe9,0x27,0xf3,0xed,0x39,0x0c,0x58,
+  0xc3,0xd7,0xb5,0x27,0xeb,0x8c,0x29,0x53,0xeb,0xb5,0x34,0x7f,0x05,0xe5,0x64,0x8e,
+  0x8c,0x49,0x5a,0x6c,0x89,0x7e,0x98,0x80,0xf4,0x9c,0x29,0x49,0x67,0xb6,0x28,0x77,
+  0x4c,0xaf,0x95,0xde,0x12,0x49,0xd9,0xc9,0x34,0xec,0xd1,0x4f,0xb6,0x23,0x94,0x46,
+  0x9e,0x72,0x04,0xa7,0x3b,0x24,0xeb,0x75,0xef,0xa0,0xac,0x4f,0xc8,0xa3,0x23,0x23,
+  0x4c,0xce,0x61,0x60,0x74,0xef,0x43,0x28,0xff,0xae,0x37,0x47,0xf6,0xf7,0xf9,0xdf,
+  0x86,0x6a,0x5e,0x5a,0x64,0x34,0x85,0x21,0xf8,0x8b,0x89,0x33,0xa5,0xec,0xec,0x8b,
+  0xa9,0xe7,0x8b,0xda,0x9a,0x86,0xb8,0xa1,0x91,0x53,0x08,0x82,0x41,0xf9,0xf2,0x8a,
+  0xac,0x5f,0x5c,0x5d,0x5d,0x66,0xaf,0xb2,0x97,0xaf,0x9e,0x9f,0x5d,0xf4,0xf7,0xc5,
+  0x7e,0x56,0x8e,0xeb,0x7f,0x0b,0xbe,0x01,0xb5,0x29,0x62,0xec,0x26,0x0c,0x00,0x00,
+};
+static const char PROGMEM WEB_ASSET_APP_HTML_EN_PLAIN[] =
+  "<!DOCTYPE html><html lang='en'><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1.0'><title>ESP32 Diagnostic v3.33.4</title><link rel='stylesheet' href='/css/app.css?v=e20690069bf3da05'></head><body><div class='update-indicator' id='updateIndicator' data-i18n='updating'>Updating...</div><div class='container'><div class='header'><h1 id='main-title'><span class='status-indicator status-online' id='statusIndicator'></span>ESP32 Diagnostic v3.33.4 - <span class='chip-type' id='chipModel'></span></h1><div class='access-row'><span class='access-label' data-i18n='access' data-i18n-suffix=' :'>Access</span><a class='access-link' id='mdnsLink' href='#' data-access-host='' data-secure='https://' data-legacy='http://' data-access-label='' data-legacy-label='' data-label-id='mdnsAddressText' aria-disabled='false'><strong id='mdnsAddressText'></strong></a><span class='access-sep'>•</span><a id='ipAddressLink' class='access-link disabled' href='#' data-access-host='' data-secure='https://' data-legacy='http://' data-access-label='' data-legacy-label='' data-label-id='ipAddressText' aria-disabled='true'><strong id='ipAddressText' data-placeholder='IP unavailable' data-placeholder-key='ip_unavailable'>IP unavailable</strong></a><span class='lang-switch' role='group' aria-label='Language'><span class='lang-label' data-i18n='language_label'>Language</span><button type='button' class='lang-btn' data-lang='fr' onclick=\"changeLang('fr',this);\">FR</button><button type='button' class='lang-btn active' data-lang='en' onclick=\"changeLang('en',this);\">EN</button></span></div><div class='nav'><button type='button' class='nav-btn active' data-tab='overview' data-i18n='nav_overview' onclick=\"showTab('overview',this);\">Overview</button><button type='button' class='nav-btn' data-tab='display-signal' data-i18n='nav_display_signal' onclick=\"showTab('display-signal',this);\">Display &amp; Signal</button><button type='button' class='nav-btn' data-tab='sensors' data-i18n='nav_sensors' onclick=\"showTab('sensors',this);\">Sensors</button><button type='button' class='nav-btn' data-tab='input-devices' data-i18n='nav_input_devices' onclick=\"showTab('input-devices',this);\">Input Devices</button><button type='button' class='nav-btn' data-tab='memory' data-i18n='nav_memory' onclick=\"showTab('memory',this);\">Memory</button><button type='button' class='nav-btn' data-tab='hardware-tests' data-i18n='nav_hardware_tests' onclick=\"showTab('hardware-tests',this);\">Hardware Tests</button><button type='button' class='nav-btn' data-tab='wireless' data-i18n='nav_wireless' onclick=\"showTab('wireless',this);\">Wireless</button><button type='button' class='nav-btn' data-tab='benchmark' data-i18n='nav_benchmark' onclick=\"showTab('benchmark',this);\">Performance</button><button type='button' class='nav-btn' data-tab='export' data-i18n='nav_export' onclick=\"showTab('export',this);\">Export</button></div></div><div class='content'><div id='tabContainer'></div></div></div><script src='/js/boot.js'></script><script src='/js/static.js?v=89af5998b7b67402'></script></body></html>";
+
+#define WEB_ASSET_APP_HTML_FR_HASH "7b308317cf394d57"
+static const char WEB_ASSET_APP_HTML_FR_ETAG[] = "\"7b308317cf394d57\"";
+static const char WEB_ASSET_APP_HTML_FR_PLAIN_ETAG[] = "\"7b308317cf394d57-id\"";
+static const size_t WEB_ASSET_APP_HTML_FR_GZ_LEN = 1041;
+static const uint8_t PROGMEM WEB_ASSET_APP_HTML_FR_GZ[] = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x57,0xdd,0x6e,0xdb,0x36,
+  0x14,0x7e,0x15,0xae,0x05,0xca,0x16,0xa8,0xac,0x24,0xee,0x4f,0xdc,0x58,0x1e,0x82,
+  0x34,0x05,0x0a,0x34,0x5b,0xb0,0x78,0x03,0x76,0x65,0x1c,0x51,0xc7,0x16,0x13,0x8a,
+  0xd4,0x48,0xca,0x8e,0xef,0xf6,0x28,0xc3,0xae,0xd6,0xe7,0xc8,0x9b,0xec,0x49,0x46,
+  0xea,0xd7,0x96,0x92,0xa1,0xf0,0x6e,0x76,0x11,0x25,0x3c,0xdf,0xf9,0xf9,0xf8,0x89,
+  0x3c,0x3a,0x99,0x7e,0xf7,0xf1,0xc7,0x8b,0xf9,0xaf,0xd7,0x97,0x24,0xb5,0x99,0x98,
+  0x4d,0xfd,0x93,0x08,0x90,0xab,0x88,0x2e,0x35,0x75,0x6b,0x84,0x64,0x36,0xcd,0xd0,
+  0x02,0x61,0x29,0x68,0x83,0x36,0xa2,0x3f,0xcf,0x3f,0x05,0xa7,0xb4,0xb6,0x4a,0xc8,
+  0x30,0xa2,0x6b,0x8e,0x9b,0x5c,0x69,0x4b,0x09,0x53,0xd2,0xa2,0x74,0x5e,0x1b,0x9e,
+  0xd8,0x34,0x4a,0x70,0xcd,0x19,0x06,0xe5,0xe2,0x35,0xe1,0x92,0x5b,0x0e,0x22,0x30,
+  0x0c,0x04,0x46,0xc7,0xa3,0x23,0x97,0xc5,0x72,0x2b,0x70,0x76,0x79,0x73,0x3d,0x3e,
+  0x21,0x1f,0x39,0xac,0xa4,0x32,0x96,0x33,0xb2,0x1e,0x8f,0xc6,0xe3,0xd1,0x9b,0x69,
+  0x58,0xe1,0x53,0xc1,0xe5,0x1d,0xd1,0x28,0x22,0x6a,0xec,0x56,0xa0,0x49,0x11,0x5d,
+  0xb5,0x54,0xe3,0x32,0xa2,0x21,0x33,0x26,0x84,0x3c,0x1f,0xb9,0xdf,0xdf,0xaf,0x23,
+  0x3c,0x39,0x7a,0x37,0x39,0x72,0x3f,0xf1,0x72,0x9c,0xc0,0xd1,0x5b,0x57,0x24,0xac,
+  0xf6,0x11,0xab,0x64,0x3b,0x9b,0x26,0x7c,0x4d,0x98,0x00,0x63,0x22,0x5a,0xe4,0x09,
+  0x58,0x0c,0xb8,0x4c,0x38,0x03,0xab,0x34,0x25,0x3c,0x69,0xac,0x9f,0x3b,0xa3,0x5b,
+  0x42,0xc0,0x8f,0x4f,0x65,0x8d,0x71,0xb9,0xa2,0xb3,0x2b,0x6e,0x90,0x3c,0xfc,0x41,
+  0x6e,0x55,0xa1,0x47,0xa3,0xd1,0x34,0x74,0x79,0xf7,0x92,0x7b,0x29,0x80,0x4b,0xf4,
+  0x3a,0xee,0x98,0x3d,0x95,0xd2,0x96,0x1e,0x97,0xd5,0x32,0xe7,0x13,0x94,0xbb,0x74,
+  0x36,0x93,0x83,0x6c,0x1c,0x8d,0x05,0x5b,0x98,0x8e,0x1c,0xa9,0x0d,0x4a,0x3a,0x31,
+  0xb0,0xa2,0x5a,0x99,0x3a,0xaa,0x6e,0xab,0x3e,0xc5,0x93,0x7a,0x92,0x80,0xec,0xd5,
+  0x60,0x29,0xcf,0x03,0xbb,0xcd,0xeb,0x74,0x7e,0x79,0xa5,0x12,0x14,0x6d,0x22,0x27,
+  0xdd,0xf1,0x1e,0x7d,0x60,0x0c,0x8d,0x09,0xb4,0xda,0xf4,0xe8,0xd6,0x80,0x80,0xd8,
+  0x85,0xef,0x4a,0x56,0x01,0x3b,0xa6,0xc0,0x14,0xcb,0x25,0xbf,0x8f,0x28,0xf9,0x40,
+  0x67,0xe7,0x8c,0x3d,0xfc,0x65,0x9a,0x6a,0xd0,0xcf,0xe6,0x5e,0x7b,0x45,0x2d,0x4b,
+  0xa4,0xf9,0x52,0xae,0xaa,0x97,0xfe,0xbc,0x4e,0x58,0x3b,0xa6,0x6e,0x9b,0x11,0xad,
+  0x6d,0x06,0x59,0xa1,0xdd,0xb1,0x4c,0xad,0xcd,0xcd,0x87,0x30,0xac,0xcd,0x02,0x57,
+  0xc0,0xb6,0x95,0xb9,0xb3,0xee,0xf2,0x6e,0x33,0x54,0xae,0x7d,0xa3,0x5f,0x05,0x0d,
+  0x99,0xf3,0x24,0xd1,0x2e,0x70,0x8e,0xf7,0xee,0x20,0x82,0xe6,0x10,0x24,0xdc,0x40,
+  0x2c,0xd0,0xe1,0x4b,0x10,0xa6,0x7c,0x9d,0x56,0x2b,0xb9,0x22,0x8f,0x85,0x78,0x81,
+  0x4b,0xd4,0xfd,0x01,0x8f,0x2a,0x69,0x30,0xa7,0xb3,0xbf,0x7f,0xff,0xb3,0xd3,0xc6,
+  0xe7,0xe1,0x79,0x9d,0xa5,0x12,0x63,0x28,0x17,0x69,0x68,0xfc,0x2f,0x94,0x6a,0xe9,
+  0x3e,0xaa,0x93,0xd5,0x45,0x4f,0xa6,0x9e,0x7f,0x99,0x2d,0x17,0xc0,0x30,0x55,0xc2,
+  0x5d,0x9b,0x88,0x7e,0xbe,0x26,0xfe,0x46,0x98,0x5c,0x49,0xee,0x92,0x0c,0x5d,0x82,
+  0x3b,0xdc,0xfa,0x3c,0x8b,0x42,0xc2,0x1a,0xb8,0xf0,0xa5,0xe8,0xac,0x17,0xf6,0xb4,
+  0xf8,0xbe,0xf9,0x05,0x66,0xc3,0x2d,0x4b,0x29,0xd1,0xca,0xf5,0x29,0xba,0xd2,0xaa,
+  0xc8,0x6b,0xee,0xf5,0x3e,0xbf,0x38,0xaf,0xa2,0x7f,0x61,0xcb,0xd0,0xe1,0xf9,0xf7,
+  0xe6,0x02,0x56,0xb8,0xa8,0xa0,0x59,0x15,0xdb,0xbc,0xd5,0xb8,0xb0,0x56,0x49,0xe2,
+  0xef,0x60,0x44,0xab,0x05,0xdd,0x4b,0x18,0x5b,0x49,0x80,0x59,0xbe,0xc6,0x56,0xdc,
+  0xba,0x3d,0x13,0x25,0x99,0xe0,0xec,0x2e,0x7a,0xe6,0x7a,0xb3,0x5c,0xa1,0x4f,0xfc,
+  0xd2,0x03,0xaf,0x6d,0xca,0xcd,0xab,0xb3,0x67,0xb3,0x4f,0x3f,0x4d,0xc3,0x2a,0xe7,
+  0xb7,0x15,0xda,0xab,0x80,0xf2,0x89,0x0a,0x0e,0x68,0x2b,0x5c,0xfe,0xd0,0x55,0x68,
+  0x3a,0x46,0xbf,0x11,0xba,0xf7,0x40,0xff,0xbd,0xbe,0xf3,0x18,0xee,0xd3,0x42,0x1c,
+  0x51,0xb5,0x46,0xed,0xbf,0x2e,0x7b,0x8a,0x3a,0xf7,0x45,0x07,0xb4,0x1c,0x4d,0xaa,
+  0x36,0x73,0x88,0x5f,0x76,0x41,0x2d,0xcd,0x5f,0x0a,0x24,0xc9,0x8b,0xe7,0xe3,0xc9,
+  0x19,0x4a,0x83,0x59,0x79,0x02,0xbe,0x45,0x98,0x9a,0xd8,0x2e,0x23,0x7f,0x88,0x04,
+  0x6c,0x03,0xc3,0x57,0x12,0xc4,0x80,0x57,0x0d,0x2f,0x1a,0x78,0xc8,0xae,0x97,0xa0,
+  0xe5,0x78,0xee,0x9a,0xa2,0x93,0x79,0x85,0xe4,0x05,0x64,0xf9,0x19,0xb9,0x29,0xf1,
+  0x83,0x79,0x1a,0xb7,0x53,0xa5,0xcd,0x80,0x60,0x6b,0x1f,0x32,0x6b,0xa0,0x96,0xd2,
+  0x05,0xe4,0x16,0x0b,0x6d,0x0e,0x26,0xc1,0x65,0x5e,0xd8,0xa0,0x9a,0x02,0x86,0x54,
+  0x4a,0x74,0xd1,0xa2,0x43,0x42,0xfb,0xe1,0x2d,0xad,0xeb,0x87,0xaf,0x9a,0xe7,0xa9,
+  0x7f,0xfe,0x56,0xe0,0xe1,0xec,0x32,0xcc,0x94,0xde,0x0e,0x68,0x35,0xe6,0x21,0x9f,
+  0x1a,0x69,0x89,0x5c,0x3d,0x7c,0xcd,0x14,0xd7,0x87,0x1f,0x26,0x37,0x53,0x25,0x1b,
+  0xd0,0x18,0x58,0x34,0x76,0x28,0x50,0x03,0x2f,0x6a,0x78,0xc8,0xa8,0x97,0xa0,0x65,
+  0x36,0xf7,0x4b,0x72,0x05,0xd6,0x8b,0x84,0x87,0x9f,0xa2,0x8d,0xdb,0x9d,0xd8,0xff,
+  0x7c,0x57,0xd4,0x3a,0x60,0x48,0xaa,0xc5,0x5a,0x3a,0x37,0x20,0x0d,0x59,0xf2,0xc3,
+  0x79,0xc4,0x28,0x59,0x9a,0x81,0xbe,0x1b,0x10,0xd9,0x41,0x86,0x4c,0x3a,0xb0,0x3b,
+  0x3c,0xa8,0x97,0x4a,0x67,0x20,0xd9,0x7f,0x38,0x39,0x78,0x5f,0x8d,0xbb,0x3d,0x2e,
+  0x8d,0x79,0x48,0xa4,0x46,0xba,0xbe,0x59,0xae,0x77,0x7a,0x67,0xd9,0x34,0x1f,0x9d,
+  0x21,0xdd,0x38,0x5d,0x4f,0x90,0xfe,0x03,0xe9,0xca,0x5f,0xec,0x0c,0x96,0xbb,0x71,
+  0xd5,0xd3,0x30,0x77,0x37,0x2c,0x31,0x9a,0xb9,0xc9,0xf8,0xd6,0x84,0xb1,0x52,0x76,
+  0x74,0x6b,0xca,0x81,0xa3,0x84,0x86,0x2e,0x7e,0x8a,0xe4,0xcc,0x39,0xb9,0xe9,0xf9,
+  0x74,0x02,0xcb,0xb7,0x93,0xc9,0x69,0xfc,0x3e,0x7e,0xf7,0xfe,0xcd,0xd1,0xc9,0x6e,
+  0x5c,0x58,0x0d,0xd0,0x61,0xf9,0xbf,0xc2,0x3f,0x8e,0x59,0x89,0x92,0x3b,0x0c,0x00,
+  0x00,
+};
+static const char PROGMEM WEB_ASSET_APP_HTML_FR_PLAIN[] =
+  "<!DOCTYPE html><html lang='fr'><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1.0'><title>ESP32 Diagnostic v3.33.4</title><link rel='stylesheet' href='/css/app.css?v=e20690069bf3da05'></head><body><div class='update-indicator' id='updateIndicator' data-i18n='updating'>Mise à jour...</div><div class='container'><div class='header'><h1 id='main-title'><span class='status-indicator status-online' id='statusIndicator'></span>ESP32 Diagnostic v3.33.4 - <span class='chip-type' id='chipModel'></span></h1><div class='access-row'><span class='access-label' data-i18n='access' data-i18n-suffix=' :'>Accès</span><a class='access-link' id='mdnsLink' href='#' data-access-host='' data-secure='https://' data-legacy='http://' data-access-label='' data-legacy-label='' data-label-id='mdnsAddressText' aria-disabled='false'><strong id='mdnsAddressText'></strong></a><span class='access-sep'>•</span><a id='ipAddressLink' class='access-link disabled' href='#' data-access-host='' data-secure='https://' data-legacy='http://' data-access-label='' data-legacy-label='' data-label-id='ipAddressText' aria-disabled='true'><strong id='ipAddressText' data-placeholder='IP indisponible' data-placeholder-key='ip_unavailable'>IP indisponible</strong></a><span class='lang-switch' role='group' aria-label='Langue'><span class='lang-label' data-i18n='language_label'>Langue</span><button type='button' class='lang-btn active' data-lang='fr' onclick=\"changeLang('fr',this);\">FR</button><button type='button' class='lang-btn' data-lang='en' onclick=\"changeLang('en',this);\">EN</button></span></div><div class='nav'><button type='button' class='nav-btn active' data-tab='overview' data-i18n='nav_overview' onclick=\"showTab('overview',this);\">Vue d&#39;ensemble</button><button type='button' class='nav-btn' data-tab='display-signal' data-i18n='nav_display_signal' onclick=\"showTab('display-signal',this);\">Affichage &amp; Signal</button><button type='button' class='nav-btn' data-tab='sensors' data-i18n='nav_sensors' onclick=\"showTab('sensors',this);\">Capteurs</button><button type='button' class='nav-btn' data-tab='input-devices' data-i18n='nav_input_devices' onclick=\"showTab('input-devices',this);\">Périphériques</button><button type='button' class='nav-btn' data-tab='memory' data-i18n='nav_memory' onclick=\"showTab('memory',this);\">Mémoire</button><button type='button' class='nav-btn' data-tab='hardware-tests' data-i18n='nav_hardware_tests' onclick=\"showTab('hardware-tests',this);\">Tests Matériel</button><button type='button' class='nav-btn' data-tab='wireless' data-i18n='nav_wireless' onclick=\"showTab('wireless',this);\">Sans fil</button><button type='button' class='nav-btn' data-tab='benchmark' data-i18n='nav_benchmark' onclick=\"showTab('benchmark',this);\">Performances</button><button type='button' class='nav-btn' data-tab='export' data-i18n='nav_export' onclick=\"showTab('export',this);\">Export</button></div></div><div class='content'><div id='tabContainer'></div></div></div><script src='/js/boot.js'></script><script src='/js/static.js?v=89af5998b7b67402'></script></body></html>";
+
+#endif // WEB_ASSETS_GZ_H
@@ -6,15 +6,17 @@
 #define WEB_INTERFACE_H
 
 #include <WebServer.h>
+#include "multiplexed_web_server.h"
 #include <pgmspace.h>
 
 #include "languages.h"
+#include "web_assets_gz.h"
 
 // [OPT-003] Extern declarations with clear organization
 // Core infrastructure
 extern const char* DIAGNOSTIC_VERSION_STR;
 extern const char* MDNS_HOSTNAME_STR;
-extern WebServer server;
+extern DiagnosticWebServer server;
 extern DiagnosticInfo diagnosticData;
 extern const char* const DIAGNOSTIC_SECURE_SCHEME;
 extern const char* const DIAGNOSTIC_LEGACY_SCHEME;
@@ -44,17 +46,25 @@ extern int rotary_sw_pin;        // Rotary Encoder SW (button)
 // Déclarations forward des fonctions
 String htmlEscape(const String& raw);
 String buildTranslationsJSON();
-String generateHTML();
 String generateJavaScript();
 // Variante UI Lite (ESP32 classique uniquement)
 String generateHTMLLite();
 
+// CSS stored in PROGMEM (Full UI) - injected by tools/minify_web.py
+static const char PROGMEM DIAGNOSTIC_CSS_STATIC[] = R"CSS(
+*{margin:0;padding:0;box-sizing:border-box}body{font-family:'Segoe UI',Roboto,'Helvetica Neue',Arial,sans-serif;background:#f8fafc;min-height:100vh;padding:0;padding-top:58px}.container{max-width:1400px;margin:0 auto;background:#fafbfc;border-radius:0;overflow:visible;min-height:calc(100vh - 58px)}.header{background:linear-gradient(135deg,#0f172a 0%,#1e293b 100%);color:#fff;padding:4px 12px;text-align:center;position:fixed;top:0;left:0;right:0;z-index:1000;box-shadow:0 8px 32px rgba(0,0,0,.4),0 4px 16px rgba(0,0,0,.25)}.header h1{font-size:.95em;margin-bottom:1px;font-weight:600;letter-spacing:0.3px;display:inline-block}.header .chip-type{font-size:.9em;font-weight:500;display:inline-block;margin-left:8px;opacity:.9}.header a{transition:all .2s}.header a.disabled{opacity:.5;pointer-events:none}.access-row{display:flex;flex-wrap:wrap;align-items:center;justify-content:center;gap:6px;font-size:.85em;opacity:.92;margin:2px 0;position:relative}.access-label{font-weight:600}.access-link{color:#06b6d4;text-decoration:underline;text-underline-offset:2px}.access-link.disabled{opacity:.5;pointer-events:none}.access-sep{opacity:.7}@keyframes fadeIn{from{opacity:0;transform:translateY(-10px)}to{opacity:1;transform:translateY(0)}}.status-indicator{display:inline-block;width:8px;height:8px;border-radius:50%;margin-right:5px;animation:pulse 2s infinite;box-shadow:0 0 16px currentColor}.status-online{background:#10b981;box-shadow:0 0 20px #10b981,0 0 30px rgba(16,185,129,.5)}.status-offline{background:#ef4444;box-shadow:0 0 20px #ef4444,0 0 30px rgba(239,68,68,.5)}@keyframes pulse{0%,100%{opacity:1}50%{opacity:0.6}}.nav{display:flex;justify-content:center;gap:4px;margin-top:3px;flex-wrap:wrap;padding:0 8px}.nav-btn{padding:5px 12px;background:rgba(6,182,212,.15);border:none;border-radius:20px;color:#fff;cursor:pointer;font-weight:600;transition:all .3s;font-size:.85em;box-shadow:0 4px 12px rgba(0,0,0,.3),inset 0 1px 2px rgba(255,255,255,.1)}.nav-btn:hover{background:rgba(6,182,212,.3);transform:translateY(-2px);box-shadow:0 6px 20px rgba(6,182,212,.4)}.nav-btn.active{background:rgba(6,182,212,.4);box-shadow:0 4px 16px rgba(6,182,212,.5),inset 0 2px 4px rgba(0,0,0,.2)}.lang-switch{display:inline-flex;align-items:center;gap:4px;margin-left:12px;position:relative}.lang-switch .lang-label{color:#fff;font-weight:600;text-transform:uppercase;letter-spacing:0.8px;font-size:.85em;display:none}.lang-btn{padding:4px 10px;border:none;border-radius:12px;background:rgba(6,182,212,.2);color:#fff;cursor:pointer;font-weight:600;transition:all .25s;font-size:.85em;box-shadow:0 3px 10px rgba(0,0,0,.3)}.lang-btn:hover{background:rgba(6,182,212,.35);box-shadow:0 4px 16px rgba(6,182,212,.4)}.lang-btn.active{background:#06b6d4;color:#0f172a;box-shadow:0 6px 20px rgba(6,182,212,.6)}.content{padding:25px;animation:fadeIn 0.6s;max-width:100%}.tab-content{display:none;animation:fadeIn 0.4s}.tab-content.active{display:block}.section{background:#fff;border-radius:16px;padding:24px;margin-bottom:24px;border:none;transition:all .3s;box-shadow:0 12px 40px rgba(0,0,0,.18),0 6px 20px rgba(0,0,0,.12)}.section:hover{transform:translateY(-6px);box-shadow:0 20px 60px rgba(0,0,0,.25),0 10px 30px rgba(0,0,0,.18)}.section h2{color:#0f172a;margin-bottom:20px;font-size:1.35em;display:flex;align-items:center;gap:10px;font-weight:700;text-shadow:0 2px 8px rgba(0,0,0,.15)}.section h3{color:#1e293b;margin:16px 0 12px;font-size:1.1em;font-weight:600}.info-grid{display:grid;grid-template-columns:repeat(auto-fit,minmax(280px,1fr));gap:16px}.info-item{background:linear-gradient(135deg,#fafbfc 0%,#fff 100%);padding:16px;border-radius:12px;border:1px solid #e2e8f0;transition:all .3s;box-shadow:0 6px 20px rgba(0,0,0,.12),0 2px 8px rgba(0,0,0,.08)}.info-item:hover{transform:translateY(-4px) scale(1.02);box-shadow:0 16px 40px rgba(6,182,212,.25),0 8px 24px rgba(0,0,0,.2);border-color:#06b6d4}.info-label{font-weight:700;color:#0f172a;margin-bottom:6px;font-size:.85em;text-transform:uppercase;letter-spacing:0.8px;text-shadow:0 1px 3px rgba(0,0,0,.08)}.info-value{font-size:1.08em;color:#1e293b;font-weight:600}.badge{display:inline-block;padding:5px 14px;border-radius:20px;font-size:.88em;font-weight:700;animation:fadeIn 0.5s;box-shadow:0 4px 16px rgba(0,0,0,.2)}.badge-success{background:linear-gradient(135deg,#10b981,#059669);color:#fff;box-shadow:0 6px 20px rgba(16,185,129,.5)}.badge-warning{background:linear-gradient(135deg,#f59e0b,#d97706);color:#fff;box-shadow:0 6px 20px rgba(245,158,11,.5)}.badge-danger{background:linear-gradient(135deg,#ef4444,#dc2626);color:#fff;box-shadow:0 6px 20px rgba(239,68,68,.5)}.badge-info{background:linear-gradient(135deg,#06b6d4,#0891b2);color:#fff;box-shadow:0 6px 20px rgba(6,182,212,.5)}.btn{padding:11px 22px;border:none;border-radius:10px;font-size:.95em;font-weight:700;cursor:pointer;margin:5px;transition:all .3s;text-decoration:none;display:inline-block;box-shadow:0 8px 28px rgba(0,0,0,.25),0 4px 12px rgba(0,0,0,.18);position:relative;overflow:hidden}.btn:hover{transform:translateY(-4px) scale(1.04);box-shadow:0 16px 48px rgba(0,0,0,.35),0 8px 24px rgba(0,0,0,.25)}.btn:active{transform:translateY(-2px) scale(1.02);box-shadow:0 8px 28px rgba(0,0,0,.25)}.btn-primary{background:linear-gradient(135deg,#0f172a 0%,#1e293b 100%);color:#fff}.btn-success{background:linear-gradient(135deg,#10b981 0%,#059669 100%);color:#fff}.btn-info{background:linear-gradient(135deg,#06b6d4 0%,#0891b2 100%);color:#fff}.btn-danger{background:linear-gradient(135deg,#ef4444 0%,#dc2626 100%);color:#fff}.btn-warning{background:linear-gradient(135deg,#f59e0b 0%,#d97706 100%);color:#fff}.progress-bar{background:linear-gradient(135deg,#e2e8f0,#cbd5e0);border-radius:12px;height:26px;overflow:hidden;margin-top:12px;position:relative;box-shadow:inset 0 4px 12px rgba(0,0,0,.2),0 3px 10px rgba(0,0,0,.12)}.progress-fill{height:100%;border-radius:12px;transition:width .6s cubic-bezier(0.4,0,0.2,1);background:linear-gradient(90deg,#06b6d4 0%,#0891b2 100%);display:flex;align-items:center;justify-content:center;color:#fff;font-weight:700;font-size:0.88em;box-shadow:0 3px 12px rgba(6,182,212,.5)}.card{background:#fff;border-radius:14px;padding:20px;margin:12px 0;border:1px solid #e2e8f0;transition:all .3s;box-shadow:0 8px 28px rgba(0,0,0,.15),0 4px 12px rgba(0,0,0,.1)}.card:hover{border-color:#06b6d4;box-shadow:0 16px 48px rgba(6,182,212,.3),0 8px 24px rgba(0,0,0,.2);transform:translateY(-5px)}.loading{display:inline-block;width:20px;height:20px;border:3px solid rgba(6,182,212,.25);border-top:3px solid #06b6d4;border-radius:50%;animation:spin 1s linear infinite;box-shadow:0 3px 12px rgba(6,182,212,.4)}@keyframes spin{0%{transform:rotate(0deg)}100%{transform:rotate(360deg)}}.status-live{padding:16px;background:linear-gradient(135deg,#f1f5f9,#e2e8f0);border-radius:10px;text-align:center;font-weight:600;margin:16px 0;border:none;box-shadow:0 6px 24px rgba(0,0,0,.15),inset 0 2px 4px rgba(255,255,255,.7)}.status-live.success{background:linear-gradient(135deg,#d1fae5,#a7f3d0);color:#065f46;box-shadow:0 8px 32px rgba(16,185,129,.4)}.status-live.error{background:linear-gradient(135deg,#fee2e2,#fecaca);color:#991b1b;box-shadow:0 8px 32px rgba(239,68,68,.4)}.gpio-grid{display:grid;grid-template-columns:repeat(auto-fill,minmax(78px,1fr));gap:10px;margin-top:16px}.gpio-item{padding:14px;background:linear-gradient(135deg,#f8fafc,#f1f5f9);border:2px solid #cbd5e0;border-radius:10px;text-align:center;font-weight:700;transition:all .3s;font-size:.92em;box-shadow:0 6px 20px rgba(0,0,0,.15),0 2px 8px rgba(0,0,0,.1)}.gpio-item:hover{transform:translateY(-4px) scale(1.1);box-shadow:0 12px 36px rgba(0,0,0,.25)}.gpio-ok{border-color:#10b981;background:linear-gradient(135deg,#d1fae5,#a7f3d0);color:#065f46;box-shadow:0 8px 28px rgba(16,185,129,.4)}.gpio-fail{border-color:#ef4444;background:linear-gradient(135deg,#fee2e2,#fecaca);color:#991b1b;box-shadow:0 8px 28px rgba(239,68,68,.4)}.wifi-list{max-height:520px;overflow-y:auto;scrollbar-width:thin;scrollbar-color:#06b6d4 #e2e8f0;padding-right:8px}.wifi-item{background:#fff;padding:16px;margin:10px 0;border-radius:12px;border:1px solid #e2e8f0;transition:all .3s;box-shadow:0 6px 20px rgba(0,0,0,.12),0 2px 8px rgba(0,0,0,.08)}.wifi-item:hover{transform:translateX(8px) translateY(-3px);box-shadow:0 14px 44px rgba(6,182,212,.3),0 6px 20px rgba(0,0,0,.2);border-color:#06b6d4}input[type='number'],input[type='color'],input[type='text'],textarea,select{padding:12px;border:2px solid #cbd5e0;border-radius:10px;font-size:.95em;transition:all .3s;font-family:inherit;background:#fff;box-shadow:0 3px 12px rgba(0,0,0,.12),inset 0 2px 4px rgba(0,0,0,.08)}input:focus,textarea:focus,select:focus{outline:none;border-color:#06b6d4;box-shadow:0 6px 24px rgba(6,182,212,.3),0 0 0 4px rgba(6,182,212,.15);transform:translateY(-2px)}input[type='range']{-webkit-appearance:none;appearance:none;width:100%;height:8px;border-radius:5px;background:linear-gradient(90deg,#cbd5e0 0%,#06b6d4 100%);outline:none;opacity:0.9;transition:opacity .3s;cursor:pointer;box-shadow:0 3px 12px rgba(0,0,0,.15),inset 0 2px 4px rgba(0,0,0,.1)}input[type='range']:hover{opacity:1}input[type='range']::-webkit-slider-thumb{-webkit-appearance:none;appearance:none;width:24px;height:24px;border-radius:50%;background:linear-gradient(135deg,#06b6d4,#0891b2);cursor:pointer;box-shadow:0 4px 16px rgba(6,182,212,.5),0 2px 8px rgba(0,0,0,.2);border:3px solid #fff;transition:all .2s}input[type='range']::-webkit-slider-thumb:hover{transform:scale(1.2);box-shadow:0 6px 24px rgba(6,182,212,.7),0 3px 12px rgba(0,0,0,.3)}input[type='range']::-moz-range-thumb{width:24px;height:24px;border-radius:50%;background:linear-gradient(135deg,#06b6d4,#0891b2);cursor:pointer;box-shadow:0 4px 16px rgba(6,182,212,.5),0 2px 8px rgba(0,0,0,.2);border:3px solid #fff;transition:all .2s}input[type='range']::-moz-range-thumb:hover{transform:scale(1.2);box-shadow:0 6px 24px rgba(6,182,212,.7),0 3px 12px rgba(0,0,0,.3)}.update-indicator{position:fixed;top:68px;right:24px;padding:12px 20px;background:linear-gradient(135deg,#06b6d4,#0891b2);color:#fff;border-radius:10px;font-weight:700;opacity:0;transition:all .4s;z-index:1001;box-shadow:0 12px 40px rgba(6,182,212,.5),0 6px 20px rgba(0,0,0,.3)}.update-indicator.show{opacity:1;transform:translateY(0)}.coming{color:#f5a623;font-size:1.3em;font-weight:bold;font-style:italic;text-align:center;opacity:1;margin:15px 0;padding:10px}@media(max-width:768px){body{padding-top:105px}.header h1{font-size:.9em}.header .chip-type{display:block;margin-left:0;margin-top:2px;font-size:.85em}.info-grid{grid-template-columns:1fr}.nav{gap:3px}.nav-btn{padding:4px 10px;font-size:.8em}.content{padding:16px}.update-indicator{top:115px;right:16px}.lang-switch{display:flex;margin-left:0;margin-top:2px;justify-content:center}}@media print{body{padding-top:0;background:#fff}.header{position:relative;box-shadow:none}.nav,.btn,.update-indicator{display:none}.container,.section,.card{box-shadow:none}}
+)CSS";
+
 // JavaScript static chunk stored in PROGMEM (Full UI)
 static const char PROGMEM DIAGNOSTIC_JS_STATIC[] = R"JS(
 function getCurrentTranslations(){return translationsCache||DEFAULT_TRANSLATIONS;}
 function setTranslationsCache(t){if(t&&typeof t==='object'){translationsCache=Object.assign({},DEFAULT_TRANSLATIONS,t);}else{translationsCache=DEFAULT_TRANSLATIONS;}}
-function fetchTranslations(lang){const params=['ts='+Date.now()];if(lang){params.push('lang='+encodeURIComponent(lang));}
+const TRANSLATION_STORAGE_PREFIX='esp32diag_tr_';function readStoredTranslations(key){try{const raw=window.localStorage.getItem(key);return raw?JSON.parse(raw):null;}catch(e){return null;}}
+function storeTranslations(prefix,key,data){try{const storage=window.localStorage;for(let i=storage.length-1;i>=0;i--){const existing=storage.key(i);if(existing&&existing.indexOf(prefix)===0&&existing!==key)storage.removeItem(existing);}
+storage.setItem(key,JSON.stringify(data));}catch(e){}}
+function fetchTranslations(lang){const target=lang||currentLang;const version=(typeof TRANSLATIONS_VERSION==='object'&&TRANSLATIONS_VERSION)?TRANSLATIONS_VERSION[target]:null;if(!version){const params=['ts='+Date.now()];if(lang){params.push('lang='+encodeURIComponent(lang));}
 const endpoint='/api/get-translations?'+params.join('&');return fetch(endpoint,{cache:'no-store'}).then(r=>{if(!r.ok)throw new Error('translation fetch failed');return r.json();});}
+const prefix=TRANSLATION_STORAGE_PREFIX+target+'_';const key=prefix+version;const stored=readStoredTranslations(key);if(stored)return Promise.resolve(stored);const endpoint='/api/get-translations?lang='+encodeURIComponent(target)+'&v='+encodeURIComponent(version);return fetch(endpoint).then(r=>{if(!r.ok)throw new Error('translation fetch failed');return r.json();}).then(t=>{storeTranslations(prefix,key,t);return t;});}
 function refetchTranslations(){return fetchTranslations(currentLang).then(t=>{setTranslationsCache(t);updateInterfaceTexts();return t;});}
 function tr(key){const translations=getCurrentTranslations();const source=translations&&translations[key];const fallback=DEFAULT_TRANSLATIONS[key];return typeof source==='string'?source:(typeof fallback==='string'?fallback:key);}
 function clearTranslationAttributes(el){if(!el)return;el.removeAttribute('data-i18n');el.removeAttribute('data-i18n-prefix');el.removeAttribute('data-i18n-suffix');if(el.attributes){const toRemove=[];for(let i=0;i<el.attributes.length;i++){const name=el.attributes[i].name;if(name&&name.indexOf('data-i18n-replace-')===0){toRemove.push(name);}}
@@ -103,17 +113,22 @@ function applyAccessLinkScheme(){var links=document.querySelectorAll('[data-acce
 var host=link.getAttribute('data-access-host');var secure=link.getAttribute('data-secure')||'https://';var legacy=link.getAttribute('data-legacy')||'http://';var labelId=link.getAttribute('data-label-id');var labelNode=labelId?document.getElementById(labelId):null;var labelHost=link.getAttribute('data-access-label')||host||'';var legacyLabel=link.getAttribute('data-legacy-label')||'';if(!host){link.href='#';link.classList.add('disabled');link.setAttribute('aria-disabled','true');if(labelNode&&labelNode.getAttribute('data-placeholder')){labelNode.textContent=labelNode.getAttribute('data-placeholder');}
 continue;}
 var useSecure=shouldPreferSecureAccess(host,secure,legacy);var scheme=useSecure?secure:legacy;link.href=scheme+host;link.classList.remove('disabled');link.setAttribute('aria-disabled','false');if(labelNode){if(!useSecure&&legacyLabel){labelNode.textContent=legacyLabel;}else{labelNode.textContent=scheme+labelHost;}}}}
-document.addEventListener('DOMContentLoaded',()=>{fetchTranslations(currentLang).then(t=>{setTranslationsCache(t);updateInterfaceTexts();}).catch(err=>{console.warn('Translations unavailable',err);setTimeout(()=>refetchTranslations().catch(retryErr=>console.error('Translations retry failed',retryErr)),1000);});initNavigation();applyAccessLinkScheme();loadAllData();startAutoUpdate();});function startAutoUpdate(){if(updateTimer)clearInterval(updateTimer);updateTimer=setInterval(()=>{if(isConnected)updateLiveData();},UPDATE_INTERVAL);}
-async function loadAllData(){showUpdateIndicator();try{await Promise.all([updateSystemInfo(),updateMemoryInfo(),updateWiFiInfo(),updatePeripheralsInfo()]);isConnected=true;updateStatusIndicator(true);}catch(error){console.error('Erreur:',error);isConnected=false;updateStatusIndicator(false);}
+document.addEventListener('DOMContentLoaded',()=>{fetchTranslations(currentLang).then(t=>{setTranslationsCache(t);updateInterfaceTexts();}).catch(err=>{console.warn('Translations unavailable',err);setTimeout(()=>refetchTranslations().catch(retryErr=>console.error('Translations retry failed',retryErr)),1000);});initNavigation();applyAccessLinkScheme();loadAllData();startLiveEvents();startAutoUpdate();});function startAutoUpdate(){if(updateTimer)clearInterval(updateTimer);updateTimer=setInterval(()=>{if(isConnected&&!liveStreamOpen)updateLiveData();},UPDATE_INTERVAL);}
+const LIVE_TOPICS=['status','buttons','rotary'];const LIVE_RATE_MS=100;const LIVE_RETRY_MS=30000;let liveSource=null;let liveStreamOpen=false;const liveState={};const liveListeners={};function startLiveEvents(){if(!window.EventSource||liveSource)return;const source=new EventSource('/api/events?topics='+LIVE_TOPICS.join(',')+',jobs&rate='+LIVE_RATE_MS);liveSource=source;source.onopen=()=>{liveStreamOpen=true;};source.onerror=()=>{liveStreamOpen=false;if(source.readyState===EventSource.CLOSED){liveSource=null;setTimeout(startLiveEvents,LIVE_RETRY_MS);}};LIVE_TOPICS.forEach(topic=>{source.addEventListener(topic,e=>{let delta;try{delta=JSON.parse(e.data);}catch(err){return;}
+const state=Object.assign(liveState[topic]||{},delta);liveState[topic]=state;(liveListeners[topic]||[]).forEach(fn=>fn(state));});});source.addEventListener('job',e=>{let job;try{job=JSON.parse(e.data);}catch(err){return;}if(job.final&&jobWaiters[job.id])jobWaiters[job.id](job.state);});}
+function onLiveTopic(topic,fn){const list=liveListeners[topic]||(liveListeners[topic]=[]);list.push(fn);if(liveState[topic])fn(liveState[topic]);return()=>{const i=list.indexOf(fn);if(i>=0)list.splice(i,1);};}
+function startMonitor(topic,onLive,poll,intervalMs){if(liveStreamOpen)return onLiveTopic(topic,onLive);const id=setInterval(()=>{poll().catch(err=>console.error('Erreur:',err));},intervalMs);return()=>clearInterval(id);}
+const JOB_POLL_MS=500;const jobWaiters={};
+function waitForJob(job){return new Promise(resolve=>{let timer=null;const done=state=>{clearTimeout(timer);delete jobWaiters[job.job_id];resolve(state);};const poll=async()=>{try{const r=await fetch(job.status_url);const s=r.ok?await r.json():null;if(!s||s.final)return done(s&&s.state);}catch(err){return done();}timer=setTimeout(poll,JOB_POLL_MS);};jobWaiters[job.job_id]=done;timer=setTimeout(poll,JOB_POLL_MS);});}
+async function fetchJobResult(url){const r=await fetch(url);if(r.status!==202)return r.json();const job=await r.json();if(await waitForJob(job)==='cancelled')throw new Error('job '+job.job_id+' cancelled');return fetchJobResult(job.result_url);}
+onLiveTopic('status',d=>{updateRealtimeValues(d);isConnected=true;updateStatusIndicator(true);});
+async function loadAllData(){showUpdateIndicator();try{const r=await fetch('/api/batch?sections=system&fields=chipModel,ipAddress');if(!r.ok)throw new Error('batch fetch failed');const d=await r.json();updateSystemInfo(d.system||{});isConnected=true;updateStatusIndicator(true);}catch(error){console.error('Erreur:',error);isConnected=false;updateStatusIndicator(false);}
 hideUpdateIndicator();}
 async function updateLiveData(){try{const response=await fetch('/api/status');const data=await response.json();updateRealtimeValues(data);isConnected=true;updateStatusIndicator(true);}catch(error){console.error('Erreur:',error);isConnected=false;updateStatusIndicator(false);}}
-async function updateSystemInfo(){const r=await fetch('/api/system-info');const d=await r.json();const chipModelEl=document.getElementById('chipModel');if(chipModelEl){chipModelEl.textContent=d.chipModel||'';}
+function updateSystemInfo(d){const chipModelEl=document.getElementById('chipModel');if(chipModelEl){chipModelEl.textContent=d.chipModel||'';}
 const ipLabel=document.getElementById('ipAddressText');const ipLink=document.getElementById('ipAddressLink');const hasIp=d.ipAddress&&d.ipAddress.length;const secureScheme=(ipLink&&ipLink.getAttribute('data-secure'))||'https://';const legacyScheme=(ipLink&&ipLink.getAttribute('data-legacy'))||'http://';if(ipLabel){if(hasIp){clearTranslationAttributes(ipLabel);ipLabel.textContent=legacyScheme+d.ipAddress;}else{ipLabel.setAttribute('data-i18n','ip_unavailable');translateElement(ipLabel,getCurrentTranslations());}}
 if(ipLink){if(hasIp){ipLink.href=legacyScheme+d.ipAddress;ipLink.setAttribute('data-access-host',d.ipAddress);ipLink.setAttribute('data-access-label',d.ipAddress);ipLink.setAttribute('data-legacy-label',legacyScheme+d.ipAddress);ipLink.setAttribute('aria-disabled','false');ipLink.classList.remove('disabled');}else{ipLink.href='#';ipLink.setAttribute('data-access-host','');ipLink.setAttribute('data-access-label','');ipLink.setAttribute('data-legacy-label','');ipLink.setAttribute('aria-disabled','true');ipLink.classList.add('disabled');}}
 applyAccessLinkScheme();}
-async function updateMemoryInfo(){await fetch('/api/memory');}
-async function updateWiFiInfo(){await fetch('/api/wifi-info');}
-async function updatePeripheralsInfo(){await fetch('/api/peripherals');}
 function showTab(tabName,btn){var contents=document.querySelectorAll('.tab-content');for(var i=0;i<contents.length;i++){contents[i].classList.remove('active');}
 var tab=document.getElementById(tabName);if(tab){tab.classList.add('active');}else{loadTab(tabName);}
 setActiveTabButton(tabName,btn);}
@@ -128,7 +143,7 @@ for(var n=0;n<navs.length;n++){(function(nav){nav.addEventListener('click',funct
 var active=document.querySelector('.nav-btn.active');if(!active){var list=document.querySelectorAll('.nav-btn');if(list.length>0){active=list[0];}}
 if(active){showTab(active.getAttribute('data-tab'),active);}else{showTab('overview');}}
 async function loadTab(tabName){const c=document.getElementById('tabContainer');let tab=document.getElementById(tabName);if(!tab){tab=document.createElement('div');tab.id=tabName;tab.className='tab-content';c.appendChild(tab);}
-tab.innerHTML='<div class="section"><div class="loading"></div><p style="text-align:center" data-i18n="loading">'+tr('loading')+'</p></div>';tab.classList.add('active');try{if(tabName==='overview'){const r=await fetch('/api/overview');const d=await r.json();tab.innerHTML=buildOverview(d);}else if(tabName==='display-signal'){const leds=await fetch('/api/leds-info');const screens=await fetch('/api/screens-info');const ld=await leds.json();const sd=await screens.json();tab.innerHTML=buildDisplaySignal(ld,sd);}else if(tabName==='sensors'){tab.innerHTML=buildSensors();loadEnvironmentalData();}else if(tabName==='input-devices'){tab.innerHTML=buildInputDevices();}else if(tabName==='memory'){tab.innerHTML=buildMemory();}else if(tabName==='hardware-tests'){tab.innerHTML=buildHardwareTests();}else if(tabName==='wireless'){tab.innerHTML=buildWireless();loadWirelessInfo();}else if(tabName==='benchmark'){tab.innerHTML=buildBenchmark();}else if(tabName==='export'){tab.innerHTML=buildExport();}
+tab.innerHTML='<div class="section"><div class="loading"></div><p style="text-align:center" data-i18n="loading">'+tr('loading')+'</p></div>';tab.classList.add('active');try{if(tabName==='overview'){const r=await fetch('/api/overview');const d=await r.json();tab.innerHTML=buildOverview(d);}else if(tabName==='display-signal'){const r=await fetch('/api/batch?sections=leds,screens');const d=await r.json();tab.innerHTML=buildDisplaySignal(d.leds,d.screens);}else if(tabName==='sensors'){tab.innerHTML=buildSensors();loadEnvironmentalData();}else if(tabName==='input-devices'){tab.innerHTML=buildInputDevices();}else if(tabName==='memory'){tab.innerHTML=buildMemory();}else if(tabName==='hardware-tests'){tab.innerHTML=buildHardwareTests();}else if(tabName==='wireless'){tab.innerHTML=buildWireless();loadWirelessInfo();}else if(tabName==='benchmark'){tab.innerHTML=buildBenchmark();}else if(tabName==='export'){tab.innerHTML=buildExport();}
 updateInterfaceTexts();}catch(e){tab.innerHTML='<div class="section"><h2 data-i18n="error_label" data-i18n-prefix="❌">'+tr('error_label')+'</h2><p>'+String(e)+'</p></div>';updateInterfaceTexts();}}
 function buildOverview(d){let h='<div class="section"><h2 data-i18n="chip_info" data-i18n-prefix="🔧">'+tr('chip_info')+'</h2><div class="info-grid">';h+='<div class="info-item"><div class="info-label" data-i18n="full_model">'+tr('full_model')+'</div><div class="info-value">'+d.chip.model+' <span data-i18n="revision">'+tr('revision')+'</span> '+d.chip.revision+'</div></div>';const cpuSummary=d.chip.cores+' <span data-i18n="cores">'+tr('cores')+'</span> @ '+d.chip.freq+' MHz';h+='<div class="info-item"><div class="info-label" data-i18n="cpu_cores">'+tr('cpu_cores')+'</div><div class="info-value">'+cpuSummary+'</div></div>';h+='<div class="info-item"><div class="info-label" data-i18n="mac_wifi">'+tr('mac_wifi')+'</div><div class="info-value">'+d.chip.mac+'</div></div>';h+='<div class="info-item"><div class="info-label" data-i18n="uptime">'+tr('uptime')+'</div><div class="info-value" id="uptime">'+formatUptime(d.chip.uptime)+'</div></div>';if(d.chip.temperature!==-999){h+='<div class="info-item"><div class="info-label" data-i18n="cpu_temp">'+tr('cpu_temp')+'</div><div class="info-value" id="temperature">'+d.chip.temperature.toFixed(1)+' °C</div></div>';}
 h+='</div></div>';h+='<div class="section"><h2 data-i18n="memory_details" data-i18n-prefix="💾">'+tr('memory_details')+'</h2>';h+='<h3 data-i18n="flash_memory" data-i18n-prefix="📦">'+tr('flash_memory')+'</h3><div class="info-grid">';h+='<div class="info-item"><div class="info-label" data-i18n="real_size">'+tr('real_size')+'</div><div class="info-value">'+(d.memory.flash.real/1048576).toFixed(2)+' MB</div></div>';h+='<div class="info-item"><div class="info-label" data-i18n="flash_type">'+tr('flash_type')+'</div><div class="info-value">'+d.memory.flash.type+'</div></div>';h+='<div class="info-item"><div class="info-label" data-i18n="flash_speed">'+tr('flash_speed')+'</div><div class="info-value">'+d.memory.flash.speed+' MHz</div></div>';h+='</div>';h+='<h3 data-i18n="internal_sram" data-i18n-prefix="🧠">'+tr('internal_sram')+'</h3><div class="info-grid">';h+='<div class="info-item"><div class="info-label" data-i18n="total_size">'+tr('total_size')+'</div><div class="info-value" id="sram-total">'+(d.memory.sram.total/1024).toFixed(2)+' KB</div></div>';h+='<div class="info-item"><div class="info-label" data-i18n="free">'+tr('free')+'</div><div class="info-value" id="sram-free">'+(d.memory.sram.free/1024).toFixed(2)+' KB</div></div>';h+='<div class="info-item"><div class="info-label" data-i18n="used">'+tr('used')+'</div><div class="info-value" id="sram-used">'+(d.memory.sram.used/1024).toFixed(2)+' KB</div></div>';h+='<div class="info-item"><div class="info-label" data-i18n="memory_fragmentation">'+tr('memory_fragmentation')+'</div><div class="info-value" id="fragmentation">'+d.memory.fragmentation.toFixed(1)+'%</div></div>';h+='</div>';const sramPct=((d.memory.sram.used/d.memory.sram.total)*100).toFixed(1);h+='<div class="progress-bar"><div class="progress-fill" id="sram-progress" style="width:'+sramPct+'%">'+sramPct+'%</div></div>';if(d.memory.psram.total>0){h+='<h3 data-i18n="psram_external" data-i18n-prefix="📦">'+tr('psram_external')+'</h3><div class="info-grid">';h+='<div class="info-item"><div class="info-label" data-i18n="total_size">'+tr('total_size')+'</div><div class="info-value" id="psram-total">'+(d.memory.psram.total/1048576).toFixed(2)+' MB</div></div>';h+='<div class="info-item"><div class="info-label" data-i18n="free">'+tr('free')+'</div><div class="info-value" id="psram-free">'+(d.memory.psram.free/1048576).toFixed(2)+' MB</div></div>';h+='<div class="info-item"><div class="info-label" data-i18n="used">'+tr('used')+'</div><div class="info-value" id="psram-used">'+(d.memory.psram.used/1048576).toFixed(2)+' MB</div></div>';h+='</div>';const psramPct=((d.memory.psram.used/d.memory.psram.total)*100).toFixed(1);h+='<div class="progress-bar"><div class="progress-fill" id="psram-progress" style="width:'+psramPct+'%">'+psramPct+'%</div></div>';}
@@ -179,8 +194,8 @@ function updateBrightnessValue(value){document.getElementById('tftBrightnessValu
 async function setTFTBrightnessLevel(level){const slider=document.getElementById('tftBrightnessSlider');const valueDisplay=document.getElementById('tftBrightnessValue');if(slider)slider.value=level;if(valueDisplay)valueDisplay.textContent=level;try{const r=await fetch('/api/tft-brightness?value='+level,{method:'POST'});const d=await r.json();if(d.success){console.log('TFT brightness set to '+level+'/255');}else{console.error('Failed to set TFT brightness: '+d.message);}}catch(e){console.error('Error setting TFT brightness: '+e);}}
 async function getTFTBrightness(){try{const r=await fetch('/api/tft-brightness');const d=await r.json();if(d.success&&d.brightness!==undefined){const slider=document.getElementById('tftBrightnessSlider');const valueDisplay=document.getElementById('tftBrightnessValue');if(slider)slider.value=d.brightness;if(valueDisplay)valueDisplay.textContent=d.brightness;}}catch(e){console.error('Error getting TFT brightness: '+e);}}
 async function testADC(){setStatus('adc-status',{key:'test_in_progress'},null);const r=await fetch('/api/adc-test');const d=await r.json();let h='';d.readings.forEach(rd=>{h+='<div class="info-item"><div class="info-label">GPIO '+rd.pin+'</div><div class="info-value">'+rd.raw+' ('+rd.voltage.toFixed(2)+'V)</div></div>';});document.getElementById('adc-results').innerHTML=h;setStatus('adc-status',d.result,null);}
-async function testAllGPIO(){setStatus('gpio-status',{key:'test_in_progress'},null);const r=await fetch('/api/test-gpio');const d=await r.json();let h='';d.results.forEach(g=>{h+='<div class="gpio-item '+(g.working?'gpio-ok':'gpio-fail')+'">GPIO '+g.pin+'<br>'+(g.working?'✅ OK':'❌ FAIL')+'</div>';});document.getElementById('gpio-results').innerHTML=h;setStatus('gpio-status',{key:'gpio_test_complete',replacements:{count:d.results.length}},null);}
-async function scanWiFi(){setStatus('wifi-status',{key:'wifi_scan_in_progress'},null);const r=await fetch('/api/wifi-scan');const d=await r.json();let h='';d.networks.forEach(n=>{const icon=n.rssi>=-60?'🟢':n.rssi>=-70?'🟡':'🔴';const color=n.rssi>=-60?'#28a745':n.rssi>=-70?'#ffc107':'#dc3545';h+='<div class="wifi-item"><div style="display:flex;justify-content:space-between"><div><strong>'+icon+' '+n.ssid+'</strong><br><small>'+n.bssid+' | '+tr('wifi_channel')+' '+n.channel+'</small></div>';h+='<div style="font-size:1.3em;font-weight:bold;color:'+color+'">'+n.rssi+' dBm</div></div></div>';});document.getElementById('wifi-results').innerHTML=h;setStatus('wifi-status',{key:'wifi_networks_found',replacements:{count:d.networks.length}},null);}
+async function testAllGPIO(){setStatus('gpio-status',{key:'test_in_progress'},null);const d=await fetchJobResult('/api/test-gpio');let h='';d.results.forEach(g=>{h+='<div class="gpio-item '+(g.working?'gpio-ok':'gpio-fail')+'">GPIO '+g.pin+'<br>'+(g.working?'✅ OK':'❌ FAIL')+'</div>';});document.getElementById('gpio-results').innerHTML=h;setStatus('gpio-status',{key:'gpio_test_complete',replacements:{count:d.results.length}},null);}
+async function scanWiFi(){setStatus('wifi-status',{key:'wifi_scan_in_progress'},null);const d=await fetchJobResult('/api/wifi-scan');let h='';d.networks.forEach(n=>{const icon=n.rssi>=-60?'🟢':n.rssi>=-70?'🟡':'🔴';const color=n.rssi>=-60?'#28a745':n.rssi>=-70?'#ffc107':'#dc3545';h+='<div class="wifi-item"><div style="display:flex;justify-content:space-between"><div><strong>'+icon+' '+n.ssid+'</strong><br><small>'+n.bssid+' | '+tr('wifi_channel')+' '+n.channel+'</small></div>';h+='<div style="font-size:1.3em;font-weight:bold;color:'+color+'">'+n.rssi+' dBm</div></div></div>';});document.getElementById('wifi-results').innerHTML=h;setStatus('wifi-status',{key:'wifi_networks_found',replacements:{count:d.networks.length}},null);}
 async function loadWirelessInfo(){try{const r=await fetch('/api/wifi-info');const d=await r.json();const connectedNode=document.getElementById('wifi-connected');const ssidNode=document.getElementById('wifi-current-ssid');const ipNode=document.getElementById('wifi-ip');const gatewayNode=document.getElementById('wifi-gateway');const dnsNode=document.getElementById('wifi-dns');const rssiNode=document.getElementById('wifi-rssi');if(connectedNode){clearTranslationAttributes(connectedNode);connectedNode.textContent=d.connected?tr('connected'):tr('disconnected');connectedNode.style.color=d.connected?'#28a745':'#dc3545';}
 if(ssidNode){clearTranslationAttributes(ssidNode);ssidNode.textContent=d.ssid||'-';}
 if(ipNode){clearTranslationAttributes(ipNode);ipNode.textContent=d.ip||'-';}
@@ -194,7 +209,7 @@ if(lonNode){clearTranslationAttributes(lonNode);lonNode.textContent=d.longitude?
 if(altNode){clearTranslationAttributes(altNode);altNode.textContent=d.altitude?d.altitude.toFixed(1)+' m':'-';}
 if(satNode){clearTranslationAttributes(satNode);satNode.textContent=d.satellites||'0';}
 if(hdopNode){clearTranslationAttributes(hdopNode);hdopNode.textContent=d.hdop?d.hdop.toFixed(2):'-';}}catch(e){console.error('Error loading GPS data:',e);}}
-async function testGPS(){setStatus('gps-test-status',{key:'test_in_progress'},null);try{const r=await fetch('/api/gps-test');const d=await r.json();setStatus('gps-test-status',{text:d.result||'Test complete'},d.success?'success':'error');setTimeout(()=>loadGPSData(),1000);}catch(e){setStatus('gps-test-status',{key:'error_label'},'error');}}
+async function testGPS(){setStatus('gps-test-status',{key:'test_in_progress'},null);try{const d=await fetchJobResult('/api/gps-test');setStatus('gps-test-status',{text:d.result||'Test complete'},d.success?'success':'error');setTimeout(()=>loadGPSData(),1000);}catch(e){setStatus('gps-test-status',{key:'error_label'},'error');}}
 async function loadEnvironmentalData(){try{const r=await fetch('/api/environmental-sensors');const d=await r.json();const aht20Node=document.getElementById('env-aht20-status');const bmp280Node=document.getElementById('env-bmp280-status');const tempNode=document.getElementById('env-temp-avg');const humNode=document.getElementById('env-humidity');const pressNode=document.getElementById('env-pressure');const altNode=document.getElementById('env-altitude');if(aht20Node){clearTranslationAttributes(aht20Node);aht20Node.textContent=d.aht20_available?'✅ '+tr('available'):'❌ '+tr('not_available');aht20Node.style.color=d.aht20_available?'#28a745':'#dc3545';}
 if(bmp280Node){clearTranslationAttributes(bmp280Node);bmp280Node.textContent=d.bmp280_available?'✅ '+tr('available'):'❌ '+tr('not_available');bmp280Node.style.color=d.bmp280_available?'#28a745':'#dc3545';}
 if(tempNode){clearTranslationAttributes(tempNode);tempNode.textContent=d.temperature_avg?d.temperature_avg.toFixed(1)+' °C':'-';}
@@ -202,7 +217,7 @@ if(humNode){clearTranslationAttributes(humNode);humNode.textContent=d.humidity?d
 if(pressNode){clearTranslationAttributes(pressNode);pressNode.textContent=d.pressure?d.pressure.toFixed(1)+' hPa':'-';}
 if(altNode){clearTranslationAttributes(altNode);altNode.textContent=d.altitude?d.altitude.toFixed(1)+' m':'-';}}catch(e){console.error('Error loading environmental data:',e);}}
 async function testEnvironmentalSensors(){setStatus('env-status',{key:'test_in_progress'},null);try{const r=await fetch('/api/environmental-test');const d=await r.json();setStatus('env-status',{text:d.result||'Test complete'},d.success?'success':'error');setTimeout(()=>loadEnvironmentalData(),1000);}catch(e){setStatus('env-status',{key:'error_label'},'error');}}
-async function runBenchmarks(){const cpuNode=document.getElementById('cpu-bench');const memNode=document.getElementById('mem-bench');const cpuScoreNode=document.getElementById('cpu-score');const memSpeedNode=document.getElementById('mem-speed');const stressNode=document.getElementById('mem-stress');const durationNode=document.getElementById('stress-duration');const allocNode=document.getElementById('mem-allocs');if(cpuNode)setElementTranslation(cpuNode,{key:'test_in_progress'});if(memNode)setElementTranslation(memNode,{key:'test_in_progress'});if(cpuScoreNode)setElementTranslation(cpuScoreNode,{key:'test_in_progress'});if(memSpeedNode)setElementTranslation(memSpeedNode,{key:'test_in_progress'});if(stressNode)setElementTranslation(stressNode,{key:'test_in_progress'});if(durationNode)setElementTranslation(durationNode,{key:'test_in_progress'});if(allocNode)setElementTranslation(allocNode,{key:'test_in_progress'});try{const r=await fetch('/api/benchmark');const d=await r.json();if(cpuNode){if(typeof d.cpu==='number'&&isFinite(d.cpu)){clearTranslationAttributes(cpuNode);cpuNode.textContent=d.cpu+' µs';}else{setElementTranslation(cpuNode,{key:'not_available'});}}
+async function runBenchmarks(){const cpuNode=document.getElementById('cpu-bench');const memNode=document.getElementById('mem-bench');const cpuScoreNode=document.getElementById('cpu-score');const memSpeedNode=document.getElementById('mem-speed');const stressNode=document.getElementById('mem-stress');const durationNode=document.getElementById('stress-duration');const allocNode=document.getElementById('mem-allocs');if(cpuNode)setElementTranslation(cpuNode,{key:'test_in_progress'});if(memNode)setElementTranslation(memNode,{key:'test_in_progress'});if(cpuScoreNode)setElementTranslation(cpuScoreNode,{key:'test_in_progress'});if(memSpeedNode)setElementTranslation(memSpeedNode,{key:'test_in_progress'});if(stressNode)setElementTranslation(stressNode,{key:'test_in_progress'});if(durationNode)setElementTranslation(durationNode,{key:'test_in_progress'});if(allocNode)setElementTranslation(allocNode,{key:'test_in_progress'});try{const d=await fetchJobResult('/api/benchmark');if(cpuNode){if(typeof d.cpu==='number'&&isFinite(d.cpu)){clearTranslationAttributes(cpuNode);cpuNode.textContent=d.cpu+' µs';}else{setElementTranslation(cpuNode,{key:'not_available'});}}
 if(memNode){if(typeof d.memory==='number'&&isFinite(d.memory)){clearTranslationAttributes(memNode);memNode.textContent=d.memory+' µs';}else{setElementTranslation(memNode,{key:'not_available'});}}
 if(cpuScoreNode){if(typeof d.cpuPerf==='number'&&isFinite(d.cpuPerf)){clearTranslationAttributes(cpuScoreNode);cpuScoreNode.textContent=d.cpuPerf.toFixed(2)+' ops/µs';}else{setElementTranslation(cpuScoreNode,{key:'not_available'});}}
 if(memSpeedNode){if(typeof d.memSpeed==='number'&&isFinite(d.memSpeed)){clearTranslationAttributes(memSpeedNode);const bandwidth=d.memSpeed*0.95367431640625;memSpeedNode.textContent=bandwidth.toFixed(2)+' MB/s';}else{setElementTranslation(memSpeedNode,{key:'not_available'});}}
@@ -232,7 +247,7 @@ async function applyDHTConfig(){const pin=parseInt(document.getElementById('dhtP
 if(type){params.append('type',type);}
 const query=params.toString();const resp=await fetch('/api/dht-config'+(query.length?'?'+query:''));const d=await resp.json();if(d.type!==undefined){document.getElementById('dhtSensorType').value=String(d.type);}
 setStatus('dht-status',d.message,d.success?'success':'error');}
-async function testDHTSensor(){setStatus('dht-status',{key:'test_in_progress'},null);document.getElementById('dht-results').innerHTML='';const r=await fetch('/api/dht-test');const d=await r.json();if(d.type!==undefined){document.getElementById('dhtSensorType').value=String(d.type);}
+async function testDHTSensor(){setStatus('dht-status',{key:'test_in_progress'},null);document.getElementById('dht-results').innerHTML='';const d=await fetchJobResult('/api/dht-test');if(d.type!==undefined){document.getElementById('dhtSensorType').value=String(d.type);}
 if(d.success){let h='';if(d.type!==undefined){h+='<div class="info-item"><div class="info-label" data-i18n="dht_sensor_type">'+tr('dht_sensor_type')+'</div><div class="info-value">'+(Number(d.type)===22?tr('dht22_option'):tr('dht11_option'))+'</div></div>';}
 h+='<div class="info-item"><div class="info-label" data-i18n="temperature">'+tr('temperature')+'</div><div class="info-value">'+d.temperature.toFixed(1)+' °C</div></div>';h+='<div class="info-item"><div class="info-label" data-i18n="humidity">'+tr('humidity')+'</div><div class="info-value">'+d.humidity.toFixed(1)+' %</div></div>';document.getElementById('dht-results').innerHTML=h;}
 setStatus('dht-status',d.result,d.success?'success':'error');}
@@ -255,15 +270,18 @@ async function formatSD(){if(!confirm(tr('sd_format_confirm'))){return;}
 setStatus('sd-status',{key:'sd_format_running'},null);const r=await fetch('/api/sd-format');const d=await r.json();setStatus('sd-status',d.result,d.success?'success':'error');}
 async function applyRotaryConfig(){const clk=document.getElementById('rotaryClk').value;const dt=document.getElementById('rotaryDt').value;const sw=document.getElementById('rotarySw').value;setStatus('rotary-status',{key:'applying_config'},null);const r=await fetch(`/api/rotary-config?clk=${clk}&dt=${dt}&sw=${sw}`);const d=await r.json();setStatus('rotary-status',d.message,d.success?'success':'error');}
 async function testRotary(){setStatus('rotary-status',{key:'test_in_progress'},null);const r=await fetch('/api/rotary-test');const d=await r.json();setStatus('rotary-status',d.result,d.success?'success':'error');}
-let rotaryMonitorInterval=null;async function toggleRotaryMonitoring(){const btn=document.getElementById('rotary-monitor-btn');if(rotaryMonitorInterval){clearInterval(rotaryMonitorInterval);rotaryMonitorInterval=null;btn.textContent='👁️ '+tr('monitor_button');btn.className='btn btn-info';setStatus('rotary-status',tr('stop_monitoring'),null);return;}
-btn.textContent='⏸️ '+tr('stop_monitoring');btn.className='btn btn-danger';setStatus('rotary-status',tr('monitor_button')+'...','success');rotaryMonitorInterval=setInterval(async()=>{const r=await fetch('/api/rotary-position');const d=await r.json();const posEl=document.getElementById('rotary-position');const btnEl=document.getElementById('rotary-button');if(posEl)posEl.textContent=d.position;if(btnEl){btnEl.textContent=d.button_pressed?tr('button_pressed'):tr('button_released');btnEl.style.color=d.button_pressed?'#dc3545':'#28a745';btnEl.style.fontWeight=d.button_pressed?'bold':'normal';}},100);}
+let rotaryMonitorStop=null;function renderRotaryState(d){const posEl=document.getElementById('rotary-position');const btnEl=document.getElementById('rotary-button');if(posEl)posEl.textContent=d.position;if(btnEl){btnEl.textContent=d.button_pressed?tr('button_pressed'):tr('button_released');btnEl.style.color=d.button_pressed?'#dc3545':'#28a745';btnEl.style.fontWeight=d.button_pressed?'bold':'normal';}}
+async function toggleRotaryMonitoring(){const btn=document.getElementById('rotary-monitor-btn');if(rotaryMonitorStop){rotaryMonitorStop();rotaryMonitorStop=null;btn.textContent='👁️ '+tr('monitor_button');btn.className='btn btn-info';setStatus('rotary-status',tr('stop_monitoring'),null);return;}
+btn.textContent='⏸️ '+tr('stop_monitoring');btn.className='btn btn-danger';setStatus('rotary-status',tr('monitor_button')+'...','success');rotaryMonitorStop=startMonitor('rotary',renderRotaryState,async()=>{const r=await fetch('/api/rotary-position');renderRotaryState(await r.json());},100);}
 async function resetRotaryPosition(){const r=await fetch('/api/rotary-reset');const d=await r.json();setStatus('rotary-status',d.message,d.success?'success':null);const posEl=document.getElementById('rotary-position');if(posEl)posEl.textContent='0';}
-let bootButtonMonitorInterval=null;async function toggleBootButtonMonitoring(){const btn=document.getElementById('boot-monitor-btn');if(bootButtonMonitorInterval){clearInterval(bootButtonMonitorInterval);bootButtonMonitorInterval=null;btn.textContent='👁️ '+tr('monitor_button');btn.className='btn btn-info';return;}
-btn.textContent='⏸️ '+tr('stop_monitoring');btn.className='btn btn-danger';bootButtonMonitorInterval=setInterval(async()=>{const r=await fetch('/api/button-state?button=boot');const d=await r.json();const stateEl=document.getElementById('boot-button-state');if(stateEl){stateEl.textContent=d.pressed?tr('button_pressed'):tr('button_released');stateEl.style.color=d.pressed?'#dc3545':'#28a745';stateEl.style.fontWeight=d.pressed?'bold':'normal';}},100);}
-let button1MonitorInterval=null;async function toggleButton1Monitoring(){const btn=document.getElementById('button1-monitor-btn');if(button1MonitorInterval){clearInterval(button1MonitorInterval);button1MonitorInterval=null;btn.textContent='👁️ '+tr('monitor_button');btn.className='btn btn-info';return;}
-btn.textContent='⏸️ '+tr('stop_monitoring');btn.className='btn btn-danger';button1MonitorInterval=setInterval(async()=>{const r=await fetch('/api/button-state?button=1');const d=await r.json();const stateEl=document.getElementById('button1-state');if(stateEl){stateEl.textContent=d.pressed?tr('button_pressed'):tr('button_released');stateEl.style.color=d.pressed?'#dc3545':'#28a745';stateEl.style.fontWeight=d.pressed?'bold':'normal';}},100);}
-let button2MonitorInterval=null;async function toggleButton2Monitoring(){const btn=document.getElementById('button2-monitor-btn');if(button2MonitorInterval){clearInterval(button2MonitorInterval);button2MonitorInterval=null;btn.textContent='👁️ '+tr('monitor_button');btn.className='btn btn-info';return;}
-btn.textContent='⏸️ '+tr('stop_monitoring');btn.className='btn btn-danger';button2MonitorInterval=setInterval(async()=>{const r=await fetch('/api/button-state?button=2');const d=await r.json();const stateEl=document.getElementById('button2-state');if(stateEl){stateEl.textContent=d.pressed?tr('button_pressed'):tr('button_released');stateEl.style.color=d.pressed?'#dc3545':'#28a745';stateEl.style.fontWeight=d.pressed?'bold':'normal';}},100);}
+function renderButtonState(elementId,pressed){const stateEl=document.getElementById(elementId);if(stateEl){stateEl.textContent=pressed?tr('button_pressed'):tr('button_released');stateEl.style.color=pressed?'#dc3545':'#28a745';stateEl.style.fontWeight=pressed?'bold':'normal';}}
+function startButtonMonitor(button,key,elementId){return startMonitor('buttons',d=>renderButtonState(elementId,d[key+'_pressed']),async()=>{const r=await fetch('/api/button-state?button='+button);const d=await r.json();renderButtonState(elementId,d.pressed);},100);}
+let bootButtonMonitorStop=null;async function toggleBootButtonMonitoring(){const btn=document.getElementById('boot-monitor-btn');if(bootButtonMonitorStop){bootButtonMonitorStop();bootButtonMonitorStop=null;btn.textContent='👁️ '+tr('monitor_button');btn.className='btn btn-info';return;}
+btn.textContent='⏸️ '+tr('stop_monitoring');btn.className='btn btn-danger';bootButtonMonitorStop=startButtonMonitor('boot','boot','boot-button-state');}
+let button1MonitorStop=null;async function toggleButton1Monitoring(){const btn=document.getElementById('button1-monitor-btn');if(button1MonitorStop){button1MonitorStop();button1MonitorStop=null;btn.textContent='👁️ '+tr('monitor_button');btn.className='btn btn-info';return;}
+btn.textContent='⏸️ '+tr('stop_monitoring');btn.className='btn btn-danger';button1MonitorStop=startButtonMonitor('1','button1','button1-state');}
+let button2MonitorStop=null;async function toggleButton2Monitoring(){const btn=document.getElementById('button2-monitor-btn');if(button2MonitorStop){button2MonitorStop();button2MonitorStop=null;btn.textContent='👁️ '+tr('monitor_button');btn.className='btn btn-info';return;}
+btn.textContent='⏸️ '+tr('stop_monitoring');btn.className='btn btn-danger';button2MonitorStop=startButtonMonitor('2','button2','button2-state');}
 async function applyButtonConfig(buttonId){const pin=document.getElementById(buttonId+'-pin').value;const r=await fetch(`/api/button-config?button=${buttonId}&pin=${pin}`);const d=await r.json();alert(d.message);}
 function formatUptime(ms){const s=Math.floor(ms/1000),m=Math.floor(s/60),h=Math.floor(m/60),d=Math.floor(h/24);return d+'j '+(h%24)+'h '+(m%60)+'m';}
 function showUpdateIndicator(){document.getElementById('updateIndicator').classList.add('show');}
@@ -297,200 +315,6 @@ document.addEventListener('DOMContentLoaded',()=>{loadLite();});
 // PWM & SPI diagnostics panels plus enhanced benchmark telemetry
 void handleJavaScriptRoute();
 
-// Génère le HTML principal
-String generateHTML() {
-  const char* langCode = (currentLanguage == LANG_FR) ? "fr" : "en";
-  String html;
-  html.reserve(9500);  // Reserve memory to avoid reallocations
-  html = "<!DOCTYPE html><html lang='";
-  html += langCode;
-  html += "'><head>";
-  html += "<meta charset='UTF-8'>";
-  html += "<meta name='viewport' content='width=device-width, initial-scale=1.0'>";
-  html += "<title>";
-  html += htmlEscape(Texts::title.str());
-  html += " ";
-  html += htmlEscape(Texts::version.str());
-  html += DIAGNOSTIC_VERSION_STR;
-  html += "</title>";
-  html += "<style>";
-  html += "*{margin:0;padding:0;box-sizing:border-box}body{font-family:'Segoe UI',Roboto,'Helvetica Neue',Arial,sans-serif;background:#f8fafc;min-height:100vh;padding:0;padding-top:58px}.container{max-width:1400px;";
-  html += "margin:0 auto;background:#fafbfc;border-radius:0;overflow:visible;min-height:calc(100vh - 58px)}.header{background:linear-gradient(135deg,#0f172a 0%,#1e293b 100%);color:#fff;padding:4px 12px;text-align:center;";
-  html += "position:fixed;top:0;left:0;right:0;z-index:1000;box-shadow:0 8px 32px rgba(0,0,0,.4),0 4px 16px rgba(0,0,0,.25)}.header h1{font-size:.95em;margin-bottom:1px;font-weight:600;letter-spacing:0.3px;display:inline-block}";
-  html += ".header .chip-type{font-size:.9em;font-weight:500;display:inline-block;margin-left:8px;opacity:.9}.header a{transition:all .2s}.header a.disabled{opacity:.5;pointer-events:none}.access-row{display:flex;";
-  html += "flex-wrap:wrap;align-items:center;justify-content:center;gap:6px;font-size:.85em;opacity:.92;margin:2px 0;position:relative}.access-label{font-weight:600}.access-link{color:#06b6d4;text-decoration:underline;";
-  html += "text-underline-offset:2px}.access-link.disabled{opacity:.5;pointer-events:none}.access-sep{opacity:.7}@keyframes fadeIn{from{opacity:0;transform:translateY(-10px)}to{opacity:1;transform:translateY(0)}";
-  html += "}.status-indicator{display:inline-block;width:8px;height:8px;border-radius:50%;margin-right:5px;animation:pulse 2s infinite;box-shadow:0 0 16px currentColor}.status-online{background:#10b981;box-shadow:0 0 20px #10b981,0 0 30px rgba(16,185,129,.5)}";
-  html += ".status-offline{background:#ef4444;box-shadow:0 0 20px #ef4444,0 0 30px rgba(239,68,68,.5)}@keyframes pulse{0%,100%{opacity:1}50%{opacity:0.6}}.nav{display:flex;justify-content:center;gap:4px;margin-top:3px;";
-  html += "flex-wrap:wrap;padding:0 8px}.nav-btn{padding:5px 12px;background:rgba(6,182,212,.15);border:none;border-radius:20px;color:#fff;cursor:pointer;font-weight:600;transition:all .3s;font-size:.85em;box-shadow:0 4px 12px rgba(0,0,0,.3),inset 0 1px 2px rgba(255,255,255,.1)}";
-  html += ".nav-btn:hover{background:rgba(6,182,212,.3);transform:translateY(-2px);box-shadow:0 6px 20px rgba(6,182,212,.4)}.nav-btn.active{background:rgba(6,182,212,.4);box-shadow:0 4px 16px rgba(6,182,212,.5),inset 0 2px 4px rgba(0,0,0,.2)}";
-  html += ".lang-switch{display:inline-flex;align-items:center;gap:4px;margin-left:12px;position:relative}.lang-switch .lang-label{color:#fff;font-weight:600;text-transform:uppercase;letter-spacing:0.8px;font-size:.85em;";
-  html += "display:none}.lang-btn{padding:4px 10px;border:none;border-radius:12px;background:rgba(6,182,212,.2);color:#fff;cursor:pointer;font-weight:600;transition:all .25s;font-size:.85em;box-shadow:0 3px 10px rgba(0,0,0,.3)}";
-  html += ".lang-btn:hover{background:rgba(6,182,212,.35);box-shadow:0 4px 16px rgba(6,182,212,.4)}.lang-btn.active{background:#06b6d4;color:#0f172a;box-shadow:0 6px 20px rgba(6,182,212,.6)}.content{padding:25px;";
-  html += "animation:fadeIn 0.6s;max-width:100%}.tab-content{display:none;animation:fadeIn 0.4s}.tab-content.active{display:block}.section{background:#fff;border-radius:16px;padding:24px;margin-bottom:24px;border:none;";
-  html += "transition:all .3s;box-shadow:0 12px 40px rgba(0,0,0,.18),0 6px 20px rgba(0,0,0,.12)}.section:hover{transform:translateY(-6px);box-shadow:0 20px 60px rgba(0,0,0,.25),0 10px 30px rgba(0,0,0,.18)}.section h2{color:#0f172a;";
-  html += "margin-bottom:20px;font-size:1.35em;display:flex;align-items:center;gap:10px;font-weight:700;text-shadow:0 2px 8px rgba(0,0,0,.15)}.section h3{color:#1e293b;margin:16px 0 12px;font-size:1.1em;font-weight:600}";
-  html += ".info-grid{display:grid;grid-template-columns:repeat(auto-fit,minmax(280px,1fr));gap:16px}.info-item{background:linear-gradient(135deg,#fafbfc 0%,#fff 100%);padding:16px;border-radius:12px;border:1px solid #e2e8f0;";
-  html += "transition:all .3s;box-shadow:0 6px 20px rgba(0,0,0,.12),0 2px 8px rgba(0,0,0,.08)}.info-item:hover{transform:translateY(-4px) scale(1.02);box-shadow:0 16px 40px rgba(6,182,212,.25),0 8px 24px rgba(0,0,0,.2);";
-  html += "border-color:#06b6d4}.info-label{font-weight:700;color:#0f172a;margin-bottom:6px;font-size:.85em;text-transform:uppercase;letter-spacing:0.8px;text-shadow:0 1px 3px rgba(0,0,0,.08)}.info-value{font-size:1.08em;";
-  html += "color:#1e293b;font-weight:600}.badge{display:inline-block;padding:5px 14px;border-radius:20px;font-size:.88em;font-weight:700;animation:fadeIn 0.5s;box-shadow:0 4px 16px rgba(0,0,0,.2)}.badge-success{background:linear-gradient(135deg,#10b981,#059669);";
-  html += "color:#fff;box-shadow:0 6px 20px rgba(16,185,129,.5)}.badge-warning{background:linear-gradient(135deg,#f59e0b,#d97706);color:#fff;box-shadow:0 6px 20px rgba(245,158,11,.5)}.badge-danger{background:linear-gradient(135deg,#ef4444,#dc2626);";
-  html += "color:#fff;box-shadow:0 6px 20px rgba(239,68,68,.5)}.badge-info{background:linear-gradient(135deg,#06b6d4,#0891b2);color:#fff;box-shadow:0 6px 20px rgba(6,182,212,.5)}.btn{padding:11px 22px;border:none;";
-  html += "border-radius:10px;font-size:.95em;font-weight:700;cursor:pointer;margin:5px;transition:all .3s;text-decoration:none;display:inline-block;box-shadow:0 8px 28px rgba(0,0,0,.25),0 4px 12px rgba(0,0,0,.18);";
-  html += "position:relative;overflow:hidden}.btn:hover{transform:translateY(-4px) scale(1.04);box-shadow:0 16px 48px rgba(0,0,0,.35),0 8px 24px rgba(0,0,0,.25)}.btn:active{transform:translateY(-2px) scale(1.02);";
-  html += "box-shadow:0 8px 28px rgba(0,0,0,.25)}.btn-primary{background:linear-gradient(135deg,#0f172a 0%,#1e293b 100%);color:#fff}.btn-success{background:linear-gradient(135deg,#10b981 0%,#059669 100%);color:#fff}";
-  html += ".btn-info{background:linear-gradient(135deg,#06b6d4 0%,#0891b2 100%);color:#fff}.btn-danger{background:linear-gradient(135deg,#ef4444 0%,#dc2626 100%);color:#fff}.btn-warning{background:linear-gradient(135deg,#f59e0b 0%,#d97706 100%);";
-  html += "color:#fff}.progress-bar{background:linear-gradient(135deg,#e2e8f0,#cbd5e0);border-radius:12px;height:26px;overflow:hidden;margin-top:12px;position:relative;box-shadow:inset 0 4px 12px rgba(0,0,0,.2),0 3px 10px rgba(0,0,0,.12)}";
-  html += ".progress-fill{height:100%;border-radius:12px;transition:width .6s cubic-bezier(0.4,0,0.2,1);background:linear-gradient(90deg,#06b6d4 0%,#0891b2 100%);display:flex;align-items:center;justify-content:center;";
-  html += "color:#fff;font-weight:700;font-size:0.88em;box-shadow:0 3px 12px rgba(6,182,212,.5)}.card{background:#fff;border-radius:14px;padding:20px;margin:12px 0;border:1px solid #e2e8f0;transition:all .3s;box-shadow:0 8px 28px rgba(0,0,0,.15),0 4px 12px rgba(0,0,0,.1)}";
-  html += ".card:hover{border-color:#06b6d4;box-shadow:0 16px 48px rgba(6,182,212,.3),0 8px 24px rgba(0,0,0,.2);transform:translateY(-5px)}.loading{display:inline-block;width:20px;height:20px;border:3px solid rgba(6,182,212,.25);";
-  html += "border-top:3px solid #06b6d4;border-radius:50%;animation:spin 1s linear infinite;box-shadow:0 3px 12px rgba(6,182,212,.4)}@keyframes spin{0%{transform:rotate(0deg)}100%{transform:rotate(360deg)}}.status-live{padding:16px;";
-  html += "background:linear-gradient(135deg,#f1f5f9,#e2e8f0);border-radius:10px;text-align:center;font-weight:600;margin:16px 0;border:none;box-shadow:0 6px 24px rgba(0,0,0,.15),inset 0 2px 4px rgba(255,255,255,.7)}";
-  html += ".status-live.success{background:linear-gradient(135deg,#d1fae5,#a7f3d0);color:#065f46;box-shadow:0 8px 32px rgba(16,185,129,.4)}.status-live.error{background:linear-gradient(135deg,#fee2e2,#fecaca);color:#991b1b;";
-  html += "box-shadow:0 8px 32px rgba(239,68,68,.4)}.gpio-grid{display:grid;grid-template-columns:repeat(auto-fill,minmax(78px,1fr));gap:10px;margin-top:16px}.gpio-item{padding:14px;background:linear-gradient(135deg,#f8fafc,#f1f5f9);";
-  html += "border:2px solid #cbd5e0;border-radius:10px;text-align:center;font-weight:700;transition:all .3s;font-size:.92em;box-shadow:0 6px 20px rgba(0,0,0,.15),0 2px 8px rgba(0,0,0,.1)}.gpio-item:hover{transform:translateY(-4px) scale(1.1);";
-  html += "box-shadow:0 12px 36px rgba(0,0,0,.25)}.gpio-ok{border-color:#10b981;background:linear-gradient(135deg,#d1fae5,#a7f3d0);color:#065f46;box-shadow:0 8px 28px rgba(16,185,129,.4)}.gpio-fail{border-color:#ef4444;";
-  html += "background:linear-gradient(135deg,#fee2e2,#fecaca);color:#991b1b;box-shadow:0 8px 28px rgba(239,68,68,.4)}.wifi-list{max-height:520px;overflow-y:auto;scrollbar-width:thin;scrollbar-color:#06b6d4 #e2e8f0;";
-  html += "padding-right:8px}.wifi-item{background:#fff;padding:16px;margin:10px 0;border-radius:12px;border:1px solid #e2e8f0;transition:all .3s;box-shadow:0 6px 20px rgba(0,0,0,.12),0 2px 8px rgba(0,0,0,.08)}.wifi-item:hover{transform:translateX(8px) translateY(-3px);";
-  html += "box-shadow:0 14px 44px rgba(6,182,212,.3),0 6px 20px rgba(0,0,0,.2);border-color:#06b6d4}input[type='number'],input[type='color'],input[type='text'],textarea,select{padding:12px;border:2px solid #cbd5e0;";
-  html += "border-radius:10px;font-size:.95em;transition:all .3s;font-family:inherit;background:#fff;box-shadow:0 3px 12px rgba(0,0,0,.12),inset 0 2px 4px rgba(0,0,0,.08)}input:focus,textarea:focus,select:focus{outline:none;";
-  html += "border-color:#06b6d4;box-shadow:0 6px 24px rgba(6,182,212,.3),0 0 0 4px rgba(6,182,212,.15);transform:translateY(-2px)}input[type='range']{-webkit-appearance:none;appearance:none;width:100%;height:8px;";
-  html += "border-radius:5px;background:linear-gradient(90deg,#cbd5e0 0%,#06b6d4 100%);outline:none;opacity:0.9;transition:opacity .3s;cursor:pointer;box-shadow:0 3px 12px rgba(0,0,0,.15),inset 0 2px 4px rgba(0,0,0,.1)}";
-  html += "input[type='range']:hover{opacity:1}input[type='range']::-webkit-slider-thumb{-webkit-appearance:none;appearance:none;width:24px;height:24px;border-radius:50%;background:linear-gradient(135deg,#06b6d4,#0891b2);";
-  html += "cursor:pointer;box-shadow:0 4px 16px rgba(6,182,212,.5),0 2px 8px rgba(0,0,0,.2);border:3px solid #fff;transition:all .2s}input[type='range']::-webkit-slider-thumb:hover{transform:scale(1.2);box-shadow:0 6px 24px rgba(6,182,212,.7),0 3px 12px rgba(0,0,0,.3)}";
-  html += "input[type='range']::-moz-range-thumb{width:24px;height:24px;border-radius:50%;background:linear-gradient(135deg,#06b6d4,#0891b2);cursor:pointer;box-shadow:0 4px 16px rgba(6,182,212,.5),0 2px 8px rgba(0,0,0,.2);";
-  html += "border:3px solid #fff;transition:all .2s}input[type='range']::-moz-range-thumb:hover{transform:scale(1.2);box-shadow:0 6px 24px rgba(6,182,212,.7),0 3px 12px rgba(0,0,0,.3)}.update-indicator{position:fixed;";
-  html += "top:68px;right:24px;padding:12px 20px;background:linear-gradient(135deg,#06b6d4,#0891b2);color:#fff;border-radius:10px;font-weight:700;opacity:0;transition:all .4s;z-index:1001;box-shadow:0 12px 40px rgba(6,182,212,.5),0 6px 20px rgba(0,0,0,.3)}";
-  html += ".update-indicator.show{opacity:1;transform:translateY(0)}.coming{color:#f5a623;font-size:1.3em;font-weight:bold;font-style:italic;text-align:center;opacity:1;margin:15px 0;padding:10px}@media(max-width:768px){body{padding-top:105px}";
-  html += ".header h1{font-size:.9em}.header .chip-type{display:block;margin-left:0;margin-top:2px;font-size:.85em}.info-grid{grid-template-columns:1fr}.nav{gap:3px}.nav-btn{padding:4px 10px;font-size:.8em}.content{padding:16px}";
-  html += ".update-indicator{top:115px;right:16px}.lang-switch{display:flex;margin-left:0;margin-top:2px;justify-content:center}}@media print{body{padding-top:0;background:#fff}.header{position:relative;box-shadow:none}";
-  html += ".nav,.btn,.update-indicator{display:none}.container,.section,.card{box-shadow:none}}";
-  html += "</style>";
-  html += "</head><body>";
-  html += "<div class='update-indicator' id='updateIndicator' data-i18n='updating'>";
-  html += htmlEscape(Texts::updating.str());
-  html += "</div>";
-  html += "<div class='container'>";
-  html += "<div class='header'>";
-  html += "<h1 id='main-title'>";
-  html += "<span class='status-indicator status-online' id='statusIndicator'></span>";
-  html += htmlEscape(Texts::title.str());
-  html += " ";
-  html += htmlEscape(Texts::version.str());
-  html += DIAGNOSTIC_VERSION_STR;
-  html += " - <span class='chip-type' id='chipModel'>";
-  html += diagnosticData.chipModel;
-  html += "</span>";
-  html += "</h1>";
-  bool ipAvailable = diagnosticData.ipAddress.length() > 0;
-  String secureScheme = String(DIAGNOSTIC_SECURE_SCHEME);
-  String legacyScheme = String(DIAGNOSTIC_LEGACY_SCHEME);
-  String mdnsHost = String(MDNS_HOSTNAME_STR) + ".local";
-  String mdnsLegacyUrl = legacyScheme + mdnsHost;
-  String mdnsDisplayUrl = mdnsLegacyUrl;
-  String ipAccessHref = ipAvailable ? (legacyScheme + diagnosticData.ipAddress) : String("#");
-  String ipLegacyHref = ipAvailable ? (legacyScheme + diagnosticData.ipAddress) : String();
-  String ipAccessClass = String("access-link");
-  if (!ipAvailable) {
-    ipAccessClass += " disabled";
-  }
-  String ipAriaDisabled = ipAvailable ? String("false") : String("true");
-  String ipLabelValue = ipAvailable ? ipAccessHref : htmlEscape(String(Texts::ip_unavailable.str()));
-  html += "<div class='access-row'>";
-  html += "<span class='access-label' data-i18n='access' data-i18n-suffix=' :'>";
-  html += htmlEscape(Texts::access.str());
-  html += "</span>";
-  html += "<a class='access-link' id='mdnsLink' href='";
-  html += mdnsDisplayUrl;
-  html += "' data-access-host='";
-  html += mdnsHost;
-  html += "' data-secure='";
-  html += secureScheme;
-  html += "' data-legacy='";
-  html += legacyScheme;
-  html += "' data-access-label='";
-  html += mdnsHost;
-  html += "' data-legacy-label='";
-  html += mdnsLegacyUrl;
-  html += "' data-label-id='mdnsAddressText' aria-disabled='false'><strong id='mdnsAddressText'>";
-  html += mdnsDisplayUrl;
-  html += "</strong></a>";
-  html += "<span class='access-sep'>•</span>";
-  html += "<a id='ipAddressLink' class='";
-  html += ipAccessClass;
-  html += "' href='";
-  html += ipAccessHref;
-  html += "' data-access-host='";
-  html += (ipAvailable ? diagnosticData.ipAddress : String(""));
-  html += "' data-secure='";
-  html += secureScheme;
-  html += "' data-legacy='";
-  html += legacyScheme;
-  html += "' data-access-label='";
-  html += (ipAvailable ? diagnosticData.ipAddress : String(""));
-  html += "' data-legacy-label='";
-  html += ipLegacyHref;
-  html += "' data-label-id='ipAddressText' aria-disabled='";
-  html += ipAriaDisabled;
-  html += "'><strong id='ipAddressText' data-placeholder='";
-  html += htmlEscape(Texts::ip_unavailable.str());
-  html += "' data-placeholder-key='ip_unavailable'>";
-  html += ipLabelValue;
-  html += "</strong></a>";
-  html += "<span class='lang-switch' role='group' aria-label='";
-  html += htmlEscape(Texts::language_label.str());
-  html += "'>";
-  html += "<span class='lang-label' data-i18n='language_label'>";
-  html += htmlEscape(Texts::language_label.str());
-  html += "</span>";
-  html += "<button type='button' class='lang-btn";
-  if (currentLanguage == LANG_FR) { html += " active"; }
-  html += "' data-lang='fr' onclick=\"changeLang('fr',this);\">FR</button>";
-  html += "<button type='button' class='lang-btn";
-  if (currentLanguage == LANG_EN) { html += " active"; }
-  html += "' data-lang='en' onclick=\"changeLang('en',this);\">EN</button>";
-  html += "</span>";
-  html += "</div>";
-  html += "<div class='nav'>";
-  html += "<button type='button' class='nav-btn active' data-tab='overview' data-i18n='nav_overview' onclick=\"showTab('overview',this);\">";
-  html += htmlEscape(Texts::nav_overview.str());
-  html += "</button>";
-  html += "<button type='button' class='nav-btn' data-tab='display-signal' data-i18n='nav_display_signal' onclick=\"showTab('display-signal',this);\">";
-  html += htmlEscape(Texts::nav_display_signal.str());
-  html += "</button>";
-  html += "<button type='button' class='nav-btn' data-tab='sensors' data-i18n='nav_sensors' onclick=\"showTab('sensors',this);\">";
-  html += htmlEscape(Texts::nav_sensors.str());
-  html += "</button>";
-  html += "<button type='button' class='nav-btn' data-tab='input-devices' data-i18n='nav_input_devices' onclick=\"showTab('input-devices',this);\">";
-  html += htmlEscape(Texts::nav_input_devices.str());
-  html += "</button>";
-  html += "<button type='button' class='nav-btn' data-tab='memory' data-i18n='nav_memory' onclick=\"showTab('memory',this);\">";
-  html += htmlEscape(Texts::nav_memory.str());
-  html += "</button>";
-  html += "<button type='button' class='nav-btn' data-tab='hardware-tests' data-i18n='nav_hardware_tests' onclick=\"showTab('hardware-tests',this);\">";
-  html += htmlEscape(Texts::nav_hardware_tests.str());
-  html += "</button>";
-  html += "<button type='button' class='nav-btn' data-tab='wireless' data-i18n='nav_wireless' onclick=\"showTab('wireless',this);\">";
-  html += htmlEscape(Texts::nav_wireless.str());
-  html += "</button>";
-  html += "<button type='button' class='nav-btn' data-tab='benchmark' data-i18n='nav_benchmark' onclick=\"showTab('benchmark',this);\">";
-  html += htmlEscape(Texts::nav_benchmark.str());
-  html += "</button>";
-  html += "<button type='button' class='nav-btn' data-tab='export' data-i18n='nav_export' onclick=\"showTab('export',this);\">";
-  html += htmlEscape(Texts::nav_export.str());
-  html += "</button>";
-  html += "</div>";
-  html += "</div>";
-  html += "<div class='content'>";
-  html += "<div id='tabContainer'></div>";
-  html += "</div>";
-  html += "</div>";
-  html += "<script src='/js/app.js'></script>";
-  html += "</body></html>";
-
-  return html;
-}
-
 // Génère le JavaScript principal
 String generateJavaScript() {
   String js;
@@ -4,6 +4,7 @@
 
 #include "environmental_sensors.h"
 #include "config.h"
+#include "test_pause.h"
 #include <cmath>
 
 // Global environmental variables
@@ -328,12 +329,15 @@ void testEnvironmentalSensors() {
   
   for (int i = 0; i < 5; i++) {
     updateEnvironmentalSensors();
-    delay(100);
-    
     if (envData.temperature_avg > -999.0) {
       success = true;
       break;
     }
+    if (!testPause(100)) {
+      envSensorTestResult = "Test cancelled";
+      Serial.println("Environmental Sensors: Test cancelled");
+      return;
+    }
   }
   
   if (success) {
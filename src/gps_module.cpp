@@ -4,6 +4,7 @@
 
 #include "gps_module.h"
 #include "config.h"
+#include "test_pause.h"
 #include <cmath>
 
 // Global GPS variables
@@ -283,7 +284,11 @@ void testGPS() {
   
   while (millis() - start_time < timeout) {
     updateGPS();
-    delay(100);
+    if (!testPause(100)) {
+      gpsTestResult = "Test cancelled";
+      Serial.println("GPS: Test cancelled");
+      return;
+    }
     
     if (gpsData.hasFix && gpsData.satellites > 0) {
       gpsTestResult = "OK";
@@ -0,0 +1,159 @@
+#pragma once
+
+// Minimal stand-in for the parts of the Arduino-ESP32 core used by the shared
+// writers (data_writer.h, json_writer.h, cbor_writer.h), for the host benches
+// only: the native_* environments put src/host first on the include path.
+// String follows the Arduino-ESP32 2.x WString allocation behaviour (32-bit
+// small string buffer of 14 characters, heap buffers rounded up to 16 bytes,
+// one realloc per growth, StringSumHelper for operator+) and counts its heap
+// calls and copied bytes in hostStringStats.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+class __FlashStringHelper;
+#define F(text) (reinterpret_cast<const __FlashStringHelper*>(text))
+#define PGM_P const char*
+#define PROGMEM
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t*>(address))
+#define strlen_P strlen
+
+struct HostStringStats {
+  uint32_t allocations;  // malloc + realloc
+  uint64_t bytesCopied;  // characters copied by String operations
+  size_t liveBytes;
+  size_t peakBytes;
+
+  void reset() { allocations = 0, bytesCopied = 0, liveBytes = 0, peakBytes = 0; }
+};
+
+inline HostStringStats hostStringStats = {0, 0, 0, 0};
+
+class String {
+ public:
+  String() : heap_(nullptr), capacity_(SSO_CAPACITY), length_(0) { sso_[0] = '\0'; }
+  String(const char* text) : String() { copy(text, strlen(text)); }
+  String(const String& other) : String() { copy(other.c_str(), other.length_); }
+  String(const __FlashStringHelper* text) : String(reinterpret_cast<const char*>(text)) {}
+  explicit String(char c) : String() { copy(&c, 1); }
+  explicit String(int value) : String() { format("%d", value); }
+  explicit String(unsigned int value) : String() { format("%u", value); }
+  explicit String(long value) : String() { format("%ld", value); }
+  explicit String(unsigned long value) : String() { format("%lu", value); }
+  explicit String(long long value) : String() { format("%lld", value); }
+  explicit String(unsigned long long value) : String() { format("%llu", value); }
+  explicit String(float value, unsigned int decimals = 2) : String() { format("%.*f", decimals, value); }
+  explicit String(double value, unsigned int decimals = 2) : String() { format("%.*f", decimals, value); }
+  ~String() { release(); }
+
+  String& operator=(const String& other) {
+    if (this != &other) {
+      copy(other.c_str(), other.length_);
+    }
+    return *this;
+  }
+  String& operator=(const char* text) {
+    copy(text, strlen(text));
+    return *this;
+  }
+
+  bool reserve(unsigned int size) {
+    if (capacity_ >= size) {
+      return true;
+    }
+    const size_t bytes = (size + 16) & ~static_cast<size_t>(0xF);
+    char* grown = static_cast<char*>(realloc(heap_, bytes));
+    if (grown == nullptr) {
+      return false;
+    }
+    if (heap_ == nullptr) {
+      memcpy(grown, sso_, length_ + 1);  // leaving the small string buffer
+      hostStringStats.bytesCopied += length_;
+    }
+    ++hostStringStats.allocations;
+    hostStringStats.liveBytes += bytes - (heap_ != nullptr ? capacity_ + 1 : 0);
+    hostStringStats.peakBytes =
+        hostStringStats.liveBytes > hostStringStats.peakBytes ? hostStringStats.liveBytes : hostStringStats.peakBytes;
+    heap_ = grown;
+    capacity_ = static_cast<unsigned int>(bytes - 1);
+    return true;
+  }
+
+  bool concat(const char* text, unsigned int length) {
+    if (!reserve(length_ + length)) {
+      return false;
+    }
+    memcpy(buffer() + length_, text, length);
+    length_ += length;
+    buffer()[length_] = '\0';
+    hostStringStats.bytesCopied += length;
+    return true;
+  }
+  bool concat(const String& other) { return concat(other.c_str(), other.length_); }
+  bool concat(const char* text) { return concat(text, strlen(text)); }
+
+  String& operator+=(const String& other) { concat(other); return *this; }
+  String& operator+=(const char* text) { concat(text); return *this; }
+  String& operator+=(char c) { concat(&c, 1); return *this; }
+
+  unsigned int length() const { return length_; }
+  const char* c_str() const { return heap_ != nullptr ? heap_ : sso_; }
+
+  friend class StringSumHelper;
+
+ private:
+  static const unsigned int SSO_CAPACITY = 14;
+
+  char* buffer() { return heap_ != nullptr ? heap_ : sso_; }
+
+  void copy(const char* text, unsigned int length) {
+    if (!reserve(length)) {
+      return;
+    }
+    memmove(buffer(), text, length);
+    length_ = length;
+    buffer()[length_] = '\0';
+    hostStringStats.bytesCopied += length;
+  }
+
+  template <typename... Args>
+  void format(const char* pattern, Args... args) {
+    char digits[64];  // the core converts into a stack buffer, then copies
+    const int length = snprintf(digits, sizeof(digits), pattern, args...);
+    copy(digits, length > 0 ? static_cast<unsigned int>(length) : 0);
+  }
+
+  void release() {
+    if (heap_ != nullptr) {
+      hostStringStats.liveBytes -= capacity_ + 1;
+      free(heap_);
+    }
+  }
+
+  char* heap_;
+  unsigned int capacity_;
+  unsigned int length_;
+  char sso_[SSO_CAPACITY + 1];
+};
+
+// Temporary of "a" + b: every operator+ appends to it in place
+class StringSumHelper : public String {
+ public:
+  StringSumHelper(const String& text) : String(text) {}
+  StringSumHelper(const char* text) : String(text) {}
+};
+
+inline StringSumHelper& operator+(const StringSumHelper& lhs, const String& rhs) {
+  StringSumHelper& sum = const_cast<StringSumHelper&>(lhs);
+  sum.concat(rhs);
+  return sum;
+}
+
+inline StringSumHelper& operator+(const StringSumHelper& lhs, const char* rhs) {
+  StringSumHelper& sum = const_cast<StringSumHelper&>(lhs);
+  sum.concat(rhs);
+  return sum;
+}
@@ -0,0 +1,53 @@
+// Host build of the CPU benchmark kernels (include/cpu_benchmark.h), to get
+// reference numbers for the same code on a PC:
+//   pio run -e native_bench && .pio/build/native_bench/program [--json]
+// or without PlatformIO:
+//   c++ -std=gnu++17 -O2 -Iinclude src/host/cpu_bench_host.cpp -o cpu_bench && ./cpu_bench
+// The cycle counter is replaced by a nanosecond clock, so "cycles" are ns here.
+// --json prints the kernels in the layout of /api/benchmark "cpu_suite".
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "cpu_benchmark.h"
+
+static const uint16_t WARMUP = 3;
+static const uint16_t ITERATIONS = 31;
+
+static uint32_t nanosecondClock() {
+  using namespace std::chrono;
+  return static_cast<uint32_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+int main(int argc, char** argv) {
+  const bool json = argc > 1 && strcmp(argv[1], "--json") == 0;
+  uint32_t samples[ITERATIONS];
+  if (json) {
+    printf("{\"clock\":\"host_ns\",\"warmup\":%u,\"iterations\":%u,\"kernels\":[", WARMUP, ITERATIONS);
+  } else {
+    printf("%-10s %12s %12s %8s %12s\n", "kernel", "median us", "p95 us", "cv %", "rate");
+  }
+  for (uint8_t i = 0; i < CPU_KERNEL_COUNT; ++i) {
+    const CpuKernel& kernel = CPU_KERNELS[i];
+    const CpuKernelStats stats = measureCpuKernel(kernel, WARMUP, ITERATIONS, samples, nanosecondClock);
+    const double medianUs = stats.medianCycles / 1000.0;
+    const double rate = kernel.work > 0 && medianUs > 0.0 ? kernel.work / medianUs : 0.0;
+    if (json) {
+      printf("%s{\"name\":\"%s\",\"median_us\":%.3f,\"p95_us\":%.3f,\"cv_percent\":%.2f", i > 0 ? "," : "",
+             kernel.name, medianUs, stats.p95Cycles / 1000.0, stats.cvPercent);
+      if (kernel.work > 0) {
+        printf(",\"rate\":%.2f,\"unit\":\"%s\"", rate, kernel.unit);
+      }
+      printf("}");
+    } else if (kernel.work > 0) {
+      printf("%-10s %12.3f %12.3f %8.2f %8.1f %s\n", kernel.name, medianUs, stats.p95Cycles / 1000.0, stats.cvPercent,
+             rate, kernel.unit);
+    } else {
+      printf("%-10s %12.3f %12.3f %8.2f\n", kernel.name, medianUs, stats.p95Cycles / 1000.0, stats.cvPercent);
+    }
+  }
+  if (json) {
+    printf("]}\n");
+  }
+  return 0;
+}
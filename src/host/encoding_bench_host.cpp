@@ -0,0 +1,511 @@
+// Host comparison of the two encodings ApiResponse negotiates: JsonWriter and
+// CborWriter (Accept: application/cbor), on the documents of /api/overview and
+// /export/json, without a device:
+//   pio run -e native_encoding && .pio/build/native_encoding/program [iterations]
+// or without PlatformIO:
+//   c++ -std=gnu++17 -O2 -Isrc/host -Iinclude src/host/encoding_bench_host.cpp -o encoding_bench && ./encoding_bench
+// The overview is the body of handleOverview() and the export goes through the
+// real DataReportRenderer (report_model.h) with the sections of
+// writeDiagnosticReport(), both filled with fixed sample values. Each CBOR
+// payload is walked back to check it is well formed and holds as many items as
+// were written. tools/encoding_bench.py measures the same on a device, network
+// included.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "Arduino.h"
+
+#ifndef PROJECT_NAME
+#define PROJECT_NAME "ESP32 Diagnostic"
+#endif
+
+#include "cbor_writer.h"
+#include "cpu_benchmark.h"
+#include "json_writer.h"
+#include "report_model.h"
+
+Language currentLanguage = LANG_EN;
+
+static const size_t STREAM_BUFFER = 1024;  // JSON_STREAM_BUFFER_SIZE (config.h)
+
+// ---- Sample values (DiagnosticInfo, DetailedMemoryInfo, sensors, benches) ----
+
+struct SampleMemoryPoint {
+  uint32_t bytes;
+  float readMBps;
+  float writeMBps;
+  float copyMBps;
+  float latencyNs;
+};
+
+struct SampleCurve {
+  const char* name;
+  bool writable;
+  uint8_t count;
+  SampleMemoryPoint points[4];
+};
+
+static const SampleCurve SAMPLE_CURVES[] = {
+  {"sram", true, 4, {{4096, 412.3f, 398.7f, 201.4f, 12.5f}, {16384, 409.8f, 396.1f, 199.9f, 12.6f},
+                     {65536, 401.2f, 390.4f, 196.3f, 12.9f}, {131072, 399.5f, 388.0f, 195.2f, 13.0f}}},
+  {"iram", true, 3, {{4096, 205.6f, 201.1f, 99.8f, 25.1f}, {16384, 204.9f, 200.7f, 99.5f, 25.2f},
+                     {32768, 204.1f, 200.2f, 99.1f, 25.4f}}},
+  {"psram", true, 4, {{16384, 310.4f, 150.2f, 61.7f, 15.8f}, {65536, 98.6f, 74.3f, 40.2f, 88.4f},
+                      {262144, 62.1f, 55.9f, 28.7f, 181.3f}, {1048576, 58.4f, 53.2f, 27.1f, 190.6f}}},
+  {"flash", false, 3, {{16384, 288.0f, 0.0f, 0.0f, 16.4f}, {65536, 41.7f, 0.0f, 0.0f, 221.9f},
+                       {262144, 19.8f, 0.0f, 0.0f, 402.5f}}},
+};
+
+struct SampleDevice {
+  String chipModel = "ESP32-S3";
+  String chipRevision = "0";
+  int cpuCores = 2;
+  int cpuFreqMHz = 240;
+  String macAddress = "7C:DF:A1:E0:12:34";
+  String sdkVersion = "v4.4.7-dirty";
+  String idfVersion = "v4.4.7";
+  unsigned long uptime = 3725000;
+  float temperature = 41.25f;
+  uint32_t flashSizeReal = 16777216;
+  uint32_t flashSizeChip = 16777216;
+  const char* flashType = "QIO";
+  const char* flashSpeed = "80 MHz";
+  uint32_t sramTotal = 327680;
+  uint32_t sramFree = 201344;
+  uint32_t sramUsed = 126336;
+  uint32_t psramTotal = 8386295;
+  uint32_t psramFree = 8123012;
+  uint32_t psramUsed = 263283;
+  float fragmentationPercent = 12.4f;
+  bool psramAvailable = true;
+  bool psramBoardSupported = true;
+  const char* psramType = "OPI";
+  String memoryStatus = "Excellent";
+  String wifiSSID = "Workshop-2G";
+  int wifiRSSI = -58;
+  const char* qualityKey = "signal_good";
+  String quality = "Good";
+  String ipAddress = "192.168.1.50";
+  bool mdnsAvailable = true;
+  String stableUrl = "http://esp32-diagnostic.local";
+  const char* subnet = "255.255.255.0";
+  const char* gateway = "192.168.1.1";
+  const char* dns = "192.168.1.1";
+  int totalGPIO = 45;
+  String gpioList = "0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 21 38 39 40 41 42 45 46 47 48";
+  int i2cCount = 2;
+  String i2cDevices = "0x3C 0x77";
+  String spiInfo = "SPI2 (FSPI), SPI3 (HSPI)";
+  String testResult = "OK";
+  unsigned long cpuBenchmark = 1843;
+  unsigned long memBenchmark = 962;
+  double cpuScore = 1.87;
+  double kernelUs = 412.35;
+  String stressTestResult = "OK - 182 KB";
+  bool ahtAvailable = true;
+  double ahtTemperature = 22.4;
+  double humidity = 48.1;
+  bool bmpAvailable = true;
+  double bmpTemperature = 22.9;
+  double pressure = 1012.6;
+  double altitude = 8.4;
+  String sensorStatus = "OK";
+  bool gpsAvailable = true;
+  String gpsStatus = "Fix 3D";
+  bool gpsFix = true;
+  uint8_t satellites = 9;
+  double latitude = 48.856613;
+  double longitude = 2.352222;
+  double gpsAltitude = 41.3;
+  double speed = 0.12;
+  double hdop = 0.91;
+  uint32_t loopPeriodP50 = 1012;
+  uint32_t loopPeriodMax = 48211;
+  uint32_t handlerP99 = 3810;
+  uint32_t handlerMax = 61204;
+  uint32_t isrP99 = 1490;
+  uint32_t isrMax = 9820;
+  uint32_t tickMax[2] = {1180, 1225};
+  uint32_t lateTicks[2] = {3, 1};
+  uint32_t stallMs = 50;
+  uint32_t stalls = 2;
+  const char* lastStall = "61 ms busy, http /export/json, jobs: - (uptime 3712 s)";
+  const char* resetReason = "Power on";
+};
+
+static const SampleDevice sample;
+
+// ---- Documents ----
+
+// handleOverview()
+static void writeOverview(DataWriter& json, const SampleDevice& d) {
+  json.beginObject();
+
+  json.beginObject("chip");
+  json.field("model", d.chipModel);
+  json.field("revision", d.chipRevision);
+  json.field("cores", d.cpuCores);
+  json.field("freq", d.cpuFreqMHz);
+  json.field("mac", d.macAddress);
+  json.field("uptime", d.uptime);
+  json.fieldFloat("temperature", d.temperature, 1);
+  json.endObject();
+
+  json.beginObject("memory");
+  json.beginObject("flash");
+  json.field("real", d.flashSizeReal);
+  json.field("type", d.flashType);
+  json.field("speed", d.flashSpeed);
+  json.endObject();
+  json.beginObject("sram");
+  json.field("total", d.sramTotal);
+  json.field("free", d.sramFree);
+  json.field("used", d.sramUsed);
+  json.endObject();
+  json.beginObject("psram");
+  json.field("total", d.psramTotal);
+  json.field("free", d.psramFree);
+  json.field("used", d.psramUsed);
+  json.endObject();
+  json.fieldFloat("fragmentation", d.fragmentationPercent, 1);
+  json.endObject();
+
+  json.beginObject("wifi");
+  json.field("ssid", d.wifiSSID);
+  json.field("rssi", d.wifiRSSI);
+  json.field("quality_key", d.qualityKey);
+  json.field("quality", d.quality);
+  json.field("ip", d.ipAddress);
+  json.endObject();
+
+  json.beginObject("gpio");
+  json.field("total", d.totalGPIO);
+  json.field("i2c_count", d.i2cCount);
+  json.field("i2c_devices", d.i2cDevices);
+  json.endObject();
+
+  json.field("snapshot_age_ms", 412UL);
+  json.endObject();
+}
+
+// writeDiagnosticReport(): same sections and fields, in the same order
+static void writeReport(ReportRenderer& renderer, const SampleDevice& d) {
+  ReportBuilder report(renderer);
+
+  report.beginSection("chip", Texts::chip_info);
+  report.text("model", Texts::model, d.chipModel);
+  report.text("revision", Texts::revision, d.chipRevision);
+  report.number("cores", Texts::cpu_cores, d.cpuCores);
+  report.number("freq_mhz", Texts::frequency, d.cpuFreqMHz, "MHz");
+  report.text("mac", Texts::mac_wifi, d.macAddress);
+  report.text("sdk", Texts::sdk_version, d.sdkVersion);
+  report.text("idf", Texts::idf_version, d.idfVersion);
+  report.decimal("temperature", Texts::cpu_temp, d.temperature, 1, "°C");
+  report.endSection();
+
+  report.beginSection("memory", Texts::memory_details);
+  report.decimal("flash_real_mb", {Texts::flash_memory, "board"}, d.flashSizeReal / 1048576.0, 2, "MB");
+  report.decimal("flash_config_mb", {Texts::flash_memory, "IDE"}, d.flashSizeChip / 1048576.0, 2, "MB");
+  report.text("flash_type", Texts::flash_type, d.flashType);
+  report.text("flash_speed", Texts::flash_speed, d.flashSpeed);
+  report.decimal("psram_mb", Texts::total_psram, d.psramTotal / 1048576.0, 2, "MB");
+  report.decimal("psram_free_mb", {Texts::free, "PSRAM"}, d.psramFree / 1048576.0, 2, "MB");
+  report.flag("psram_available", Texts::psram_external, d.psramAvailable, Texts::detected_active, Texts::not_detected);
+  report.flag("psram_supported", {Texts::psram_external, "board"}, d.psramBoardSupported, Texts::ok,
+              Texts::not_available);
+  report.text("psram_type", {Texts::type, "PSRAM"}, d.psramType);
+  report.decimal("sram_kb", Texts::internal_sram, d.sramTotal / 1024.0, 2, "KB");
+  report.decimal("sram_free_kb", {Texts::free, "SRAM"}, d.sramFree / 1024.0, 2, "KB");
+  report.decimal("fragmentation", Texts::memory_fragmentation, d.fragmentationPercent, 1, "%");
+  report.text("status", Texts::memory_status, d.memoryStatus);
+  report.endSection();
+
+  report.beginSection("wifi", Texts::wifi_connection);
+  report.text("ssid", Texts::ssid, d.wifiSSID);
+  report.number("rssi", Texts::signal_power, d.wifiRSSI, "dBm");
+  report.text("quality", Texts::signal_quality, d.quality);
+  report.text("ip", Texts::ip_address, d.ipAddress);
+  report.flag("mdns_ready", {Texts::hostname, "mDNS"}, d.mdnsAvailable, Texts::ok, Texts::not_available);
+  report.text("stable_url", Texts::access, d.stableUrl);
+  report.text("subnet", Texts::subnet_mask, d.subnet);
+  report.text("gateway", Texts::gateway, d.gateway);
+  report.text("dns", Texts::dns, d.dns);
+  report.endSection();
+
+  report.beginSection("gpio", Texts::gpio_interfaces);
+  report.number("total", Texts::total_gpio, d.totalGPIO);
+  report.text("list", Texts::gpio_list, d.gpioList);
+  report.endSection();
+
+  report.beginSection("peripherals", Texts::i2c_peripherals);
+  report.number("i2c_count", Texts::device_count, d.i2cCount);
+  report.text("i2c_devices", Texts::i2c_devices, d.i2cDevices);
+  report.text("spi", Texts::spi_bus, d.spiInfo);
+  report.endSection();
+
+  report.beginSection("hardware_tests", Texts::test);
+  report.text("builtin_led", Texts::builtin_led, d.testResult);
+  report.text("neopixel", Texts::neopixel, d.testResult);
+  report.text("oled", Texts::oled_screen, d.testResult);
+  report.text("adc", Texts::adc_test, d.testResult);
+  report.text("pwm", Texts::pwm_test, d.testResult);
+  report.text("sd_card", Texts::sd_card, d.testResult);
+  report.text("rotary_encoder", Texts::rotary_encoder, d.testResult);
+  report.endSection();
+
+  report.beginSection("performance", Texts::performance_bench);
+  report.number("cpu_us", Texts::cpu_benchmark, d.cpuBenchmark, "us");
+  report.decimal("cpu_perf", Texts::cpu_perf_score, d.cpuScore, 2, "ops/us");
+  for (uint8_t kernel = 0; kernel < CPU_KERNEL_COUNT; ++kernel) {
+    char key[24];
+    snprintf(key, sizeof(key), "cpu_%s_us", CPU_KERNELS[kernel].name);
+    report.decimal(key, {Texts::cpu_benchmark, CPU_KERNELS[kernel].name}, d.kernelUs + kernel, 2, "us");
+  }
+  report.number("memory_us", Texts::memory_benchmark, d.memBenchmark, "us");
+  report.text("stress_test", Texts::memory_stress, d.stressTestResult);
+  report.endSection();
+
+  report.beginSection("memory_hierarchy", Texts::memory_hierarchy);
+  for (const SampleCurve& curve : SAMPLE_CURVES) {
+    for (uint8_t i = 0; i < curve.count; ++i) {
+      const SampleMemoryPoint& point = curve.points[i];
+      const unsigned long kb = point.bytes / 1024;
+      char key[32];
+      char detail[24];
+      snprintf(detail, sizeof(detail), "%s %lu KB", curve.name, kb);
+      snprintf(key, sizeof(key), "%s_%luk_read_mbps", curve.name, kb);
+      report.decimal(key, {Texts::read_bandwidth, detail}, point.readMBps, 1, "MB/s");
+      if (curve.writable) {
+        snprintf(key, sizeof(key), "%s_%luk_write_mbps", curve.name, kb);
+        report.decimal(key, {Texts::write_bandwidth, detail}, point.writeMBps, 1, "MB/s");
+        snprintf(key, sizeof(key), "%s_%luk_copy_mbps", curve.name, kb);
+        report.decimal(key, {Texts::copy_bandwidth, detail}, point.copyMBps, 1, "MB/s");
+      }
+      snprintf(key, sizeof(key), "%s_%luk_latency_ns", curve.name, kb);
+      report.decimal(key, {Texts::access_latency, detail}, point.latencyNs, 1, "ns");
+    }
+  }
+  report.endSection();
+
+  report.beginSection("environment", Texts::environmental_sensors);
+  report.flag("aht20_available", Texts::aht20_sensor, d.ahtAvailable, Texts::ok, Texts::not_detected);
+  report.optionalDecimal("temperature_aht20", {Texts::temperature, "AHT20"}, d.ahtTemperature, true, 1, "°C");
+  report.optionalDecimal("humidity", Texts::humidity, d.humidity, true, 1, "%");
+  report.text("aht20_status", {Texts::status, "AHT20"}, d.sensorStatus);
+  report.flag("bmp280_available", Texts::bmp280_sensor, d.bmpAvailable, Texts::ok, Texts::not_detected);
+  report.optionalDecimal("temperature_bmp280", {Texts::temperature, "BMP280"}, d.bmpTemperature, true, 1, "°C");
+  report.optionalDecimal("pressure", Texts::pressure, d.pressure, true, 1, "hPa");
+  report.optionalDecimal("altitude", Texts::altitude_calculated, d.altitude, true, 1, "m");
+  report.text("bmp280_status", {Texts::status, "BMP280"}, d.sensorStatus);
+  report.optionalDecimal("temperature_avg", Texts::temperature_avg, (d.ahtTemperature + d.bmpTemperature) / 2, true,
+                         1, "°C");
+  report.text("combined_status", Texts::status, d.sensorStatus);
+  report.endSection();
+
+  report.beginSection("gps", Texts::gps_module);
+  report.flag("available", Texts::gps_module, d.gpsAvailable, Texts::ok, Texts::not_detected);
+  report.text("status", Texts::gps_status, d.gpsStatus);
+  report.flag("has_fix", Texts::gps_fix_type, d.gpsFix, Texts::ok, Texts::none);
+  report.number("satellites", Texts::gps_satellites, d.satellites);
+  report.optionalDecimal("latitude", Texts::gps_latitude, d.latitude, d.gpsFix, 6);
+  report.optionalDecimal("longitude", Texts::gps_longitude, d.longitude, d.gpsFix, 6);
+  report.optionalDecimal("altitude", Texts::gps_altitude, d.gpsAltitude, d.gpsFix, 1, "m");
+  report.optionalDecimal("speed", Texts::gps_speed, d.speed, d.gpsFix, 2, "kn");
+  report.optionalDecimal("hdop", Texts::gps_hdop, d.hdop, d.gpsFix, 2);
+  report.text("date_time", Texts::gps_date_time, "17/10/2026 09:41:07");
+  report.endSection();
+
+  static const char* const CORE_NAMES[2] = {"core 0", "core 1"};
+  static const char* const TICK_MAX_KEYS[2] = {"tick_max_us_core0", "tick_max_us_core1"};
+  static const char* const LATE_TICK_KEYS[2] = {"late_ticks_core0", "late_ticks_core1"};
+  report.beginSection("responsiveness", Texts::responsiveness);
+  report.number("loop_period_p50_us", {Texts::loop_period, "p50"}, d.loopPeriodP50, "us");
+  report.number("loop_period_max_us", {Texts::loop_period, "max"}, d.loopPeriodMax, "us");
+  report.number("handler_p99_us", {Texts::handler_duration, "p99"}, d.handlerP99, "us");
+  report.number("handler_max_us", {Texts::handler_duration, "max"}, d.handlerMax, "us");
+  report.number("isr_latency_p99_us", {Texts::isr_loop_latency, "p99"}, d.isrP99, "us");
+  report.number("isr_latency_max_us", {Texts::isr_loop_latency, "max"}, d.isrMax, "us");
+  for (uint8_t core = 0; core < 2; ++core) {
+    report.number(TICK_MAX_KEYS[core], {Texts::tick_interval_max, CORE_NAMES[core]}, d.tickMax[core], "us");
+    report.number(LATE_TICK_KEYS[core], {Texts::late_ticks, CORE_NAMES[core]}, d.lateTicks[core]);
+  }
+  report.number("stall_threshold_ms", Texts::stall_threshold, d.stallMs, "ms");
+  report.number("stalls", Texts::stalls, d.stalls);
+  report.text("last_stall", Texts::last_stall, d.lastStall);
+  report.endSection();
+
+  report.beginSection("system", Texts::system_section);
+  report.duration("uptime_ms", Texts::uptime, d.uptime);
+  report.text("reset_reason", Texts::last_reset, d.resetReason);
+  report.text("language", Texts::language_label, "en");
+  report.endSection();
+}
+
+// handleExportJSON()
+static void writeExport(DataWriter& json, const SampleDevice& d) {
+  json.beginObject();
+  DataReportRenderer renderer(json);
+  writeReport(renderer, d);
+  json.endObject();
+}
+
+// ---- Measurement ----
+
+// Counts what a document writes: keys, scalars and containers
+class ItemCounter final : public DataWriter {
+ public:
+  uint32_t items = 0;
+
+  void flush() override {}
+  void writeKey(const char*) override { ++items; }
+  void writeItem() override {}
+  void writeOpen(bool) override { ++items; }
+  void writeClose(bool) override {}
+  void writeText(const char*, size_t) override { ++items; }
+  void writeFlashText(const __FlashStringHelper*) override { ++items; }
+  void writeBool(bool) override { ++items; }
+  void writeNull() override { ++items; }
+  void writeSigned(long long) override { ++items; }
+  void writeUnsigned(unsigned long long) override { ++items; }
+  void writeFloat(double, uint8_t) override { ++items; }
+};
+
+// Walks one CBOR item (the subset CborWriter emits); false if malformed
+static bool walkCbor(const std::string& data, size_t& pos, uint32_t& items) {
+  if (pos >= data.size()) {
+    return false;
+  }
+  const uint8_t initial = static_cast<uint8_t>(data[pos++]);
+  const uint8_t major = initial >> 5;
+  const uint8_t info = initial & 0x1F;
+  if (major == 5 || major == 4) {
+    if (info != 31) {
+      return false;  // CborWriter only opens indefinite-length containers
+    }
+    ++items;
+    while (pos < data.size() && static_cast<uint8_t>(data[pos]) != 0xFF) {
+      // Map keys count as items, like writeKey()
+      if (!walkCbor(data, pos, items) || (major == 5 && !walkCbor(data, pos, items))) {
+        return false;
+      }
+    }
+    return pos++ < data.size();
+  }
+  unsigned long long argument = info;
+  if (info >= 24 && info <= 27) {
+    const size_t bytes = static_cast<size_t>(1) << (info - 24);
+    if (pos + bytes > data.size()) {
+      return false;
+    }
+    argument = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+      argument = (argument << 8) | static_cast<uint8_t>(data[pos++]);
+    }
+  } else if (info > 27) {
+    return false;
+  }
+  if (major == 3) {
+    if (pos + argument > data.size()) {
+      return false;
+    }
+    pos += argument;
+  } else if (major == 7) {
+    if (info < 20 || info > 27 || info == 23 || info == 24) {
+      return false;  // false/true/null or float16/32/64 only
+    }
+  } else if (major > 1) {
+    return false;
+  }
+  ++items;
+  return true;
+}
+
+struct EncodingResult {
+  size_t bytes;
+  uint32_t flushes;
+  double ns;
+};
+
+// Stands for WebServer::sendContent(): keeps the payload to check it
+struct Socket {
+  std::string payload;
+  uint32_t flushes;
+};
+
+static void sendToSocket(const char* data, size_t length, void* context) {
+  Socket* socket = static_cast<Socket*>(context);
+  socket->payload.append(data, length);
+  ++socket->flushes;
+}
+
+static int64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+template <typename Writer>
+static EncodingResult measure(void (*build)(DataWriter&, const SampleDevice&), uint32_t iterations,
+                              std::string& payload) {
+  char buffer[STREAM_BUFFER];
+  Socket socket = {std::string(), 0};
+  {
+    Writer writer(buffer, sizeof(buffer), sendToSocket, &socket);
+    build(writer, sample);
+    writer.flush();
+  }
+  payload = socket.payload;
+  EncodingResult result = {payload.size(), socket.flushes, 0.0};
+  const int64_t start = nowNs();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    Writer writer(buffer, sizeof(buffer), nullptr, nullptr);
+    build(writer, sample);
+    writer.flush();
+  }
+  result.ns = static_cast<double>(nowNs() - start) / iterations;
+  return result;
+}
+
+static void printRow(const char* response, const char* encoding, const EncodingResult& r, size_t jsonBytes) {
+  printf("%-14s %-6s %7zu %7.1f %8u %10.0f\n", response, encoding, r.bytes, 100.0 * r.bytes / jsonBytes, r.flushes,
+         r.ns);
+}
+
+int main(int argc, char** argv) {
+  const uint32_t iterations = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 20000;
+  if (iterations == 0) {
+    fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+    return 2;
+  }
+  struct Case {
+    const char* name;
+    void (*build)(DataWriter&, const SampleDevice&);
+  };
+  static const Case CASES[] = {{"/api/overview", writeOverview}, {"/export/json", writeExport}};
+
+  printf("%-14s %-6s %7s %7s %8s %10s\n", "response", "format", "bytes", "% json", "flushes", "ns/resp");
+  int failures = 0;
+  for (const Case& c : CASES) {
+    std::string jsonPayload;
+    std::string cborPayload;
+    const EncodingResult json = measure<JsonWriter>(c.build, iterations, jsonPayload);
+    const EncodingResult cbor = measure<CborWriter>(c.build, iterations, cborPayload);
+    printRow(c.name, "json", json, json.bytes);
+    printRow(c.name, "cbor", cbor, json.bytes);
+
+    ItemCounter expected;
+    c.build(expected, sample);
+    size_t pos = 0;
+    uint32_t items = 0;
+    if (!walkCbor(cborPayload, pos, items) || pos != cborPayload.size() || items != expected.items) {
+      ++failures;
+      printf("  [WARN] CBOR payload does not match the document (%u of %u items, %zu of %zu bytes read)\n", items,
+             expected.items, pos, cborPayload.size());
+    }
+  }
+  printf("%% json: payload size relative to JSON, flushes: sendContent() calls of a\n"
+         "%zu-byte stream buffer, ns/resp: encode time on this host.\n",
+         STREAM_BUFFER);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,330 @@
+// Host comparison of the two ways API responses have been built: the former
+// String concatenation (json += "\"key\":" + String(x) + ",") and the streaming
+// JsonWriter (include/json_writer.h) behind ApiResponse:
+//   pio run -e native_json && .pio/build/native_json/program [iterations]
+// or without PlatformIO:
+//   c++ -std=gnu++17 -O2 -Isrc/host -Iinclude src/host/json_bench_host.cpp -o json_bench && ./json_bench
+// The documents are those of /api/status, /api/overview and
+// /api/memory-details before the switch, with fixed sample values; both paths
+// must produce the same bytes. String is the counting stand-in of
+// src/host/Arduino.h, so "allocations" and "copied" are what the Arduino-ESP32
+// 2.x String does, not the PC allocator.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "Arduino.h"
+#include "json_writer.h"
+
+static const size_t STREAM_BUFFER = 1024;  // JSON_STREAM_BUFFER_SIZE (config.h)
+
+// Fields of DiagnosticInfo / DetailedMemoryInfo read by the three handlers
+struct SampleTelemetry {
+  String chipModel = "ESP32-S3";
+  String chipRevision = "0";
+  int cpuCores = 2;
+  int cpuFreqMHz = 240;
+  String macAddress = "7C:DF:A1:E0:12:34";
+  unsigned long uptime = 3725000;
+  float temperature = 41.25f;
+  uint32_t flashSizeReal = 16777216;
+  uint32_t flashSizeChip = 16777216;
+  const char* flashType = "QIO";
+  const char* flashSpeed = "80 MHz";
+  uint32_t sramTotal = 327680;
+  uint32_t sramFree = 201344;
+  uint32_t sramUsed = 126336;
+  uint32_t psramTotal = 8386295;
+  uint32_t psramFree = 8123012;
+  uint32_t psramUsed = 263283;
+  float fragmentationPercent = 12.4f;
+  bool psramAvailable = true;
+  bool psramConfigured = true;
+  bool psramBoardSupported = true;
+  const char* psramType = "OPI";
+  String memoryStatus = "Excellent";
+  String wifiSSID = "Workshop-2G";
+  int wifiRSSI = -58;
+  const char* qualityKey = "signal_good";
+  String quality = "Good";
+  String ipAddress = "192.168.1.50";
+  int totalGPIO = 45;
+  int i2cCount = 2;
+  String i2cDevices = "0x3C 0x77";
+  bool wifiConnected = true;
+};
+
+static const SampleTelemetry sample;
+
+// ---- Former String builders (same statements as the handlers had) ----
+
+static String stringStatus(const SampleTelemetry& d) {
+  String json;
+  json.reserve(400);
+  json = "{";
+  json += "\"connected\":" + String(d.wifiConnected ? "true" : "false") + ",";
+  json += "\"uptime\":" + String(d.uptime) + ",";
+  json += "\"temperature\":" + String(d.temperature) + ",";
+  json += "\"sram\":{\"total\":" + String(d.sramTotal) +
+          ",\"free\":" + String(d.sramFree) +
+          ",\"used\":" + String(d.sramUsed) + "},";
+  json += "\"psram\":{\"total\":" + String(d.psramTotal) +
+          ",\"free\":" + String(d.psramFree) +
+          ",\"used\":" + String(d.psramUsed) + "},";
+  json += "\"fragmentation\":" + String(d.fragmentationPercent, 1) + "";
+  json += "}";
+  return json;
+}
+
+static String stringOverview(const SampleTelemetry& d) {
+  String json;
+  json.reserve(2500);
+  json = "{";
+  json += "\"chip\":{";
+  json += "\"model\":\"" + d.chipModel + "\",";
+  json += "\"revision\":\"" + d.chipRevision + "\",";
+  json += "\"cores\":" + String(d.cpuCores) + ",";
+  json += "\"freq\":" + String(d.cpuFreqMHz) + ",";
+  json += "\"mac\":\"" + d.macAddress + "\",";
+  json += "\"uptime\":" + String(d.uptime);
+  json += ",\"temperature\":" + String(d.temperature, 1);
+  json += "},";
+  json += "\"memory\":{";
+  json += "\"flash\":{\"real\":" + String(d.flashSizeReal) +
+          ",\"type\":\"" + String(d.flashType) + "\",\"speed\":\"" + String(d.flashSpeed) + "\"},";
+  json += "\"sram\":{\"total\":" + String(d.sramTotal) +
+          ",\"free\":" + String(d.sramFree) +
+          ",\"used\":" + String(d.sramUsed) + "},";
+  json += "\"psram\":{\"total\":" + String(d.psramTotal) +
+          ",\"free\":" + String(d.psramFree) +
+          ",\"used\":" + String(d.psramUsed) + "},";
+  json += "\"fragmentation\":" + String(d.fragmentationPercent, 1);
+  json += "},";
+  json += "\"wifi\":{";
+  json += "\"ssid\":\"" + d.wifiSSID + "\",";
+  json += "\"rssi\":" + String(d.wifiRSSI) + ",";
+  json += "\"quality_key\":\"" + String(d.qualityKey) + "\",";
+  json += "\"quality\":\"" + d.quality + "\",";
+  json += "\"ip\":\"" + d.ipAddress + "\"";
+  json += "},";
+  json += "\"gpio\":{";
+  json += "\"total\":" + String(d.totalGPIO) + ",";
+  json += "\"i2c_count\":" + String(d.i2cCount) + ",";
+  json += "\"i2c_devices\":\"" + d.i2cDevices + "\"";
+  json += "}";
+  json += "}";
+  return json;
+}
+
+static String stringMemoryDetails(const SampleTelemetry& d) {
+  String json;
+  json.reserve(450);
+  json = "{\"flash\":{\"real\":" + String(d.flashSizeReal) + ",\"chip\":" + String(d.flashSizeChip) + "},";
+  json += "\"psram\":{\"available\":" + String(d.psramAvailable ? "true" : "false") +
+          ",\"configured\":" + String(d.psramConfigured ? "true" : "false") +
+          ",\"supported\":" + String(d.psramBoardSupported ? "true" : "false") +
+          ",\"type\":\"" + String(d.psramType) + "\"" +
+          ",\"total\":" + String(d.psramTotal) + ",\"free\":" + String(d.psramFree) + "},";
+  json += "\"sram\":{\"total\":" + String(d.sramTotal) + ",\"free\":" + String(d.sramFree) + "},";
+  json += "\"fragmentation\":" + String(d.fragmentationPercent, 1) + ",\"status\":\"" + d.memoryStatus + "\"}";
+  return json;
+}
+
+// ---- JsonWriter builders (same documents) ----
+
+static void writerStatus(JsonWriter& json, const SampleTelemetry& d) {
+  json.beginObject();
+  json.field("connected", d.wifiConnected);
+  json.field("uptime", d.uptime);
+  json.fieldFloat("temperature", d.temperature, 2);
+  json.beginObject("sram");
+  json.field("total", d.sramTotal);
+  json.field("free", d.sramFree);
+  json.field("used", d.sramUsed);
+  json.endObject();
+  json.beginObject("psram");
+  json.field("total", d.psramTotal);
+  json.field("free", d.psramFree);
+  json.field("used", d.psramUsed);
+  json.endObject();
+  json.fieldFloat("fragmentation", d.fragmentationPercent, 1);
+  json.endObject();
+}
+
+static void writerOverview(JsonWriter& json, const SampleTelemetry& d) {
+  json.beginObject();
+  json.beginObject("chip");
+  json.field("model", d.chipModel);
+  json.field("revision", d.chipRevision);
+  json.field("cores", d.cpuCores);
+  json.field("freq", d.cpuFreqMHz);
+  json.field("mac", d.macAddress);
+  json.field("uptime", d.uptime);
+  json.fieldFloat("temperature", d.temperature, 1);
+  json.endObject();
+  json.beginObject("memory");
+  json.beginObject("flash");
+  json.field("real", d.flashSizeReal);
+  json.field("type", d.flashType);
+  json.field("speed", d.flashSpeed);
+  json.endObject();
+  json.beginObject("sram");
+  json.field("total", d.sramTotal);
+  json.field("free", d.sramFree);
+  json.field("used", d.sramUsed);
+  json.endObject();
+  json.beginObject("psram");
+  json.field("total", d.psramTotal);
+  json.field("free", d.psramFree);
+  json.field("used", d.psramUsed);
+  json.endObject();
+  json.fieldFloat("fragmentation", d.fragmentationPercent, 1);
+  json.endObject();
+  json.beginObject("wifi");
+  json.field("ssid", d.wifiSSID);
+  json.field("rssi", d.wifiRSSI);
+  json.field("quality_key", d.qualityKey);
+  json.field("quality", d.quality);
+  json.field("ip", d.ipAddress);
+  json.endObject();
+  json.beginObject("gpio");
+  json.field("total", d.totalGPIO);
+  json.field("i2c_count", d.i2cCount);
+  json.field("i2c_devices", d.i2cDevices);
+  json.endObject();
+  json.endObject();
+}
+
+static void writerMemoryDetails(JsonWriter& json, const SampleTelemetry& d) {
+  json.beginObject();
+  json.beginObject("flash");
+  json.field("real", d.flashSizeReal);
+  json.field("chip", d.flashSizeChip);
+  json.endObject();
+  json.beginObject("psram");
+  json.field("available", d.psramAvailable);
+  json.field("configured", d.psramConfigured);
+  json.field("supported", d.psramBoardSupported);
+  json.field("type", d.psramType);
+  json.field("total", d.psramTotal);
+  json.field("free", d.psramFree);
+  json.endObject();
+  json.beginObject("sram");
+  json.field("total", d.sramTotal);
+  json.field("free", d.sramFree);
+  json.endObject();
+  json.fieldFloat("fragmentation", d.fragmentationPercent, 1);
+  json.field("status", d.memoryStatus);
+  json.endObject();
+}
+
+// ---- Measurement ----
+
+struct PathResult {
+  size_t bytes;
+  uint32_t allocations;
+  size_t peakHeap;
+  uint64_t copied;
+  uint32_t flushes;
+  double ns;
+};
+
+// Stands for WebServer::sendContent(): keeps the last response to compare
+struct Socket {
+  std::string last;
+  uint32_t flushes;
+};
+
+static void sendToSocket(const char* data, size_t length, void* context) {
+  Socket* socket = static_cast<Socket*>(context);
+  socket->last.append(data, length);
+  ++socket->flushes;
+}
+
+static int64_t nowNs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static PathResult measureString(String (*build)(const SampleTelemetry&), uint32_t iterations, std::string& out) {
+  hostStringStats.reset();
+  {
+    const String json = build(sample);
+    out.assign(json.c_str(), json.length());
+  }
+  PathResult result = {out.size(), hostStringStats.allocations, hostStringStats.peakBytes, hostStringStats.bytesCopied,
+                       0, 0.0};
+  const int64_t start = nowNs();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    const String json = build(sample);
+    if (json.length() == 0) {
+      break;
+    }
+  }
+  result.ns = static_cast<double>(nowNs() - start) / iterations;
+  return result;
+}
+
+static PathResult measureWriter(void (*build)(JsonWriter&, const SampleTelemetry&), uint32_t iterations,
+                                std::string& out) {
+  char buffer[STREAM_BUFFER];
+  Socket socket = {std::string(), 0};
+  hostStringStats.reset();
+  {
+    JsonWriter json(buffer, sizeof(buffer), sendToSocket, &socket);
+    build(json, sample);
+    json.flush();
+  }
+  out = socket.last;
+  // Every byte is written once into the stack buffer, then handed to the socket
+  PathResult result = {out.size(), hostStringStats.allocations, hostStringStats.peakBytes,
+                       hostStringStats.bytesCopied + out.size(), socket.flushes, 0.0};
+  const int64_t start = nowNs();
+  for (uint32_t i = 0; i < iterations; ++i) {
+    JsonWriter json(buffer, sizeof(buffer), nullptr, nullptr);
+    build(json, sample);
+    json.flush();
+  }
+  result.ns = static_cast<double>(nowNs() - start) / iterations;
+  return result;
+}
+
+static void printRow(const char* response, const char* path, const PathResult& r) {
+  printf("%-20s %-10s %6zu %7u %9zu %8llu %8u %10.0f\n", response, path, r.bytes, r.allocations, r.peakHeap,
+         static_cast<unsigned long long>(r.copied), r.flushes, r.ns);
+}
+
+int main(int argc, char** argv) {
+  const uint32_t iterations = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 20000;
+  if (iterations == 0) {
+    fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+    return 2;
+  }
+  struct Case {
+    const char* name;
+    String (*string)(const SampleTelemetry&);
+    void (*writer)(JsonWriter&, const SampleTelemetry&);
+  };
+  static const Case CASES[] = {{"/api/status", stringStatus, writerStatus},
+                               {"/api/overview", stringOverview, writerOverview},
+                               {"/api/memory-details", stringMemoryDetails, writerMemoryDetails}};
+
+  printf("%-20s %-10s %6s %7s %9s %8s %8s %10s\n", "response", "path", "bytes", "allocs", "peak heap", "copied",
+         "flushes", "ns/resp");
+  int mismatches = 0;
+  for (const Case& c : CASES) {
+    std::string stringOut;
+    std::string writerOut;
+    printRow(c.name, "String", measureString(c.string, iterations, stringOut));
+    printRow(c.name, "JsonWriter", measureWriter(c.writer, iterations, writerOut));
+    if (stringOut != writerOut) {
+      ++mismatches;
+      printf("  [WARN] outputs differ:\n  %s\n  %s\n", stringOut.c_str(), writerOut.c_str());
+    }
+  }
+  printf("allocs: String heap calls (malloc/realloc), copied: characters moved by the\n"
+         "builder, flushes: sendContent() calls of a %zu-byte stream buffer.\n",
+         STREAM_BUFFER);
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,199 @@
+// Native stand-in for the network throughput endpoints of the firmware
+// (include/net_throughput.h), to try tools/net_bench.py without a board:
+//   pio run -e native_net && .pio/build/native_net/program [http_port] [echo_port]
+// or without PlatformIO:
+//   c++ -std=gnu++17 -O2 -pthread -Iinclude src/host/net_server_host.cpp -o net_server && ./net_server
+// Serves GET /api/net/download?bytes=N, POST /api/net/upload and GET /api/net
+// with the same payloads and JSON fields as the board, plus the TCP echo port.
+// Defaults: HTTP on 8080, echo on 7007. One thread per connection.
+
+#include <arpa/inet.h>
+#include <signal.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "net_throughput.h"
+
+static const uint64_t DEFAULT_BYTES = 1024 * 1024;
+static const uint64_t MAX_BYTES = 1024ULL * 1024 * 1024;
+static const size_t CHUNK = 16384;
+
+static uint8_t chunk[CHUNK];
+static NetEchoServer echoServer;
+static std::mutex transfersMutex;
+static NetTransfer lastDownload = {0, 0, 0, 0, false};
+static NetTransfer lastUpload = {0, 0, 0, 0, false};
+
+static int64_t nowUs() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void sendText(int fd, int status, const char* reason, const char* type, const std::string& body) {
+  char header[192];
+  snprintf(header, sizeof(header),
+           "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n", status, reason,
+           type, body.size());
+  NetEchoServer::sendAll(fd, reinterpret_cast<const uint8_t*>(header), strlen(header));
+  NetEchoServer::sendAll(fd, reinterpret_cast<const uint8_t*>(body.data()), body.size());
+}
+
+static std::string transferJson(const NetTransfer& transfer) {
+  char json[160];
+  snprintf(json, sizeof(json), "{\"bytes\":%llu,\"expected\":%llu,\"us\":%lld,\"mbps\":%.2f,\"complete\":%s}",
+           static_cast<unsigned long long>(transfer.bytes), static_cast<unsigned long long>(transfer.expected),
+           static_cast<long long>(transfer.us), transfer.mbps(), transfer.complete ? "true" : "false");
+  return json;
+}
+
+// Value of name= in the query string, or "" when absent
+static std::string queryArg(const std::string& target, const char* name) {
+  const size_t query = target.find('?');
+  const std::string key = std::string(name) + "=";
+  for (size_t at = query; at != std::string::npos && at + 1 < target.size(); at = target.find('&', at + 1)) {
+    if (target.compare(at + 1, key.size(), key) == 0) {
+      const size_t end = target.find('&', at + 1);
+      return target.substr(at + 1 + key.size(), end == std::string::npos ? std::string::npos : end - at - 1 - key.size());
+    }
+  }
+  return "";
+}
+
+static void serveDownload(int fd, const std::string& target) {
+  const std::string arg = queryArg(target, "bytes");
+  uint64_t bytes = arg.empty() ? DEFAULT_BYTES : strtoull(arg.c_str(), nullptr, 10);
+  bytes = bytes > MAX_BYTES ? MAX_BYTES : bytes;
+  char header[192];
+  snprintf(header, sizeof(header),
+           "HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\nContent-Length: %llu\r\n"
+           "Cache-Control: no-store\r\nConnection: close\r\n\r\n",
+           static_cast<unsigned long long>(bytes));
+  NetEchoServer::sendAll(fd, reinterpret_cast<const uint8_t*>(header), strlen(header));
+  NetTransfer transfer;
+  transfer.start(bytes, nowUs());
+  transfer.bytes = netStreamPattern(
+      [fd](const uint8_t* data, size_t length) {
+        return NetEchoServer::sendAll(fd, data, length) ? length : 0;
+      },
+      bytes, chunk, sizeof(chunk));
+  transfer.finish(nowUs());
+  std::lock_guard<std::mutex> lock(transfersMutex);
+  lastDownload = transfer;
+}
+
+// already: body bytes read together with the headers
+static void serveUpload(int fd, uint64_t contentLength, size_t already) {
+  static thread_local uint8_t sink[CHUNK];
+  NetTransfer transfer;
+  transfer.start(contentLength, nowUs());
+  transfer.bytes = already;
+  while (transfer.bytes < contentLength) {
+    const ssize_t received = recv(fd, sink, sizeof(sink), 0);
+    if (received <= 0) {
+      break;
+    }
+    transfer.bytes += static_cast<uint64_t>(received);
+  }
+  transfer.finish(nowUs());
+  {
+    std::lock_guard<std::mutex> lock(transfersMutex);
+    lastUpload = transfer;
+  }
+  sendText(fd, 200, "OK", "application/json", transferJson(transfer));
+}
+
+static void serveStatus(int fd) {
+  std::string json;
+  {
+    std::lock_guard<std::mutex> lock(transfersMutex);
+    char head[160];
+    snprintf(head, sizeof(head), "{\"echo_port\":%u,\"echo_sessions\":%u,\"echo_bytes\":%llu,\"chunk_bytes\":%zu,",
+             echoServer.port(), echoServer.sessions(), static_cast<unsigned long long>(echoServer.bytes()), CHUNK);
+    json = std::string(head) + "\"last_download\":" + transferJson(lastDownload) +
+           ",\"last_upload\":" + transferJson(lastUpload) + "}";
+  }
+  sendText(fd, 200, "OK", "application/json", json);
+}
+
+static void serveConnection(int fd) {
+  char buffer[4096];
+  size_t length = 0;
+  size_t headerEnd = std::string::npos;
+  while (headerEnd == std::string::npos && length < sizeof(buffer)) {
+    const ssize_t received = recv(fd, buffer + length, sizeof(buffer) - length, 0);
+    if (received <= 0) {
+      close(fd);
+      return;
+    }
+    length += static_cast<size_t>(received);
+    headerEnd = std::string(buffer, length).find("\r\n\r\n");
+  }
+  const std::string head(buffer, headerEnd == std::string::npos ? length : headerEnd);
+  const size_t methodEnd = head.find(' ');
+  const size_t targetEnd = head.find(' ', methodEnd + 1);
+  const std::string method = head.substr(0, methodEnd);
+  const std::string target = methodEnd == std::string::npos ? "" : head.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+  const std::string path = target.substr(0, target.find('?'));
+
+  if (headerEnd == std::string::npos) {
+    sendText(fd, 431, "Request Header Fields Too Large", "text/plain", "");
+  } else if (method == "GET" && path == "/api/net/download") {
+    serveDownload(fd, target);
+  } else if (method == "POST" && path == "/api/net/upload") {
+    uint64_t contentLength = 0;
+    for (size_t at = head.find("\r\n"); at != std::string::npos; at = head.find("\r\n", at + 2)) {
+      if (strncasecmp(head.c_str() + at + 2, "Content-Length:", 15) == 0) {
+        contentLength = strtoull(head.c_str() + at + 17, nullptr, 10);
+      }
+    }
+    serveUpload(fd, contentLength, length - headerEnd - 4);
+  } else if (method == "GET" && path == "/api/net") {
+    serveStatus(fd);
+  } else {
+    sendText(fd, 404, "Not Found", "text/plain", "Not found\n");
+  }
+  close(fd);
+}
+
+int main(int argc, char** argv) {
+  const uint16_t httpPort = static_cast<uint16_t>(argc > 1 ? atoi(argv[1]) : 8080);
+  const uint16_t echoPort = static_cast<uint16_t>(argc > 2 ? atoi(argv[2]) : 7007);
+  signal(SIGPIPE, SIG_IGN);
+  netFillPattern(chunk, sizeof(chunk));
+
+  if (!echoServer.begin(echoPort)) {
+    fprintf(stderr, "echo: cannot listen on port %u\n", echoPort);
+    return 1;
+  }
+  std::thread([] {
+    static uint8_t buffer[1460];
+    while (echoServer.serveOne(buffer, sizeof(buffer), 10000)) {
+    }
+  }).detach();
+
+  const int listenFd = socket(AF_INET, SOCK_STREAM, 0);
+  int enable = 1;
+  setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(httpPort);
+  if (listenFd < 0 || bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+      listen(listenFd, 16) != 0) {
+    fprintf(stderr, "http: cannot listen on port %u\n", httpPort);
+    return 1;
+  }
+  printf("HTTP on %u (/api/net/download, /api/net/upload, /api/net), TCP echo on %u\n", httpPort, echoPort);
+  fflush(stdout);
+  for (;;) {
+    const int fd = accept(listenFd, nullptr, nullptr);
+    if (fd >= 0) {
+      std::thread(serveConnection, fd).detach();
+    }
+  }
+}
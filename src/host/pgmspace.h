@@ -0,0 +1,6 @@
+#pragma once
+
+// Host stand-in for <pgmspace.h>: flash and RAM share one address space on a
+// PC, the PROGMEM helpers live in src/host/Arduino.h.
+
+#include "Arduino.h"
@@ -9,6 +9,7 @@
 #include <WiFi.h>
 #include <WiFiMulti.h>
 #include <WebServer.h>
+#include <uri/UriBraces.h>
 
 #if defined(ARDUINO_ARCH_ESP32)
   #include <freertos/FreeRTOS.h>
@@ -51,9 +52,12 @@
 #include <esp_mac.h>
 #include <esp_flash.h>
 #include <esp_heap_caps.h>
+#include <esp_idf_version.h>
+#include <esp_ota_ops.h>
 #include <esp_partition.h>
 #include <esp_wifi.h>
 #include <esp_task_wdt.h>
+#include <lwip/sockets.h>
 #if defined(__has_include)
   #if __has_include(<sdkconfig.h>)
     #include <sdkconfig.h>
@@ -90,6 +94,23 @@
 #include <string>
 #include <initializer_list>
 #include "json_helpers.h"
+#include "json_writer.h"
+#include "cbor_writer.h"
+#include "multiplexed_web_server.h"
+#include "route_metrics.h"
+#include "job_scheduler.h"
+#include "stack_profiler.h"
+#include "buffer_pool.h"
+#include "core_placement.h"
+#include "loop_events.h"
+#include "jitter_monitor.h"
+#include "test_pause.h"
+#include "cpu_bench_suite.h"
+#include "memory_benchmark.h"
+#include "sd_benchmark.h"
+#include "i2c_benchmark.h"
+#include "display_benchmark.h"
+#include "net_throughput.h"
 
 // Configuration file - customize your setup
 // Copy include/config-example.h to include/config.h and customize your settings
@@ -102,6 +123,7 @@
 
 // Dual-language UI strings
 #include "languages.h"
+#include "report_model.h"
 
 // TFT Display support
 #include "tft_display.h"
@@ -117,14 +139,16 @@ Language currentLanguage = DEFAULT_LANGUAGE;
 
 // --- Prototypes pour fonctions de réponse JSON/API ---
 void sendJsonResponse(int statusCode, std::initializer_list<JsonFieldSpec> fields);
-void sendOperationSuccess(const String& message, std::initializer_list<JsonFieldSpec> extraFields = {});
-void sendOperationError(int statusCode, const String& message, std::initializer_list<JsonFieldSpec> extraFields = {});
-void sendActionResponse(int statusCode, bool success, const String& message, std::initializer_list<JsonFieldSpec> extraFields = {});
+// Message : const char*, String ou texte flash (Texts::*), écrit sans copie
+void sendActionFields(int statusCode, bool success, const JsonFieldSpec& message, std::initializer_list<JsonFieldSpec> extraFields);
+template <typename Message>
+void sendOperationSuccess(const Message& message, std::initializer_list<JsonFieldSpec> extraFields = {});
+template <typename Message>
+void sendOperationError(int statusCode, const Message& message, std::initializer_list<JsonFieldSpec> extraFields = {});
+template <typename Message>
+void sendActionResponse(int statusCode, bool success, const Message& message, std::initializer_list<JsonFieldSpec> extraFields = {});
 void tftStepBoot();
 
-static String buildActionResponseJson(bool success,
-                                      const String& message,
-                                      std::initializer_list<JsonFieldSpec> extraFields = {});
 String htmlEscape(const String& raw);
 String jsonEscape(const char* raw);
 String buildTranslationsJSON();
@@ -200,6 +224,7 @@ String getArduinoCoreVersionString() {
 // I2C pins for OLED and environmental sensors (modifiable via web interface)
 int i2c_sda = I2C_SDA;
 int i2c_scl = I2C_SCL;
+uint32_t i2cClockHz = I2C_CLOCK_HZ;  // ?apply=1 de /api/i2c-benchmark
 
 // RGB LED pins (modifiable via web interface)
 int rgb_led_pin_r = LED_RED;
@@ -235,7 +260,24 @@ int oledHeight = SCREEN_HEIGHT;
 uint8_t DHT_SENSOR_TYPE = DEFAULT_DHT_SENSOR_TYPE;
 
 // ========== OBJETS GLOBAUX ==========
-WebServer server(WEB_SERVER_PORT);
+// [OPT-015]: Jusqu'à MAX_WEB_CLIENTS connexions multiplexées (voir multiplexed_web_server.h)
+// [OPT-018]: Avec ENABLE_ROUTE_METRICS, chaque route est instrumentée (voir route_metrics.h)
+#if ENABLE_ROUTE_METRICS
+typedef InstrumentedWebServer<MultiplexedWebServer<MAX_WEB_CLIENTS>, ROUTE_METRICS_MAX_ROUTES> DiagnosticWebServer;
+#else
+typedef MultiplexedWebServer<MAX_WEB_CLIENTS> DiagnosticWebServer;
+#endif
+DiagnosticWebServer server(WEB_SERVER_PORT);
+
+// Octets écrits directement sur server.client() : invisibles pour les compteurs
+// de route_metrics.h, ils sont imputés explicitement à la route en cours
+static inline void recordDirectBytes(size_t bytes) {
+#if ENABLE_ROUTE_METRICS
+  server.addSentBytes(bytes);
+#else
+  (void)bytes;
+#endif
+}
 WiFiMulti wifiMulti;
 #if DIAGNOSTIC_HAS_MDNS
 bool mdnsServiceActive = false;
@@ -248,6 +290,123 @@ bool mdnsResponderInitialized = false;
 #endif
 U8G2_SSD1306_128X64_NONAME_F_HW_I2C oled(U8G2_R0, U8X8_PIN_NONE);
 
+// ========== STREAMING API RESPONSES ==========
+// [OPT-010]: Documents written into a fixed stack buffer instead of String concatenation.
+// Small payloads go out in one send() with Content-Length; larger ones switch to
+// chunked transfer on the first buffer flush. The response is completed when the
+// object goes out of scope.
+// [OPT-017]: The encoding is negotiated from the Accept header: application/cbor
+// selects the CBOR encoder, anything else gets JSON. Handlers describe the document
+// once through DataWriter, so both encodings always carry the same fields.
+class ApiResponse : public DataWriter {
+ public:
+  // Encoding negotiated with the client
+  explicit ApiResponse(int statusCode) : ApiResponse(statusCode, "application/json", clientAcceptsCbor()) {
+    server.sendHeader("Vary", "Accept");
+  }
+
+  // Always JSON, with an explicit content type
+  ApiResponse(int statusCode, const char* jsonContentType) : ApiResponse(statusCode, jsonContentType, false) {}
+
+  ~ApiResponse() {
+    WriterBuffer& output = cborSelected_ ? static_cast<WriterBuffer&>(cbor_) : static_cast<WriterBuffer&>(json_);
+    if (!streaming_) {
+      server.send_P(statusCode_, contentType_, output.pending(), output.pendingLength());
+      return;
+    }
+    flush();
+    server.sendContent("");
+  }
+
+  bool isCbor() const { return cborSelected_; }
+
+  void flush() override { active().flush(); }
+
+  void writeKey(const char* key) override { active().writeKey(key); }
+  void writeItem() override { active().writeItem(); }
+  void writeOpen(bool object) override { active().writeOpen(object); }
+  void writeClose(bool object) override { active().writeClose(object); }
+  void writeText(const char* text, size_t length) override { active().writeText(text, length); }
+  void writeFlashText(const __FlashStringHelper* text) override { active().writeFlashText(text); }
+  void writeBool(bool value) override { active().writeBool(value); }
+  void writeNull() override { active().writeNull(); }
+  void writeSigned(long long value) override { active().writeSigned(value); }
+  void writeUnsigned(unsigned long long value) override { active().writeUnsigned(value); }
+  void writeFloat(double value, uint8_t decimals) override { active().writeFloat(value, decimals); }
+
+ private:
+  ApiResponse(int statusCode, const char* jsonContentType, bool cbor)
+      : json_(buffer_, sizeof(buffer_), flushToClient, this),
+        cbor_(buffer_, sizeof(buffer_), flushToClient, this),
+        cborSelected_(cbor),
+        statusCode_(statusCode),
+        contentType_(cbor ? "application/cbor" : jsonContentType),
+        streaming_(false) {}
+
+  static bool clientAcceptsCbor() {
+    return server.header("Accept").indexOf("application/cbor") >= 0;
+  }
+
+  DataWriter& active() { return cborSelected_ ? static_cast<DataWriter&>(cbor_) : static_cast<DataWriter&>(json_); }
+
+  static void flushToClient(const char* data, size_t length, void* context) {
+    ApiResponse* self = static_cast<ApiResponse*>(context);
+    if (!self->streaming_) {
+      self->streaming_ = true;
+      server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+      server.send(self->statusCode_, self->contentType_, "");
+    }
+    server.sendContent(data, length);
+  }
+
+  char buffer_[JSON_STREAM_BUFFER_SIZE];
+  JsonWriter json_;  // both encoders share buffer_, only one is used
+  CborWriter cbor_;
+  bool cborSelected_;
+  int statusCode_;
+  const char* contentType_;
+  bool streaming_;
+};
+
+// Same delivery as ApiResponse for text formats (TXT/CSV/HTML exports): one
+// send() when the document fits in the buffer, chunked transfer otherwise.
+class TextResponse {
+ public:
+  TextResponse(int statusCode, const char* contentType)
+      : sink_(buffer_, sizeof(buffer_), flushToClient, this),
+        statusCode_(statusCode),
+        contentType_(contentType),
+        streaming_(false) {}
+
+  ~TextResponse() {
+    if (!streaming_) {
+      server.send_P(statusCode_, contentType_, sink_.pending(), sink_.pendingLength());
+      return;
+    }
+    sink_.flush();
+    server.sendContent("");
+  }
+
+  ReportSink& sink() { return sink_; }
+
+ private:
+  static void flushToClient(const char* data, size_t length, void* context) {
+    TextResponse* self = static_cast<TextResponse*>(context);
+    if (!self->streaming_) {
+      self->streaming_ = true;
+      server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+      server.send(self->statusCode_, self->contentType_, "");
+    }
+    server.sendContent(data, length);
+  }
+
+  char buffer_[JSON_STREAM_BUFFER_SIZE];
+  ReportSink sink_;
+  int statusCode_;
+  const char* contentType_;
+  bool streaming_;
+};
+
 
 // NeoPixel (from board_config.h via config.h)
 int LED_PIN = NEOPIXEL;
@@ -278,9 +437,10 @@ Adafruit_NeoPixel *strip = nullptr;
 
 // NeoPixel heartbeat state
 volatile bool neopixelStatusPaused = false;
-unsigned long neopixelHeartbeatPreviousMillis = 0;
-const unsigned long NEOPIXEL_HEARTBEAT_INTERVAL_MS = 1000;
-bool neopixelHeartbeatState = false;
+const unsigned long NEOPIXEL_HEARTBEAT_FADE_PERIOD_MS = 1200;
+const uint8_t NEOPIXEL_HEARTBEAT_BRIGHTNESS_MIN = 10;
+const uint8_t NEOPIXEL_HEARTBEAT_BRIGHTNESS_MAX = 60;
+uint8_t neopixelHeartbeatBrightness = 0;  // dernière luminosité affichée, 0 : à redessiner
 bool neopixelStatusKnown = false;
 bool neopixelLastWifiConnected = false;
 bool neopixelConnecting = false;
@@ -303,7 +463,7 @@ void neopixelShowConnecting();
 void neopixelPauseStatus();
 void neopixelResumeStatus();
 void neopixelRestoreWifiStatus();
-void updateNeoPixelWifiStatus();
+uint32_t updateNeoPixelWifiStatus();
 
 // Built-in LED (from config.h)
 int BUILTIN_LED_PIN = LED_BUILTIN;
@@ -319,81 +479,143 @@ String oledTestResult = DEFAULT_TEST_RESULT_STR;
 String tftTestResult = DEFAULT_TEST_RESULT_STR;
 #endif
 
-// Exécution asynchrone des tests matériels
-typedef void (*TestRoutine)();
-
-struct AsyncTestRunner {
-  const char* taskName;
-  TaskHandle_t taskHandle;
-  volatile bool running;
+// [OPT-020]: Tests matériels exécutés comme jobs par un pool de workers créé
+// au démarrage (voir job_scheduler.h) : plus de tâche FreeRTOS créée/détruite
+// ni d'allocation par test, et suivi via /api/jobs
+static JobScheduler<JOB_WORKER_COUNT, JOB_STORE_SIZE> jobScheduler;
+
+// [OPT-023]: Pic de pile mesuré par tâche et par type de job (voir stack_profiler.h),
+// conservé en NVS ; au démarrage les piles des workers et de l'échantillonneur
+// sont dimensionnées d'après ce profil (/api/stacks)
+// 20 types de job + 6 tâches, avec de la marge : un nom qui n'existe plus ne
+// prend pas la place d'un nom courant (voir le static_assert après JOB_TYPE_COUNT)
+static const uint8_t STACK_PROFILE_ENTRIES = 32;
+static const uint8_t STACK_PROFILE_TASKS = 6;  // JobWorker, TelemetrySampler, loopTask, HttpWatcher, NetEcho, NetDownload
+static const char* const STACK_WORKER = "JobWorker";
+static const char* const STACK_TELEMETRY = "TelemetrySampler";
+static const char* const STACK_LOOP = "loopTask";
+static StackProfile<STACK_PROFILE_ENTRIES> stackProfile({STACK_PROFILE_MARGIN_PERCENT, STACK_PROFILE_MIN_MARGIN,
+                                                         STACK_PROFILE_MIN_SAMPLES, STACK_PROFILE_MIN_STACK,
+                                                         STACK_PROFILE_MAX_STACK});
+
+// [OPT-024]: Tampons de travail des tests en mémoire statique (voir buffer_pool.h) :
+// un par worker, aucun malloc par exécution de test
+static BufferPool<WORK_BUFFER_SIZE, WORK_BUFFER_COUNT> workBuffers;
+typedef WorkBuffer<decltype(workBuffers)> TestBuffer;
+
+// [OPT-025]: Charge par coeur mesurée au tick (voir core_placement.h) ; en mode
+// mesuré les jobs ne démarrent que sur le coeur le moins chargé par loop()/Wi-Fi
+// quand l'écart dépasse CORE_PLACEMENT_IMBALANCE_PERCENT (/api/cores)
+static CoreLoadMonitor coreLoadMonitor;
+static CorePlacement corePlacement(CORE_PLACEMENT_MEASURED ? PLACEMENT_MEASURED : PLACEMENT_FIXED,
+                                   CORE_PLACEMENT_FIXED_JOB_CORES, CORE_PLACEMENT_IMBALANCE_PERCENT);
+static CoreLoad coreLoads[CoreLoadMonitor::MAX_CORES];
+static int8_t loopCore = -1;
+
+// [OPT-026]: loop() piloté par événements (voir loop_events.h) : chaque sous-système
+// a un bit, posé par une interruption, une autre tâche ou un timer logiciel à sa
+// prochaine échéance ; plus de delay(10) ni de réveil à 100 Hz (/api/loop)
+enum LoopEvent : EventBits_t {
+  LOOP_HTTP = 1 << 0,     // connexion ou requête en attente (tâche HttpWatcher)
+  LOOP_BUTTONS = 1 << 1,  // front sur un bouton (ISR), anti-rebond ou barre d'appui long
+  LOOP_NETWORK = 1 << 2,  // événement Wi-Fi ou nouvel essai mDNS
+  LOOP_LEDS = 1 << 3,     // image suivante du battement NeoPixel
+  LOOP_STREAMS = 1 << 4,  // échéance d'un flux SSE
+  LOOP_JOBS = 1 << 5,     // job terminé
+  LOOP_TICK = 1 << 6,     // entretien : timeouts, placement, profil de pile, soak
+  LOOP_REPORT = 1 << 7,   // résumé série périodique
 };
-
-struct AsyncTestTaskArgs {
-  AsyncTestRunner* runner;
-  TestRoutine routine;
-};
-
-static void asyncTestTask(void* parameters) {
-  AsyncTestTaskArgs* args = static_cast<AsyncTestTaskArgs*>(parameters);
-  if (args && args->routine) {
-    args->routine();
-  }
-  if (args) {
-    if (args->runner) {
-      args->runner->running = false;
-      args->runner->taskHandle = nullptr;
-    }
-    delete args;
-  }
-  vTaskDelete(nullptr);
-}
-
-static bool startAsyncTest(AsyncTestRunner& runner,
-                           TestRoutine routine,
-                           bool& alreadyRunning,
-                           uint32_t stackSize = 4096,
-                           UBaseType_t priority = 1) {
-  alreadyRunning = runner.running;
-  if (runner.running) {
-    return false;
-  }
-
-  AsyncTestTaskArgs* args = new AsyncTestTaskArgs{&runner, routine};
-  runner.running = true;
-
-#if CONFIG_FREERTOS_UNICORE
-  const BaseType_t targetCore = tskNO_AFFINITY;
-#else
-  const BaseType_t targetCore = 1;
-#endif
-
-  BaseType_t result = xTaskCreatePinnedToCore(asyncTestTask,
-                                              runner.taskName,
-                                              stackSize,
-                                              args,
-                                              priority,
-                                              &runner.taskHandle,
-                                              targetCore);
-  if (result != pdPASS) {
-    runner.running = false;
-    runner.taskHandle = nullptr;
-    delete args;
-    alreadyRunning = false;
-    return false;
+static const uint8_t LOOP_EVENT_SOURCES = 8;
+static const char* const LOOP_EVENT_NAMES[LOOP_EVENT_SOURCES] = {"http",    "buttons", "network", "leds",
+                                                                 "streams", "jobs",    "tick",    "report"};
+static LoopEvents<LOOP_EVENT_SOURCES> loopEvents;
+static TimerHandle_t buttonTimer = nullptr;
+static TimerHandle_t networkTimer = nullptr;
+static TimerHandle_t ledTimer = nullptr;
+static TimerHandle_t streamTimer = nullptr;
+static const char* const STACK_HTTP_WATCHER = "HttpWatcher";
+
+// [OPT-027]: histogrammes de période de boucle, durée des handlers, latence
+// signal -> loop() et intervalle des ticks ; blocages > JITTER_STALL_MS journalisés (/api/jitter)
+static JitterMonitor<JITTER_STALL_LOG> jitterMonitor(JITTER_STALL_MS);
+
+// [OPT-028]: Annulation coopérative des tests (voir test_pause.h) : une
+// annulation (/api/jobs/{id}/cancel) ou l'échéance du job réveille le worker
+// pendant sa pause, le test s'arrête en moins d'un tick
+bool testPause(uint32_t ms) {
+  JobContext* job = jobScheduler.current();
+  if (job == nullptr) {
+    delay(ms);
+    return true;
   }
-
-  alreadyRunning = false;
-  return true;
-}
-
-// Orchestrateurs asynchrones des tests lents
-static AsyncTestRunner builtinLedTestRunner = {"BuiltinLEDTest", nullptr, false};
-static AsyncTestRunner neopixelTestRunner = {"NeoPixelTest", nullptr, false};
-static AsyncTestRunner oledTestRunner = {"OLEDTest", nullptr, false};
-static AsyncTestRunner rgbLedTestRunner = {"RgbLedTest", nullptr, false};
-static AsyncTestRunner buzzerTestRunner = {"BuzzerTest", nullptr, false};
-static AsyncTestRunner sdTestRunner = {"SDTest", nullptr, false};
-static AsyncTestRunner rotaryTestRunner = {"RotaryTest", nullptr, false};
+  return job->sleep(ms);
+}
+
+bool testStopping() {
+  const JobContext* job = jobScheduler.current();
+  return job != nullptr && job->stopRequested();
+}
+
+// [OPT-029]: Banc CPU multi-noyaux (voir cpu_benchmark.h / cpu_bench_suite.h) :
+// échauffement puis passes chronométrées au compteur de cycles, médiane, p95 et
+// CV par noyau, sur chaque coeur seul puis sur les deux à la fois (/api/benchmark)
+typedef CpuBenchSuite<CPU_BENCH_ITERATIONS> CpuBench;
+static CpuBench cpuBench(CPU_BENCH_WARMUP, CPU_BENCH_TASK_STACK);
+
+// [OPT-030]: Courbe de la hiérarchie mémoire (voir memory_benchmark.h) : débit
+// lecture/écriture/copie et latence d'accès aléatoire de 1 Ko à plusieurs Mo en
+// SRAM interne, IRAM, PSRAM et flash mappée (/api/benchmark, exports)
+static const uint8_t MEM_CURVE_POINTS = 13;  // 1 Ko .. 4 Mo
+typedef MemoryCurve<MEM_CURVE_POINTS> MemCurve;
+enum MemoryRegion : uint8_t { MEM_SRAM, MEM_IRAM, MEM_PSRAM, MEM_FLASH, MEM_REGIONS };
+static MemCurve memoryCurves[MEM_REGIONS] = {{"sram", true}, {"iram", true}, {"psram", true}, {"flash", false}};
+static uint32_t memoryCurvesMs = 0;  // durée de la dernière mesure, 0 : jamais mesurée
+
+// [OPT-031]: Banc SD (voir sd_benchmark.h) : débit séquentiel par taille de bloc,
+// IOPS 4 Ko aléatoires, latence fsync et histogrammes par opération, à chaque
+// fréquence SPI de SD_BENCH_CLOCKS_KHZ (/api/sd-benchmark)
+static const uint32_t SD_BENCH_CLOCKS[] = {SD_BENCH_CLOCKS_KHZ};
+static const uint8_t SD_BENCH_CLOCK_COUNT = sizeof(SD_BENCH_CLOCKS) / sizeof(SD_BENCH_CLOCKS[0]);
+static SdBenchmark<SD_BENCH_CLOCK_COUNT> sdBench(SD_BENCH_RANDOM_OPS, SD_BENCH_FSYNC_OPS);
+static uint32_t sdBenchFileKb = SD_BENCH_FILE_KB;  // ?size_kb= de /api/sd-benchmark
+static const char* const SD_BENCH_FILE = "/sd_bench.bin";
+// Tampon des blocs pris au premier banc puis gardé (pas de malloc de 64 Ko à
+// chaque exécution), en PSRAM quand il y en a pour ne pas immobiliser le heap interne
+static uint8_t* sdBenchBuffer = nullptr;
+static uint32_t sdBenchBufferSize = 0;
+
+// [OPT-032]: Banc I2C (voir i2c_benchmark.h) : latence d'une lecture de registre,
+// débit en rafale, NACK/erreurs et étirement d'horloge par périphérique à chaque
+// fréquence de I2C_BENCH_CLOCKS_HZ ; recommande la plus rapide sans erreur (/api/i2c-benchmark)
+static const uint32_t I2C_BENCH_CLOCKS[] = {I2C_BENCH_CLOCKS_HZ};
+static const uint8_t I2C_BENCH_CLOCK_COUNT = sizeof(I2C_BENCH_CLOCKS) / sizeof(I2C_BENCH_CLOCKS[0]);
+static I2cBenchmark<I2C_BENCH_MAX_DEVICES, I2C_BENCH_CLOCK_COUNT> i2cBench(I2C_BENCH_OPS);
+
+// [OPT-033]: Banc d'affichage (voir display_benchmark.h) : remplissage, envoi
+// d'image, rectangles et texte par pilote TFT, fréquence SPI et rotation, puis
+// rendu et envoi du buffer OLED à chaque fréquence I2C (/api/display-benchmark)
+static const uint32_t DISPLAY_BENCH_SPI[] = {DISPLAY_BENCH_SPI_HZ};
+static const uint8_t DISPLAY_BENCH_ROTATION_LIST[] = {DISPLAY_BENCH_ROTATIONS};
+static const uint8_t DISPLAY_BENCH_TFT_RUNS =
+    2 * (sizeof(DISPLAY_BENCH_SPI) / sizeof(DISPLAY_BENCH_SPI[0])) * sizeof(DISPLAY_BENCH_ROTATION_LIST);
+static DisplayBenchmark<DISPLAY_BENCH_TFT_RUNS, I2C_BENCH_CLOCK_COUNT> displayBench(DISPLAY_BENCH_FRAMES,
+                                                                                    DISPLAY_BENCH_TARGET_FPS);
+
+// [OPT-034]: Débit réseau réel (voir net_throughput.h) : téléchargement d'un motif
+// fixe depuis un bloc statique, envoi compté puis jeté, et service d'écho TCP
+// pour les temps d'aller-retour (/api/net, tools/net_bench.py)
+static_assert(NET_BENCH_CHUNK % NET_PATTERN_PERIOD == 0, "each chunk must restart the download pattern");
+static uint8_t netChunk[NET_BENCH_CHUNK];
+static NetEchoServer netEcho;
+static NetTransfer netDownload = {0, 0, 0, 0, false};
+static NetTransfer netUpload = {0, 0, 0, 0, false};
+static TaskHandle_t netEchoTaskHandle = nullptr;
+static const char* const STACK_NET_ECHO = "NetEcho";
+// Téléchargement envoyé par sa propre tâche : loop() reste libre pendant le transfert
+static TaskHandle_t netDownloadTaskHandle = nullptr;
+static const char* const STACK_NET_DOWNLOAD = "NetDownload";
+static WiFiClient netDownloadClient;  // copie du client HTTP, garde le socket ouvert
+static volatile bool netDownloadBusy = false;
 
 bool runtimeBLE = false;
 
@@ -466,8 +688,19 @@ static unsigned long button1LastChange = 0;
 static unsigned long button2LastChange = 0;
 static const unsigned long debounceMs = 30;
 static const unsigned long longPressMs = 2000;
+static const unsigned long buttonProgressFrameMs = 50;  // barre d'appui long tant que BOOT est maintenu
 static bool buttonBootLongPressTriggered = false;
 
+static void IRAM_ATTR onButtonEdge() {
+  loopEvents.signalFromISR(LOOP_BUTTONS);
+}
+
+static void attachButtonInterrupt(int pin) {
+  if (pin >= 0 && digitalPinToInterrupt(pin) != NOT_AN_INTERRUPT) {
+    attachInterrupt(digitalPinToInterrupt(pin), onButtonEdge, CHANGE);
+  }
+}
+
 static void initButtons() {
   // Bouton BOOT (GPIO 0)
   if (buttonBootPin >= 0 && buttonBootPin <= 48) {
@@ -499,6 +732,11 @@ static void initButtons() {
     pinMode(button2Pin, INPUT_PULLUP);
 #endif
   }
+
+  // Chaque front réveille loop() ; plus de lecture des boutons toutes les 10 ms
+  attachButtonInterrupt(buttonBootPin);
+  attachButtonInterrupt(button1Pin);
+  attachButtonInterrupt(button2Pin);
 }
 
 // Inline helper for NeoPixel reboot flash
@@ -605,9 +843,11 @@ static int lastProgress = -1;
 static bool frameDrawn = false;
 static bool earthbeatWasActive = false;
 
-// Fonction centrale de gestion des boutons et de la machine d'état BOOT
-static void maintainButtons() {
+// Fonction centrale de gestion des boutons et de la machine d'état BOOT.
+// Renvoie le délai avant la prochaine vérification nécessaire (0 : attendre un front).
+static uint32_t maintainButtons() {
   unsigned long now = millis();
+  uint32_t recheckMs = 0;
 
   // --- Gestion du bouton BOOT avec machine d'état ---
   if (buttonBootPin >= 0) {
@@ -732,6 +972,11 @@ static void maintainButtons() {
         break;
     }
     buttonBootLast = s;
+    if (bootState == BOOT_PROGRESS) {
+      recheckMs = buttonProgressFrameMs;
+    } else if (bootState != BOOT_NORMAL) {
+      recheckMs = 1;  // annulation ou action finale au passage suivant
+    }
   }
 
   // --- Bouton 1: Gestion appui simple pour cycle RGB ---
@@ -744,6 +989,8 @@ static void maintainButtons() {
         if (s == LOW) {
           onButton1Pressed();
         }
+      } else {
+        recheckMs = debounceMs;  // front ignoré : relire une fois le rebond passé
       }
     }
   }
@@ -758,9 +1005,12 @@ static void maintainButtons() {
         if (s == LOW) {
           onButton2Pressed();
         }
+      } else {
+        recheckMs = debounceMs;
       }
     }
   }
+  return recheckMs;
 }
 #endif
 
@@ -843,6 +1093,49 @@ struct DetailedMemoryInfo {
 
 DetailedMemoryInfo detailedMemory;
 
+// ========== TELEMETRY SNAPSHOTS ==========
+// [OPT-011]: Les endpoints en lecture seule sérialisent un instantané publié par
+// la tâche d'échantillonnage au lieu d'interroger le matériel à chaque requête.
+// Double tampon : l'échantillonneur remplit l'emplacement arrière puis bascule
+// telemetryFrontIndex sous telemetryMutex. Les lecteurs copient l'instantané sous
+// le mutex puis le rendent avant de sérialiser : un client lent ne retient jamais
+// l'échantillonneur, et la copie ne change plus pendant la réponse.
+struct TelemetrySnapshot {
+  DiagnosticInfo diag;
+  DetailedMemoryInfo memory;
+  unsigned long sampledAtMs;
+  uint32_t sequence;
+};
+
+TelemetrySnapshot telemetrySnapshots[2];
+volatile uint8_t telemetryFrontIndex = 0;
+SemaphoreHandle_t telemetryMutex = nullptr;
+TaskHandle_t telemetryTaskHandle = nullptr;
+
+class TelemetryReader {
+ public:
+  TelemetryReader() {
+    if (telemetryMutex != nullptr) {
+      xSemaphoreTake(telemetryMutex, portMAX_DELAY);
+    }
+    snapshot_ = telemetrySnapshots[telemetryFrontIndex];
+    if (telemetryMutex != nullptr) {
+      xSemaphoreGive(telemetryMutex);
+    }
+  }
+
+  const TelemetrySnapshot& snapshot() const { return snapshot_; }
+  const DiagnosticInfo& diag() const { return snapshot_.diag; }
+  const DetailedMemoryInfo& memory() const { return snapshot_.memory; }
+  unsigned long ageMs() const { return millis() - snapshot_.sampledAtMs; }
+
+ private:
+  TelemetryReader(const TelemetryReader&) = delete;
+  TelemetryReader& operator=(const TelemetryReader&) = delete;
+
+  TelemetrySnapshot snapshot_;
+};
+
 struct GPIOTestResult {
   int pin;
   bool tested;
@@ -880,6 +1173,22 @@ float heapHistory[HISTORY_SIZE];
 float tempHistory[HISTORY_SIZE];
 int historyIndex = 0;
 
+// [OPT-010]: Dotted IPv4 formatting into a caller buffer (no IPAddress::toString() String)
+static void formatIPAddress(const IPAddress& ip, char* buffer, size_t size) {
+  snprintf(buffer, size, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+}
+
+// FNV-1a 32 bits ; passer le hash précédent pour hacher par morceaux
+static const uint32_t FNV1A_OFFSET_BASIS = 2166136261UL;
+
+static uint32_t fnv1aHash(const char* data, size_t length, uint32_t hash = FNV1A_OFFSET_BASIS) {
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= static_cast<uint8_t>(data[i]);
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
 String getStableAccessURL() {
   return buildAccessUrl(getStableAccessHost());
 }
@@ -1005,7 +1314,8 @@ bool startMDNSService(bool verbose) {
 #endif
 }
 
-void maintainNetworkServices() {
+// Appelé sur événement Wi-Fi ; renvoie le délai avant un nouvel essai mDNS (0 : aucun)
+uint32_t maintainNetworkServices() {
 #if DIAGNOSTIC_HAS_MDNS
   bool wifiConnectedNow = (WiFi.status() == WL_CONNECTED);
   if (wifiConnectedNow) {
@@ -1018,9 +1328,17 @@ void maintainNetworkServices() {
     stopMDNSService("WiFi déconnecté");
   }
   wifiPreviouslyConnected = wifiConnectedNow;
+  return wifiConnectedNow && !mdnsServiceActive ? 5000 : 0;
+#else
+  return 0;
 #endif
 }
 
+static void onNetworkEvent(arduino_event_id_t event) {
+  (void)event;
+  loopEvents.signal(LOOP_NETWORK);
+}
+
 // ========== DÉTECTION MODÈLE ==========
 String detectChipModel() {
   #ifdef CONFIG_IDF_TARGET_ESP32
@@ -1173,16 +1491,20 @@ String getMemoryStatus() {
   else return Texts::critical.str();
 }
 
-const char* getWiFiSignalQualityKey() {
-  if (diagnosticData.wifiRSSI >= -50) return "excellent";
-  else if (diagnosticData.wifiRSSI >= -60) return "very_good";
-  else if (diagnosticData.wifiRSSI >= -70) return "good";
-  else if (diagnosticData.wifiRSSI >= -80) return "weak";
+const char* getWiFiSignalQualityKey(int rssi) {
+  if (rssi >= -50) return "excellent";
+  else if (rssi >= -60) return "very_good";
+  else if (rssi >= -70) return "good";
+  else if (rssi >= -80) return "weak";
   else return "very_weak";
 }
 
-String getWiFiSignalQuality() {
-  const char* key = getWiFiSignalQualityKey();
+const char* getWiFiSignalQualityKey() {
+  return getWiFiSignalQualityKey(diagnosticData.wifiRSSI);
+}
+
+String getWiFiSignalQuality(int rssi) {
+  const char* key = getWiFiSignalQualityKey(rssi);
   if (key == nullptr) {
     return Texts::unknown.str();
   }
@@ -1194,6 +1516,10 @@ String getWiFiSignalQuality() {
   return Texts::unknown.str();
 }
 
+String getWiFiSignalQuality() {
+  return getWiFiSignalQuality(diagnosticData.wifiRSSI);
+}
+
 // Use translation keys for WiFi auth modes
 String wifiAuthModeToString(wifi_auth_mode_t mode) {
   switch (mode) {
@@ -1393,89 +1719,93 @@ bool testPSRAMQuick() {
   return ok;
 }
 
-void collectDetailedMemory() {
+void collectDetailedMemory(DetailedMemoryInfo& memory) {
   uint32_t flashSizeReal;
   esp_flash_get_size(NULL, &flashSizeReal);
   
-  detailedMemory.flashSizeChip = flashSizeReal;
-  detailedMemory.flashSizeReal = ESP.getFlashChipSize();
+  memory.flashSizeChip = flashSizeReal;
+  memory.flashSizeReal = ESP.getFlashChipSize();
   
-  detailedMemory.psramTotal = ESP.getPsramSize();
-  detailedMemory.psramAvailable = (detailedMemory.psramTotal > 0);
+  memory.psramTotal = ESP.getPsramSize();
+  memory.psramAvailable = (memory.psramTotal > 0);
 
-  detailedMemory.psramConfigured = false;
-  detailedMemory.psramBoardSupported = false;
-  detailedMemory.psramType = "PSRAM";
+  memory.psramConfigured = false;
+  memory.psramBoardSupported = false;
+  memory.psramType = "PSRAM";
 
   #if defined(CONFIG_SPIRAM)
-    detailedMemory.psramConfigured = true;
-    detailedMemory.psramBoardSupported = true;
+    memory.psramConfigured = true;
+    memory.psramBoardSupported = true;
   #endif
   #if defined(CONFIG_SPIRAM_SUPPORT)
-    detailedMemory.psramConfigured = true;
-    detailedMemory.psramBoardSupported = true;
+    memory.psramConfigured = true;
+    memory.psramBoardSupported = true;
   #endif
   #if defined(BOARD_HAS_PSRAM)
-    detailedMemory.psramConfigured = true;
-    detailedMemory.psramBoardSupported = true;
+    memory.psramConfigured = true;
+    memory.psramBoardSupported = true;
   #endif
   #if defined(CONFIG_SPIRAM_MODE_OCT)
-    detailedMemory.psramConfigured = true;
-    detailedMemory.psramBoardSupported = true;
-    detailedMemory.psramType = "OPI";
+    memory.psramConfigured = true;
+    memory.psramBoardSupported = true;
+    memory.psramType = "OPI";
   #endif
   #if defined(CONFIG_SPIRAM_MODE_QUAD)
-    detailedMemory.psramConfigured = true;
-    detailedMemory.psramBoardSupported = true;
-    detailedMemory.psramType = "QSPI";
+    memory.psramConfigured = true;
+    memory.psramBoardSupported = true;
+    memory.psramType = "QSPI";
   #endif
 
-  if (detailedMemory.psramTotal == 0) {
-    detailedMemory.psramConfigured = false;
+  if (memory.psramTotal == 0) {
+    memory.psramConfigured = false;
   }
   
-  if (detailedMemory.psramAvailable) {
-    detailedMemory.psramFree = ESP.getFreePsram();
-    detailedMemory.psramUsed = detailedMemory.psramTotal - detailedMemory.psramFree;
+  if (memory.psramAvailable) {
+    memory.psramFree = ESP.getFreePsram();
+    memory.psramUsed = memory.psramTotal - memory.psramFree;
     
     multi_heap_info_t info;
     heap_caps_get_info(&info, MALLOC_CAP_SPIRAM);
-    detailedMemory.psramLargestBlock = info.largest_free_block;
+    memory.psramLargestBlock = info.largest_free_block;
   } else {
-    detailedMemory.psramFree = 0;
-    detailedMemory.psramUsed = 0;
-    detailedMemory.psramLargestBlock = 0;
+    memory.psramFree = 0;
+    memory.psramUsed = 0;
+    memory.psramLargestBlock = 0;
   }
   
   multi_heap_info_t infoInternal;
   heap_caps_get_info(&infoInternal, MALLOC_CAP_INTERNAL);
-  detailedMemory.sramTotal = infoInternal.total_free_bytes + infoInternal.total_allocated_bytes;
-  detailedMemory.sramFree = infoInternal.total_free_bytes;
-  detailedMemory.sramUsed = infoInternal.total_allocated_bytes;
-  detailedMemory.sramLargestBlock = infoInternal.largest_free_block;
+  memory.sramTotal = infoInternal.total_free_bytes + infoInternal.total_allocated_bytes;
+  memory.sramFree = infoInternal.total_free_bytes;
+  memory.sramUsed = infoInternal.total_allocated_bytes;
+  memory.sramLargestBlock = infoInternal.largest_free_block;
   
   size_t largestBlock = ESP.getMaxAllocHeap();
   size_t freeHeap = ESP.getFreeHeap();
   if (freeHeap > 0) {
-    detailedMemory.fragmentationPercent = 100.0 - (100.0 * largestBlock / freeHeap);
+    memory.fragmentationPercent = 100.0 - (100.0 * largestBlock / freeHeap);
   } else {
-    detailedMemory.fragmentationPercent = 0;
+    memory.fragmentationPercent = 0;
   }
   
-  detailedMemory.sramTestPassed = testSRAMQuick();
-  detailedMemory.psramTestPassed = testPSRAMQuick();
+  memory.sramTestPassed = testSRAMQuick();
+  memory.psramTestPassed = testPSRAMQuick();
   
-  if (detailedMemory.fragmentationPercent < 20) {
-    detailedMemory.memoryStatus = Texts::excellent.str();
-  } else if (detailedMemory.fragmentationPercent < 40) {
-    detailedMemory.memoryStatus = Texts::good.str();
-  } else if (detailedMemory.fragmentationPercent < 60) {
-    detailedMemory.memoryStatus = "Moyen"; // Pas traduit (statut technique)
+  if (memory.fragmentationPercent < 20) {
+    memory.memoryStatus = Texts::excellent.str();
+  } else if (memory.fragmentationPercent < 40) {
+    memory.memoryStatus = Texts::good.str();
+  } else if (memory.fragmentationPercent < 60) {
+    memory.memoryStatus = "Moyen"; // Pas traduit (statut technique)
   } else {
-    detailedMemory.memoryStatus = Texts::critical.str();
+    memory.memoryStatus = Texts::critical.str();
   }
 }
 
+void collectDetailedMemory() {
+  collectDetailedMemory(detailedMemory);
+}
+
 void printPSRAMDiagnostic() {
   Serial.println("\r\n=== DIAGNOSTIC PSRAM DETAILLE ===");
   Serial.printf("ESP.getPsramSize(): %u octets (%.2f MB)\r\n", 
@@ -1530,33 +1860,172 @@ void printPSRAMDiagnostic() {
 }
 
 // ========== BENCHMARKS ==========
-unsigned long benchmarkCPU() {
+// Suite complète : chaque noyau sur le coeur 0, le coeur 1, puis les deux ensemble.
+// cpuBenchmark garde son sens d'avant (temps d'un passage, en us) : somme des
+// médianes sur le coeur de l'application.
+static bool benchmarkCPU(JobContext& job) {
   Serial.println("\r\n=== BENCHMARK CPU ===");
-  unsigned long start = micros();
-  
-  volatile float result = 0;
-  for (int i = 0; i < 100000; i++) {
-    result += sqrt(i) * sin(i);
+  cpuBench.clear();
+  if (!cpuBench.begin(CPU_BENCH_TASK_PRIORITY)) {
+    Serial.println("CPU: benchmark tasks unavailable");
+    return false;
+  }
+  const uint8_t cores = cpuBench.cores();
+  const uint8_t appCore = cores - 1;
+  const uint8_t bothCores = (1 << cores) - 1;
+  const unsigned long start = millis();
+  for (uint8_t kernel = 0; kernel < CPU_KERNEL_COUNT; ++kernel) {
+    for (uint8_t core = 0; core < cores; ++core) {
+      if (testStopping() || !cpuBench.run(kernel, CpuBench::SINGLE, 1 << core, 5000)) {
+        return false;
+      }
+    }
+    if (cores > 1 && (testStopping() || !cpuBench.run(kernel, CpuBench::DUAL, bothCores, 5000))) {
+      return false;
+    }
+    const CpuKernelStats& stats = cpuBench.stats(kernel, CpuBench::SINGLE, appCore);
+    Serial.printf("  %-8s median %.2f us, p95 %.2f us, CV %.1f%%\r\n", CPU_KERNELS[kernel].name,
+                  cpuBench.toUs(stats.medianCycles), cpuBench.toUs(stats.p95Cycles), stats.cvPercent);
+    job.setProgress(static_cast<uint8_t>(5 + 25 * (kernel + 1) / CPU_KERNEL_COUNT));
+  }
+  cpuBench.finish(ESP.getCpuFreqMHz(), millis() - start);
+  Serial.printf("CPU: %.0f us (%.2f ops/us)\r\n", cpuBench.totalUs(appCore), cpuBench.score(appCore));
+  return true;
+}
+
+static uint32_t floorPowerOfTwo(uint32_t value) { return value == 0 ? 0 : 1UL << (31 - __builtin_clz(value)); }
+
+static uint32_t cycleCounter() { return ESP.getCycleCount(); }
+
+// Un point par taille de travail, de 1 Ko à maxBytes (puissance de deux)
+static bool measureMemoryCurve(MemCurve& curve, uint32_t* buffer, uint32_t maxBytes) {
+  curve.count = 0;
+  curve.maxBytes = 0;
+  if (buffer == nullptr) {
+    Serial.printf("  %-5s unavailable\r\n", curve.name);
+    return true;
+  }
+  const uint32_t mhz = ESP.getCpuFreqMHz();
+  for (uint32_t bytes = 1024; bytes <= maxBytes && curve.count < MEM_CURVE_POINTS; bytes *= 2) {
+    if (testStopping()) {
+      return false;
+    }
+    const MemoryPoint point = measureMemoryPoint(buffer, bytes, curve.writable, MEM_BENCH_REPEATS, mhz, cycleCounter);
+    curve.points[curve.count++] = point;
+    curve.maxBytes = bytes;
+    Serial.printf("  %-5s %5lu KB  read %8.1f  write %8.1f  copy %8.1f MB/s  latency %7.1f ns\r\n", curve.name,
+                  static_cast<unsigned long>(bytes / 1024), point.readMBps, point.writeMBps, point.copyMBps,
+                  point.latencyNs);
   }
+  return true;
+}
 
-  unsigned long duration = micros() - start;
-  Serial.printf("CPU: %lu us (%.2f MFLOPS)\r\n", duration, 100000.0 / duration);
-  return duration;
+// Tampon alloué le temps de la mesure : la moitié du plus grand bloc libre, au plus limit
+static bool measureHeapRegion(MemCurve& curve, uint32_t caps, uint32_t limit) {
+  const uint32_t bytes = min(limit, floorPowerOfTwo(heap_caps_get_largest_free_block(caps) / 2));
+  uint32_t* buffer = bytes >= 1024 ? static_cast<uint32_t*>(heap_caps_malloc(bytes, caps)) : nullptr;
+  const bool completed = measureMemoryCurve(curve, buffer, bytes);
+  heap_caps_free(buffer);
+  return completed;
+}
+
+// Données en flash : le début de la partition de l'application, mappé via le cache
+static bool measureFlashRegion(MemCurve& curve, uint32_t limit) {
+  const esp_partition_t* app = esp_ota_get_running_partition();
+  const uint32_t bytes = app != nullptr ? min(limit, floorPowerOfTwo(app->size)) : 0;
+  const void* mapped = nullptr;
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  esp_partition_mmap_handle_t handle;
+  const bool ok = bytes >= 1024 && esp_partition_mmap(app, 0, bytes, ESP_PARTITION_MMAP_DATA, &mapped, &handle) == ESP_OK;
+#else
+  spi_flash_mmap_handle_t handle;
+  const bool ok = bytes >= 1024 && esp_partition_mmap(app, 0, bytes, SPI_FLASH_MMAP_DATA, &mapped, &handle) == ESP_OK;
+#endif
+  // Lecture seule : measureMemoryPoint() n'écrit pas quand curve.writable est faux
+  const bool completed =
+      measureMemoryCurve(curve, ok ? const_cast<uint32_t*>(static_cast<const uint32_t*>(mapped)) : nullptr, bytes);
+  if (ok) {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+    esp_partition_munmap(handle);
+#else
+    spi_flash_munmap(handle);
+#endif
+  }
+  return completed;
+}
+
+static bool benchmarkMemoryHierarchy(JobContext& job) {
+  Serial.println("=== BENCHMARK HIERARCHIE MEMOIRE ===");
+  memoryCurvesMs = 0;
+  const unsigned long start = millis();
+  bool completed = measureHeapRegion(memoryCurves[MEM_SRAM], MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, MEM_BENCH_SRAM_MAX);
+  job.setProgress(35);
+  // IRAM : accès 32 bits uniquement (ESP32) ; indisponible quand la protection mémoire l'interdit
+  completed = completed && measureHeapRegion(memoryCurves[MEM_IRAM], MALLOC_CAP_EXEC, MEM_BENCH_IRAM_MAX);
+  job.setProgress(40);
+  completed = completed && measureHeapRegion(memoryCurves[MEM_PSRAM], MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+                                             psramFound() ? MEM_BENCH_PSRAM_MAX : 0);
+  job.setProgress(55);
+  completed = completed && measureFlashRegion(memoryCurves[MEM_FLASH], MEM_BENCH_FLASH_MAX);
+  job.setProgress(65);
+  if (completed) {
+    memoryCurvesMs = max(1UL, millis() - start);
+  }
+  return completed;
+}
+
+// {"duration_ms","repeats","line_bytes","regions":[{"name","writable","max_bytes","latency_method","points":[...]}]}
+static void writeMemoryHierarchy(DataWriter& out) {
+  out.field("duration_ms", memoryCurvesMs);
+  out.field("repeats", MEM_BENCH_REPEATS);
+  out.field("line_bytes", MEM_BENCH_LINE);
+  out.beginArray("regions");
+  for (const MemCurve& curve : memoryCurves) {
+    out.beginObject();
+    out.field("name", curve.name);
+    out.field("writable", curve.writable);
+    out.field("max_bytes", curve.maxBytes);
+    out.field("latency_method", curve.writable ? "pointer_chase" : "dependent_index");
+    out.beginArray("points");
+    for (uint8_t i = 0; i < curve.count; ++i) {
+      const MemoryPoint& point = curve.points[i];
+      out.beginObject();
+      out.field("bytes", point.bytes);
+      out.fieldFloat("read_mbps", point.readMBps, 1);
+      if (curve.writable) {
+        out.fieldFloat("write_mbps", point.writeMBps, 1);
+        out.fieldFloat("copy_mbps", point.copyMBps, 1);
+      }
+      out.fieldFloat("latency_ns", point.latencyNs, 1);
+      out.endObject();
+    }
+    out.endArray();
+    out.endObject();
+  }
+  out.endArray();
 }
 
 unsigned long benchmarkMemory() {
   Serial.println("=== BENCHMARK MEMOIRE ===");
   unsigned long start = micros();
 
-  const int size = 10000;
-  int* testArray = (int*)malloc(size * sizeof(int));
-  if (!testArray) return 0;
+  // Même volume (10000 écritures puis 10000 lectures) par blocs d'un tampon du pool
+  TestBuffer buffer(workBuffers);
+  if (!buffer) return 0;
+  int* testArray = buffer.as<int>();
+  const int chunk = TestBuffer::size() / sizeof(int);
 
-  for (int i = 0; i < size; i++) testArray[i] = i;
+  const int size = 10000;
+  for (int done = 0; done < size; done += chunk) {
+    const int count = min(chunk, size - done);
+    for (int i = 0; i < count; i++) testArray[i] = done + i;
+  }
   volatile int sum = 0;
-  for (int i = 0; i < size; i++) sum += testArray[i];
-  
-  free(testArray);
+  for (int done = 0; done < size; done += chunk) {
+    const int count = min(chunk, size - done);
+    for (int i = 0; i < count; i++) sum += testArray[i];
+  }
+
   unsigned long duration = micros() - start;
   Serial.printf("Memory: %lu us\r\n", duration);
   return duration;
@@ -1571,7 +2040,8 @@ void ensureI2CBusConfigured() {
 #else
   Wire.begin(i2c_sda, i2c_scl);
 #endif
-  Wire.setClock(400000);
+  Wire.setClock(i2cClockHz);
+  oled.setBusClock(i2cClockHz);  // U8g2 règle l'horloge à chaque transfert
 }
 
 void scanI2C() {
@@ -1601,6 +2071,39 @@ void scanI2C() {
   Serial.printf("I2C: %d peripherique(s)\r\n", diagnosticData.i2cCount);
 }
 
+// Détection à la fréquence la plus lente, puis chaque fréquence du banc ; revient à i2cClockHz
+static bool runI2cBenchmark(JobContext& job) {
+  Serial.println("\r\n=== BENCHMARK I2C ===");
+  ensureI2CBusConfigured();
+  uint32_t slowest = I2C_BENCH_CLOCKS[0];
+  for (uint32_t hz : I2C_BENCH_CLOCKS) {
+    slowest = min(slowest, hz);
+  }
+  Wire.setClock(slowest);
+  const uint8_t devices = i2cBench.discover(Wire, SCREEN_ADDRESS);
+  Serial.printf("I2C: SDA=%d, SCL=%d, %u peripherique(s)\r\n", i2c_sda, i2c_scl, devices);
+  bool stopped = false;
+  for (uint8_t i = 0; i < I2C_BENCH_CLOCK_COUNT && !stopped; ++i) {
+    const uint32_t hz = I2C_BENCH_CLOCKS[i];
+    Wire.setClock(hz);
+    stopped = !i2cBench.runClock(Wire, hz, testStopping);
+    if (!stopped) {
+      Serial.printf("  %lu kHz: %s\r\n", static_cast<unsigned long>(hz / 1000),
+                    i2cBench.reliable(i2cBench.clockCount() - 1) ? "OK" : "NACK/erreurs");
+    }
+    job.setProgress(static_cast<uint8_t>(5 + 90 * (i + 1) / I2C_BENCH_CLOCK_COUNT));
+  }
+  ensureI2CBusConfigured();
+  if (stopped) {
+    return false;
+  }
+  i2cBench.finish();
+  Serial.printf("I2C: frequence recommandee %lu kHz (actuelle %lu kHz)\r\n",
+                static_cast<unsigned long>(i2cBench.recommendedHz() / 1000),
+                static_cast<unsigned long>(i2cClockHz / 1000));
+  return true;
+}
+
 // ========== SCAN WIFI ==========
 void scanWiFiNetworks() {
   Serial.println("\r\n=== SCAN WIFI ===");
@@ -1725,7 +2228,6 @@ bool testSingleGPIO(int pin) {
 
 void testAllGPIOs() {
   Serial.println("\r\n=== TEST GPIO ===");
-  gpioResults.clear();
   
   #ifdef CONFIG_IDF_TARGET_ESP32
     int gpios[] = {0,2,4,5,12,13,14,15,16,17,18,19,21,22,23,25,26,27,32,33};
@@ -1741,15 +2243,16 @@ void testAllGPIOs() {
     int numGPIO = 4;
   #endif
   
+  // Entrées réutilisées d'un test à l'autre : les String gardent leur tampon
+  gpioResults.resize(numGPIO);
   for (int i = 0; i < numGPIO; i++) {
-    GPIOTestResult result;
+    GPIOTestResult& result = gpioResults[i];
     result.pin = gpios[i];
     result.tested = true;
     result.working = testSingleGPIO(gpios[i]);
     result.mode = "Digital I/O";
     // [OPT-009]: Use pre-allocated constants instead of String(Texts::ok/fail)
     result.notes = result.working ? OK_STR : FAIL_STR;
-    gpioResults.push_back(result);
   }
   Serial.printf("GPIO: %d testes\r\n", numGPIO);
 }
@@ -1780,25 +2283,29 @@ void testBuiltinLED() {
   Serial.println("\r\n=== TEST LED ===");
   pinMode(BUILTIN_LED_PIN, OUTPUT);
 
-  for (int i = 0; i < 5; i++) {
+  bool completed = true;
+  for (int i = 0; i < 5 && completed; i++) {
     digitalWrite(BUILTIN_LED_PIN, HIGH);
-    delay(80);
+    completed = testPause(80);
     digitalWrite(BUILTIN_LED_PIN, LOW);
-    delay(80);
+    completed = completed && testPause(80);
   }
 
-  for (int i = 0; i <= 255; i += 51) {
+  for (int i = 0; i <= 255 && completed; i += 51) {
     analogWrite(BUILTIN_LED_PIN, i);
-    delay(25);
-    yield();
+    completed = testPause(25);
   }
-  for (int i = 255; i >= 0; i -= 51) {
+  for (int i = 255; i >= 0 && completed; i -= 51) {
     analogWrite(BUILTIN_LED_PIN, i);
-    delay(25);
-    yield();
+    completed = testPause(25);
   }
   
   digitalWrite(BUILTIN_LED_PIN, LOW);
+  if (!completed) {
+    builtinLedTestResult = String(Texts::test_cancelled);
+    Serial.println("LED: annule");
+    return;
+  }
   builtinLedAvailable = true;
   // [OPT-009]: Buffer-based test result (1 vs 4 allocations)
   char ledBuf[96];
@@ -1852,27 +2359,27 @@ void testNeoPixel() {
   strip->clear();
   strip->show();
 
-  strip->setPixelColor(0, strip->Color(255, 0, 0));
-  strip->show();
-  delay(160);
-
-  strip->setPixelColor(0, strip->Color(0, 255, 0));
-  strip->show();
-  delay(160);
-
-  strip->setPixelColor(0, strip->Color(0, 0, 255));
-  strip->show();
-  delay(160);
+  const uint32_t primaries[] = {strip->Color(255, 0, 0), strip->Color(0, 255, 0), strip->Color(0, 0, 255)};
+  bool completed = true;
+  for (size_t i = 0; i < sizeof(primaries) / sizeof(primaries[0]) && completed; i++) {
+    strip->setPixelColor(0, primaries[i]);
+    strip->show();
+    completed = testPause(160);
+  }
 
-  for (int i = 0; i < 256; i += 64) {
+  for (int i = 0; i < 256 && completed; i += 64) {
     strip->setPixelColor(0, strip->gamma32(strip->ColorHSV(i * 256)));
     strip->show();
-    delay(28);
-    yield();
+    completed = testPause(28);
   }
 
   strip->clear();
   strip->show();
+  if (!completed) {
+    neopixelTestResult = String(Texts::test_cancelled);
+    Serial.println("NeoPixel: annule");
+    return;
+  }
 
   neopixelAvailable = true;
   // [OPT-009]: Buffer-based test result (1 vs 4 allocations)
@@ -1904,6 +2411,7 @@ void neopixelResumeStatus() {
   neopixelStatusPaused = false;
   neopixelStatusKnown = false;
   neopixelConnecting = false;
+  loopEvents.signal(LOOP_LEDS);  // le battement reprend depuis loop()
 }
 
 void neopixelShowConnecting() {
@@ -1919,39 +2427,43 @@ void neopixelSetWifiState(bool connected) {
   neopixelConnecting = false;
   neopixelLastWifiConnected = connected;
   neopixelStatusKnown = true;
-  neopixelHeartbeatPreviousMillis = millis();
-  neopixelHeartbeatState = false;
+  neopixelHeartbeatBrightness = 0;
   strip->setBrightness(60);
   strip->setPixelColor(0, connected ? strip->Color(0, 50, 0) : strip->Color(50, 0, 0));
   strip->show();
 }
 
-void updateNeoPixelWifiStatus() {
-  if (!neopixelReady() || neopixelStatusPaused) return;
-  if (neopixelConnecting) return; // Couleur fixe tant que la connexion est en cours
+// Une image du battement (fondu vert si connecté, rouge sinon), calculée en
+// entiers depuis millis() ; show() seulement si la luminosité change.
+// Renvoie le délai avant l'image suivante (0 : pause ou connexion en cours).
+uint32_t updateNeoPixelWifiStatus() {
+  if (!neopixelReady() || neopixelStatusPaused) return 0;
+  if (neopixelConnecting) return 0; // Couleur fixe tant que la connexion est en cours
 
   bool connected = (WiFi.status() == WL_CONNECTED);
 
   if (!neopixelStatusKnown || connected != neopixelLastWifiConnected) {
     neopixelSetWifiState(connected);
-    return;
   }
 
-  unsigned long now = millis();
-  if (now - neopixelHeartbeatPreviousMillis >= NEOPIXEL_HEARTBEAT_INTERVAL_MS) {
-    neopixelHeartbeatPreviousMillis = now;
-    neopixelHeartbeatState = !neopixelHeartbeatState;
-    uint32_t color = connected
-      ? (neopixelHeartbeatState ? strip->Color(0, 50, 0) : strip->Color(0, 10, 0))
-      : (neopixelHeartbeatState ? strip->Color(50, 0, 0) : strip->Color(10, 0, 0));
-    strip->setPixelColor(0, color);
+  const unsigned long position = millis() % (2 * NEOPIXEL_HEARTBEAT_FADE_PERIOD_MS);
+  const unsigned long ramp = position < NEOPIXEL_HEARTBEAT_FADE_PERIOD_MS
+                                 ? position
+                                 : 2 * NEOPIXEL_HEARTBEAT_FADE_PERIOD_MS - position;
+  const uint8_t brightness = NEOPIXEL_HEARTBEAT_BRIGHTNESS_MIN +
+      (NEOPIXEL_HEARTBEAT_BRIGHTNESS_MAX - NEOPIXEL_HEARTBEAT_BRIGHTNESS_MIN) * ramp / NEOPIXEL_HEARTBEAT_FADE_PERIOD_MS;
+  if (brightness != neopixelHeartbeatBrightness) {
+    neopixelHeartbeatBrightness = brightness;
+    strip->setBrightness(brightness);
+    strip->setPixelColor(0, connected ? strip->Color(0, brightness, 0) : strip->Color(brightness, 0, 0));
     strip->show();
   }
+  return NEOPIXEL_HEARTBEAT_FRAME_MS;
 }
 
+// Peut être appelé depuis un worker : le rendu reste dans loop()
 void neopixelRestoreWifiStatus() {
   neopixelResumeStatus();
-  updateNeoPixelWifiStatus();
 }
 
 void neopixelShowRebootFlash() {
@@ -1969,7 +2481,11 @@ void neopixelRainbow() {
       strip->setPixelColor(j, strip->gamma32(strip->ColorHSV(i * 256)));
     }
     strip->show();
-    delay(10);
+    if (!testPause(10)) {
+      strip->clear();
+      strip->show();
+      return;
+    }
   }
 }
 
@@ -1978,26 +2494,33 @@ void neopixelBlink(uint32_t color, int times) {
   for (int i = 0; i < times; i++) {
     strip->fill(color);
     strip->show();
-    delay(120);
+    const bool lit = testPause(120);
     strip->clear();
     strip->show();
-    delay(120);
+    if (!lit || !testPause(120)) {
+      return;
+    }
   }
 }
 
 void neopixelFade(uint32_t color) {
   if (!strip) return;
-  for (int brightness = 0; brightness <= 255; brightness += 5) {
+  bool completed = true;
+  for (int brightness = 0; brightness <= 255 && completed; brightness += 5) {
     strip->setBrightness(brightness);
     strip->fill(color);
     strip->show();
-    delay(20);
+    completed = testPause(20);
   }
-  for (int brightness = 255; brightness >= 0; brightness -= 5) {
+  for (int brightness = 255; brightness >= 0 && completed; brightness -= 5) {
     strip->setBrightness(brightness);
     strip->fill(color);
     strip->show();
-    delay(20);
+    completed = testPause(20);
+  }
+  if (!completed) {
+    strip->clear();
+    strip->show();
   }
   strip->setBrightness(255);
 }
@@ -2014,9 +2537,10 @@ void neopixelChase() {
   };
   int numColors = sizeof(colors) / sizeof(colors[0]);
 
-  for (int cycle = 0; cycle < 3; cycle++) {
-    for (int colorIndex = 0; colorIndex < numColors; colorIndex++) {
-      for (int pos = 0; pos < LED_COUNT; pos++) {
+  bool completed = true;
+  for (int cycle = 0; cycle < 3 && completed; cycle++) {
+    for (int colorIndex = 0; colorIndex < numColors && completed; colorIndex++) {
+      for (int pos = 0; pos < LED_COUNT && completed; pos++) {
         strip->clear();
         for (int i = 0; i < LED_COUNT; i++) {
           if ((i + pos) % 3 == 0) {
@@ -2024,7 +2548,7 @@ void neopixelChase() {
           }
         }
         strip->show();
-        delay(100);
+        completed = testPause(100);
       }
     }
   }
@@ -2086,7 +2610,7 @@ void oledStepWelcome() {
   snprintf(buf, sizeof(buf), "SDA:%d SCL:%d", i2c_sda, i2c_scl);
   oled.drawStr(0, 60, buf);
   oled.sendBuffer();
-  delay(700);
+  testPause(700);
 }
 
 void oledStepBigText() {
@@ -2096,7 +2620,7 @@ void oledStepBigText() {
   oled.setFont(u8g2_font_ncenB14_tr);
   oled.drawStr(20, 35, "ESP32");
   oled.sendBuffer();
-  delay(450);
+  testPause(450);
 }
 
 void oledStepTextSizes() {
@@ -2110,7 +2634,7 @@ void oledStepTextSizes() {
   oled.setFont(u8g2_font_6x10_tf);
   oled.drawStr(0, 50, "Retour taille 1");
   oled.sendBuffer();
-  delay(550);
+  testPause(550);
 }
 
 void oledStepShapes() {
@@ -2123,7 +2647,7 @@ void oledStepShapes() {
   oled.drawDisc(65, 50, 10);
   oled.drawTriangle(95, 30, 85, 10, 105, 10);
   oled.sendBuffer();
-  delay(550);
+  testPause(550);
 }
 
 void oledStepHorizontalLines() {
@@ -2134,7 +2658,7 @@ void oledStepHorizontalLines() {
     oled.drawLine(0, i, SCREEN_WIDTH - 1, i);
   }
   oled.sendBuffer();
-  delay(350);
+  testPause(350);
 }
 
 void oledStepDiagonals() {
@@ -2146,7 +2670,7 @@ void oledStepDiagonals() {
     oled.drawLine(SCREEN_WIDTH - 1, 0, i, SCREEN_HEIGHT - 1);
   }
   oled.sendBuffer();
-  delay(350);
+  testPause(350);
 }
 
 void oledStepMovingSquare() {
@@ -2156,8 +2680,9 @@ void oledStepMovingSquare() {
     oled.clearBuffer();
     oled.drawBox(x, 22, 20, 20);
     oled.sendBuffer();
-    delay(12);
-    yield();
+    if (!testPause(12)) {
+      break;
+    }
   }
 }
 
@@ -2180,10 +2705,11 @@ void oledStepProgressBar() {
     snprintf(buf, sizeof(buf), "%d%%", i);
     oled.drawStr(45, 55, buf);
     oled.sendBuffer();
-    delay(45);
-    yield();
+    if (!testPause(45)) {
+      return;
+    }
   }
-  delay(300);
+  testPause(300);
 }
 
 void oledStepScrollText() {
@@ -2197,8 +2723,9 @@ void oledStepScrollText() {
     oled.setCursor(-offset, 35);
     oled.print(scrollText);
     oled.sendBuffer();
-    delay(12);
-    yield();
+    if (!testPause(12)) {
+      break;
+    }
   }
 }
 
@@ -2210,7 +2737,7 @@ void oledStepFinalMessage() {
   oled.drawStr(30, 30, "TEST OK!");
   oled.drawFrame(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
   oled.sendBuffer();
-  delay(600);
+  testPause(600);
   oled.clearBuffer();
   oled.sendBuffer();
 }
@@ -2266,16 +2793,20 @@ void testOLED() {
 
   Serial.println("\r\n=== TEST OLED ===");
 
-  oledStepWelcome();
-  oledStepBigText();
-  oledStepTextSizes();
-  oledStepShapes();
-  oledStepHorizontalLines();
-  oledStepDiagonals();
-  oledStepMovingSquare();
-  oledStepProgressBar();
-  oledStepScrollText();
-  oledStepFinalMessage();
+  static void (*const steps[])() = {
+    oledStepWelcome, oledStepBigText, oledStepTextSizes, oledStepShapes, oledStepHorizontalLines,
+    oledStepDiagonals, oledStepMovingSquare, oledStepProgressBar, oledStepScrollText, oledStepFinalMessage
+  };
+  for (auto step : steps) {
+    step();
+    if (testStopping()) {
+      oled.clearBuffer();
+      oled.sendBuffer();
+      oledTestResult = String(Texts::test_cancelled);
+      Serial.println("OLED: annule\r\n");
+      return;
+    }
+  }
 
   oledTested = true;
   // [OPT-009]: Buffer-based test result (1 vs 3 allocations)
@@ -2352,7 +2883,7 @@ void tftStepBoot() {
 #if ENABLE_TFT_DISPLAY
   if (!tftAvailable) return;
   displayBootSplash();
-  delay(1000);
+  testPause(1000);
 #endif
 }
 
@@ -2369,7 +2900,9 @@ void tftStepColors() {
     tft->setTextSize(2);
     tft->setCursor(60, 110);
     tft->print(names[i]);
-    delay(500);
+    if (!testPause(500)) {
+      return;
+    }
   }
 #endif
 }
@@ -2392,7 +2925,7 @@ void tftStepShapes() {
   tft->drawTriangle(60, 180, 40, 220, 80, 220, TFT_CYAN);
   tft->fillTriangle(180, 180, 160, 220, 200, 220, TFT_MAGENTA);
   
-  delay(1500);
+  testPause(1500);
 #endif
 }
 
@@ -2420,7 +2953,7 @@ void tftStepText() {
   tft->setCursor(10, 140);
   tft->println("Colored Text");
   
-  delay(1500);
+  testPause(1500);
 #endif
 }
 
@@ -2434,7 +2967,7 @@ void tftStepLines() {
   for (int y = 0; y < TFT_HEIGHT; y += 10) {
     tft->drawFastHLine(0, y, TFT_WIDTH, TFT_CYAN);
   }
-  delay(700);
+  if (!testPause(700)) return;
   
   tft->fillScreen(TFT_BLACK);
   
@@ -2442,7 +2975,7 @@ void tftStepLines() {
   for (int x = 0; x < TFT_WIDTH; x += 10) {
     tft->drawFastVLine(x, 0, TFT_HEIGHT, TFT_MAGENTA);
   }
-  delay(700);
+  if (!testPause(700)) return;
   
   tft->fillScreen(TFT_BLACK);
   
@@ -2451,7 +2984,7 @@ void tftStepLines() {
     tft->drawLine(0, 0, i, TFT_HEIGHT - 1, TFT_YELLOW);
     tft->drawLine(TFT_WIDTH - 1, 0, i, TFT_HEIGHT - 1, TFT_GREEN);
   }
-  delay(700);
+  testPause(700);
 #endif
 }
 
@@ -2465,14 +2998,14 @@ void tftStepAnimation() {
   int squareSize = 30;
   for (int x = 0; x <= TFT_WIDTH - squareSize; x += 5) {
     tft->fillRect(x, (TFT_HEIGHT - squareSize) / 2, squareSize, squareSize, TFT_BLUE);
-    delay(20);
+    const bool running = testPause(20);
     if (x + squareSize < TFT_WIDTH) {
       tft->fillRect(x, (TFT_HEIGHT - squareSize) / 2, squareSize, squareSize, TFT_BLACK);
     }
-    yield();
+    if (!running) return;
   }
   
-  delay(500);
+  testPause(500);
 #endif
 }
 
@@ -2505,11 +3038,10 @@ void tftStepProgressBar() {
     tft->print(i);
     tft->print("%");
     
-    delay(30);
-    yield();
+    if (!testPause(30)) return;
   }
   
-  delay(500);
+  testPause(500);
 #endif
 }
 
@@ -2533,7 +3065,7 @@ void tftStepFinal() {
   tft->setCursor(108, 172);
   tft->print("OK");
   
-  delay(2000);
+  testPause(2000);
 #endif
 }
 
@@ -2590,20 +3122,78 @@ void testTFT() {
 
   Serial.println("\r\n=== TEST TFT ===");
 
-  tftStepBoot();
-  tftStepColors();
-  tftStepShapes();
-  tftStepText();
-  tftStepLines();
-  tftStepAnimation();
-  tftStepProgressBar();
-  tftStepFinal();
+  static void (*const steps[])() = {
+    tftStepBoot, tftStepColors, tftStepShapes, tftStepText, tftStepLines, tftStepAnimation, tftStepProgressBar,
+    tftStepFinal
+  };
+  for (auto step : steps) {
+    step();
+    if (testStopping()) {
+      tft->fillScreen(TFT_BLACK);
+      tftTestResult = String(Texts::test_cancelled);
+      Serial.println("TFT: annule\r\n");
+      return;
+    }
+  }
 
   tftTestResult = "OK - Tests complets";
   Serial.println("TFT: Tests complets OK\r\n");
 #endif
 }
 
+// Chaque pilote TFT (dalle réinitialisée), puis l'OLED ; rétablit ensuite le
+// pilote, la rotation et les fréquences d'origine
+static bool runDisplayBenchmark(JobContext& job) {
+  Serial.println("\r\n=== BENCHMARK AFFICHAGE ===");
+  displayBench.begin();
+  const uint8_t steps = DISPLAY_BENCH_TFT_RUNS + I2C_BENCH_CLOCK_COUNT;
+  uint8_t done = 0;
+  bool stopped = false;
+#if ENABLE_TFT_DISPLAY
+  if (tftAvailable) {
+    static const TFT_DriverType DRIVERS[] = {TFT_DRIVER_ILI9341, TFT_DRIVER_ST7789};
+    const TFT_DriverType original = currentTFTDriver;
+    const uint32_t stripPixels = static_cast<uint32_t>(max(tftWidth, tftHeight)) * DISPLAY_BENCH_STRIP_ROWS;
+    uint16_t* strip = static_cast<uint16_t*>(malloc(stripPixels * sizeof(uint16_t)));
+    for (uint8_t d = 0; d < 2 && strip != nullptr && !stopped; ++d) {
+      initTFT(DRIVERS[d], tftWidth, tftHeight, tftRotation);
+      Adafruit_SPITFT* panel =
+          DRIVERS[d] == TFT_DRIVER_ILI9341 ? static_cast<Adafruit_SPITFT*>(tft_ili9341) : tft_st7789;
+      for (uint8_t i = 0; i < DISPLAY_BENCH_TFT_RUNS / 2 && !stopped; ++i) {
+        const uint32_t hz = DISPLAY_BENCH_SPI[i / sizeof(DISPLAY_BENCH_ROTATION_LIST)];
+        const uint8_t rotation = DISPLAY_BENCH_ROTATION_LIST[i % sizeof(DISPLAY_BENCH_ROTATION_LIST)];
+        panel->setSPISpeed(hz);
+        stopped = !displayBench.runTft(*panel, getTFTDriverName(), DRIVERS[d] == original, hz, rotation, strip,
+                                       stripPixels, testStopping);
+        const auto& run = displayBench.tftRun(displayBench.tftCount() - 1);
+        Serial.printf("  %s %lu kHz r%u: fill %lu us, push %.1f fps, %lu rects/%lu us, text %lu us\r\n",
+                      run.driver, static_cast<unsigned long>(hz / 1000), rotation,
+                      static_cast<unsigned long>(run.fillUs), displayBench.fps(run.pushUs),
+                      static_cast<unsigned long>(displayBench.RECTS_PER_SAMPLE), static_cast<unsigned long>(run.rectsUs),
+                      static_cast<unsigned long>(run.textUs));
+        job.setProgress(static_cast<uint8_t>(5 + 90 * ++done / steps));
+      }
+    }
+    free(strip);
+    initTFT(original, tftWidth, tftHeight, tftRotation);
+  }
+#endif
+  if (oledAvailable) {
+    for (uint8_t i = 0; i < I2C_BENCH_CLOCK_COUNT && !stopped; ++i) {
+      displayBench.runOled(oled, u8g2_font_6x10_tf, I2C_BENCH_CLOCKS[i]);
+      stopped = testStopping();
+      job.setProgress(static_cast<uint8_t>(5 + 90 * ++done / steps));
+    }
+    oled.setBusClock(i2cClockHz);
+    Wire.setClock(i2cClockHz);
+  }
+  if (stopped) {
+    return false;
+  }
+  displayBench.finish();
+  return true;
+}
+
 // ========== TEST ADC ==========
 void testADC() {
   Serial.println("\r\n=== TEST ADC ===");
@@ -2641,15 +3231,20 @@ void testADC() {
 }
 
 // ========== TEST PWM ==========
+// Broche fixe du test PWM (LED de la carte), aussi déclarée par le job "pwm"
+static int pwmTestPin() {
+#ifdef CONFIG_IDF_TARGET_ESP32S3
+  return 48;
+#elif defined(CONFIG_IDF_TARGET_ESP32C3)
+  return 8;
+#else
+  return 2;
+#endif
+}
+
 void testPWM() {
   Serial.println("\r\n=== TEST PWM ===");
-  int testPin = 2;
-
-  #ifdef CONFIG_IDF_TARGET_ESP32S3
-    testPin = 48;
-  #elif defined(CONFIG_IDF_TARGET_ESP32C3)
-    testPin = 8;
-  #endif
+  const int testPin = pwmTestPin();
 
   Serial.printf("Test PWM sur GPIO%d\r\n", testPin);
 
@@ -2658,15 +3253,22 @@ void testPWM() {
   ledcSetup(pwmChannel, 5000, 8);       // channel, freq, resolution
   ledcAttachPin(testPin, pwmChannel);    // pin, channel
 
-  for (int duty = 0; duty <= 255; duty += 51) {
+  bool completed = true;
+  for (int duty = 0; duty <= 255 && completed; duty += 51) {
     ledcWrite(pwmChannel, duty);         // channel, duty
     Serial.printf("PWM duty: %d/255\r\n", duty);
-    delay(80);
-    yield();
+    completed = testPause(80);
   }
 
   ledcWrite(pwmChannel, 0);
   ledcDetachPin(testPin);                // pin
+  if (!completed) {
+    pinMode(testPin, OUTPUT);
+    digitalWrite(testPin, LOW);
+    pwmTestResult = String(Texts::test_cancelled);
+    Serial.println("PWM: annule");
+    return;
+  }
 
   // [OPT-009]: Buffer-based test result (1 vs 4 allocations)
   char pwmBuf[96];
@@ -2745,19 +3347,19 @@ void testRGBLed() {
   digitalWrite(rgb_led_pin_r, LOW);
   digitalWrite(rgb_led_pin_g, LOW);
   digitalWrite(rgb_led_pin_b, LOW);
-  delay(120);
-
-  digitalWrite(rgb_led_pin_r, HIGH);
-  delay(150);
-  digitalWrite(rgb_led_pin_r, LOW);
-
-  digitalWrite(rgb_led_pin_g, HIGH);
-  delay(150);
-  digitalWrite(rgb_led_pin_g, LOW);
+  bool completed = testPause(120);
 
-  digitalWrite(rgb_led_pin_b, HIGH);
-  delay(150);
-  digitalWrite(rgb_led_pin_b, LOW);
+  const int channels[] = {rgb_led_pin_r, rgb_led_pin_g, rgb_led_pin_b};
+  for (int i = 0; i < 3 && completed; i++) {
+    digitalWrite(channels[i], HIGH);
+    completed = testPause(150);
+    digitalWrite(channels[i], LOW);
+  }
+  if (!completed) {
+    rgbLedTestResult = String(Texts::test_cancelled);
+    Serial.println("LED RGB: annule");
+    return;
+  }
 
   rgbLedTestResult = OK_STR;
   rgbLedAvailable = true;
@@ -2786,13 +3388,19 @@ void testBuzzer() {
   pinMode(buzzer_pin, OUTPUT);
   Serial.printf("Test Buzzer - Pin:%d\r\n", buzzer_pin);
 
-  tone(buzzer_pin, 1000, 160);
-  delay(220);
-  tone(buzzer_pin, 1500, 160);
-  delay(220);
-  tone(buzzer_pin, 2000, 160);
-  delay(220);
+  const int frequencies[] = {1000, 1500, 2000};
+  bool completed = true;
+  for (int i = 0; i < 3 && completed; i++) {
+    tone(buzzer_pin, frequencies[i], 160);
+    completed = testPause(220);
+  }
   noTone(buzzer_pin);
+  if (!completed) {
+    digitalWrite(buzzer_pin, LOW);
+    buzzerTestResult = String(Texts::test_cancelled);
+    Serial.println("Buzzer: annule");
+    return;
+  }
 
   buzzerTestResult = OK_STR;
   buzzerAvailable = true;
@@ -3121,10 +3729,15 @@ void testSD() {
     return;
   }
 
-  String readData = file.readStringUntil('\n');
+  char readData[32];
+  const size_t readLength = file.readBytesUntil('\n', readData, sizeof(readData) - 1);
+  readData[readLength] = '\0';
   file.close();
+  if (readLength > 0 && readData[readLength - 1] == '\r') {
+    readData[readLength - 1] = '\0';  // println() écrit "\r\n"
+  }
 
-  if (readData == testData) {
+  if (strcmp(readData, testData) == 0) {
     uint64_t totalBytes = SD.totalBytes() / (1024 * 1024);
     uint64_t usedBytes = SD.usedBytes() / (1024 * 1024);
 
@@ -3157,6 +3770,67 @@ String getSDInfo() {
   return info;
 }
 
+// Un tampon plus petit que le plus grand bloc (heap juste au premier passage) est
+// rendu et redemandé au banc suivant ; les blocs plus grands que lui sont sautés
+static bool acquireSdBenchBuffer() {
+  const uint32_t largest = SD_BENCH_BLOCKS[SD_BENCH_BLOCK_COUNT - 1];
+  if (sdBenchBuffer != nullptr && sdBenchBufferSize >= largest) {
+    return true;
+  }
+  heap_caps_free(sdBenchBuffer);
+  sdBenchBuffer = nullptr;
+  sdBenchBufferSize = 0;
+  for (uint32_t size = largest; size >= SD_BENCH_BLOCKS[0] && sdBenchBuffer == nullptr; size /= 2) {
+    sdBenchBuffer = static_cast<uint8_t*>(heap_caps_malloc_prefer(size, 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+                                                                  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    sdBenchBufferSize = sdBenchBuffer != nullptr ? size : 0;
+  }
+  return sdBenchBuffer != nullptr;
+}
+
+// Remonte la carte à chaque fréquence du banc, puis revient à la fréquence par défaut
+static bool runSdBenchmark(JobContext& job) {
+  Serial.println("\r\n=== BENCHMARK SD ===");
+  if (!initSD()) {
+    return false;
+  }
+  if (!acquireSdBenchBuffer()) {
+    return false;
+  }
+  uint8_t* const buffer = sdBenchBuffer;
+  const uint32_t bufferSize = sdBenchBufferSize;
+  sdBench.begin(sdCardTypeStr.c_str(), sdCardSize, sdBenchFileKb * 1024);
+  bool stopped = false;
+  for (uint8_t i = 0; i < SD_BENCH_CLOCK_COUNT && !stopped; ++i) {
+    const uint32_t khz = SD_BENCH_CLOCKS[i];
+    SD.end();
+    if (!SD.begin(sd_cs_pin, *sdSPI, khz * 1000)) {
+      sdBench.skipClock(khz);
+      Serial.printf("  %lu kHz: mount failed\r\n", static_cast<unsigned long>(khz));
+      continue;
+    }
+    const bool complete = sdBench.runClock(SD, SD_BENCH_FILE, khz, buffer, bufferSize, testStopping);
+    stopped = !complete && testStopping();
+    const auto& result = sdBench.clock(sdBench.count() - 1);
+    Serial.printf("  %lu kHz: write %.3f read %.3f MB/s (%lu B), 4K random %.1f/%.1f IOPS, fsync p99 %lu us%s\r\n",
+                  static_cast<unsigned long>(khz), result.writeMBps[SD_BENCH_BLOCK_COUNT - 1],
+                  result.readMBps[SD_BENCH_BLOCK_COUNT - 1],
+                  static_cast<unsigned long>(SD_BENCH_BLOCKS[SD_BENCH_BLOCK_COUNT - 1]), result.randomReadIops,
+                  result.randomWriteIops,
+                  static_cast<unsigned long>(result.latency[decltype(sdBench)::OP_FSYNC].percentileUs(990)),
+                  complete ? "" : " (I/O error)");
+    job.setProgress(static_cast<uint8_t>(5 + 90 * (i + 1) / SD_BENCH_CLOCK_COUNT));
+  }
+  SD.remove(SD_BENCH_FILE);
+  SD.end();
+  sdAvailable = SD.begin(sd_cs_pin, *sdSPI);
+  if (stopped) {
+    return false;
+  }
+  sdBench.finish();
+  return true;
+}
+
 void resetSDTest() {
   sdTested = false;
   sdAvailable = false;
@@ -3226,8 +3900,12 @@ void testRotaryEncoder() {
       break;
     }
 
-    delay(10);
-    yield();
+    if (!testPause(10)) {
+      rotaryTestResult = String(Texts::test_cancelled);
+      Serial.println("Rotary: annule");
+      rotaryPosition = 0;
+      return;
+    }
   }
 
   char rotaryBuf[256];
@@ -3303,6 +3981,8 @@ int getRotaryButtonGPIOState() {
 }
 
 // ========== TEST STRESS MÉMOIRE ==========
+static const size_t STRESS_TEST_INTERNAL_RESERVE = 32 * 1024;
+
 void memoryStressTest() {
   Serial.println("\r\n=== STRESS TEST MEMOIRE ===");
   
@@ -3312,13 +3992,20 @@ void memoryStressTest() {
 
   const int allocSize = 1024;
   int maxAllocs = 0;
-  std::vector<void*> allocations;
+  // Liste chaînée dans les blocs eux-mêmes : aucun tableau de pointeurs alloué
+  // (un std::vector ré-allouait jusqu'à plusieurs dizaines de Ko de heap interne)
+  void* allocations = nullptr;
   
   Serial.println("Allocation progressive...");
   while(true) {
-    void* ptr = malloc(allocSize);
+    // Exécuté en tâche de fond : une réserve de heap interne reste au serveur web
+    // et à lwIP, la suite des allocations ne peut venir que de la PSRAM
+    void* ptr = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) > STRESS_TEST_INTERNAL_RESERVE
+                    ? malloc(allocSize)
+                    : heap_caps_malloc(allocSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
     if (!ptr) break;
-    allocations.push_back(ptr);
+    *static_cast<void**>(ptr) = allocations;
+    allocations = ptr;
     maxAllocs++;
     
     if (maxAllocs % 100 == 0) {
@@ -3330,8 +4017,10 @@ void memoryStressTest() {
 
 
   Serial.println("Liberation memoire...");
-  for (auto ptr : allocations) {
-    free(ptr);
+  while (allocations != nullptr) {
+    void* next = *static_cast<void**>(allocations);
+    free(allocations);
+    allocations = next;
   }
 
   stressAllocationCount = maxAllocs;
@@ -3342,34 +4031,35 @@ void memoryStressTest() {
 }
 
 // ========== COLLECTE DONNÉES ==========
-void collectDiagnosticInfo() {
+// Lecture matérielle seule : appelable depuis la tâche d'échantillonnage
+void collectDiagnosticInfo(DiagnosticInfo& info) {
   esp_chip_info_t chip_info;
   esp_chip_info(&chip_info);
   
-  diagnosticData.chipModel = detectChipModel();
-  diagnosticData.chipRevision = String(chip_info.revision);
-  diagnosticData.cpuCores = chip_info.cores;
-  diagnosticData.cpuFreqMHz = ESP.getCpuFreqMHz();
+  info.chipModel = detectChipModel();
+  info.chipRevision = String(chip_info.revision);
+  info.cpuCores = chip_info.cores;
+  info.cpuFreqMHz = ESP.getCpuFreqMHz();
   
   uint32_t flash_size;
   esp_flash_get_size(NULL, &flash_size);
-  diagnosticData.flashSize = flash_size;
-  diagnosticData.psramSize = ESP.getPsramSize();
+  info.flashSize = flash_size;
+  info.psramSize = ESP.getPsramSize();
   
   uint8_t mac[6];
   esp_read_mac(mac, ESP_MAC_WIFI_STA);
   char macStr[18];
   sprintf(macStr, "%02X:%02X:%02X:%02X:%02X:%02X", 
           mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
-  diagnosticData.macAddress = String(macStr);
+  info.macAddress = String(macStr);
   
-  diagnosticData.heapSize = ESP.getHeapSize();
-  diagnosticData.freeHeap = ESP.getFreeHeap();
-  diagnosticData.minFreeHeap = ESP.getMinFreeHeap();
-  diagnosticData.maxAllocHeap = ESP.getMaxAllocHeap();
+  info.heapSize = ESP.getHeapSize();
+  info.freeHeap = ESP.getFreeHeap();
+  info.minFreeHeap = ESP.getMinFreeHeap();
+  info.maxAllocHeap = ESP.getMaxAllocHeap();
   
-  diagnosticData.hasWiFi = (chip_info.features & CHIP_FEATURE_WIFI_BGN);
-  diagnosticData.hasBT = (chip_info.features & CHIP_FEATURE_BT);
+  info.hasWiFi = (chip_info.features & CHIP_FEATURE_WIFI_BGN);
+  info.hasBT = (chip_info.features & CHIP_FEATURE_BT);
   bool featureBLE = (chip_info.features & CHIP_FEATURE_BLE);
 
 #ifdef CHIP_ESP32S2
@@ -3399,117 +4089,772 @@ void collectDiagnosticInfo() {
 #endif
 
   if (WiFi.status() == WL_CONNECTED) {
-    diagnosticData.wifiSSID = WiFi.SSID();
-    diagnosticData.wifiRSSI = WiFi.RSSI();
-    diagnosticData.ipAddress = WiFi.localIP().toString();
+    info.wifiSSID = WiFi.SSID();
+    info.wifiRSSI = WiFi.RSSI();
+    info.ipAddress = WiFi.localIP().toString();
 #if DIAGNOSTIC_HAS_MDNS
-    diagnosticData.mdnsAvailable = mdnsServiceActive;
+    info.mdnsAvailable = mdnsServiceActive;
 #else
-    diagnosticData.mdnsAvailable = false;
+    info.mdnsAvailable = false;
 #endif
   } else {
-    diagnosticData.wifiSSID = "";
-    diagnosticData.wifiRSSI = -127;
-    diagnosticData.ipAddress = "";
-    diagnosticData.mdnsAvailable = false;
+    info.wifiSSID = "";
+    info.wifiRSSI = -127;
+    info.ipAddress = "";
+    info.mdnsAvailable = false;
   }
   
-  diagnosticData.gpioList = getGPIOList();
-  diagnosticData.totalGPIO = countGPIO();
+  info.gpioList = getGPIOList();
+  info.totalGPIO = countGPIO();
   
-  diagnosticData.sdkVersion = ESP.getSdkVersion();
-  diagnosticData.idfVersion = esp_get_idf_version();
-  diagnosticData.uptime = millis();
+  info.sdkVersion = ESP.getSdkVersion();
+  info.idfVersion = esp_get_idf_version();
+  info.uptime = millis();
   
   #ifdef SOC_TEMP_SENSOR_SUPPORTED
-    diagnosticData.temperature = temperatureRead();
+    info.temperature = temperatureRead();
   #else
-    diagnosticData.temperature = -999;
+    info.temperature = -999;
   #endif
-  
+}
+
+void collectDiagnosticInfo() {
+  collectDiagnosticInfo(diagnosticData);
+
   diagnosticData.neopixelTested = neopixelTested;
   diagnosticData.neopixelAvailable = neopixelAvailable;
   diagnosticData.neopixelResult = neopixelTestResult;
-  
+
   diagnosticData.oledTested = oledTested;
   diagnosticData.oledAvailable = oledAvailable;
   diagnosticData.oledResult = oledTestResult;
+}
 
-  heapHistory[historyIndex] = (float)diagnosticData.freeHeap / 1024.0;
-  if (diagnosticData.temperature != -999) {
-    tempHistory[historyIndex] = diagnosticData.temperature;
+// ========== TELEMETRY SAMPLER ==========
+// Appelé sous telemetryMutex, comme toute lecture de l'historique
+void recordTelemetryHistory(const DiagnosticInfo& info) {
+  heapHistory[historyIndex] = (float)info.freeHeap / 1024.0;
+  if (info.temperature != -999) {
+    tempHistory[historyIndex] = info.temperature;
   }
   historyIndex = (historyIndex + 1) % HISTORY_SIZE;
 }
 
-// Routines de tests en tâche de fond
-static void runBuiltinLedTestTask() {
-  resetBuiltinLEDTest();
-  testBuiltinLED();
+// Remplit le tampon arrière puis le publie ; seule la tâche d'échantillonnage
+// (ou setup() avant son démarrage) écrit telemetryFrontIndex.
+void sampleTelemetry() {
+  const uint8_t front = telemetryFrontIndex;
+  TelemetrySnapshot& back = telemetrySnapshots[front ^ 1];
+  collectDiagnosticInfo(back.diag);
+  collectDetailedMemory(back.memory);
+  back.sampledAtMs = millis();
+  back.sequence = telemetrySnapshots[front].sequence + 1;
+
+  xSemaphoreTake(telemetryMutex, portMAX_DELAY);
+  telemetryFrontIndex = front ^ 1;
+  recordTelemetryHistory(back.diag);
+  xSemaphoreGive(telemetryMutex);
 }
 
-static void runNeopixelTestTask() {
-  neopixelPauseStatus();
+static void telemetrySamplerTask(void* parameters) {
+  (void)parameters;
+  TickType_t lastWake = xTaskGetTickCount();
+  for (;;) {
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(TELEMETRY_SAMPLE_PERIOD_MS));
+    sampleTelemetry();
+  }
+}
+
+void startTelemetrySampler() {
+  if (telemetryMutex == nullptr) {
+    telemetryMutex = xSemaphoreCreateMutex();
+  }
+  // Premier instantané synchrone : les handlers ont toujours des données valides
+  sampleTelemetry();
+
+#if CONFIG_FREERTOS_UNICORE
+  const BaseType_t targetCore = tskNO_AFFINITY;
+#else
+  const BaseType_t targetCore = TELEMETRY_CORE < 0 ? tskNO_AFFINITY : TELEMETRY_CORE;
+#endif
+
+  const uint32_t stackSize = stackProfile.recommended(STACK_TELEMETRY, TELEMETRY_TASK_STACK);
+  bool inPsram = false;
+  if (!createTask(telemetrySamplerTask,
+                  STACK_TELEMETRY,
+                  stackSize,
+                  nullptr,
+                  TELEMETRY_TASK_PRIORITY,
+                  &telemetryTaskHandle,
+                  targetCore,
+                  TELEMETRY_STACK_IN_PSRAM,
+                  &inPsram)) {
+    telemetryTaskHandle = nullptr;
+    Serial.println("[TELEMETRY] Echec creation tache d'echantillonnage");
+    return;
+  }
+  stackProfile.setAllocated(STACK_TELEMETRY, stackSize, inPsram);
+}
+
+// Routines de tests en tâche de fond (jobs)
+static void runBuiltinLedTestJob(JobContext& job) {
+  resetBuiltinLEDTest();
+  testBuiltinLED();
+  job.setResult(builtinLedTestResult.c_str(), builtinLedAvailable);
+}
+
+static void runNeopixelTestJob(JobContext& job) {
+  neopixelPauseStatus();
   resetNeoPixelTest();
   testNeoPixel();
   neopixelRestoreWifiStatus();
+  job.setResult(neopixelTestResult.c_str(), neopixelAvailable);
 }
 
-static void runOledTestTask() {
+static void runOledTestJob(JobContext& job) {
   resetOLEDTest();
   testOLED();
+  job.setResult(oledTestResult.c_str(), oledAvailable);
 }
 
-static void runRgbLedTestTask() {
+static void runRgbLedTestJob(JobContext& job) {
   testRGBLed();
+  job.setResult(rgbLedTestResult.c_str(), rgbLedAvailable);
 }
 
-static void runBuzzerTestTask() {
+static void runBuzzerTestJob(JobContext& job) {
   testBuzzer();
+  job.setResult(buzzerTestResult.c_str(), buzzerAvailable);
 }
 
-static void runSDTestTask() {
+static void runSDTestJob(JobContext& job) {
   resetSDTest();
   testSD();
+  job.setResult(sdTestResult.c_str(), sdAvailable);
+}
+
+static void runSdBenchJob(JobContext& job) {
+  resetSDTest();
+  if (!runSdBenchmark(job)) {
+    job.setResult(testStopping() ? Texts::test_cancelled.str().c_str() : sdTestResult.c_str(), false);
+    return;
+  }
+  char summary[64];
+  snprintf(summary, sizeof(summary), "%s %llu MB, %u clocks", sdCardTypeStr.c_str(), sdCardSize,
+           static_cast<unsigned>(sdBench.count()));
+  job.setResult(summary, true);
+}
+
+static void runI2cBenchJob(JobContext& job) {
+  if (!runI2cBenchmark(job)) {
+    job.setResult(Texts::test_cancelled.str().c_str(), false);
+    return;
+  }
+  char summary[64];
+  snprintf(summary, sizeof(summary), "%u devices, %lu kHz recommended", static_cast<unsigned>(i2cBench.deviceCount()),
+           static_cast<unsigned long>(i2cBench.recommendedHz() / 1000));
+  job.setResult(summary, i2cBench.deviceCount() > 0);
+}
+
+static void runDisplayBenchJob(JobContext& job) {
+  if (!runDisplayBenchmark(job)) {
+    job.setResult(Texts::test_cancelled.str().c_str(), false);
+    return;
+  }
+  char summary[64];
+  snprintf(summary, sizeof(summary), "%u TFT runs, %u OLED runs", static_cast<unsigned>(displayBench.tftCount()),
+           static_cast<unsigned>(displayBench.oledCount()));
+  job.setResult(summary, displayBench.tftCount() + displayBench.oledCount() > 0);
 }
 
-static void runRotaryTestTask() {
+static void runRotaryTestJob(JobContext& job) {
   resetRotaryTest();
   testRotaryEncoder();
+  job.setResult(rotaryTestResult.c_str(), rotaryAvailable);
+}
+
+static void runDhtTestJob(JobContext& job) {
+  testDHTSensor();
+  job.setResult(dhtTestResult.c_str(), dhtAvailable);
+}
+
+static void runLightSensorTestJob(JobContext& job) {
+  testLightSensor();
+  job.setResult(lightSensorTestResult.c_str(), lightSensorAvailable);
+}
+
+static void runDistanceSensorTestJob(JobContext& job) {
+  testDistanceSensor();
+  job.setResult(distanceSensorTestResult.c_str(), distanceSensorAvailable);
+}
+
+static void runMotionSensorTestJob(JobContext& job) {
+  testMotionSensor();
+  job.setResult(motionSensorTestResult.c_str(), motionSensorAvailable);
+}
+
+static void runPwmTestJob(JobContext& job) {
+  testPWM();
+  job.setResult(pwmTestResult.c_str(), true);
+}
+
+static void runEnvironmentalTestJob(JobContext& job) {
+  testEnvironmentalSensors();
+  job.setResult(envSensorTestResult.c_str(), envSensorAvailable);
+}
+
+static void runGpsTestJob(JobContext& job) {
+  testGPS();
+  job.setResult(gpsTestResult.c_str(), gpsAvailable);
+}
+
+static void runGpioTestJob(JobContext& job) {
+  testAllGPIOs();
+  uint8_t working = 0;
+  for (const auto& result : gpioResults) {
+    working += result.working ? 1 : 0;
+  }
+  char summary[48];
+  snprintf(summary, sizeof(summary), "%u/%u GPIO OK", static_cast<unsigned>(working),
+           static_cast<unsigned>(gpioResults.size()));
+  job.setResult(summary, true);
+}
+
+static void runWifiScanJob(JobContext& job) {
+  scanWiFiNetworks();
+  char summary[48];
+  snprintf(summary, sizeof(summary), "%u networks", static_cast<unsigned>(wifiNetworks.size()));
+  job.setResult(summary, true);
+}
+
+static void runBenchmarkJob(JobContext& job) {
+  diagnosticData.cpuBenchmark =
+      benchmarkCPU(job) ? static_cast<unsigned long>(lroundf(cpuBench.totalUs(cpuBench.cores() - 1))) : 0;
+  job.setProgress(30);
+  if (testStopping() || !benchmarkMemoryHierarchy(job)) {
+    job.setResult(Texts::test_cancelled.str().c_str(), false);
+    return;
+  }
+  diagnosticData.memBenchmark = benchmarkMemory();
+  job.setProgress(70);
+  memoryStressTest();
+  char summary[64];
+  snprintf(summary, sizeof(summary), "CPU %lu us, memory %lu us", diagnosticData.cpuBenchmark,
+           diagnosticData.memBenchmark);
+  job.setResult(summary, diagnosticData.cpuBenchmark > 0 && diagnosticData.memBenchmark > 0);
+}
+
+// ---- Ressources réclamées par les tests (graphe de conflits) ----
+// Deux tests qui partagent un bit ou une GPIO ne tournent jamais en même temps.
+enum TestResource : uint32_t {
+  RES_I2C_BUS = 1UL << 0,  // Wire (OLED, AHT20/BMP280)
+  RES_SPI_HOST = 1UL << 1,  // bus SPI partagé SD/TFT
+  RES_LEDC_CH0 = 1UL << 2,  // canal LEDC 0 : tone() et test PWM
+  RES_UART1 = 1UL << 3,     // Serial1 (GPS)
+  RES_RMT = 1UL << 4,       // NeoPixel, LED intégrée RGB de l'ESP32-S3
+  RES_WIFI_RADIO = 1UL << 5,  // scan WiFi (coupe brièvement la station)
+  RES_ALL = 0xFFFFFFFFUL      // job exclusif (benchmark : heap et mesures de temps)
+};
+
+// Wire est à un job (banc I2C qui change d'horloge, OLED, capteurs) : les handlers
+// et les flux ne font ni scan, ni lecture, ni Wire.end()/setClock() ; ils servent
+// les dernières valeurs ou répondent 409. Leurs transactions fausseraient aussi
+// les latences et NACK du banc.
+static bool i2cBusClaimed() { return (jobScheduler.busyResources() & RES_I2C_BUS) != 0; }
+
+static uint64_t pinBit(int pin) {
+#ifdef RGB_BUILTIN
+  if (pin >= SOC_GPIO_PIN_COUNT) {
+    pin -= SOC_GPIO_PIN_COUNT;  // LED_BUILTIN virtuel de l'ESP32-S3 -> GPIO de la LED RGB
+  }
+#endif
+  return (pin >= 0 && pin < 64) ? (1ULL << pin) : 0;
+}
+
+static uint64_t builtinLedPins() { return pinBit(BUILTIN_LED_PIN); }
+static uint64_t neopixelPins() { return pinBit(LED_PIN); }
+static uint64_t i2cPins() { return pinBit(i2c_sda) | pinBit(i2c_scl); }
+static uint64_t rgbLedPins() { return pinBit(rgb_led_pin_r) | pinBit(rgb_led_pin_g) | pinBit(rgb_led_pin_b); }
+static uint64_t buzzerPins() { return pinBit(buzzer_pin); }
+static uint64_t sdPins() { return pinBit(sd_miso_pin) | pinBit(sd_mosi_pin) | pinBit(sd_sclk_pin) | pinBit(sd_cs_pin); }
+static uint64_t rotaryPins() { return pinBit(rotary_clk_pin) | pinBit(rotary_dt_pin) | pinBit(rotary_sw_pin); }
+static uint64_t dhtPins() { return pinBit(dht_pin); }
+static uint64_t lightSensorPins() { return pinBit(light_sensor_pin); }
+static uint64_t distanceSensorPins() { return pinBit(distance_trig_pin) | pinBit(distance_echo_pin); }
+static uint64_t motionSensorPins() { return pinBit(motion_sensor_pin); }
+static uint64_t pwmPins() { return pinBit(pwmTestPin()); }
+static uint64_t displayPins() {
+#if ENABLE_TFT_DISPLAY
+  return i2cPins() | pinBit(tftMOSI) | pinBit(tftSCLK) | pinBit(tftCS) | pinBit(tftDC) | pinBit(tftRST);
+#else
+  return i2cPins();
+#endif
+}
+static uint64_t gpsPins() { return pinBit(GPS_RXD) | pinBit(GPS_TXD); }
+static uint64_t allPins() { return ~0ULL; }
+
+// ESP32-S3 : la LED intégrée est la LED RGB adressable, pilotée par neopixelWrite() via le RMT
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+static const uint32_t BUILTIN_LED_RESOURCES = RES_RMT;
+#else
+static const uint32_t BUILTIN_LED_RESOURCES = 0;
+#endif
+
+// name, routine, priority, timeout (ms), resources, GPIOs
+static const JobType builtinLedTestJob = {"builtin_led", runBuiltinLedTestJob, 2, 15000, BUILTIN_LED_RESOURCES,
+                                          builtinLedPins};
+static const JobType neopixelTestJob = {"neopixel", runNeopixelTestJob, 2, 15000, RES_RMT, neopixelPins};
+static const JobType oledTestJob = {"oled", runOledTestJob, 2, 30000, RES_I2C_BUS, i2cPins};
+static const JobType rgbLedTestJob = {"rgb_led", runRgbLedTestJob, 2, 10000, 0, rgbLedPins};
+static const JobType buzzerTestJob = {"buzzer", runBuzzerTestJob, 2, 10000, RES_LEDC_CH0, buzzerPins};
+static const JobType sdTestJob = {"sd", runSDTestJob, 2, 30000, RES_SPI_HOST, sdPins};
+static const JobType rotaryTestJob = {"rotary", runRotaryTestJob, 2, 15000, 0, rotaryPins};
+static const JobType dhtTestJob = {"dht", runDhtTestJob, 2, 5000, 0, dhtPins};
+static const JobType lightSensorTestJob = {"light", runLightSensorTestJob, 2, 5000, 0, lightSensorPins};
+static const JobType distanceSensorTestJob = {"distance", runDistanceSensorTestJob, 2, 5000, 0, distanceSensorPins};
+static const JobType motionSensorTestJob = {"motion", runMotionSensorTestJob, 2, 5000, 0, motionSensorPins};
+static const JobType pwmTestJob = {"pwm", runPwmTestJob, 2, 5000, RES_LEDC_CH0, pwmPins};
+static const JobType environmentalTestJob = {"environment", runEnvironmentalTestJob, 2, 10000, RES_I2C_BUS, i2cPins};
+static const JobType gpsTestJob = {"gps", runGpsTestJob, 2, 20000, RES_UART1, gpsPins};
+static const JobType gpioTestJob = {"gpio", runGpioTestJob, 2, 10000, 0, allPins};
+static const JobType wifiScanJob = {"wifi_scan", runWifiScanJob, 3, 20000, RES_WIFI_RADIO, nullptr};
+static const JobType benchmarkJob = {"benchmark", runBenchmarkJob, 1, 60000, RES_ALL, allPins};
+static const JobType sdBenchJob = {"sd_bench", runSdBenchJob, 1, 180000, RES_SPI_HOST, sdPins};
+static const JobType i2cBenchJob = {"i2c_bench", runI2cBenchJob, 1, 30000, RES_I2C_BUS, i2cPins};
+static const JobType displayBenchJob = {"display_bench", runDisplayBenchJob, 1, 120000, RES_SPI_HOST | RES_I2C_BUS,
+                                        displayPins};
+
+static const JobType* const JOB_TYPES[] = {
+  &builtinLedTestJob, &neopixelTestJob, &oledTestJob, &rgbLedTestJob, &buzzerTestJob, &sdTestJob, &rotaryTestJob,
+  &dhtTestJob, &lightSensorTestJob, &distanceSensorTestJob, &motionSensorTestJob, &pwmTestJob, &environmentalTestJob,
+  &gpsTestJob, &gpioTestJob, &wifiScanJob, &benchmarkJob, &sdBenchJob, &i2cBenchJob, &displayBenchJob
+};
+
+static const JobType* findJobType(const String& name) {
+  for (const JobType* type : JOB_TYPES) {
+    if (name == type->name) {
+      return type;
+    }
+  }
+  return nullptr;
+}
+
+// true si le job vient d'être mis en file ; alreadyRunning si un job du même
+// type est déjà en file ou en cours (jobId est alors le sien). Les deux à
+// false : stockage plein, le handler exécute le test en ligne comme avant.
+static bool startTestJob(const JobType& type, bool& alreadyRunning, uint32_t& jobId) {
+  const auto status = jobScheduler.submit(type, jobId);
+  alreadyRunning = status == decltype(jobScheduler)::ALREADY_ACTIVE;
+  return status == decltype(jobScheduler)::SUBMITTED;
+}
+
+// [OPT-022]: Endpoints longs (scan WiFi, benchmark, GPS, GPIO, DHT) : la requête
+// met le travail en file et répond 202 avec l'URL de suivi ; le résultat est
+// ensuite relu depuis le cache (?cached=1), avec son âge. ?max_age=ms sert
+// directement un cache assez récent. Le cache n'est lu que lorsqu'aucun job du
+// type n'est en file ou en cours (seul loop() soumet des jobs).
+struct ResultCache {
+  unsigned long updatedMs;
+  bool valid;
+};
+
+static ResultCache wifiScanCache = {0, false};
+static ResultCache benchmarkCache = {0, false};
+static ResultCache gpioTestCache = {0, false};
+static ResultCache dhtTestCache = {0, false};
+static ResultCache gpsTestCache = {0, false};
+static ResultCache sdBenchCache = {0, false};
+static ResultCache i2cBenchCache = {0, false};
+static ResultCache displayBenchCache = {0, false};
+
+static const JobType* const CACHED_JOB_TYPES[] = {&wifiScanJob, &benchmarkJob, &gpioTestJob, &dhtTestJob, &gpsTestJob,
+                                                  &sdBenchJob, &i2cBenchJob, &displayBenchJob};
+static ResultCache* const CACHED_JOB_RESULTS[] = {&wifiScanCache, &benchmarkCache, &gpioTestCache, &dhtTestCache,
+                                                  &gpsTestCache, &sdBenchCache, &i2cBenchCache, &displayBenchCache};
+
+// Appelé depuis loop() : horodate les résultats des jobs terminés depuis le dernier passage
+static void refreshResultCaches() {
+  static uint32_t seenFinishes = 0;
+  const uint32_t finishes = jobScheduler.finishCount();
+  if (finishes == seenFinishes) {
+    return;
+  }
+  jobScheduler.forEach([&](const Job& job) {
+    if (job.finishSeq <= seenFinishes || job.attached || job.state == JOB_CANCELLED) {
+      return;
+    }
+    if (job.type == &sdBenchJob && job.state == JOB_DONE && sdBench.valid()) {
+      sdBench.save(PROJECT_VERSION);  // NVS : ici dans loop(), jamais sur la pile (PSRAM possible) d'un worker
+    }
+    for (uint8_t i = 0; i < sizeof(CACHED_JOB_TYPES) / sizeof(CACHED_JOB_TYPES[0]); ++i) {
+      if (job.type == CACHED_JOB_TYPES[i] && (!CACHED_JOB_RESULTS[i]->valid ||
+                                               job.finishedMs - CACHED_JOB_RESULTS[i]->updatedMs < 0x80000000UL)) {
+        CACHED_JOB_RESULTS[i]->updatedMs = job.finishedMs;
+        CACHED_JOB_RESULTS[i]->valid = true;
+      }
+    }
+  });
+  seenFinishes = finishes;
+}
+
+// Identifiant du build pour le profil de pile : début du SHA-256 de l'ELF, qui
+// change à chaque recompilation même sans changement de PROJECT_VERSION
+static const char* stackProfileBuildId() {
+  static char id[decltype(stackProfile)::BUILD_ID_LENGTH] = {0};
+  if (id[0] == '\0') {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+    esp_app_get_elf_sha256(id, sizeof(id));
+#else
+    esp_ota_get_app_elf_sha256(id, sizeof(id));
+#endif
+    if (id[0] == '\0') {
+      strlcpy(id, PROJECT_VERSION, sizeof(id));
+    }
+  }
+  return id;
+}
+
+// Pile des workers : ils exécutent tous les types de job, donc le plus gros
+// pic observé ; tant qu'un type n'a jamais tourné, pas en dessous de JOB_WORKER_STACK
+static uint32_t jobWorkerStackSize() {
+  uint32_t learned = 0;
+  bool complete = true;
+  for (const JobType* type : JOB_TYPES) {
+    if (stackProfile.learned(type->name)) {
+      learned = max(learned, stackProfile.recommended(type->name, 0));
+    } else {
+      complete = false;
+    }
+  }
+  if (learned == 0) {
+    return JOB_WORKER_STACK;
+  }
+  return complete ? learned : max(learned, static_cast<uint32_t>(JOB_WORKER_STACK));
+}
+
+// Taille prévue au prochain démarrage ; loopTask est indicatif (SET_LOOP_TASK_STACK_SIZE)
+static uint32_t recommendedStackSize(const char* name) {
+  if (strcmp(name, STACK_WORKER) == 0) {
+    return jobWorkerStackSize();
+  }
+  if (strcmp(name, STACK_TELEMETRY) == 0) {
+    return stackProfile.recommended(name, TELEMETRY_TASK_STACK);
+  }
+  if (strcmp(name, STACK_LOOP) == 0) {
+    return stackProfile.recommended(name, getArduinoLoopTaskStackSize());
+  }
+  if (strcmp(name, STACK_HTTP_WATCHER) == 0) {
+    return stackProfile.recommended(name, HTTP_WATCHER_STACK);
+  }
+  if (strcmp(name, STACK_NET_ECHO) == 0) {
+    return stackProfile.recommended(name, NET_ECHO_STACK);
+  }
+  if (strcmp(name, STACK_NET_DOWNLOAD) == 0) {
+    return stackProfile.recommended(name, NET_DOWNLOAD_STACK);
+  }
+  return stackProfile.recommended(name, JOB_WORKER_STACK);  // type de job
+}
+
+static void sampleTaskStacks() {
+  if (telemetryTaskHandle != nullptr) {
+    stackProfile.record(STACK_TELEMETRY, stackPeakBytes(telemetryTaskHandle, stackProfile.stackSize(STACK_TELEMETRY)));
+  }
+  stackProfile.record(STACK_LOOP, stackPeakBytes(nullptr, getArduinoLoopTaskStackSize()));
+  if (server.watcherTask() != nullptr) {
+    stackProfile.record(STACK_HTTP_WATCHER,
+                        stackPeakBytes(server.watcherTask(), stackProfile.stackSize(STACK_HTTP_WATCHER)));
+  }
+  if (netEchoTaskHandle != nullptr) {
+    stackProfile.record(STACK_NET_ECHO, stackPeakBytes(netEchoTaskHandle, stackProfile.stackSize(STACK_NET_ECHO)));
+  }
+  if (netDownloadTaskHandle != nullptr) {
+    stackProfile.record(STACK_NET_DOWNLOAD,
+                        stackPeakBytes(netDownloadTaskHandle, stackProfile.stackSize(STACK_NET_DOWNLOAD)));
+  }
+}
+
+// Appelé depuis loop() : pic de pile des jobs terminés, relevé des tâches
+// permanentes et sauvegarde NVS périodique (jamais depuis un worker)
+static void refreshStackProfile() {
+  static uint32_t seenFinishes = 0;
+  static unsigned long lastSaveMs = 0;
+  const uint32_t finishes = jobScheduler.finishCount();
+  if (finishes != seenFinishes) {
+    jobScheduler.forEach([&](const Job& job) {
+      if (job.finishSeq <= seenFinishes || job.attached || job.stackPeak == 0) {
+        return;
+      }
+      stackProfile.record(job.type->name, job.stackPeak);
+      stackProfile.record(STACK_WORKER, job.stackPeak);
+      if (job.stackPeak + 256 > jobScheduler.stackSize()) {
+        Serial.printf("[STACK] %s: %u/%lu octets de pile utilises\r\n", job.type->name,
+                      static_cast<unsigned>(job.stackPeak), static_cast<unsigned long>(jobScheduler.stackSize()));
+      }
+    });
+    seenFinishes = finishes;
+  }
+  if (millis() - lastSaveMs >= STACK_PROFILE_SAVE_INTERVAL_MS) {
+    lastSaveMs = millis();
+    sampleTaskStacks();
+#if ENABLE_STACK_PROFILE
+    stackProfile.save();
+#endif
+  }
+}
+
+static const char* coreMaskName(uint8_t mask) {
+  return mask == 0x1 ? "0" : mask == 0x2 ? "1" : "0+1";
+}
+
+// Appelé depuis loop() : une fenêtre de charge par coeur, puis les coeurs
+// autorisés à démarrer des jobs (un job déjà lancé reste sur son coeur)
+static void refreshCorePlacement() {
+  static unsigned long lastWindowMs = 0;
+  if (coreLoadMonitor.cores() == 0 || millis() - lastWindowMs < CORE_PLACEMENT_INTERVAL_MS) {
+    return;
+  }
+  lastWindowMs = millis();
+  coreLoadMonitor.sample(coreLoads);
+  const uint8_t mask = corePlacement.update(coreLoads, coreLoadMonitor.cores(), jobScheduler.workerCores());
+  if (mask != jobScheduler.allowedCores()) {
+    jobScheduler.setAllowedCores(mask);
+    Serial.printf("[CORES] Jobs sur coeur %s (charge hors jobs %u%% / %u%%)\r\n", coreMaskName(mask),
+                  static_cast<unsigned>(coreLoads[0].background()), static_cast<unsigned>(coreLoads[1].background()));
+  }
+}
+
+// Coeur d'une tâche pour /api/cores, -1 si elle n'est pas épinglée
+static int taskCore(TaskHandle_t task) {
+  if (task == nullptr) {
+    return -1;
+  }
+  const BaseType_t core = xTaskGetAffinity(task);
+  return core == tskNO_AFFINITY ? -1 : static_cast<int>(core);
+}
+
+// true : l'appelant répond 200 avec le contenu du cache (et son âge).
+// false : une réponse 202 (job en file) ou 503 a déjà été envoyée.
+static bool serveCachedOrSubmit(const JobType& type, const ResultCache& cache, const char* path) {
+  refreshResultCaches();
+  uint32_t jobId = jobScheduler.activeJob(type);
+  const unsigned long now = millis();
+  if (jobId == 0 && cache.valid) {
+    const bool cached = server.hasArg("cached");
+    const unsigned long maxAge = strtoul(server.arg("max_age").c_str(), nullptr, 10);
+    if (cached || (maxAge > 0 && now - cache.updatedMs <= maxAge)) {
+      return true;
+    }
+  }
+  if (jobId == 0 && jobScheduler.submit(type, jobId) == decltype(jobScheduler)::STORE_FULL) {
+    server.sendHeader("Retry-After", "2");
+    sendOperationError(503, "Job store full", {});
+    return false;
+  }
+
+  char statusUrl[32];
+  char resultUrl[48];
+  snprintf(statusUrl, sizeof(statusUrl), "/api/jobs?id=%lu", static_cast<unsigned long>(jobId));
+  snprintf(resultUrl, sizeof(resultUrl), "%s?cached=1", path);
+  ApiResponse json(202);
+  json.beginObject();
+  json.field("running", true);
+  json.field("job_id", jobId);
+  json.field("status_url", statusUrl);
+  json.field("result_url", resultUrl);
+  if (cache.valid) {
+    json.field("cached_age_ms", now - cache.updatedMs);
+  }
+  json.endObject();
+  return false;
 }
 
 // ========== HANDLERS API ==========
 void handleTestGPIO() {
-  testAllGPIOs();
-  String json;
-  json.reserve(gpioResults.size() * 40 + 20);  // Estimate size to avoid reallocations
-  json = "{\"results\":[";
-  for (size_t i = 0; i < gpioResults.size(); i++) {
-    if (i > 0) json += ",";
-    json += "{\"pin\":" + String(gpioResults[i].pin) + ",\"working\":" + String(gpioResults[i].working ? "true" : "false") + "}";
+  if (!serveCachedOrSubmit(gpioTestJob, gpioTestCache, "/api/test-gpio")) {
+    return;
   }
-  json += "]}";
-  server.send(200, "application/json", json);
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("age_ms", millis() - gpioTestCache.updatedMs);
+  json.beginArray("results");
+  for (const auto& result : gpioResults) {
+    json.beginObject();
+    json.field("pin", result.pin);
+    json.field("working", result.working);
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
 }
 
 void handleWiFiScan() {
-  scanWiFiNetworks();
-  String json;
-  json.reserve(wifiNetworks.size() * 150 + 20);  // Estimate size to avoid reallocations
-  json = "{\"networks\":[";
-  for (size_t i = 0; i < wifiNetworks.size(); i++) {
-    if (i > 0) json += ",";
-    json += "{\"ssid\":\"" + wifiNetworks[i].ssid + "\",\"rssi\":" + String(wifiNetworks[i].rssi) +
-            ",\"channel\":" + String(wifiNetworks[i].channel) + ",\"encryption\":\"" + wifiNetworks[i].encryption +
-            "\",\"bssid\":\"" + wifiNetworks[i].bssid + "\",\"band\":\"" + wifiNetworks[i].band +
-            "\",\"bandwidth\":\"" + wifiNetworks[i].bandwidth + "\",\"phy\":\"" + wifiNetworks[i].phyModes +
-            "\",\"freq\":" + String(wifiNetworks[i].freqMHz) + "}";
+  if (!serveCachedOrSubmit(wifiScanJob, wifiScanCache, "/api/wifi-scan")) {
+    return;
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("age_ms", millis() - wifiScanCache.updatedMs);
+  json.beginArray("networks");
+  for (const auto& network : wifiNetworks) {
+    json.beginObject();
+    json.field("ssid", network.ssid);
+    json.field("rssi", network.rssi);
+    json.field("channel", network.channel);
+    json.field("encryption", network.encryption);
+    json.field("bssid", network.bssid);
+    json.field("band", network.band);
+    json.field("bandwidth", network.bandwidth);
+    json.field("phy", network.phyModes);
+    json.field("freq", network.freqMHz);
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+}
+
+// ========== DÉBIT RÉSEAU ==========
+static void writeNetTransfer(DataWriter& out, const NetTransfer& transfer) {
+  out.field("bytes", transfer.bytes);
+  out.field("expected", transfer.expected);
+  out.field("us", transfer.us);
+  out.fieldFloat("mbps", transfer.mbps(), 2);
+  out.field("complete", transfer.complete);
+}
+
+// ?bytes=N octets du motif, envoyés depuis netChunk sans allocation. loop() n'écrit
+// que l'en-tête puis confie le socket à netDownloadTask : HTTP, SSE, boutons et
+// délais des jobs continuent pendant le transfert. Un téléchargement à la fois.
+void handleNetDownload() {
+  if (netDownloadTaskHandle == nullptr || netDownloadBusy) {
+    server.sendHeader("Retry-After", "2");
+    sendOperationError(503, netDownloadBusy ? "Download in progress" : "Download task unavailable", {});
+    return;
+  }
+  uint64_t bytes = NET_BENCH_DEFAULT_BYTES;
+  if (server.hasArg("bytes")) {
+    bytes = strtoull(server.arg("bytes").c_str(), nullptr, 10);
+  }
+  bytes = bytes > NET_BENCH_MAX_BYTES ? NET_BENCH_MAX_BYTES : bytes;
+  server.sendHeader("Cache-Control", "no-store");
+  server.setContentLength(static_cast<size_t>(bytes));
+  server.send(200, "application/octet-stream", "");
+  netDownloadClient = server.client();
+  netDownload.start(bytes, esp_timer_get_time());
+  recordDirectBytes(static_cast<size_t>(bytes));  // corps confié à la tâche, envoyé après le handler
+  netDownloadBusy = true;
+  xTaskNotifyGive(netDownloadTaskHandle);
+}
+
+static bool netUploadIsMultipart() { return server.header("Content-Type").startsWith("multipart/"); }
+
+// Corps brut de /api/net/upload, lu par blocs de HTTP_RAW_BUFLEN par le
+// WebServer : seulement compté et chronométré
+void handleNetUploadBody() {
+  if (netUploadIsMultipart()) {
+    return;
+  }
+  HTTPRaw& raw = server.raw();
+  switch (raw.status) {
+    case RAW_START:
+      netUpload.start(server.clientContentLength(), esp_timer_get_time());
+      break;
+    case RAW_WRITE:
+      netUpload.bytes += raw.currentSize;
+      break;
+    case RAW_END:
+    case RAW_ABORTED:
+      netUpload.finish(esp_timer_get_time());
+      break;
+  }
+}
+
+void handleNetUpload() {
+  if (netUploadIsMultipart()) {
+    sendOperationError(415, "Raw body expected (application/octet-stream)", {});
+    return;
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  writeNetTransfer(json, netUpload);
+  json.endObject();
+}
+
+void handleNet() {
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("echo_port", netEcho.port());
+  json.field("echo_sessions", netEcho.sessions());
+  json.field("echo_bytes", netEcho.bytes());
+  json.field("chunk_bytes", sizeof(netChunk));
+  if (WiFi.status() == WL_CONNECTED) {
+    json.field("rssi", WiFi.RSSI());
+  }
+  json.beginObject("last_download");
+  writeNetTransfer(json, netDownload);
+  json.endObject();
+  json.beginObject("last_upload");
+  writeNetTransfer(json, netUpload);
+  json.endObject();
+  json.endObject();
+}
+
+// Un client d'écho à la fois ; un client muet NET_ECHO_IDLE_MS est déconnecté
+static void netEchoTask(void* parameters) {
+  (void)parameters;
+  static uint8_t buffer[1460];  // un segment TCP
+  for (;;) {
+    if (!netEcho.serveOne(buffer, sizeof(buffer), NET_ECHO_IDLE_MS)) {
+      vTaskDelay(pdMS_TO_TICKS(1000));
+    }
+  }
+}
+
+static void netDownloadTask(void* parameters) {
+  (void)parameters;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    WiFiClient& client = netDownloadClient;
+    netDownload.bytes = netStreamPattern(
+        [&client](const uint8_t* data, size_t length) { return client.write(data, length); }, netDownload.expected,
+        netChunk, sizeof(netChunk));
+    netDownload.finish(esp_timer_get_time());
+    client.stop();  // dernière référence : ferme le socket
+    netDownloadBusy = false;
+  }
+}
+
+static void startNetDownload() {
+  const uint32_t stackSize = stackProfile.recommended(STACK_NET_DOWNLOAD, NET_DOWNLOAD_STACK);
+  if (!createTask(netDownloadTask, STACK_NET_DOWNLOAD, stackSize, nullptr, 1, &netDownloadTaskHandle, tskNO_AFFINITY,
+                  false)) {
+    netDownloadTaskHandle = nullptr;
+    Serial.println("[NET] Echec creation tache de telechargement");
+    return;
+  }
+  stackProfile.setAllocated(STACK_NET_DOWNLOAD, stackSize, false);
+}
+
+static void startNetEcho() {
+  netFillPattern(netChunk, sizeof(netChunk));
+  if (NET_ECHO_PORT == 0 || !netEcho.begin(NET_ECHO_PORT)) {
+    Serial.println("[NET] Service d'echo TCP desactive");
+    return;
+  }
+  const uint32_t stackSize = stackProfile.recommended(STACK_NET_ECHO, NET_ECHO_STACK);
+  if (!createTask(netEchoTask, STACK_NET_ECHO, stackSize, nullptr, 1, &netEchoTaskHandle, tskNO_AFFINITY, false)) {
+    netEchoTaskHandle = nullptr;
+    Serial.println("[NET] Echec creation tache d'echo");
+    return;
   }
-  json += "]}";
-  server.send(200, "application/json", json);
+  stackProfile.setAllocated(STACK_NET_ECHO, stackSize, false);
+  Serial.printf("[NET] Echo TCP sur le port %u\r\n", NET_ECHO_PORT);
 }
 
 void handleI2CScan() {
+  if (i2cBusClaimed()) {
+    sendOperationError(409, "I2C busy", {});
+    return;
+  }
   scanI2C();
   sendJsonResponse(200, {
     jsonNumberField("count", diagnosticData.i2cCount),
@@ -3517,6 +4862,32 @@ void handleI2CScan() {
   });
 }
 
+// ?apply=1 avec un résultat en cache : adopte la fréquence recommandée jusqu'au redémarrage
+void handleI2CBenchmark() {
+  if (!serveCachedOrSubmit(i2cBenchJob, i2cBenchCache, "/api/i2c-benchmark")) {
+    return;
+  }
+  const bool apply = server.hasArg("apply") && i2cBench.valid() && i2cBench.recommendedHz() > 0;
+  if (apply && i2cBusClaimed()) {
+    sendOperationError(409, "I2C busy", {});
+    return;
+  }
+  if (apply) {
+    i2cClockHz = i2cBench.recommendedHz();
+    Wire.setClock(i2cClockHz);
+    oled.setBusClock(i2cClockHz);
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("age_ms", millis() - i2cBenchCache.updatedMs);
+  json.field("success", i2cBench.valid());
+  json.field("applied", apply);
+  if (i2cBench.valid()) {
+    i2cBench.writeJson(json, i2cClockHz);
+  }
+  json.endObject();
+}
+
 void handleBuiltinLEDConfig() {
   if (server.hasArg("gpio")) {
     int newGPIO = server.arg("gpio").toInt();
@@ -3526,28 +4897,31 @@ void handleBuiltinLEDConfig() {
       // [OPT-007]: Buffer-based message formatting (1 vs 4 allocations)
       char msgBuf[96];
       snprintf(msgBuf, sizeof(msgBuf), "%s %s %d", Texts::config.str().c_str(), Texts::gpio.str().c_str(), BUILTIN_LED_PIN);
-      sendOperationSuccess(String(msgBuf), {});
+      sendOperationSuccess(msgBuf, {});
       return;
     }
   }
-  sendOperationError(400, Texts::gpio_invalid.str(), {});
+  sendOperationError(400, Texts::gpio_invalid, {});
 }
 
 void handleBuiltinLEDTest() {
   bool alreadyRunning = false;
-  bool started = startAsyncTest(builtinLedTestRunner, runBuiltinLedTestTask, alreadyRunning);
+  uint32_t jobId = 0;
+  bool started = startTestJob(builtinLedTestJob, alreadyRunning, jobId);
 
   if (started) {
-    sendActionResponse(202, true, String(Texts::test_in_progress), {
+    sendActionResponse(202, true, Texts::test_in_progress, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonStringField("result", builtinLedTestResult)
     });
     return;
   }
 
   if (alreadyRunning) {
-    sendActionResponse(200, true, String(Texts::test_in_progress), {
+    sendActionResponse(200, true, Texts::test_in_progress, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonStringField("result", builtinLedTestResult)
     });
     return;
@@ -3563,13 +4937,13 @@ void handleBuiltinLEDTest() {
 
 void handleBuiltinLEDControl() {
   if (!server.hasArg("action")) {
-    sendOperationError(400, Texts::configuration_invalid.str(), {});
+    sendOperationError(400, Texts::configuration_invalid, {});
     return;
   }
 
   String action = server.arg("action");
   if (BUILTIN_LED_PIN == -1) {
-    sendOperationError(400, Texts::gpio_invalid.str(), {});
+    sendOperationError(400, Texts::gpio_invalid, {});
     return;
   }
 
@@ -3606,7 +4980,7 @@ void handleBuiltinLEDControl() {
     builtinLedTested = false;
     message = String(Texts::off);
   } else {
-    sendOperationError(400, Texts::configuration_invalid.str(), {});
+    sendOperationError(400, Texts::configuration_invalid, {});
     return;
   }
 
@@ -3627,20 +5001,22 @@ void handleNeoPixelConfig() {
       // [OPT-007]: Buffer-based message formatting (1 vs 4 allocations)
       char msgBuf[96];
       snprintf(msgBuf, sizeof(msgBuf), "%s %s %d", Texts::config.str().c_str(), Texts::gpio.str().c_str(), LED_PIN);
-      sendOperationSuccess(String(msgBuf), {});
+      sendOperationSuccess(msgBuf, {});
       return;
     }
   }
-  sendOperationError(400, Texts::configuration_invalid.str(), {});
+  sendOperationError(400, Texts::configuration_invalid, {});
 }
 
 void handleNeoPixelTest() {
   bool alreadyRunning = false;
-  bool started = startAsyncTest(neopixelTestRunner, runNeopixelTestTask, alreadyRunning);
+  uint32_t jobId = 0;
+  bool started = startTestJob(neopixelTestJob, alreadyRunning, jobId);
 
   if (started) {
-    sendActionResponse(202, true, String(Texts::test_in_progress), {
+    sendActionResponse(202, true, Texts::test_in_progress, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("available", neopixelAvailable),
       jsonStringField("result", neopixelTestResult)
     });
@@ -3648,8 +5024,9 @@ void handleNeoPixelTest() {
   }
 
   if (alreadyRunning) {
-    sendActionResponse(200, true, String(Texts::test_in_progress), {
+    sendActionResponse(200, true, Texts::test_in_progress, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("available", neopixelAvailable),
       jsonStringField("result", neopixelTestResult)
     });
@@ -3669,7 +5046,7 @@ void handleNeoPixelTest() {
 
 void handleNeoPixelPattern() {
   if (!server.hasArg("pattern")) {
-    sendOperationError(400, Texts::configuration_invalid.str(), {});
+    sendOperationError(400, Texts::configuration_invalid, {});
     return;
   }
 
@@ -3710,7 +5087,7 @@ void handleNeoPixelPattern() {
     neopixelTested = false;
     message = String(Texts::off);
   } else {
-    sendOperationError(400, Texts::configuration_invalid.str(), {});
+    sendOperationError(400, Texts::configuration_invalid, {});
     neopixelRestoreWifiStatus();
     return;
   }
@@ -3721,7 +5098,7 @@ void handleNeoPixelPattern() {
 
 void handleNeoPixelColor() {
   if (!server.hasArg("r") || !server.hasArg("g") || !server.hasArg("b") || !strip) {
-    sendOperationError(400, Texts::configuration_invalid.str());
+    sendOperationError(400, Texts::configuration_invalid);
     return;
   }
 
@@ -3738,6 +5115,10 @@ void handleNeoPixelColor() {
 }
 
 void handleOLEDConfig() {
+  if (i2cBusClaimed()) {
+    sendOperationError(409, "I2C busy", {});
+    return;
+  }
   if (server.hasArg("sda") && server.hasArg("scl") && server.hasArg("rotation")) {
     int newSDA = server.arg("sda").toInt();
     int newSCL = server.arg("scl").toInt();
@@ -3770,7 +5151,7 @@ void handleOLEDConfig() {
       char messageBuffer[128];
       snprintf(messageBuffer, sizeof(messageBuffer), "I2C reconfigure: SDA:%d SCL:%d Rot:%d Res:%dx%d",
                i2c_sda, i2c_scl, oledRotation, oledWidth, oledHeight);
-      sendOperationSuccess(String(messageBuffer), {
+      sendOperationSuccess(messageBuffer, {
         jsonNumberField("sda", i2c_sda),
         jsonNumberField("scl", i2c_scl),
         jsonNumberField("rotation", oledRotation),
@@ -3780,16 +5161,18 @@ void handleOLEDConfig() {
       return;
     }
   }
-  sendOperationError(400, Texts::configuration_invalid.str(), {});
+  sendOperationError(400, Texts::configuration_invalid, {});
 }
 
 void handleOLEDTest() {
   bool alreadyRunning = false;
-  bool started = startAsyncTest(oledTestRunner, runOledTestTask, alreadyRunning, 6144, 1);
+  uint32_t jobId = 0;
+  bool started = startTestJob(oledTestJob, alreadyRunning, jobId);
 
   if (started) {
-    sendActionResponse(202, true, String(Texts::test_in_progress), {
+    sendActionResponse(202, true, Texts::test_in_progress, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("available", oledAvailable),
       jsonStringField("result", oledTestResult)
     });
@@ -3797,14 +5180,19 @@ void handleOLEDTest() {
   }
 
   if (alreadyRunning) {
-    sendActionResponse(200, true, String(Texts::test_in_progress), {
+    sendActionResponse(200, true, Texts::test_in_progress, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("available", oledAvailable),
       jsonStringField("result", oledTestResult)
     });
     return;
   }
 
+  if (i2cBusClaimed()) {  // stockage plein pendant un job I2C : pas de test en ligne
+    sendOperationError(409, "I2C busy", {});
+    return;
+  }
   resetOLEDTest();
   testOLED();
   sendActionResponse(200, oledAvailable, oledTestResult, {
@@ -3816,20 +5204,24 @@ void handleOLEDTest() {
 
 void handleOLEDStep() {
   if (!server.hasArg("step")) {
-    sendOperationError(400, Texts::oled_step_unknown.str(), {});
+    sendOperationError(400, Texts::oled_step_unknown, {});
     return;
   }
 
   String stepId = server.arg("step");
 
+  if (i2cBusClaimed()) {
+    sendOperationError(409, "I2C busy", {});
+    return;
+  }
   if (!oledAvailable) {
-    sendActionResponse(200, false, Texts::oled_step_unavailable.str(), {});
+    sendActionResponse(200, false, Texts::oled_step_unavailable, {});
     return;
   }
 
   bool ok = performOLEDStep(stepId);
   if (!ok) {
-    sendOperationError(400, Texts::oled_step_unknown.str(), {});
+    sendOperationError(400, Texts::oled_step_unknown, {});
     return;
   }
 
@@ -3837,22 +5229,30 @@ void handleOLEDStep() {
   // [OPT-007]: Buffer-based message formatting (1 vs 2 allocations)
   char msgBuf[256];
   snprintf(msgBuf, sizeof(msgBuf), "%s %s", Texts::oled_step_executed_prefix.str().c_str(), label.c_str());
-  sendOperationSuccess(String(msgBuf), {});
+  sendOperationSuccess(msgBuf, {});
 }
 
 void handleOLEDMessage() {
   if (!server.hasArg("message")) {
-    sendOperationError(400, Texts::configuration_invalid.str(), {});
+    sendOperationError(400, Texts::configuration_invalid, {});
     return;
   }
 
+  if (i2cBusClaimed()) {
+    sendOperationError(409, "I2C busy", {});
+    return;
+  }
   String message = server.arg("message");
   oledShowMessage(message);
   // Use translation key instead of hardcoded string
-  sendOperationSuccess(Texts::message_displayed.str(), {});
+  sendOperationSuccess(Texts::message_displayed, {});
 }
 
 void handleOLEDBoot() {
+  if (i2cBusClaimed()) {
+    sendOperationError(409, "I2C busy", {});
+    return;
+  }
   if (!oledAvailable) {
     sendActionResponse(200, false, "OLED not available", {});
     return;
@@ -3862,6 +5262,20 @@ void handleOLEDBoot() {
   sendOperationSuccess("Boot screen displayed", {});
 }
 
+void handleDisplayBenchmark() {
+  if (!serveCachedOrSubmit(displayBenchJob, displayBenchCache, "/api/display-benchmark")) {
+    return;
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("age_ms", millis() - displayBenchCache.updatedMs);
+  json.field("success", displayBench.valid());
+  if (displayBench.valid()) {
+    displayBench.writeJson(json);
+  }
+  json.endObject();
+}
+
 void handleTFTTest() {
 #if ENABLE_TFT_DISPLAY
   if (!tftAvailable) {
@@ -4036,7 +5450,7 @@ void handleTFTConfig() {
       return;
     }
   }
-  sendOperationError(400, Texts::configuration_invalid.str(), {});
+  sendOperationError(400, Texts::configuration_invalid, {});
 #else
   sendActionResponse(200, false, "TFT not enabled");
 #endif
@@ -4086,16 +5500,19 @@ void handleTFTBrightness() {
 
 void handleADCTest() {
   testADC();
-  String json;
-  json.reserve(adcReadings.size() * 60 + 50);  // Estimate size to avoid reallocations
-  json = "{\"readings\":[";
-  for (size_t i = 0; i < adcReadings.size(); i++) {
-    if (i > 0) json += ",";
-    json += "{\"pin\":" + String(adcReadings[i].pin) + ",\"raw\":" + String(adcReadings[i].rawValue) +
-            ",\"voltage\":" + String(adcReadings[i].voltage, 2) + "}";
+  ApiResponse json(200);
+  json.beginObject();
+  json.beginArray("readings");
+  for (const auto& reading : adcReadings) {
+    json.beginObject();
+    json.field("pin", reading.pin);
+    json.field("raw", reading.rawValue);
+    json.fieldFloat("voltage", reading.voltage, 2);
+    json.endObject();
   }
-  json += "],\"result\":\"" + adcTestResult + "\"}";
-  server.send(200, "application/json", json);
+  json.endArray();
+  json.field("result", adcTestResult);
+  json.endObject();
 }
 
 void handlePWMTest() {
@@ -4132,17 +5549,19 @@ void handleRGBLedConfig() {
     // [OPT-009]: Use OK_STR constant instead of String(Texts::ok)
     sendActionResponse(200, true, OK_STR, {});
   } else {
-    sendActionResponse(400, false, String(Texts::configuration_invalid), {});
+    sendActionResponse(400, false, Texts::configuration_invalid, {});
   }
 }
 
 void handleRGBLedTest() {
   bool alreadyRunning = false;
-  bool started = startAsyncTest(rgbLedTestRunner, runRgbLedTestTask, alreadyRunning, 3072, 1);
+  uint32_t jobId = 0;
+  bool started = startTestJob(rgbLedTestJob, alreadyRunning, jobId);
 
   if (started) {
     sendJsonResponse(202, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("success", rgbLedAvailable),
       jsonStringField("result", rgbLedTestResult)
     });
@@ -4152,6 +5571,7 @@ void handleRGBLedTest() {
   if (alreadyRunning) {
     sendJsonResponse(200, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("success", rgbLedAvailable),
       jsonStringField("result", rgbLedTestResult)
     });
@@ -4174,7 +5594,7 @@ void handleRGBLedColor() {
     setRGBLedColor(r, g, b);
     sendActionResponse(200, true, "RGB(" + String(r) + "," + String(g) + "," + String(b) + ")", {});
   } else {
-    sendActionResponse(400, false, String(Texts::configuration_invalid), {});
+    sendActionResponse(400, false, Texts::configuration_invalid, {});
   }
 }
 
@@ -4184,17 +5604,19 @@ void handleBuzzerConfig() {
     // [OPT-009]: Use OK_STR constant instead of String(Texts::ok)
     sendActionResponse(200, true, OK_STR, {});
   } else {
-    sendActionResponse(400, false, String(Texts::configuration_invalid), {});
+    sendActionResponse(400, false, Texts::configuration_invalid, {});
   }
 }
 
 void handleBuzzerTest() {
   bool alreadyRunning = false;
-  bool started = startAsyncTest(buzzerTestRunner, runBuzzerTestTask, alreadyRunning, 3072, 1);
+  uint32_t jobId = 0;
+  bool started = startTestJob(buzzerTestJob, alreadyRunning, jobId);
 
   if (started) {
     sendJsonResponse(202, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("success", buzzerAvailable),
       jsonStringField("result", buzzerTestResult)
     });
@@ -4204,6 +5626,7 @@ void handleBuzzerTest() {
   if (alreadyRunning) {
     sendJsonResponse(200, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("success", buzzerAvailable),
       jsonStringField("result", buzzerTestResult)
     });
@@ -4225,7 +5648,7 @@ void handleBuzzerTone() {
     playBuzzerTone(freq, duration);
     sendActionResponse(200, true, String(freq) + "Hz", {});
   } else {
-    sendActionResponse(400, false, String(Texts::configuration_invalid), {});
+    sendActionResponse(400, false, Texts::configuration_invalid, {});
   }
 }
 
@@ -4253,7 +5676,7 @@ void handleDHTConfig() {
       DHT_SENSOR_TYPE = candidate;
       updated = true;
     } else {
-      sendActionResponse(400, false, String(Texts::configuration_invalid), {});
+      sendActionResponse(400, false, Texts::configuration_invalid, {});
       return;
     }
   }
@@ -4261,16 +5684,19 @@ void handleDHTConfig() {
   if (updated) {
     sendActionResponse(200,
                        true,
-                       String(Texts::ok),
+                       Texts::ok,
                        {jsonNumberField("type", static_cast<int>(DHT_SENSOR_TYPE))});
   } else {
-    sendActionResponse(400, false, String(Texts::configuration_invalid), {});
+    sendActionResponse(400, false, Texts::configuration_invalid, {});
   }
 }
 
 void handleDHTTest() {
-  testDHTSensor();
+  if (!serveCachedOrSubmit(dhtTestJob, dhtTestCache, "/api/dht-test")) {
+    return;
+  }
   sendJsonResponse(200, {
+    jsonNumberField("age_ms", millis() - dhtTestCache.updatedMs),
     jsonBoolField("success", dhtAvailable),
     jsonStringField("result", dhtTestResult),
     jsonFloatField("temperature", dhtTemperature, 1),
@@ -4285,7 +5711,7 @@ void handleLightSensorConfig() {
     // [OPT-009]: Use OK_STR constant instead of String(Texts::ok)
     sendActionResponse(200, true, OK_STR, {});
   } else {
-    sendActionResponse(400, false, String(Texts::configuration_invalid), {});
+    sendActionResponse(400, false, Texts::configuration_invalid, {});
   }
 }
 
@@ -4305,7 +5731,7 @@ void handleDistanceSensorConfig() {
     // [OPT-009]: Use OK_STR constant instead of String(Texts::ok)
     sendActionResponse(200, true, OK_STR, {});
   } else {
-    sendActionResponse(400, false, String(Texts::configuration_invalid), {});
+    sendActionResponse(400, false, Texts::configuration_invalid, {});
   }
 }
 
@@ -4324,7 +5750,7 @@ void handleMotionSensorConfig() {
     // [OPT-009]: Use OK_STR constant instead of String(Texts::ok)
     sendActionResponse(200, true, OK_STR, {});
   } else {
-    sendActionResponse(400, false, String(Texts::configuration_invalid), {});
+    sendActionResponse(400, false, Texts::configuration_invalid, {});
   }
 }
 
@@ -4338,7 +5764,25 @@ void handleMotionSensorTest() {
 }
 
 // ========== SD CARD HANDLERS ==========
+// La claim RES_SPI_HOST ne protège que les jobs entre eux : tant qu'un test ou
+// un banc SD est en file ou en cours (le banc démonte et remonte la carte à
+// chaque fréquence et garde son fichier ouvert), les handlers ne touchent pas à SD
+static bool rejectIfSdBusy() {
+  uint32_t jobId = jobScheduler.activeJob(sdBenchJob);
+  if (jobId == 0) {
+    jobId = jobScheduler.activeJob(sdTestJob);
+  }
+  if (jobId == 0) {
+    return false;
+  }
+  sendOperationError(409, "SD busy", {jsonNumberField("job_id", jobId)});
+  return true;
+}
+
 void handleSDConfig() {
+  if (rejectIfSdBusy()) {
+    return;
+  }
   if (server.hasArg("miso") && server.hasArg("mosi") &&
       server.hasArg("sclk") && server.hasArg("cs")) {
     sd_miso_pin = server.arg("miso").toInt();
@@ -4349,17 +5793,19 @@ void handleSDConfig() {
     resetSDTest();
     sendActionResponse(200, true, OK_STR, {});
   } else {
-    sendActionResponse(400, false, String(Texts::configuration_invalid), {});
+    sendActionResponse(400, false, Texts::configuration_invalid, {});
   }
 }
 
 void handleSDTest() {
   bool alreadyRunning = false;
-  bool started = startAsyncTest(sdTestRunner, runSDTestTask, alreadyRunning, 6144, 1);
+  uint32_t jobId = 0;
+  bool started = startTestJob(sdTestJob, alreadyRunning, jobId);
 
   if (started) {
     sendJsonResponse(202, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("success", sdAvailable),
       jsonStringField("result", sdTestResult)
     });
@@ -4369,12 +5815,16 @@ void handleSDTest() {
   if (alreadyRunning) {
     sendJsonResponse(200, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("success", sdAvailable),
       jsonStringField("result", sdTestResult)
     });
     return;
   }
 
+  if (rejectIfSdBusy()) {  // stockage plein pendant un banc : pas de test en ligne
+    return;
+  }
   testSD();
   sendJsonResponse(200, {
     jsonBoolField("running", false),
@@ -4384,6 +5834,9 @@ void handleSDTest() {
 }
 
 void handleSDInfo() {
+  if (rejectIfSdBusy()) {
+    return;
+  }
   if (!sdAvailable) {
     initSD();
   }
@@ -4398,7 +5851,41 @@ void handleSDInfo() {
   });
 }
 
+void handleSDBenchmark() {
+  if (server.hasArg("saved")) {  // dernier résultat enregistré en NVS, sans lancer de banc
+    if (!sdBench.hasSaved()) {
+      sendOperationError(404, "No saved SD benchmark", {});
+      return;
+    }
+    ApiResponse json(200);
+    json.beginObject();
+    sdBench.writeSavedJson(json);
+    json.endObject();
+    return;
+  }
+  if (server.hasArg("size_kb") && jobScheduler.activeJob(sdBenchJob) == 0) {
+    const unsigned long sizeKb = strtoul(server.arg("size_kb").c_str(), nullptr, 10);
+    sdBenchFileKb = constrain(sizeKb, 16UL, 16384UL);
+  }
+  if (!serveCachedOrSubmit(sdBenchJob, sdBenchCache, "/api/sd-benchmark")) {
+    return;
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("age_ms", millis() - sdBenchCache.updatedMs);
+  json.field("success", sdBench.valid());
+  if (sdBench.valid()) {
+    sdBench.writeJson(json);
+  } else {
+    json.field("result", sdTestResult);
+  }
+  json.endObject();
+}
+
 void handleSDTestRead() {
+  if (rejectIfSdBusy()) {
+    return;
+  }
   if (!sdAvailable) {
     initSD();
   }
@@ -4406,7 +5893,7 @@ void handleSDTestRead() {
   if (!sdAvailable) {
     sendJsonResponse(200, {
       jsonBoolField("success", false),
-      jsonStringField("result", String(Texts::not_available))
+      jsonStringField("result", Texts::not_available)
     });
     return;
   }
@@ -4443,6 +5930,9 @@ void handleSDTestRead() {
 }
 
 void handleSDTestWrite() {
+  if (rejectIfSdBusy()) {
+    return;
+  }
   if (!sdAvailable) {
     initSD();
   }
@@ -4450,7 +5940,7 @@ void handleSDTestWrite() {
   if (!sdAvailable) {
     sendJsonResponse(200, {
       jsonBoolField("success", false),
-      jsonStringField("result", String(Texts::not_available))
+      jsonStringField("result", Texts::not_available)
     });
     return;
   }
@@ -4479,6 +5969,9 @@ void handleSDTestWrite() {
 }
 
 void handleSDFormat() {
+  if (rejectIfSdBusy()) {
+    return;
+  }
   if (!sdAvailable) {
     initSD();
   }
@@ -4486,7 +5979,7 @@ void handleSDFormat() {
   if (!sdAvailable) {
     sendJsonResponse(200, {
       jsonBoolField("success", false),
-      jsonStringField("result", String(Texts::not_available))
+      jsonStringField("result", Texts::not_available)
     });
     return;
   }
@@ -4495,6 +5988,7 @@ void handleSDFormat() {
   SD.remove("/test_esp32.txt");
   SD.remove("/test_read.txt");
   SD.remove("/test_write.txt");
+  SD.remove(SD_BENCH_FILE);
 
   // Note: Full SD card formatting requires low-level access
   // This is a basic cleanup of test files
@@ -4516,17 +6010,19 @@ void handleRotaryConfig() {
     resetRotaryTest();
     sendActionResponse(200, true, OK_STR);
   } else {
-    sendActionResponse(400, false, String(Texts::configuration_invalid));
+    sendActionResponse(400, false, Texts::configuration_invalid);
   }
 }
 
 void handleRotaryTest() {
   bool alreadyRunning = false;
-  bool started = startAsyncTest(rotaryTestRunner, runRotaryTestTask, alreadyRunning, 4096, 1);
+  uint32_t jobId = 0;
+  bool started = startTestJob(rotaryTestJob, alreadyRunning, jobId);
 
   if (started) {
     sendJsonResponse(202, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("success", rotaryAvailable),
       jsonStringField("result", rotaryTestResult)
     });
@@ -4536,6 +6032,7 @@ void handleRotaryTest() {
   if (alreadyRunning) {
     sendJsonResponse(200, {
       jsonBoolField("running", true),
+      jsonNumberField("job_id", jobId),
       jsonBoolField("success", rotaryAvailable),
       jsonStringField("result", rotaryTestResult)
     });
@@ -4630,909 +6127,1943 @@ void handleButtonState() {
 // GPS Handlers
 void handleGPSData() {
   updateGPS();
-  String json;
-  json.reserve(400);
-  json = "{";
-  json += "\"valid\":" + String(gpsData.valid ? "true" : "false") + ",";
-  json += "\"hasFix\":" + String(gpsData.hasFix ? "true" : "false") + ",";
-  json += "\"latitude\":" + String(gpsData.latitude, 6) + ",";
-  json += "\"longitude\":" + String(gpsData.longitude, 6) + ",";
-  json += "\"altitude\":" + String(gpsData.altitude, 2) + ",";
-  json += "\"satellites\":" + String(gpsData.satellites) + ",";
-  json += "\"satellites_used\":" + String(gpsData.satellites_used) + ",";
-  json += "\"hdop\":" + String(gpsData.hdop, 2) + ",";
-  json += "\"speed\":" + String(gpsData.speed, 2) + ",";
-  json += "\"course\":" + String(gpsData.course, 2) + ",";
-  json += "\"fix_type\":\"" + gpsData.fix_type + "\",";
-  json += "\"status\":\"" + gpsData.status_str + "\",";
-  json += "\"time\":\"" + String(gpsData.hour) + ":" + String(gpsData.minute) + ":" + String(gpsData.second) + "\",";
-  json += "\"date\":\"" + String(gpsData.day) + "/" + String(gpsData.month) + "/" + String(gpsData.year) + "\"";
-  json += "}";
-  
-  server.send(200, "application/json", json);
+  char timeStr[12];
+  char dateStr[12];
+  snprintf(timeStr, sizeof(timeStr), "%u:%u:%u", gpsData.hour, gpsData.minute, gpsData.second);
+  snprintf(dateStr, sizeof(dateStr), "%u/%u/%u", gpsData.day, gpsData.month, gpsData.year);
+
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("valid", gpsData.valid);
+  json.field("hasFix", gpsData.hasFix);
+  json.fieldFloat("latitude", gpsData.latitude, 6);
+  json.fieldFloat("longitude", gpsData.longitude, 6);
+  json.fieldFloat("altitude", gpsData.altitude, 2);
+  json.field("satellites", gpsData.satellites);
+  json.field("satellites_used", gpsData.satellites_used);
+  json.fieldFloat("hdop", gpsData.hdop, 2);
+  json.fieldFloat("speed", gpsData.speed, 2);
+  json.fieldFloat("course", gpsData.course, 2);
+  json.field("fix_type", gpsData.fix_type);
+  json.field("status", gpsData.status_str);
+  json.field("time", timeStr);
+  json.field("date", dateStr);
+  json.endObject();
 }
 
 void handleGPSTest() {
-  testGPS();
-  String json;
-  json.reserve(200);
-  json = "{";
-  json += "\"success\":" + String(gpsAvailable ? "true" : "false") + ",";
-  json += "\"result\":\"" + gpsTestResult + "\",";
-  json += "\"available\":" + String(gpsAvailable ? "true" : "false");
-  json += "}";
-  
-  server.send(200, "application/json", json);
+  if (!serveCachedOrSubmit(gpsTestJob, gpsTestCache, "/api/gps-test")) {
+    return;
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("age_ms", millis() - gpsTestCache.updatedMs);
+  json.field("success", gpsAvailable);
+  json.field("result", gpsTestResult);
+  json.field("available", gpsAvailable);
+  json.endObject();
 }
 
 // Environmental Sensors Handlers
 void handleEnvironmentalSensors() {
-  updateEnvironmentalSensors();
-  String json;
-  json.reserve(400);
-  json = "{";
-  json += "\"aht20_available\":" + String(envData.aht20_available ? "true" : "false") + ",";
-  json += "\"bmp280_available\":" + String(envData.bmp280_available ? "true" : "false") + ",";
-  json += "\"temperature_avg\":" + String(envData.temperature_avg, 1) + ",";
-  json += "\"humidity\":" + String(envData.humidity, 1) + ",";
-  json += "\"pressure\":" + String(envData.pressure, 2) + ",";
-  json += "\"altitude\":" + String(envData.altitude, 1) + ",";
-  json += "\"aht20_temp\":" + String(envData.temperature_aht20, 1) + ",";
-  json += "\"bmp280_temp\":" + String(envData.temperature_bmp280, 1) + ",";
-  json += "\"aht20_status\":\"" + envData.aht20_status + "\",";
-  json += "\"bmp280_status\":\"" + envData.bmp280_status + "\",";
-  json += "\"combined_status\":\"" + envData.combined_status + "\"";
-  json += "}";
-  
-  server.send(200, "application/json", json);
+  if (!i2cBusClaimed()) {
+    updateEnvironmentalSensors();  // sinon : dernières valeurs lues
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("aht20_available", envData.aht20_available);
+  json.field("bmp280_available", envData.bmp280_available);
+  json.fieldFloat("temperature_avg", envData.temperature_avg, 1);
+  json.fieldFloat("humidity", envData.humidity, 1);
+  json.fieldFloat("pressure", envData.pressure, 2);
+  json.fieldFloat("altitude", envData.altitude, 1);
+  json.fieldFloat("aht20_temp", envData.temperature_aht20, 1);
+  json.fieldFloat("bmp280_temp", envData.temperature_bmp280, 1);
+  json.field("aht20_status", envData.aht20_status);
+  json.field("bmp280_status", envData.bmp280_status);
+  json.field("combined_status", envData.combined_status);
+  json.endObject();
 }
 
 void handleEnvironmentalTest() {
+  if (i2cBusClaimed()) {
+    sendOperationError(409, "I2C busy", {});
+    return;
+  }
   testEnvironmentalSensors();
-  String json;
-  json.reserve(200);
-  json = "{";
-  json += "\"success\":" + String(envSensorAvailable ? "true" : "false") + ",";
-  json += "\"result\":\"" + envSensorTestResult + "\",";
-  json += "\"available\":" + String(envSensorAvailable ? "true" : "false");
-  json += "}";
-  
-  server.send(200, "application/json", json);
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("success", envSensorAvailable);
+  json.field("result", envSensorTestResult);
+  json.field("available", envSensorAvailable);
+  json.endObject();
 }
 
 void handleBenchmark() {
-  unsigned long cpuTime = benchmarkCPU();
-  unsigned long memTime = benchmarkMemory();
-
-  diagnosticData.cpuBenchmark = cpuTime;
-  diagnosticData.memBenchmark = memTime;
-
-  // Provide derived benchmark metrics for richer telemetry
-  // Combined memory stress metrics for the benchmark API
-  memoryStressTest();
-
-  double cpuPerf = 100000.0 / static_cast<double>(cpuTime);
-  double memSpeed = (10000.0 * sizeof(int) * 2.0) / static_cast<double>(memTime);
-  sendJsonResponse(200, {
-    jsonNumberField("cpu", cpuTime),
-    jsonNumberField("memory", memTime),
-    jsonFloatField("cpuPerf", cpuPerf, 2),
-    jsonFloatField("memSpeed", memSpeed, 2),
-    jsonNumberField("allocations", static_cast<unsigned long>(stressAllocationCount)),
-    jsonNumberField("stressDuration", stressDurationMs),
-    jsonStringField("stress", stressTestResult),
-    jsonStringField("allocationsLabel", stressTestResult)
+  if (!serveCachedOrSubmit(benchmarkJob, benchmarkCache, "/api/benchmark")) {
+    return;
+  }
+  const unsigned long cpuTime = diagnosticData.cpuBenchmark;
+  const unsigned long memTime = diagnosticData.memBenchmark;
+
+  // cpuPerf : opérations nominales par us sur le coeur de l'application
+  double cpuPerf = cpuBench.valid() ? cpuBench.score(cpuBench.cores() - 1) : 0.0;
+  // memTime vaut 0 quand le tampon de travail n'a pas pu être pris : pas de débit
+  const bool memValid = memTime > 0;
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("age_ms", millis() - benchmarkCache.updatedMs);
+  json.field("cpu", cpuTime);
+  json.field("memory", memTime);
+  json.fieldFloat("cpuPerf", cpuPerf, 2);
+  if (memValid) {
+    json.fieldFloat("memSpeed", (10000.0 * sizeof(int) * 2.0) / static_cast<double>(memTime), 2);
+  } else {
+    json.fieldNull("memSpeed");
+  }
+  json.field("memValid", memValid);
+  json.field("allocations", static_cast<unsigned long>(stressAllocationCount));
+  json.field("stressDuration", stressDurationMs);
+  json.field("stress", stressTestResult);
+  json.field("allocationsLabel", stressTestResult);
+  if (cpuBench.valid()) {
+    json.beginObject("cpu_suite");
+    cpuBench.writeJson(json);
+    json.endObject();
+  }
+  if (memoryCurvesMs > 0) {
+    json.beginObject("memory_hierarchy");
+    writeMemoryHierarchy(json);
+    json.endObject();
+  }
+  json.endObject();
+}
+
+// ========== SECTION WRITERS ==========
+// Optional field projection for /api/batch: "key" applies to every section,
+// "section.key" to one section. A section with no matching entry is complete.
+struct FieldProjection {
+  static const uint8_t MAX_ENTRIES = 24;
+
+  char buffer[160];
+  const char* entries[MAX_ENTRIES];
+  uint8_t count = 0;
+
+  // false when the list is too long to be honoured
+  bool parse(const String& list) {
+    count = 0;
+    if (list.length() >= sizeof(buffer)) {
+      return false;
+    }
+    strlcpy(buffer, list.c_str(), sizeof(buffer));
+    char* saveptr = nullptr;
+    for (char* token = strtok_r(buffer, ",", &saveptr); token != nullptr; token = strtok_r(nullptr, ",", &saveptr)) {
+      if (count >= MAX_ENTRIES) {
+        return false;
+      }
+      entries[count++] = token;
+    }
+    return true;
+  }
+
+  bool selectsSection(const char* section) const {
+    for (uint8_t i = 0; i < count; ++i) {
+      if (entryMatches(entries[i], section, nullptr)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool matches(const char* section, const char* key) const {
+    for (uint8_t i = 0; i < count; ++i) {
+      if (entryMatches(entries[i], section, key)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  // key == nullptr: does the entry concern this section at all
+  static bool entryMatches(const char* entry, const char* section, const char* key) {
+    const char* dot = strchr(entry, '.');
+    if (dot == nullptr) {
+      return key == nullptr || strcmp(entry, key) == 0;
+    }
+    size_t sectionLength = static_cast<size_t>(dot - entry);
+    if (section == nullptr || strlen(section) != sectionLength || strncmp(entry, section, sectionLength) != 0) {
+      return false;
+    }
+    return key == nullptr || strcmp(dot + 1, key) == 0;
+  }
+};
+
+// Writes the members of one section, dropping those the projection excludes
+class SectionWriter {
+ public:
+  explicit SectionWriter(DataWriter& json, const char* section = nullptr, const FieldProjection* projection = nullptr)
+      : json_(json), section_(section),
+        projection_((projection != nullptr && projection->selectsSection(section)) ? projection : nullptr) {}
+
+  template <typename T>
+  void field(const char* key, const T& value) {
+    if (wanted(key)) {
+      json_.field(key, value);
+    }
+  }
+
+  void fieldFloat(const char* key, double value, uint8_t decimals) {
+    if (wanted(key)) {
+      json_.fieldFloat(key, value, decimals);
+    }
+  }
+
+  template <typename WriteFn>
+  void member(const char* key, WriteFn write) {
+    if (wanted(key)) {
+      write(json_);
+    }
+  }
+
+ private:
+  bool wanted(const char* key) const { return projection_ == nullptr || projection_->matches(section_, key); }
+
+  DataWriter& json_;
+  const char* section_;
+  const FieldProjection* projection_;
+};
+
+template <typename Sink>
+static void writeSystemSection(Sink& out, const DiagnosticInfo& diag) {
+  out.field("chipModel", diag.chipModel);
+  out.field("chipRevision", diag.chipRevision);
+  out.field("cpuCores", diag.cpuCores);
+  out.field("cpuFreq", diag.cpuFreqMHz);
+  out.field("macAddress", diag.macAddress);
+  out.field("ipAddress", diag.ipAddress);
+  out.field("mdnsReady", diag.mdnsAvailable);
+  out.field("uptime", diag.uptime);
+  if (diag.temperature != -999) {
+    out.fieldFloat("temperature", diag.temperature, 1);
+  }
+}
+
+template <typename Sink>
+static void writeLedsSection(Sink& out) {
+  out.member("builtin", [](DataWriter& json) {
+    json.beginObject("builtin");
+    json.field("pin", BUILTIN_LED_PIN);
+    json.field("status", builtinLedTestResult);
+    json.endObject();
+  });
+  out.member("neopixel", [](DataWriter& json) {
+    json.beginObject("neopixel");
+    json.field("pin", LED_PIN);
+    json.field("count", LED_COUNT);
+    json.field("status", neopixelTestResult);
+    json.endObject();
+  });
+}
+
+template <typename Sink>
+static void writeScreensSection(Sink& out) {
+  out.member("oled", [](DataWriter& json) {
+    json.beginObject("oled");
+    json.field("available", oledAvailable);
+    json.field("status", oledTestResult);
+    json.beginObject("pins");
+    json.field("sda", i2c_sda);
+    json.field("scl", i2c_scl);
+    json.endObject();
+    json.field("rotation", oledRotation);
+    json.field("width", oledWidth);
+    json.field("height", oledHeight);
+    json.endObject();
+  });
+  out.member("tft", [](DataWriter& json) {
+    json.beginObject("tft");
+    #if ENABLE_TFT_DISPLAY
+    json.field("available", true);
+    json.field("status", tftTestResult.length() > 0 ? tftTestResult.c_str() : "Ready");
+    json.field("driver", tftDriver);  // v3.30.0: Current TFT driver
+    json.field("width", tftWidth);
+    json.field("height", tftHeight);
+    json.field("rotation", tftRotation);
+    json.beginObject("pins");
+    json.field("miso", tftMISO);
+    json.field("mosi", tftMOSI);
+    json.field("sclk", tftSCLK);
+    json.field("cs", tftCS);
+    json.field("dc", tftDC);
+    json.field("rst", tftRST);
+    json.field("bl", tftBL);
+    json.endObject();
+    #else
+    json.field("available", false);
+    json.field("status", "Not enabled");
+    #endif
+    json.endObject();
+  });
+}
+
+// Last I2C scan (boot, /api/i2c-scan, /api/peripherals), no rescan
+template <typename Sink>
+static void writePeripheralsSection(Sink& out) {
+  out.member("i2c", [](DataWriter& json) {
+    json.beginObject("i2c");
+    json.field("count", diagnosticData.i2cCount);
+    json.field("devices", diagnosticData.i2cDevices);
+    json.endObject();
+  });
+  out.member("gpio", [](DataWriter& json) {
+    json.beginObject("gpio");
+    json.field("total", diagnosticData.totalGPIO);
+    json.field("list", diagnosticData.gpioList);
+    json.endObject();
+  });
+}
+
+void handleStatus() {
+  TelemetryReader telemetry;
+  const DiagnosticInfo& diag = telemetry.diag();
+  const DetailedMemoryInfo& memory = telemetry.memory();
+
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("connected", WiFi.status() == WL_CONNECTED);
+  json.field("uptime", millis());
+  json.fieldFloat("temperature", diag.temperature, 2);
+  json.beginObject("sram");
+  json.field("total", memory.sramTotal);
+  json.field("free", memory.sramFree);
+  json.field("used", memory.sramUsed);
+  json.endObject();
+  json.beginObject("psram");
+  json.field("total", memory.psramTotal);
+  json.field("free", memory.psramFree);
+  json.field("used", memory.psramUsed);
+  json.endObject();
+  json.fieldFloat("fragmentation", memory.fragmentationPercent, 1);
+  json.field("snapshot_age_ms", telemetry.ageMs());
+  json.endObject();
+}
+
+void handleSystemInfo() {
+  TelemetryReader telemetry;
+  const DiagnosticInfo& diag = telemetry.diag();
+
+  ApiResponse json(200);
+  json.beginObject();
+  SectionWriter out(json);
+  writeSystemSection(out, diag);
+  json.field("snapshot_age_ms", telemetry.ageMs());
+  json.endObject();
+}
+
+void handleMemory() {
+  TelemetryReader telemetry;
+  const DiagnosticInfo& diag = telemetry.diag();
+  const DetailedMemoryInfo& memory = telemetry.memory();
+
+  ApiResponse json(200);
+  json.beginObject();
+  json.beginObject("heap");
+  json.field("total", diag.heapSize);
+  json.field("free", diag.freeHeap);
+  json.field("used", diag.heapSize - diag.freeHeap);
+  json.endObject();
+  json.beginObject("psram");
+  json.field("total", memory.psramTotal);
+  json.field("free", memory.psramFree);
+  json.field("used", memory.psramUsed);
+  json.endObject();
+  json.fieldFloat("fragmentation", memory.fragmentationPercent, 1);
+  json.field("snapshot_age_ms", telemetry.ageMs());
+  json.endObject();
+}
+
+void handleWiFiInfo() {
+  char gateway[16];
+  char dns[16];
+  formatIPAddress(WiFi.gatewayIP(), gateway, sizeof(gateway));
+  formatIPAddress(WiFi.dnsIP(), dns, sizeof(dns));
+
+  TelemetryReader telemetry;
+  const DiagnosticInfo& diag = telemetry.diag();
+
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("connected", WiFi.status() == WL_CONNECTED);
+  json.field("ssid", diag.wifiSSID);
+  json.field("rssi", diag.wifiRSSI);
+  json.field("quality_key", getWiFiSignalQualityKey(diag.wifiRSSI));
+  json.field("quality", getWiFiSignalQuality(diag.wifiRSSI));
+  json.field("ip", diag.ipAddress);
+  json.field("gateway", gateway);
+  json.field("dns", dns);
+  json.field("snapshot_age_ms", telemetry.ageMs());
+  json.endObject();
+}
+
+// ========== EVENT STREAM (SSE) ==========
+// [OPT-014]: /api/events pousse les mesures au lieu du polling navigateur.
+// Chaque client choisit ses topics et sa cadence maximale ; seuls les champs dont
+// la valeur sérialisée a changé depuis son dernier envoi sont transmis.
+enum EventTopic : uint8_t {
+  EVENT_TOPIC_STATUS = 0,
+  EVENT_TOPIC_MEMORY,
+  EVENT_TOPIC_WIFI,
+  EVENT_TOPIC_BUTTONS,
+  EVENT_TOPIC_ROTARY,
+  EVENT_TOPIC_GPS,
+  EVENT_TOPIC_ENV,
+  EVENT_TOPIC_COUNT
+};
+
+static const char* const EVENT_TOPIC_NAMES[EVENT_TOPIC_COUNT] = {
+  "status", "memory", "wifi", "buttons", "rotary", "gps", "env"
+};
+
+// Pas un topic télémétrie : un événement "job" par job terminé (résultat prêt)
+static const uint8_t EVENT_JOBS = 1 << EVENT_TOPIC_COUNT;
+static const uint8_t EVENT_TOPIC_ALL = ((1 << EVENT_TOPIC_COUNT) - 1) | EVENT_JOBS;
+static_assert(EVENT_TOPIC_COUNT < 8, "topics and the jobs flag share an 8-bit mask");
+static const uint8_t EVENT_MAX_FIELDS = 16;  // champs suivis par topic
+
+struct EventStreamClient {
+  WiFiClient client;
+  bool active;
+  bool failed;
+  uint8_t topics;   // masque de EventTopic
+  uint8_t primed;   // topics déjà envoyés en entier
+  uint16_t intervalMs;
+  unsigned long lastPushMs;
+  unsigned long lastWriteMs;
+  uint32_t hashes[EVENT_TOPIC_COUNT][EVENT_MAX_FIELDS];
+};
+
+static EventStreamClient eventClients[EVENT_STREAM_MAX_CLIENTS];
+static unsigned long lastEventSensorReadMs = 0;
+static uint32_t lastJobEventSeq = 0;
+static const uint32_t EVENT_STREAM_GPS_READ_MS = 100;  // lecture du port série GPS tant que le topic est suivi
+
+// Compare the serialized form of each member with the hash last sent to the
+// client. Probe pass (out == nullptr) only counts changes; the write pass emits
+// changed members and records their hashes.
+class EventDelta {
+ public:
+  EventDelta(uint32_t* hashes, bool primed, DataWriter* out)
+      : hashes_(hashes), primed_(primed), out_(out), index_(0), changes_(0) {}
+
+  template <typename T>
+  void field(const char* key, const T& value) {
+    member(key, [&](DataWriter& json) { json.field(key, value); });
+  }
+
+  void fieldFloat(const char* key, double value, uint8_t decimals) {
+    member(key, [&](DataWriter& json) { json.fieldFloat(key, value, decimals); });
+  }
+
+  template <typename WriteFn>
+  void member(const char* key, WriteFn write) {
+    (void)key;  // members are tracked by position
+    uint32_t hash = FNV1A_OFFSET_BASIS;
+    char scratch[32];
+    JsonWriter hasher(scratch, sizeof(scratch), hashChunk, &hash);
+    write(hasher);
+    hasher.flush();
+
+    bool tracked = index_ < EVENT_MAX_FIELDS;
+    if (!primed_ || !tracked || hashes_[index_] != hash) {
+      ++changes_;
+      if (out_ != nullptr) {
+        write(*out_);
+        if (tracked) {
+          hashes_[index_] = hash;
+        }
+      }
+    }
+    ++index_;
+  }
+
+  size_t changes() const { return changes_; }
+
+ private:
+  static void hashChunk(const char* data, size_t length, void* context) {
+    uint32_t* hash = static_cast<uint32_t*>(context);
+    *hash = fnv1aHash(data, length, *hash);
+  }
+
+  uint32_t* hashes_;
+  bool primed_;
+  DataWriter* out_;
+  uint8_t index_;
+  size_t changes_;
+};
+
+// Shared by /api/events (EventDelta) and /api/batch (SectionWriter)
+template <typename Sink>
+static void writeTopicSection(EventTopic topic, Sink& out, const TelemetrySnapshot& snapshot) {
+  switch (topic) {
+    case EVENT_TOPIC_STATUS: {
+      const DiagnosticInfo& diag = snapshot.diag;
+      const DetailedMemoryInfo& memory = snapshot.memory;
+      out.field("connected", WiFi.status() == WL_CONNECTED);
+      out.field("uptime", diag.uptime);
+      out.fieldFloat("temperature", diag.temperature, 1);
+      out.member("sram", [&](DataWriter& json) {
+        json.beginObject("sram");
+        json.field("total", memory.sramTotal);
+        json.field("free", memory.sramFree);
+        json.field("used", memory.sramUsed);
+        json.endObject();
+      });
+      out.member("psram", [&](DataWriter& json) {
+        json.beginObject("psram");
+        json.field("total", memory.psramTotal);
+        json.field("free", memory.psramFree);
+        json.field("used", memory.psramUsed);
+        json.endObject();
+      });
+      out.fieldFloat("fragmentation", memory.fragmentationPercent, 1);
+      break;
+    }
+    case EVENT_TOPIC_MEMORY: {
+      const DiagnosticInfo& diag = snapshot.diag;
+      const DetailedMemoryInfo& memory = snapshot.memory;
+      out.member("heap", [&](DataWriter& json) {
+        json.beginObject("heap");
+        json.field("total", diag.heapSize);
+        json.field("free", diag.freeHeap);
+        json.field("used", diag.heapSize - diag.freeHeap);
+        json.endObject();
+      });
+      out.member("psram", [&](DataWriter& json) {
+        json.beginObject("psram");
+        json.field("total", memory.psramTotal);
+        json.field("free", memory.psramFree);
+        json.field("used", memory.psramUsed);
+        json.endObject();
+      });
+      out.field("sram_largest_block", memory.sramLargestBlock);
+      out.field("psram_largest_block", memory.psramLargestBlock);
+      out.fieldFloat("fragmentation", memory.fragmentationPercent, 1);
+      break;
+    }
+    case EVENT_TOPIC_WIFI: {
+      const DiagnosticInfo& diag = snapshot.diag;
+      out.field("connected", WiFi.status() == WL_CONNECTED);
+      out.field("ssid", diag.wifiSSID);
+      out.field("rssi", diag.wifiRSSI);
+      out.field("quality_key", getWiFiSignalQualityKey(diag.wifiRSSI));
+      out.field("ip", diag.ipAddress);
+      break;
+    }
+    case EVENT_TOPIC_BUTTONS: {
+      // LOW = pressed (pull-up), -1 = pin unavailable
+      int bootState = getButtonBootState();
+      int button1State = getButton1State();
+      int button2State = getButton2State();
+      out.field("boot_pressed", bootState == LOW);
+      out.field("button1_pressed", button1State == LOW);
+      out.field("button2_pressed", button2State == LOW);
+      out.field("boot_available", bootState != -1);
+      out.field("button1_available", button1State != -1);
+      out.field("button2_available", button2State != -1);
+      break;
+    }
+    case EVENT_TOPIC_ROTARY: {
+      int buttonGPIOState = getRotaryButtonGPIOState();
+      out.field("position", static_cast<int32_t>(rotaryPosition));
+      out.field("button_pressed", buttonGPIOState == LOW);
+      out.field("available", rotaryAvailable);
+      break;
+    }
+    case EVENT_TOPIC_GPS:
+      out.field("valid", gpsData.valid);
+      out.field("hasFix", gpsData.hasFix);
+      out.fieldFloat("latitude", gpsData.latitude, 6);
+      out.fieldFloat("longitude", gpsData.longitude, 6);
+      out.fieldFloat("altitude", gpsData.altitude, 2);
+      out.field("satellites", gpsData.satellites);
+      out.field("satellites_used", gpsData.satellites_used);
+      out.fieldFloat("hdop", gpsData.hdop, 2);
+      out.fieldFloat("speed", gpsData.speed, 2);
+      out.fieldFloat("course", gpsData.course, 2);
+      out.field("fix_type", gpsData.fix_type);
+      out.field("status", gpsData.status_str);
+      break;
+    case EVENT_TOPIC_ENV:
+      out.field("aht20_available", envData.aht20_available);
+      out.field("bmp280_available", envData.bmp280_available);
+      out.fieldFloat("temperature_avg", envData.temperature_avg, 1);
+      out.fieldFloat("humidity", envData.humidity, 1);
+      out.fieldFloat("pressure", envData.pressure, 2);
+      out.fieldFloat("altitude", envData.altitude, 1);
+      out.fieldFloat("aht20_temp", envData.temperature_aht20, 1);
+      out.fieldFloat("bmp280_temp", envData.temperature_bmp280, 1);
+      out.field("aht20_status", envData.aht20_status);
+      out.field("bmp280_status", envData.bmp280_status);
+      out.field("combined_status", envData.combined_status);
+      break;
+    default:
+      break;
+  }
+}
+
+static void writeEventChunk(const char* data, size_t length, void* context) {
+  EventStreamClient* stream = static_cast<EventStreamClient*>(context);
+  if (stream->failed) {
+    return;
+  }
+  // MSG_DONTWAIT : WiFiClient::write() attend jusqu'à 10 x 1 s qu'un client qui
+  // ne lit plus (onglet suspendu, pair Wi-Fi perdu) libère le tampon d'envoi, loop()
+  // compris. Tampon plein : le flux est fermé et le navigateur se reconnecte (retry)
+  const int fd = stream->client.fd();
+  size_t sent = 0;
+  while (fd >= 0 && sent < length) {
+    const ssize_t written = lwip_send(fd, data + sent, length - sent, MSG_DONTWAIT);
+    if (written <= 0) {
+      break;
+    }
+    sent += static_cast<size_t>(written);
+  }
+  if (sent != length) {
+    stream->failed = true;
+    return;
+  }
+  stream->lastWriteMs = millis();
+}
+
+static void pushEventTopic(EventStreamClient& stream, EventTopic topic, char* buffer, size_t capacity) {
+  TelemetryReader telemetry;  // same snapshot for the probe and the write pass
+  const uint8_t bit = 1 << topic;
+  uint32_t* hashes = stream.hashes[topic];
+  const bool primed = (stream.primed & bit) != 0;
+
+  EventDelta probe(hashes, primed, nullptr);
+  writeTopicSection(topic, probe, telemetry.snapshot());
+  if (probe.changes() == 0) {
+    return;
+  }
+
+  // One SSE message per topic: "event: <topic>\ndata: {changed fields}\n\n"
+  JsonWriter json(buffer, capacity, writeEventChunk, &stream);
+  json.raw("event: ");
+  json.raw(EVENT_TOPIC_NAMES[topic]);
+  json.raw("\ndata: ");
+  json.beginObject();
+  EventDelta delta(hashes, primed, &json);
+  writeTopicSection(topic, delta, telemetry.snapshot());
+  json.endObject();
+  json.raw("\n\n");
+  json.flush();
+  stream.primed |= bit;
+}
+
+// "event: job" vers les flux abonnés, pour chaque job terminé depuis le dernier passage
+static void pushJobEvents(char* buffer, size_t capacity) {
+  const uint32_t since = lastJobEventSeq;
+  lastJobEventSeq = jobScheduler.finishCount();
+  if (lastJobEventSeq == since) {
+    return;
+  }
+  jobScheduler.forEach([&](const Job& job) {
+    if (job.finishSeq <= since) {
+      return;
+    }
+    for (EventStreamClient& stream : eventClients) {
+      if (!stream.active || stream.failed || (stream.topics & EVENT_JOBS) == 0) {
+        continue;
+      }
+      JsonWriter json(buffer, capacity, writeEventChunk, &stream);
+      json.raw("event: job\ndata: ");
+      json.beginObject();
+      json.field("id", job.id);
+      json.field("type", job.type->name);
+      json.field("state", jobStateName(job.state));
+      json.field("success", job.success);
+      json.field("result", job.result);
+      json.field("final", !job.attached);
+      json.endObject();
+      json.raw("\n\n");
+      json.flush();
+    }
   });
 }
 
-void handleStatus() {
-  collectDiagnosticInfo();
-  collectDetailedMemory();
+static void closeEventClient(EventStreamClient& stream) {
+  stream.client.stop();
+  stream.active = false;
+  Serial.println("[SSE] Flux d'événements fermé");
+}
+
+// Appelé depuis loop() : lecture des capteurs partagée puis envoi des deltas dus.
+// Renvoie le délai avant la prochaine échéance (push ou keep-alive), 0 sans flux.
+uint32_t serviceEventStreams() {
+  uint8_t wanted = 0;
+  for (EventStreamClient& stream : eventClients) {
+    if (!stream.active) {
+      continue;
+    }
+    if (stream.failed || !stream.client.connected()) {
+      closeEventClient(stream);
+      continue;
+    }
+    wanted |= stream.topics;
+  }
+  if ((wanted & EVENT_JOBS) == 0) {
+    lastJobEventSeq = jobScheduler.finishCount();  // pas d'arriéré pour un futur abonné
+  }
+  if (wanted == 0) {
+    return 0;
+  }
+
+  unsigned long now = millis();
+  if (wanted & (1 << EVENT_TOPIC_GPS)) {
+    updateGPS();
+  }
+  if ((wanted & (1 << EVENT_TOPIC_ENV)) && now - lastEventSensorReadMs >= EVENT_STREAM_SENSOR_INTERVAL_MS &&
+      !i2cBusClaimed()) {
+    lastEventSensorReadMs = now;
+    updateEnvironmentalSensors();
+  }
+
+  char buffer[JSON_STREAM_BUFFER_SIZE];
+  pushJobEvents(buffer, sizeof(buffer));
+  for (EventStreamClient& stream : eventClients) {
+    if (!stream.active) {
+      continue;
+    }
+    // Coalescing: changes between two pushes are merged into a single delta
+    if (now - stream.lastPushMs >= stream.intervalMs) {
+      stream.lastPushMs = now;
+      for (uint8_t topic = 0; topic < EVENT_TOPIC_COUNT && !stream.failed; ++topic) {
+        if (stream.topics & (1 << topic)) {
+          pushEventTopic(stream, static_cast<EventTopic>(topic), buffer, sizeof(buffer));
+        }
+      }
+    }
+    if (!stream.failed && now - stream.lastWriteMs >= EVENT_STREAM_KEEPALIVE_MS) {
+      static const char keepAlive[] = ": keep-alive\n\n";
+      writeEventChunk(keepAlive, sizeof(keepAlive) - 1, &stream);
+    }
+    if (stream.failed) {
+      closeEventClient(stream);
+    }
+  }
+
+  uint32_t nextMs = EVENT_STREAM_KEEPALIVE_MS;
+  for (const EventStreamClient& stream : eventClients) {
+    if (!stream.active) {
+      continue;
+    }
+    const uint32_t sincePush = now - stream.lastPushMs;
+    const uint32_t sinceWrite = now - stream.lastWriteMs;
+    const uint32_t pushIn = sincePush < stream.intervalMs ? stream.intervalMs - sincePush : 1;
+    const uint32_t keepAliveIn = sinceWrite < EVENT_STREAM_KEEPALIVE_MS ? EVENT_STREAM_KEEPALIVE_MS - sinceWrite : 1;
+    nextMs = min(nextMs, min(pushIn, keepAliveIn));
+  }
+  if (wanted & (1 << EVENT_TOPIC_GPS)) {
+    nextMs = min(nextMs, static_cast<uint32_t>(EVENT_STREAM_GPS_READ_MS));  // vider le tampon série du GPS
+  }
+  return nextMs;
+}
+
+static uint8_t parseEventTopics(const String& list) {
+  uint8_t topics = 0;
+  char tokens[96];
+  strlcpy(tokens, list.c_str(), sizeof(tokens));
+  char* saveptr = nullptr;
+  for (char* token = strtok_r(tokens, ",", &saveptr); token != nullptr; token = strtok_r(nullptr, ",", &saveptr)) {
+    if (strcmp(token, "all") == 0) {
+      return EVENT_TOPIC_ALL;
+    }
+    if (strcmp(token, "jobs") == 0) {
+      topics |= EVENT_JOBS;
+    }
+    for (uint8_t topic = 0; topic < EVENT_TOPIC_COUNT; ++topic) {
+      if (strcmp(token, EVENT_TOPIC_NAMES[topic]) == 0) {
+        topics |= 1 << topic;
+      }
+    }
+  }
+  return topics;
+}
+
+void handleEventStream() {
+  uint8_t topics = server.hasArg("topics") ? parseEventTopics(server.arg("topics")) : EVENT_TOPIC_ALL;
+  if (topics == 0) {
+    sendActionResponse(400, false, "Unknown topics (status, memory, wifi, buttons, rotary, gps, env, jobs)");
+    return;
+  }
+
+  long interval = server.hasArg("rate") ? server.arg("rate").toInt() : EVENT_STREAM_DEFAULT_INTERVAL_MS;
+  interval = constrain(interval, EVENT_STREAM_MIN_INTERVAL_MS, 60000L);
+
+  EventStreamClient* slot = nullptr;
+  for (EventStreamClient& stream : eventClients) {
+    if (!stream.active) {
+      slot = &stream;
+      break;
+    }
+  }
+  if (slot == nullptr) {
+    server.sendHeader("Retry-After", "5");
+    sendActionResponse(503, false, "Too many event streams");
+    return;
+  }
+
+  // The WebServer releases its reference after the handler; the copy kept in
+  // the slot holds the socket open for the stream.
+  slot->client = server.client();
+  slot->client.setNoDelay(true);
+  slot->client.setTimeout(1);  // en-tête ci-dessous ; les messages passent par writeEventChunk() sans attente
+  recordDirectBytes(slot->client.print(F("HTTP/1.1 200 OK\r\n"
+                                         "Content-Type: text/event-stream\r\n"
+                                         "Cache-Control: no-cache\r\n"
+                                         "Connection: keep-alive\r\n"
+                                         "\r\n"
+                                         "retry: 3000\n\n")));
+
+  unsigned long now = millis();
+  slot->active = true;
+  slot->failed = false;
+  slot->topics = topics;
+  slot->primed = 0;
+  slot->intervalMs = static_cast<uint16_t>(interval);
+  slot->lastPushMs = now - slot->intervalMs;  // premier envoi complet immédiat
+  slot->lastWriteMs = now;
+
+  char ip[16];
+  formatIPAddress(slot->client.remoteIP(), ip, sizeof(ip));
+  Serial.printf("[SSE] Flux ouvert pour %s (topics 0x%02x, %u ms)\r\n", ip, topics, slot->intervalMs);
+  loopEvents.signal(LOOP_STREAMS);
+}
+
+void handlePeripherals() {
+  if (!i2cBusClaimed()) {
+    scanI2C();  // sinon : résultat du dernier scan
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  SectionWriter out(json);
+  writePeripheralsSection(out);
+  json.endObject();
+}
+
+// ========== BATCH ENDPOINT ==========
+// [OPT-016]: /api/batch?sections=a,b&fields=x,a.y regroupe plusieurs sections en
+// une seule réponse streamée, toutes tirées du même instantané de télémétrie.
+enum BatchSection : uint8_t {
+  BATCH_SECTION_SYSTEM = EVENT_TOPIC_COUNT,  // after the streamable topics
+  BATCH_SECTION_LEDS,
+  BATCH_SECTION_SCREENS,
+  BATCH_SECTION_PERIPHERALS,
+  BATCH_SECTION_COUNT
+};
+
+static const char* const BATCH_SECTION_NAMES[BATCH_SECTION_COUNT - EVENT_TOPIC_COUNT] = {
+  "system", "leds", "screens", "peripherals"
+};
+
+static const char* batchSectionName(uint8_t section) {
+  return section < EVENT_TOPIC_COUNT ? EVENT_TOPIC_NAMES[section] : BATCH_SECTION_NAMES[section - EVENT_TOPIC_COUNT];
+}
+
+// Sections are written in enum order, whatever the request order
+static bool parseBatchSections(const String& list, uint16_t& sections) {
+  sections = 0;
+  char tokens[128];
+  if (list.length() >= sizeof(tokens)) {
+    return false;
+  }
+  strlcpy(tokens, list.c_str(), sizeof(tokens));
+  char* saveptr = nullptr;
+  for (char* token = strtok_r(tokens, ",", &saveptr); token != nullptr; token = strtok_r(nullptr, ",", &saveptr)) {
+    bool known = false;
+    for (uint8_t section = 0; section < BATCH_SECTION_COUNT; ++section) {
+      if (strcmp(token, batchSectionName(section)) == 0) {
+        sections |= 1U << section;
+        known = true;
+      }
+    }
+    if (!known) {
+      return false;
+    }
+  }
+  return sections != 0;
+}
+
+void handleBatch() {
+  uint16_t sections = 0;
+  if (!parseBatchSections(server.hasArg("sections") ? server.arg("sections") : String("status"), sections)) {
+    sendActionResponse(400, false,
+                       "Invalid sections (status, memory, wifi, buttons, rotary, gps, env, system, leds, screens, peripherals)");
+    return;
+  }
+
+  FieldProjection projection;
+  if (server.hasArg("fields") && !projection.parse(server.arg("fields"))) {
+    sendActionResponse(400, false, "Too many fields");
+    return;
+  }
+
+  // Sensors are read on demand like their dedicated endpoints
+  if (sections & (1U << EVENT_TOPIC_GPS)) {
+    updateGPS();
+  }
+  if ((sections & (1U << EVENT_TOPIC_ENV)) && !i2cBusClaimed()) {
+    updateEnvironmentalSensors();
+  }
+
+  TelemetryReader telemetry;
+  ApiResponse json(200);
+  json.beginObject();
+  for (uint8_t section = 0; section < BATCH_SECTION_COUNT; ++section) {
+    if (!(sections & (1U << section))) {
+      continue;
+    }
+    const char* name = batchSectionName(section);
+    json.beginObject(name);
+    SectionWriter out(json, name, &projection);
+    switch (section) {
+      case BATCH_SECTION_SYSTEM:
+        writeSystemSection(out, telemetry.diag());
+        break;
+      case BATCH_SECTION_LEDS:
+        writeLedsSection(out);
+        break;
+      case BATCH_SECTION_SCREENS:
+        writeScreensSection(out);
+        break;
+      case BATCH_SECTION_PERIPHERALS:
+        writePeripheralsSection(out);
+        break;
+      default:
+        writeTopicSection(static_cast<EventTopic>(section), out, telemetry.snapshot());
+        break;
+    }
+    json.endObject();
+  }
+  json.field("snapshot_age_ms", telemetry.ageMs());
+  json.endObject();
+}
+
+#if ENABLE_ROUTE_METRICS
+// ========== ROUTE METRICS ==========
+// [OPT-018]: JSON (CBOR via Accept) by default; Prometheus text exposition with
+// ?format=prometheus or when the scraper asks for text/plain
+static void flushMetricsText(const char* data, size_t length, void* context) {
+  (void)context;
+  server.sendContent(data, length);
+}
+
+void handleMetrics() {
+  const bool prometheus = server.arg("format") == "prometheus" || server.header("Accept").indexOf("text/plain") >= 0;
+  if (!prometheus) {
+    ApiResponse json(200);
+    json.beginObject();
+    json.field("firmware_version", PROJECT_VERSION);
+    json.field("uptime_ms", millis());
+    json.field("active_clients", server.activeClients());
+    json.field("rejected_clients", server.rejectedClients());
+    server.metrics().writeJson(json);
+    json.endObject();
+    return;
+  }
+
+  char buffer[JSON_STREAM_BUFFER_SIZE];
+  JsonWriter text(buffer, sizeof(buffer), flushMetricsText, nullptr);  // raw() only, used as a byte sink
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain; version=0.0.4; charset=utf-8", "");
+
+  char line[256];
+  int length = snprintf(line, sizeof(line),
+                        "# TYPE esp32diag_build_info gauge\nesp32diag_build_info{version=\"%s\"} 1\n"
+                        "# TYPE esp32diag_http_rejected_connections_total counter\n"
+                        "esp32diag_http_rejected_connections_total %u\n",
+                        PROJECT_VERSION, static_cast<unsigned>(server.rejectedClients()));
+  if (length > 0) {
+    text.raw(line, static_cast<size_t>(length) < sizeof(line) ? static_cast<size_t>(length) : sizeof(line) - 1);
+  }
+  server.metrics().writePrometheus(text);
+  text.flush();
+  server.sendContent("");
+}
+#endif
+
+// ========== JOBS ==========
+// [OPT-020]: GET /api/jobs liste les jobs, ?id=N en donne un,
+// ?action=submit&type=X[&priority=P] en met un en file (202 + URL de suivi),
+// ?action=cancel&id=N (ou /api/jobs/N/cancel) l'annule
+static void writeJob(DataWriter& out, const Job& job, unsigned long now) {
+  out.field("id", job.id);
+  out.field("type", job.type->name);
+  out.field("state", jobStateName(job.state));
+  out.field("priority", job.priority);
+  out.field("progress", job.progress);
+  out.field("success", job.success);
+  out.field("result", job.result);
+  out.field("timeout_ms", job.type->timeoutMs);
+  out.field("core", job.core);
+  out.field("queued_ms", (job.state == JOB_QUEUED ? now : job.startedMs) - job.submittedMs);
+  if (job.state != JOB_QUEUED && job.startedMs != 0) {
+    out.field("run_ms", (jobFinished(job.state) ? job.finishedMs : now) - job.startedMs);
+  }
+  if (jobFinished(job.state)) {
+    out.field("finished_ms_ago", now - job.finishedMs);
+  }
+  out.field("final", jobFinished(job.state) && !job.attached);  // timed out but still running: false
+  if (job.stackPeak > 0) {
+    out.field("stack_peak", job.stackPeak);
+  }
+}
+
+static void sendJobStatus(int statusCode, uint32_t id) {
+  Job job;
+  if (!jobScheduler.get(id, job)) {
+    sendOperationError(404, "Unknown job", {jsonNumberField("job_id", id)});
+    return;
+  }
+  char url[32];
+  snprintf(url, sizeof(url), "/api/jobs?id=%lu", static_cast<unsigned long>(id));
+  ApiResponse json(statusCode);
+  json.beginObject();
+  writeJob(json, job, millis());
+  json.field("url", url);
+  json.endObject();
+}
+
+// Un job en cours s'arrête à sa prochaine pause (testPause), en moins d'un tick
+static void cancelJob(uint32_t id) {
+  if (!jobScheduler.cancel(id)) {
+    Job job;
+    const bool known = jobScheduler.get(id, job);
+    sendOperationError(known ? 409 : 404, known ? "Job already finished" : "Unknown job",
+                       {jsonNumberField("job_id", id)});
+    return;
+  }
+  sendJobStatus(200, id);
+}
+
+void handleJobs() {
+  const String action = server.arg("action");
+  const uint32_t id = static_cast<uint32_t>(strtoul(server.arg("id").c_str(), nullptr, 10));
+
+  if (action == "submit") {
+    const JobType* type = findJobType(server.arg("type"));
+    if (type == nullptr) {
+      sendOperationError(400, "Unknown job type", {jsonStringField("type", server.arg("type"))});
+      return;
+    }
+    const int priority = server.hasArg("priority") ? constrain(server.arg("priority").toInt(), 0, 255) : -1;
+    uint32_t jobId = 0;
+    const auto status = jobScheduler.submit(*type, jobId, priority);
+    if (status == decltype(jobScheduler)::STORE_FULL) {
+      sendOperationError(503, "Job store full", {});
+      return;
+    }
+    sendJobStatus(status == decltype(jobScheduler)::SUBMITTED ? 202 : 200, jobId);
+    return;
+  }
+
+  if (action == "cancel") {
+    cancelJob(id);
+    return;
+  }
+
+  if (!action.isEmpty()) {
+    sendOperationError(400, "Unknown action", {jsonStringField("action", action)});
+    return;
+  }
+
+  if (server.hasArg("id")) {
+    sendJobStatus(200, id);
+    return;
+  }
+
+  const unsigned long now = millis();
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("workers", JOB_WORKER_COUNT);
+  json.field("capacity", JOB_STORE_SIZE);
+  json.field("active", jobScheduler.activeJobs());
+  json.beginArray("types");
+  for (const JobType* type : JOB_TYPES) {
+    json.value(type->name);
+  }
+  json.endArray();
+  json.beginArray("jobs");
+  jobScheduler.forEach([&](const Job& job) {
+    json.beginObject();
+    writeJob(json, job, now);
+    json.endObject();
+  });
+  json.endArray();
+  json.endObject();
+}
+
+void handleJobCancel() {
+  cancelJob(static_cast<uint32_t>(strtoul(server.pathArg(0).c_str(), nullptr, 10)));
+}
+
+// ========== FULL SUITE ==========
+// [OPT-021]: "Tout tester" soumet chaque test comme job ; l'ordonnanceur lance en
+// parallèle (workers sur les deux coeurs) ceux dont les ressources ne se
+// chevauchent pas. Soumission par durée estimée décroissante (LPT) : les tests
+// longs démarrent d'abord, les courts comblent les trous. tools/suite_plan_sim.py
+// relit cette table et les JobType ci-dessus, rejoue le plan sur l'hôte et
+// mesure le makespan.
+struct SuiteTest {
+  const JobType* type;
+  uint16_t estimateMs;  // durée typique (somme des délais du test)
+};
+
+static const SuiteTest SUITE_TESTS[] = {
+  {&gpsTestJob, 10000}, {&oledTestJob, 5500}, {&rotaryTestJob, 5000}, {&sdTestJob, 1500},
+  {&builtinLedTestJob, 1200}, {&buzzerTestJob, 800}, {&neopixelTestJob, 700}, {&rgbLedTestJob, 700},
+  {&pwmTestJob, 500}, {&environmentalTestJob, 300}, {&dhtTestJob, 300}, {&distanceSensorTestJob, 300},
+  {&lightSensorTestJob, 100}, {&motionSensorTestJob, 100}
+};
+static const uint8_t SUITE_TEST_COUNT = sizeof(SUITE_TESTS) / sizeof(SUITE_TESTS[0]);
+
+struct SuiteRun {
+  uint32_t id;  // 0 = jamais lancé
+  unsigned long startedMs;
+  uint32_t jobIds[SUITE_TEST_COUNT];  // 0 = non soumis (stockage plein)
+};
+
+static SuiteRun suiteRun = {};
+
+static bool suiteActive() {
+  Job job;
+  for (uint8_t i = 0; i < SUITE_TEST_COUNT; ++i) {
+    if (suiteRun.jobIds[i] != 0 && jobScheduler.get(suiteRun.jobIds[i], job) && (!jobFinished(job.state) || job.attached)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void startSuite() {
+  ++suiteRun.id;
+  suiteRun.startedMs = millis();
+  for (uint8_t i = 0; i < SUITE_TEST_COUNT; ++i) {
+    jobScheduler.submit(*SUITE_TESTS[i].type, suiteRun.jobIds[i]);  // un test déjà en cours est repris tel quel
+  }
+}
+
+static void sendSuiteReport(int statusCode) {
+  const unsigned long now = millis();
+  uint8_t finished = 0;
+  uint8_t passed = 0;
+  unsigned long serialMs = 0;
+  unsigned long lastEndMs = suiteRun.startedMs;
+  bool running = false;
+
+  ApiResponse json(statusCode);
+  json.beginObject();
+  json.field("suite", suiteRun.id);
+  json.field("workers", JOB_WORKER_COUNT);
+  json.beginArray("jobs");
+  for (uint8_t i = 0; i < SUITE_TEST_COUNT; ++i) {
+    Job job;
+    json.beginObject();
+    json.field("type", SUITE_TESTS[i].type->name);
+    json.field("estimate_ms", SUITE_TESTS[i].estimateMs);
+    if (suiteRun.jobIds[i] == 0 || !jobScheduler.get(suiteRun.jobIds[i], job)) {
+      json.field("state", suiteRun.jobIds[i] == 0 ? "not_run" : "expired");
+      json.endObject();
+      continue;
+    }
+    json.field("id", job.id);
+    json.field("state", jobStateName(job.state));
+    json.field("success", job.success);
+    json.field("result", job.result);
+    json.field("core", job.core);
+    if (job.state != JOB_QUEUED) {
+      const unsigned long endMs = jobFinished(job.state) ? job.finishedMs : now;
+      json.field("start_ms", static_cast<long>(job.startedMs - suiteRun.startedMs));
+      json.field("run_ms", endMs - job.startedMs);
+      serialMs += endMs - job.startedMs;
+      if (static_cast<long>(endMs - lastEndMs) > 0) {
+        lastEndMs = endMs;
+      }
+    }
+    if (jobFinished(job.state)) {
+      ++finished;
+      passed += job.state == JOB_DONE ? 1 : 0;
+    } else {
+      running = true;
+    }
+    json.endObject();
+  }
+  json.endArray();
+
+  const unsigned long wallMs = (running ? now : lastEndMs) - suiteRun.startedMs;
+  json.field("state", running ? "running" : "done");
+  json.field("tests", SUITE_TEST_COUNT);
+  json.field("finished", finished);
+  json.field("passed", passed);
+  json.field("wall_ms", wallMs);
+  json.field("serial_ms", serialMs);  // somme des durées : temps d'une exécution un par un
+  json.fieldFloat("parallelism", wallMs > 0 ? static_cast<double>(serialMs) / wallMs : 0.0, 2);
+  json.endObject();
+}
+
+// GET /api/stacks : pic de pile par tâche et par type de job, taille
+// recommandée (appliquée au prochain démarrage) ; ?action=reset efface le profil
+void handleStacks() {
+  if (server.arg("action") == "reset") {
+    stackProfile.reset();
+    sendActionResponse(200, true, "Stack profile cleared", {});
+    return;
+  }
+  sampleTaskStacks();
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("persisted", ENABLE_STACK_PROFILE);
+  json.field("worker_stack", jobScheduler.stackSize());
+  json.field("worker_stack_in_psram", jobScheduler.stacksInPsram());
+  json.field("worker_stack_next_boot", jobWorkerStackSize());
+  stackProfile.writeJson(json, recommendedStackSize);
+  json.endObject();
+}
+
+// GET /api/cores : charge de chaque coeur sur la dernière fenêtre, coeur de
+// chaque tâche et coeurs où les jobs démarrent ; ?mode=fixed|measured
+void handleCores() {
+  const String mode = server.arg("mode");
+  if (mode.length() > 0) {
+    if (mode != "fixed" && mode != "measured") {
+      sendOperationError(400, "mode must be fixed or measured", {});
+      return;
+    }
+    corePlacement.setMode(mode == "measured" ? PLACEMENT_MEASURED : PLACEMENT_FIXED);
+    jobScheduler.setAllowedCores(
+        corePlacement.update(coreLoads, coreLoadMonitor.cores(), jobScheduler.workerCores()));
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  json.field("mode", corePlacementModeName(corePlacement.mode()));
+  json.field("interval_ms", static_cast<uint32_t>(CORE_PLACEMENT_INTERVAL_MS));
+  json.field("imbalance_percent", static_cast<uint8_t>(CORE_PLACEMENT_IMBALANCE_PERCENT));
+  json.field("job_cores", coreMaskName(jobScheduler.allowedCores()));
+  json.field("placement_changes", corePlacement.changes());
+  json.beginObject("tasks");
+  json.field("loop", static_cast<int>(loopCore));  // serveur HTTP, affichage, NeoPixel
+  json.field("telemetry", taskCore(telemetryTaskHandle));
+  json.beginArray("job_workers");
+  for (uint8_t i = 0; i < JOB_WORKER_COUNT; ++i) {
+    json.value(taskCore(jobScheduler.workerHandle(i)));
+  }
+  json.endArray();
+  json.endObject();
+  json.beginArray("cores");
+  for (uint8_t core = 0; core < coreLoadMonitor.cores(); ++core) {
+    const CoreLoad& load = coreLoads[core];
+    json.beginObject();
+    json.field("core", core);
+    json.field("ticks", load.ticks);
+    json.field("busy", load.busy());
+    for (uint8_t bucket = 0; bucket < CORE_BUCKET_COUNT; ++bucket) {
+      json.field(coreLoadBucketName(bucket), load.percent[bucket]);
+    }
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+}
+
+// GET /api/loop : réveils de loop() par source, temps passé hors attente,
+// latence signal -> traitement et gigue des timers périodiques ; ?action=reset
+void handleLoop() {
+  if (server.arg("action") == "reset") {
+    loopEvents.reset();
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  loopEvents.writeJson(json, LOOP_EVENT_NAMES);
+  json.field("http_watcher", server.watcherTask() != nullptr);
+  json.beginArray("core_idle_percent");  // dernière fenêtre de /api/cores
+  for (uint8_t core = 0; core < coreLoadMonitor.cores(); ++core) {
+    json.value(coreLoads[core].percent[CORE_IDLE]);
+  }
+  json.endArray();
+  json.endObject();
+}
+
+// Types des jobs en cours, séparés par des virgules (journal des blocages)
+static void describeRunningJobs(char* out, size_t size) {
+  size_t used = 0;
+  out[0] = '\0';
+  jobScheduler.forEach([&](const Job& job) {
+    if (job.state != JOB_RUNNING || used + 1 >= size) {
+      return;
+    }
+    const int written = snprintf(out + used, size - used, "%s%s", used > 0 ? "," : "", job.type->name);
+    used = written > 0 ? min(size - 1, used + static_cast<size_t>(written)) : used;
+  });
+}
+
+// GET /api/jitter : histogrammes log2 (µs) et derniers blocages de loop() ; ?action=reset
+void handleJitter() {
+  if (server.arg("action") == "reset") {
+    jitterMonitor.reset();
+  }
+  ApiResponse json(200);
+  json.beginObject();
+  jitterMonitor.writeJson(json);
+  json.endObject();
+}
+
+// GET /api/suite : rapport de la dernière campagne ; ?action=run en lance une
+void handleSuite() {
+  if (server.arg("action") == "run") {
+    if (suiteActive()) {
+      sendSuiteReport(200);
+      return;
+    }
+    startSuite();
+    sendSuiteReport(202);
+    return;
+  }
+  if (suiteRun.id == 0) {
+    sendOperationError(404, "No suite run yet", {});
+    return;
+  }
+  sendSuiteReport(200);
+}
+
+// ========== SOAK ==========
+// [OPT-024]: Endurance : ?action=start&runs=N relance N fois chaque test fonctionnel
+// (SOAK_JOB_TYPES : les benchmarks, longs et sans intérêt pour une fuite, en sont
+// exclus). Un tour soumet tous les types ensemble (comme /api/suite) ; une fois le tour
+// terminé, le heap interne libre, son minimum historique et le plus grand bloc
+// libre sont relevés. En régime établi, aucune des deux courbes ne doit dériver :
+// le rapport donne SOAK_CHECKPOINTS points répartis sur la durée et la pente
+// (moindres carrés, octets pour 100 tours) calculée après le premier tour.
+static const uint8_t SOAK_CHECKPOINTS = 32;
+static const uint8_t JOB_TYPE_COUNT = sizeof(JOB_TYPES) / sizeof(JOB_TYPES[0]);
+static_assert(STACK_PROFILE_ENTRIES >= JOB_TYPE_COUNT + STACK_PROFILE_TASKS + 4,
+              "STACK_PROFILE_ENTRIES: garder de la marge au-delà des types de job et des tâches");
+
+static const JobType* const SOAK_JOB_TYPES[] = {
+  &builtinLedTestJob, &neopixelTestJob, &oledTestJob, &rgbLedTestJob, &buzzerTestJob, &sdTestJob, &rotaryTestJob,
+  &dhtTestJob, &lightSensorTestJob, &distanceSensorTestJob, &motionSensorTestJob, &pwmTestJob, &environmentalTestJob,
+  &gpsTestJob, &gpioTestJob, &wifiScanJob
+};
+static const uint8_t SOAK_TYPE_COUNT = sizeof(SOAK_JOB_TYPES) / sizeof(SOAK_JOB_TYPES[0]);
+
+struct SoakSample {
+  uint32_t round;
+  uint32_t freeHeap;
+  uint32_t minFreeHeap;
+  uint32_t largestBlock;
+  uint32_t freePsram;
+};
 
-  bool wifiConnected = (WiFi.status() == WL_CONNECTED);
-  unsigned long currentUptime = millis();
-
-  String json;
-  json.reserve(400);
-  json = "{";
-  json += "\"connected\":" + String(wifiConnected ? "true" : "false") + ",";
-  json += "\"uptime\":" + String(currentUptime) + ",";
-  json += "\"temperature\":" + String(diagnosticData.temperature) + ",";
-  json += "\"sram\":{\"total\":" + String(detailedMemory.sramTotal) +
-          ",\"free\":" + String(detailedMemory.sramFree) +
-          ",\"used\":" + String(detailedMemory.sramUsed) + "},";
-  json += "\"psram\":{\"total\":" + String(detailedMemory.psramTotal) +
-          ",\"free\":" + String(detailedMemory.psramFree) +
-          ",\"used\":" + String(detailedMemory.psramUsed) + "},";
-  json += "\"fragmentation\":" + String(detailedMemory.fragmentationPercent, 1) + "";
-  json += "}";
-
-  server.send(200, "application/json", json);
+struct SoakRun {
+  uint32_t id;  // 0 = jamais lancé
+  bool active;
+  uint32_t runs;
+  uint32_t rounds;  // tours terminés
+  unsigned long startedMs;
+  unsigned long elapsedMs;
+  uint32_t jobIds[SOAK_TYPE_COUNT];
+  uint32_t passed[SOAK_TYPE_COUNT];
+  uint32_t failed[SOAK_TYPE_COUNT];
+  SoakSample first;  // après le premier tour (allocations paresseuses faites)
+  SoakSample last;
+  SoakSample checkpoints[SOAK_CHECKPOINTS];
+  uint8_t checkpointCount;
+  double sumX, sumXX, sumFree, sumXFree, sumBlock, sumXBlock;
+};
+
+static SoakRun soakRun = {};
+
+static SoakSample sampleHeap(uint32_t round) {
+  SoakSample sample;
+  sample.round = round;
+  sample.freeHeap = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  sample.minFreeHeap = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  sample.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  sample.freePsram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  return sample;
 }
 
-void handleSystemInfo() {
-  collectDiagnosticInfo();
-  String json;
-  json.reserve(600);
-  json = "{";
-  json += "\"chipModel\":\"" + diagnosticData.chipModel + "\",";
-  json += "\"chipRevision\":\"" + diagnosticData.chipRevision + "\",";
-  json += "\"cpuCores\":" + String(diagnosticData.cpuCores) + ",";
-  json += "\"cpuFreq\":" + String(diagnosticData.cpuFreqMHz) + ",";
-  json += "\"macAddress\":\"" + diagnosticData.macAddress + "\",";
-  json += "\"ipAddress\":\"" + diagnosticData.ipAddress + "\",";
-  json += "\"mdnsReady\":" + String(diagnosticData.mdnsAvailable ? "true" : "false") + ",";
-  json += "\"uptime\":" + String(diagnosticData.uptime);
-  if (diagnosticData.temperature != -999) {
-    json += ",\"temperature\":" + String(diagnosticData.temperature, 1);
+static void recordSoakRound() {
+  const SoakSample sample = sampleHeap(++soakRun.rounds);
+  soakRun.last = sample;
+  if (soakRun.rounds == 1) {
+    soakRun.first = sample;
+  } else {
+    const double x = sample.round;
+    soakRun.sumX += x;
+    soakRun.sumXX += x * x;
+    soakRun.sumFree += sample.freeHeap;
+    soakRun.sumXFree += x * sample.freeHeap;
+    soakRun.sumBlock += sample.largestBlock;
+    soakRun.sumXBlock += x * sample.largestBlock;
+  }
+  const uint32_t stride = max(1UL, static_cast<unsigned long>((soakRun.runs + SOAK_CHECKPOINTS - 1) / SOAK_CHECKPOINTS));
+  if (soakRun.rounds == 1 || soakRun.rounds % stride == 0 || soakRun.rounds == soakRun.runs) {
+    const uint8_t slot = soakRun.checkpointCount < SOAK_CHECKPOINTS ? soakRun.checkpointCount++ : SOAK_CHECKPOINTS - 1;
+    soakRun.checkpoints[slot] = sample;
   }
-  json += "}";
-  server.send(200, "application/json", json);
 }
 
-void handleMemory() {
-  collectDetailedMemory();
-  String json;
-  json.reserve(500);
-  json = "{";
-  json += "\"heap\":{\"total\":" + String(diagnosticData.heapSize) +
-          ",\"free\":" + String(diagnosticData.freeHeap) +
-          ",\"used\":" + String(diagnosticData.heapSize - diagnosticData.freeHeap) + "},";
-  json += "\"psram\":{\"total\":" + String(detailedMemory.psramTotal) +
-          ",\"free\":" + String(detailedMemory.psramFree) +
-          ",\"used\":" + String(detailedMemory.psramUsed) + "},";
-  json += "\"fragmentation\":" + String(detailedMemory.fragmentationPercent, 1);
-  json += "}";
-  server.send(200, "application/json", json);
+// Octets pour 100 tours, 0 tant qu'il n'y a pas deux points après le premier tour
+static double soakSlope(double sumY, double sumXY) {
+  const double n = soakRun.rounds > 1 ? soakRun.rounds - 1 : 0;
+  const double denominator = n * soakRun.sumXX - soakRun.sumX * soakRun.sumX;
+  return n < 2 || denominator == 0 ? 0.0 : 100.0 * (n * sumXY - soakRun.sumX * sumY) / denominator;
 }
 
-void handleWiFiInfo() {
-  collectDiagnosticInfo();
-  String json;
-  json.reserve(400);
-  json = "{";
-  json += "\"connected\":" + String(WiFi.status() == WL_CONNECTED ? "true" : "false") + ",";
-  json += "\"ssid\":\"" + diagnosticData.wifiSSID + "\",";
-  json += "\"rssi\":" + String(diagnosticData.wifiRSSI) + ",";
-  json += "\"quality_key\":\"" + String(getWiFiSignalQualityKey()) + "\",";
-  json += "\"quality\":\"" + getWiFiSignalQuality() + "\",";
-  json += "\"ip\":\"" + diagnosticData.ipAddress + "\",";
-  json += "\"gateway\":\"" + WiFi.gatewayIP().toString() + "\",";
-  json += "\"dns\":\"" + WiFi.dnsIP().toString() + "\"";
-  json += "}";
-  server.send(200, "application/json", json);
+// Appelé depuis loop() : fait avancer la campagne d'un tour quand le précédent est fini
+static void serviceSoak() {
+  if (!soakRun.active) {
+    return;
+  }
+  bool submitted = false;
+  Job job;
+  for (uint8_t i = 0; i < SOAK_TYPE_COUNT; ++i) {
+    if (soakRun.jobIds[i] == 0) {
+      continue;
+    }
+    if (jobScheduler.get(soakRun.jobIds[i], job) && (!jobFinished(job.state) || job.attached)) {
+      return;  // tour en cours
+    }
+    submitted = true;
+  }
+  if (submitted) {
+    for (uint8_t i = 0; i < SOAK_TYPE_COUNT; ++i) {
+      const bool found = soakRun.jobIds[i] != 0 && jobScheduler.get(soakRun.jobIds[i], job);
+      if (found && job.state == JOB_DONE) {
+        ++soakRun.passed[i];
+      } else if (found && job.state != JOB_CANCELLED) {
+        ++soakRun.failed[i];
+      }
+      soakRun.jobIds[i] = 0;
+    }
+    recordSoakRound();
+    soakRun.elapsedMs = millis() - soakRun.startedMs;
+    if (soakRun.rounds >= soakRun.runs) {
+      soakRun.active = false;
+      Serial.printf("[SOAK] %lu tours, heap %lu -> %lu, bloc %lu -> %lu\r\n",
+                    static_cast<unsigned long>(soakRun.rounds), static_cast<unsigned long>(soakRun.first.freeHeap),
+                    static_cast<unsigned long>(soakRun.last.freeHeap), static_cast<unsigned long>(soakRun.first.largestBlock),
+                    static_cast<unsigned long>(soakRun.last.largestBlock));
+      return;
+    }
+  }
+  for (uint8_t i = 0; i < SOAK_TYPE_COUNT; ++i) {
+    jobScheduler.submit(*SOAK_JOB_TYPES[i], soakRun.jobIds[i]);  // 0 si le stockage est plein : type sauté pour ce tour
+  }
 }
 
-void handlePeripherals() {
-  scanI2C();
-  String json;
-  json.reserve(300);
-  json = "{";
-  json += "\"i2c\":{\"count\":" + String(diagnosticData.i2cCount) +
-          ",\"devices\":\"" + diagnosticData.i2cDevices + "\"},";
-  json += "\"gpio\":{\"total\":" + String(diagnosticData.totalGPIO) +
-          ",\"list\":\"" + diagnosticData.gpioList + "\"}";
-  json += "}";
-  server.send(200, "application/json", json);
+static void stopSoak() {
+  for (uint8_t i = 0; i < SOAK_TYPE_COUNT; ++i) {
+    if (soakRun.jobIds[i] != 0) {
+      jobScheduler.cancel(soakRun.jobIds[i]);
+      soakRun.jobIds[i] = 0;
+    }
+  }
+  soakRun.active = false;
+  soakRun.elapsedMs = millis() - soakRun.startedMs;
+}
+
+static void writeSoakSample(DataWriter& out, const SoakSample& sample) {
+  out.field("round", sample.round);
+  out.field("free_heap", sample.freeHeap);
+  out.field("min_free_heap", sample.minFreeHeap);
+  out.field("largest_block", sample.largestBlock);
+  out.field("free_psram", sample.freePsram);
+}
+
+static void sendSoakReport(int statusCode) {
+  ApiResponse json(statusCode);
+  json.beginObject();
+  json.field("soak", soakRun.id);
+  json.field("state", soakRun.active ? "running" : "done");
+  json.field("runs", soakRun.runs);
+  json.field("rounds", soakRun.rounds);
+  json.field("elapsed_ms", soakRun.active ? millis() - soakRun.startedMs : soakRun.elapsedMs);
+  json.beginArray("types");
+  for (uint8_t i = 0; i < SOAK_TYPE_COUNT; ++i) {
+    json.beginObject();
+    json.field("type", SOAK_JOB_TYPES[i]->name);
+    json.field("passed", soakRun.passed[i]);
+    json.field("failed", soakRun.failed[i]);
+    json.endObject();
+  }
+  json.endArray();
+  json.beginArray("checkpoints");
+  for (uint8_t i = 0; i < soakRun.checkpointCount; ++i) {
+    json.beginObject();
+    writeSoakSample(json, soakRun.checkpoints[i]);
+    json.endObject();
+  }
+  json.endArray();
+  if (soakRun.rounds > 0) {
+    json.beginObject("trend");
+    json.field("free_heap_delta", static_cast<int32_t>(soakRun.last.freeHeap - soakRun.first.freeHeap));
+    json.field("largest_block_delta", static_cast<int32_t>(soakRun.last.largestBlock - soakRun.first.largestBlock));
+    json.fieldFloat("free_heap_per_100_rounds", soakSlope(soakRun.sumFree, soakRun.sumXFree), 1);
+    json.fieldFloat("largest_block_per_100_rounds", soakSlope(soakRun.sumBlock, soakRun.sumXBlock), 1);
+    json.endObject();
+  }
+  json.beginObject("work_buffers");
+  workBuffers.writeJson(json);
+  json.endObject();
+  json.endObject();
+}
+
+// GET /api/soak : rapport de la dernière campagne ; ?action=start&runs=N la lance
+// (1000 par défaut), ?action=stop l'interrompt
+void handleSoak() {
+  const String action = server.arg("action");
+  if (action == "start") {
+    if (soakRun.active) {
+      sendSoakReport(200);
+      return;
+    }
+    const uint32_t id = soakRun.id + 1;
+    const long runs = server.hasArg("runs") ? server.arg("runs").toInt() : 1000;
+    if (runs < 1 || runs > 100000) {
+      sendOperationError(400, "Invalid runs (1-100000)", {});
+      return;
+    }
+    soakRun = {};
+    soakRun.id = id;
+    soakRun.active = true;
+    soakRun.runs = runs;
+    soakRun.startedMs = millis();
+    serviceSoak();
+    sendSoakReport(202);
+    return;
+  }
+  if (action == "stop") {
+    stopSoak();
+  }
+  if (soakRun.id == 0) {
+    sendOperationError(404, "No soak run yet", {});
+    return;
+  }
+  sendSoakReport(200);
 }
 
 void handleLedsInfo() {
-  String json;
-  json.reserve(400);
-  json = "{";
-  json += "\"builtin\":{\"pin\":" + String(BUILTIN_LED_PIN) +
-          ",\"status\":\"" + builtinLedTestResult + "\"},";
-  json += "\"neopixel\":{\"pin\":" + String(LED_PIN) +
-          ",\"count\":" + String(LED_COUNT) +
-          ",\"status\":\"" + neopixelTestResult + "\"}";
-  json += "}";
-  server.send(200, "application/json", json);
+  ApiResponse json(200);
+  json.beginObject();
+  SectionWriter out(json);
+  writeLedsSection(out);
+  json.endObject();
 }
 
 void handleScreensInfo() {
-  String json;
-  json.reserve(900);  // Increased for driver field
-  json = "{";
-  json += "\"oled\":{\"available\":" + String(oledAvailable ? "true" : "false") +
-          ",\"status\":\"" + oledTestResult + "\",";
-  json += "\"pins\":{\"sda\":" + String(i2c_sda) + ",\"scl\":" + String(i2c_scl) + "},";
-  json += "\"rotation\":" + String(oledRotation) + ",";
-  json += "\"width\":" + String(oledWidth) + ",\"height\":" + String(oledHeight) + "}";
-
-  #if ENABLE_TFT_DISPLAY
-  json += ",\"tft\":{\"available\":true,";
-  json += "\"status\":\"" + String(tftTestResult.length() > 0 ? tftTestResult : "Ready") + "\",";
-  json += "\"driver\":\"" + tftDriver + "\",";  // v3.30.0: Current TFT driver
-  json += "\"width\":" + String(tftWidth) + ",\"height\":" + String(tftHeight) + ",";
-  json += "\"rotation\":" + String(tftRotation) + ",";
-  json += "\"pins\":{\"miso\":" + String(tftMISO) + ",\"mosi\":" + String(tftMOSI) + ",\"sclk\":" + String(tftSCLK) +
-          ",\"cs\":" + String(tftCS) + ",\"dc\":" + String(tftDC) + ",\"rst\":" + String(tftRST) +
-          ",\"bl\":" + String(tftBL) + "}}";
-  #else
-  json += ",\"tft\":{\"available\":false,\"status\":\"Not enabled\"}";
-  #endif
-
-  json += "}";
-  server.send(200, "application/json", json);
+  ApiResponse json(200);
+  json.beginObject();
+  SectionWriter out(json);
+  writeScreensSection(out);
+  json.endObject();
 }
 
 void handleOverview() {
-  collectDiagnosticInfo();
-  collectDetailedMemory();
-  scanI2C();
+  TelemetryReader telemetry;
+  const DiagnosticInfo& diag = telemetry.diag();
+  const DetailedMemoryInfo& memory = telemetry.memory();
 
-  String json;
-  json.reserve(2500);  // Reserve memory for the complete overview response
-  json = "{";
+  ApiResponse json(200);
+  json.beginObject();
 
   // Chip info
-  json += "\"chip\":{";
-  json += "\"model\":\"" + diagnosticData.chipModel + "\",";
-  json += "\"revision\":\"" + diagnosticData.chipRevision + "\",";
-  json += "\"cores\":" + String(diagnosticData.cpuCores) + ",";
-  json += "\"freq\":" + String(diagnosticData.cpuFreqMHz) + ",";
-  json += "\"mac\":\"" + diagnosticData.macAddress + "\",";
-  json += "\"uptime\":" + String(diagnosticData.uptime);
-  if (diagnosticData.temperature != -999) {
-    json += ",\"temperature\":" + String(diagnosticData.temperature, 1);
+  json.beginObject("chip");
+  json.field("model", diag.chipModel);
+  json.field("revision", diag.chipRevision);
+  json.field("cores", diag.cpuCores);
+  json.field("freq", diag.cpuFreqMHz);
+  json.field("mac", diag.macAddress);
+  json.field("uptime", diag.uptime);
+  if (diag.temperature != -999) {
+    json.fieldFloat("temperature", diag.temperature, 1);
   } else {
-    json += ",\"temperature\":-999";
+    json.field("temperature", -999);
   }
-  json += "},";
+  json.endObject();
 
   // Memory info
-  json += "\"memory\":{";
-  json += "\"flash\":{\"real\":" + String(detailedMemory.flashSizeReal) +
-          ",\"type\":\"" + getFlashType() + "\",\"speed\":\"" + getFlashSpeed() + "\"},";
-  json += "\"sram\":{\"total\":" + String(detailedMemory.sramTotal) +
-          ",\"free\":" + String(detailedMemory.sramFree) +
-          ",\"used\":" + String(detailedMemory.sramUsed) + "},";
-  json += "\"psram\":{\"total\":" + String(detailedMemory.psramTotal) +
-          ",\"free\":" + String(detailedMemory.psramFree) +
-          ",\"used\":" + String(detailedMemory.psramUsed) + "},";
-  json += "\"fragmentation\":" + String(detailedMemory.fragmentationPercent, 1);
-  json += "},";
+  json.beginObject("memory");
+  json.beginObject("flash");
+  json.field("real", memory.flashSizeReal);
+  json.field("type", getFlashType());
+  json.field("speed", getFlashSpeed());
+  json.endObject();
+  json.beginObject("sram");
+  json.field("total", memory.sramTotal);
+  json.field("free", memory.sramFree);
+  json.field("used", memory.sramUsed);
+  json.endObject();
+  json.beginObject("psram");
+  json.field("total", memory.psramTotal);
+  json.field("free", memory.psramFree);
+  json.field("used", memory.psramUsed);
+  json.endObject();
+  json.fieldFloat("fragmentation", memory.fragmentationPercent, 1);
+  json.endObject();
 
   // WiFi info - Use translation key instead of translated string
-  json += "\"wifi\":{";
-  json += "\"ssid\":\"" + diagnosticData.wifiSSID + "\",";
-  json += "\"rssi\":" + String(diagnosticData.wifiRSSI) + ",";
-  json += "\"quality_key\":\"" + String(getWiFiSignalQualityKey()) + "\",";  // Return key, not translated string
-  json += "\"quality\":\"" + getWiFiSignalQuality() + "\",";  // Keep for backward compatibility
-  json += "\"ip\":\"" + diagnosticData.ipAddress + "\"";
-  json += "},";
+  json.beginObject("wifi");
+  json.field("ssid", diag.wifiSSID);
+  json.field("rssi", diag.wifiRSSI);
+  json.field("quality_key", getWiFiSignalQualityKey(diag.wifiRSSI));  // Return key, not translated string
+  json.field("quality", getWiFiSignalQuality(diag.wifiRSSI));  // Keep for backward compatibility
+  json.field("ip", diag.ipAddress);
+  json.endObject();
 
-  // GPIO info
-  json += "\"gpio\":{";
-  json += "\"total\":" + String(diagnosticData.totalGPIO) + ",";
-  json += "\"i2c_count\":" + String(diagnosticData.i2cCount) + ",";
-  json += "\"i2c_devices\":\"" + diagnosticData.i2cDevices + "\"";
-  json += "}";
+  // GPIO info - I2C devices come from the last explicit scan (boot, /api/i2c-scan, /api/peripherals)
+  json.beginObject("gpio");
+  json.field("total", diag.totalGPIO);
+  json.field("i2c_count", diagnosticData.i2cCount);
+  json.field("i2c_devices", diagnosticData.i2cDevices);
+  json.endObject();
 
-  json += "}";
-  server.send(200, "application/json", json);
+  json.field("snapshot_age_ms", telemetry.ageMs());
+  json.endObject();
 }
 
 void handleMemoryDetails() {
-  collectDetailedMemory();
-
-  String json;
-  json.reserve(450);  // Reserve memory to avoid reallocations
-  json = "{\"flash\":{\"real\":" + String(detailedMemory.flashSizeReal) + ",\"chip\":" + String(detailedMemory.flashSizeChip) + "},";
-  json += "\"psram\":{\"available\":" + String(detailedMemory.psramAvailable ? "true" : "false") +
-          ",\"configured\":" + String(detailedMemory.psramConfigured ? "true" : "false") +
-          ",\"supported\":" + String(detailedMemory.psramBoardSupported ? "true" : "false") +
-          ",\"type\":\"" + String(detailedMemory.psramType ? detailedMemory.psramType : Texts::unknown.str()) + "\"" +
-          ",\"total\":" + String(detailedMemory.psramTotal) + ",\"free\":" + String(detailedMemory.psramFree) + "},";
-  json += "\"sram\":{\"total\":" + String(detailedMemory.sramTotal) + ",\"free\":" + String(detailedMemory.sramFree) + "},";
-  json += "\"fragmentation\":" + String(detailedMemory.fragmentationPercent, 1) + ",\"status\":\"" + detailedMemory.memoryStatus + "\"}";
-
-  server.send(200, "application/json", json);
+  TelemetryReader telemetry;
+  const DetailedMemoryInfo& memory = telemetry.memory();
+
+  ApiResponse json(200);
+  json.beginObject();
+  json.beginObject("flash");
+  json.field("real", memory.flashSizeReal);
+  json.field("chip", memory.flashSizeChip);
+  json.endObject();
+  json.beginObject("psram");
+  json.field("available", memory.psramAvailable);
+  json.field("configured", memory.psramConfigured);
+  json.field("supported", memory.psramBoardSupported);
+  json.field("type", memory.psramType ? memory.psramType : Texts::unknown.str());
+  json.field("total", memory.psramTotal);
+  json.field("free", memory.psramFree);
+  json.endObject();
+  json.beginObject("sram");
+  json.field("total", memory.sramTotal);
+  json.field("free", memory.sramFree);
+  json.endObject();
+  json.fieldFloat("fragmentation", memory.fragmentationPercent, 1);
+  json.field("status", memory.memoryStatus);
+  json.field("snapshot_age_ms", telemetry.ageMs());
+  json.endObject();
 }
 
 // ========== EXPORTS ==========
-void handleExportTXT() {
-  collectDiagnosticInfo();
-  collectDetailedMemory();
-
-  String txt;
-  txt.reserve(4500);  // Reserve memory to avoid reallocations during export
-  txt = "========================================\r\n";
-  txt += String(Texts::title) + " " + String(Texts::version) + String(PROJECT_VERSION) + "\r\n";
-  txt += "========================================\r\n\r\n";
-  
-  txt += "=== CHIP ===\r\n";
-  txt += String(Texts::model) + ": " + diagnosticData.chipModel + " " + String(Texts::revision) + diagnosticData.chipRevision + "\r\n";
-  txt += "CPU: " + String(diagnosticData.cpuCores) + " " + String(Texts::cores) + " @ " + String(diagnosticData.cpuFreqMHz) + " MHz\r\n";
-  txt += "MAC WiFi: " + diagnosticData.macAddress + "\r\n";
-  txt += "SDK: " + diagnosticData.sdkVersion + "\r\n";
-  txt += "ESP-IDF: " + diagnosticData.idfVersion + "\r\n";
+// [OPT-019]: Un seul modèle de rapport (sections ordonnées, champs typés) alimente
+// TXT, JSON/CBOR, CSV et /print. Chaque format est un ReportRenderer qui écrit
+// au fil de l'eau dans un buffer fixe (envoi chunked) : aucune String géante en RAM.
+
+// Ordered report content shared by every export format
+void writeDiagnosticReport(ReportRenderer& renderer) {
+  ReportBuilder report(renderer);
+
+  report.beginSection("chip", Texts::chip_info);
+  report.text("model", Texts::model, diagnosticData.chipModel);
+  report.text("revision", Texts::revision, diagnosticData.chipRevision);
+  report.number("cores", Texts::cpu_cores, diagnosticData.cpuCores);
+  report.number("freq_mhz", Texts::frequency, diagnosticData.cpuFreqMHz, "MHz");
+  report.text("mac", Texts::mac_wifi, diagnosticData.macAddress);
+  report.text("sdk", Texts::sdk_version, diagnosticData.sdkVersion);
+  report.text("idf", Texts::idf_version, diagnosticData.idfVersion);
   if (diagnosticData.temperature != -999) {
-    txt += String(Texts::cpu_temp) + ": " + String(diagnosticData.temperature, 1) + " °C\r\n";
-  }
-  txt += "\r\n";
-  
-  txt += "=== " + String(Texts::memory_details) + " ===\r\n";
-  txt += "Flash (" + String(Texts::board) + "): " + String(detailedMemory.flashSizeReal / 1048576.0, 2) + " MB\r\n";
-  txt += "Flash (IDE): " + String(detailedMemory.flashSizeChip / 1048576.0, 2) + " MB\r\n";
-  txt += String(Texts::flash_type) + ": " + getFlashType() + " @ " + getFlashSpeed() + "\r\n";
-  txt += "PSRAM: " + String(detailedMemory.psramTotal / 1048576.0, 2) + " MB";
-  if (detailedMemory.psramAvailable) {
-    txt += " (" + String(Texts::free) + ": " + String(detailedMemory.psramFree / 1048576.0, 2) + " MB)\r\n";
-  } else if (detailedMemory.psramBoardSupported) {
-    String psramHint = String(Texts::enable_psram_hint);
-    psramHint.replace("%TYPE%", detailedMemory.psramType ? detailedMemory.psramType : "PSRAM");
-    txt += " (" + String(Texts::supported_not_enabled) + " - " + psramHint + ")\r\n";
-  } else {
-    txt += " (" + String(Texts::not_detected) + ")\r\n";
-  }
-  txt += "SRAM: " + String(detailedMemory.sramTotal / 1024.0, 2) + " KB";
-  txt += " (" + String(Texts::free) + ": " + String(detailedMemory.sramFree / 1024.0, 2) + " KB)\r\n";
-  txt += String(Texts::memory_fragmentation) + ": " + String(detailedMemory.fragmentationPercent, 1) + "%\r\n";
-  txt += String(Texts::memory_status) + ": " + detailedMemory.memoryStatus + "\r\n";
-  txt += "\r\n";
-  
-  txt += "=== WIFI ===\r\n";
-  txt += "SSID: " + diagnosticData.wifiSSID + "\r\n";
-  txt += "RSSI: " + String(diagnosticData.wifiRSSI) + " dBm (" + getWiFiSignalQuality() + ")\r\n";
-  txt += "IP: " + diagnosticData.ipAddress + "\r\n";
-  txt += "Lien constant: " + getStableAccessURL() + " (" + String(diagnosticData.mdnsAvailable ? "actif" : "en attente") + ")\r\n";
-  txt += String(Texts::subnet_mask) + ": " + WiFi.subnetMask().toString() + "\r\n";
-  txt += String(Texts::gateway) + ": " + WiFi.gatewayIP().toString() + "\r\n";
-  txt += "DNS: " + WiFi.dnsIP().toString() + "\r\n";
-  txt += "\r\n";
-
-  txt += "=== GPIO ===\r\n";
-  txt += String(Texts::total_gpio) + ": " + String(diagnosticData.totalGPIO) + " " + String(Texts::pins) + "\r\n";
-  txt += String(Texts::gpio_list) + ": " + diagnosticData.gpioList + "\r\n";
-  txt += "\r\n";
-  
-  txt += "=== " + String(Texts::i2c_peripherals) + " ===\r\n";
-  txt += String(Texts::device_count) + ": " + String(diagnosticData.i2cCount) + " - " + diagnosticData.i2cDevices + "\r\n";
-  txt += "SPI: " + spiInfo + "\r\n";
-  txt += "\r\n";
-  
-  txt += "=== " + String(Texts::test) + " ===\r\n";
-  txt += String(Texts::builtin_led) + ": " + builtinLedTestResult + "\r\n";
-  txt += String(Texts::neopixel) + ": " + neopixelTestResult + "\r\n";
-  txt += "OLED: " + oledTestResult + "\r\n";
-  txt += "ADC: " + adcTestResult + "\r\n";
-  txt += "PWM: " + pwmTestResult + "\r\n";
-  txt += "SD Card: " + sdTestResult + "\r\n";
-  txt += "Rotary Encoder: " + rotaryTestResult + "\r\n";
-  txt += "\r\n";
-  
-  txt += "=== " + String(Texts::performance_bench) + " ===\r\n";
+    report.decimal("temperature", Texts::cpu_temp, diagnosticData.temperature, 1, "°C");
+  }
+  report.endSection();
+
+  report.beginSection("memory", Texts::memory_details);
+  report.decimal("flash_real_mb", {Texts::flash_memory, "board"}, detailedMemory.flashSizeReal / 1048576.0, 2, "MB");
+  report.decimal("flash_config_mb", {Texts::flash_memory, "IDE"}, detailedMemory.flashSizeChip / 1048576.0, 2, "MB");
+  report.text("flash_type", Texts::flash_type, getFlashType());
+  report.text("flash_speed", Texts::flash_speed, getFlashSpeed());
+  report.decimal("psram_mb", Texts::total_psram, detailedMemory.psramTotal / 1048576.0, 2, "MB");
+  report.decimal("psram_free_mb", {Texts::free, "PSRAM"}, detailedMemory.psramFree / 1048576.0, 2, "MB");
+  report.flag("psram_available", Texts::psram_external, detailedMemory.psramAvailable, Texts::detected_active,
+              Texts::not_detected);
+  report.flag("psram_supported", {Texts::psram_external, "board"}, detailedMemory.psramBoardSupported, Texts::ok,
+              Texts::not_available);
+  report.text("psram_type", {Texts::type, "PSRAM"},
+              detailedMemory.psramType ? String(detailedMemory.psramType) : Texts::unknown.str());
+  report.decimal("sram_kb", Texts::internal_sram, detailedMemory.sramTotal / 1024.0, 2, "KB");
+  report.decimal("sram_free_kb", {Texts::free, "SRAM"}, detailedMemory.sramFree / 1024.0, 2, "KB");
+  report.decimal("fragmentation", Texts::memory_fragmentation, detailedMemory.fragmentationPercent, 1, "%");
+  report.text("status", Texts::memory_status, detailedMemory.memoryStatus);
+  report.endSection();
+
+  char address[16];
+  report.beginSection("wifi", Texts::wifi_connection);
+  report.text("ssid", Texts::ssid, diagnosticData.wifiSSID);
+  report.number("rssi", Texts::signal_power, diagnosticData.wifiRSSI, "dBm");
+  report.text("quality", Texts::signal_quality, getWiFiSignalQuality());
+  report.text("ip", Texts::ip_address, diagnosticData.ipAddress);
+  report.flag("mdns_ready", {Texts::hostname, "mDNS"}, diagnosticData.mdnsAvailable, Texts::ok, Texts::not_available);
+  report.text("stable_url", Texts::access, getStableAccessURL());
+  formatIPAddress(WiFi.subnetMask(), address, sizeof(address));
+  report.text("subnet", Texts::subnet_mask, address);
+  formatIPAddress(WiFi.gatewayIP(), address, sizeof(address));
+  report.text("gateway", Texts::gateway, address);
+  formatIPAddress(WiFi.dnsIP(), address, sizeof(address));
+  report.text("dns", Texts::dns, address);
+  report.endSection();
+
+  report.beginSection("gpio", Texts::gpio_interfaces);
+  report.number("total", Texts::total_gpio, diagnosticData.totalGPIO);
+  report.text("list", Texts::gpio_list, diagnosticData.gpioList);
+  report.endSection();
+
+  report.beginSection("peripherals", Texts::i2c_peripherals);
+  report.number("i2c_count", Texts::device_count, diagnosticData.i2cCount);
+  report.text("i2c_devices", Texts::i2c_devices, diagnosticData.i2cDevices);
+  report.text("spi", Texts::spi_bus, spiInfo);
+  report.endSection();
+
+  report.beginSection("hardware_tests", Texts::test);
+  report.text("builtin_led", Texts::builtin_led, builtinLedTestResult);
+  report.text("neopixel", Texts::neopixel, neopixelTestResult);
+  report.text("oled", Texts::oled_screen, oledTestResult);
+  report.text("adc", Texts::adc_test, adcTestResult);
+  report.text("pwm", Texts::pwm_test, pwmTestResult);
+  report.text("sd_card", Texts::sd_card, sdTestResult);
+  report.text("rotary_encoder", Texts::rotary_encoder, rotaryTestResult);
+  report.endSection();
+
+  report.beginSection("performance", Texts::performance_bench);
   if (diagnosticData.cpuBenchmark > 0) {
-    txt += "CPU: " + String(diagnosticData.cpuBenchmark) + " us (" + String(100000.0 / diagnosticData.cpuBenchmark, 2) + " MFLOPS)\r\n";
-    txt += String(Texts::memory_benchmark) + ": " + String(diagnosticData.memBenchmark) + " us\r\n";
+    report.number("cpu_us", Texts::cpu_benchmark, diagnosticData.cpuBenchmark, "us");
+    if (cpuBench.valid()) {
+      const uint8_t appCore = cpuBench.cores() - 1;
+      report.decimal("cpu_perf", Texts::cpu_perf_score, cpuBench.score(appCore), 2, "ops/us");
+      for (uint8_t kernel = 0; kernel < CPU_KERNEL_COUNT; ++kernel) {
+        char key[24];
+        snprintf(key, sizeof(key), "cpu_%s_us", CPU_KERNELS[kernel].name);
+        report.decimal(key, {Texts::cpu_benchmark, CPU_KERNELS[kernel].name},
+                       cpuBench.medianUs(kernel, CpuBench::SINGLE, appCore), 2, "us");
+      }
+    }
+    report.number("memory_us", Texts::memory_benchmark, diagnosticData.memBenchmark, "us");
   } else {
-    txt += String(Texts::not_tested) + "\r\n";
-  }
-  txt += "Stress test: " + stressTestResult + "\r\n";
-  txt += "\r\n";
-  
-  unsigned long seconds = diagnosticData.uptime / 1000;
-  unsigned long minutes = seconds / 60;
-  unsigned long hours = minutes / 60;
-  unsigned long days = hours / 24;
-  // === ENVIRONNEMENT ===
-  txt += "=== ENVIRONNEMENT ===\r\n";
-  txt += "AHT20: ";
-  txt += envData.aht20_available ? "OK" : "Non détecté";
-  txt += "\r\n";
-  txt += "  Température (AHT20): ";
-  txt += (envData.temperature_aht20 != -999.0 ? String(envData.temperature_aht20, 1) + " °C" : "N/A");
-  txt += "\r\n";
-  txt += "  Humidité: ";
-  txt += (envData.humidity != -999.0 ? String(envData.humidity, 1) + " %" : "N/A");
-  txt += "\r\n";
-  txt += "  Statut: " + envData.aht20_status + "\r\n";
-  txt += "BMP280: ";
-  txt += envData.bmp280_available ? "OK" : "Non détecté";
-  txt += "\r\n";
-  txt += "  Température (BMP280): ";
-  txt += (envData.temperature_bmp280 != -999.0 ? String(envData.temperature_bmp280, 1) + " °C" : "N/A");
-  txt += "\r\n";
-  txt += "  Pression: ";
-  txt += (envData.pressure != -999.0 ? String(envData.pressure, 1) + " hPa" : "N/A");
-  txt += "\r\n";
-  txt += "  Altitude: ";
-  txt += (envData.altitude != -999.0 ? String(envData.altitude, 1) + " m" : "N/A");
-  txt += "\r\n";
-  txt += "  Statut: " + envData.bmp280_status + "\r\n";
-  txt += "Moyenne température: ";
-  txt += (envData.temperature_avg != -999.0 ? String(envData.temperature_avg, 1) + " °C" : "N/A");
-  txt += "\r\n";
-  txt += "Statut global: " + envData.combined_status + "\r\n";
-  txt += "\r\n";
-
-  // === GPS ===
-  txt += "=== GPS ===\r\n";
-  txt += "Module: ";
-  txt += gpsAvailable ? "OK" : "Non détecté";
-  txt += "\r\n";
-  txt += "  Statut: " + gpsData.status_str + "\r\n";
-  txt += "  Fix: ";
-  txt += gpsData.hasFix ? "Oui" : "Non";
-  txt += "\r\n";
-  txt += "  Satellites: ";
-  txt += String(gpsData.satellites);
-  txt += "\r\n";
-  txt += "  Latitude: ";
-  txt += (gpsData.hasFix ? String(gpsData.latitude, 6) : "N/A");
-  txt += "\r\n";
-  txt += "  Longitude: ";
-  txt += (gpsData.hasFix ? String(gpsData.longitude, 6) : "N/A");
-  txt += "\r\n";
-  txt += "  Altitude: ";
-  txt += (gpsData.hasFix ? String(gpsData.altitude, 1) + " m" : "N/A");
-  txt += "\r\n";
-  txt += "  Vitesse: ";
-  txt += (gpsData.hasFix ? String(gpsData.speed, 2) + " noeuds" : "N/A");
-  txt += "\r\n";
-  txt += "  HDOP: ";
-  txt += (gpsData.hasFix ? String(gpsData.hdop, 2) : "N/A");
-  txt += "\r\n";
-  txt += "  Date/Heure: ";
+    report.text("benchmarks", Texts::cpu_benchmark, "not_run", Texts::not_tested);
+  }
+  report.text("stress_test", Texts::memory_stress, stressTestResult);
+  report.endSection();
+
+  if (memoryCurvesMs > 0) {
+    report.beginSection("memory_hierarchy", Texts::memory_hierarchy);
+    for (const MemCurve& curve : memoryCurves) {
+      for (uint8_t i = 0; i < curve.count; ++i) {
+        const MemoryPoint& point = curve.points[i];
+        const unsigned long kb = point.bytes / 1024;
+        char key[32];
+        char detail[24];
+        snprintf(detail, sizeof(detail), "%s %lu KB", curve.name, kb);
+        snprintf(key, sizeof(key), "%s_%luk_read_mbps", curve.name, kb);
+        report.decimal(key, {Texts::read_bandwidth, detail}, point.readMBps, 1, "MB/s");
+        if (curve.writable) {
+          snprintf(key, sizeof(key), "%s_%luk_write_mbps", curve.name, kb);
+          report.decimal(key, {Texts::write_bandwidth, detail}, point.writeMBps, 1, "MB/s");
+          snprintf(key, sizeof(key), "%s_%luk_copy_mbps", curve.name, kb);
+          report.decimal(key, {Texts::copy_bandwidth, detail}, point.copyMBps, 1, "MB/s");
+        }
+        snprintf(key, sizeof(key), "%s_%luk_latency_ns", curve.name, kb);
+        report.decimal(key, {Texts::access_latency, detail}, point.latencyNs, 1, "ns");
+      }
+    }
+    report.endSection();
+  }
+
+  report.beginSection("environment", Texts::environmental_sensors);
+  report.flag("aht20_available", Texts::aht20_sensor, envData.aht20_available, Texts::ok, Texts::not_detected);
+  report.optionalDecimal("temperature_aht20", {Texts::temperature, "AHT20"}, envData.temperature_aht20,
+                         envData.temperature_aht20 != -999.0, 1, "°C");
+  report.optionalDecimal("humidity", Texts::humidity, envData.humidity, envData.humidity != -999.0, 1, "%");
+  report.text("aht20_status", {Texts::status, "AHT20"}, envData.aht20_status);
+  report.flag("bmp280_available", Texts::bmp280_sensor, envData.bmp280_available, Texts::ok, Texts::not_detected);
+  report.optionalDecimal("temperature_bmp280", {Texts::temperature, "BMP280"}, envData.temperature_bmp280,
+                         envData.temperature_bmp280 != -999.0, 1, "°C");
+  report.optionalDecimal("pressure", Texts::pressure, envData.pressure, envData.pressure != -999.0, 1, "hPa");
+  report.optionalDecimal("altitude", Texts::altitude_calculated, envData.altitude, envData.altitude != -999.0, 1, "m");
+  report.text("bmp280_status", {Texts::status, "BMP280"}, envData.bmp280_status);
+  report.optionalDecimal("temperature_avg", Texts::temperature_avg, envData.temperature_avg,
+                         envData.temperature_avg != -999.0, 1, "°C");
+  report.text("combined_status", Texts::status, envData.combined_status);
+  report.endSection();
+
+  char dateTime[24];
   if (gpsData.hasTime && gpsData.hasDate) {
-    txt += String(gpsData.day) + "/" + String(gpsData.month) + "/" + String(gpsData.year) + " ";
-    txt += (gpsData.hour < 10 ? "0" : "") + String(gpsData.hour) + ":";
-    txt += (gpsData.minute < 10 ? "0" : "") + String(gpsData.minute) + ":";
-    txt += (gpsData.second < 10 ? "0" : "") + String(gpsData.second);
+    snprintf(dateTime, sizeof(dateTime), "%u/%u/%u %02u:%02u:%02u",
+             gpsData.day, gpsData.month, gpsData.year,
+             gpsData.hour, gpsData.minute, gpsData.second);
   } else {
-    txt += "N/A";
-  }
-  txt += "\r\n\r\n";
-
-  // === SYSTEME ===
-  txt += "=== SYSTEM ===\r\n";
-  txt += String(Texts::uptime) + ": " + String(days) + "d " + String(hours % 24) + "h " + String(minutes % 60) + "m\r\n";
-  txt += String(Texts::last_reset) + ": " + getResetReason() + "\r\n";
-  txt += "\r\n";
-  txt += "========================================\r\n";
-  txt += String(Texts::export_generated) + " " + String(millis()/1000) + "s " + String(Texts::export_after_boot) + "\r\n";
-  txt += "========================================\r\n";
-
-  server.sendHeader("Content-Disposition", "attachment; filename=esp32_diagnostic_v"+ String(PROJECT_VERSION) +".txt");
-  server.send(200, "text/plain; charset=utf-8", txt);
+    snprintf(dateTime, sizeof(dateTime), "N/A");
+  }
+  report.beginSection("gps", Texts::gps_module);
+  report.flag("available", Texts::gps_module, gpsAvailable, Texts::ok, Texts::not_detected);
+  report.text("status", Texts::gps_status, gpsData.status_str);
+  report.flag("has_fix", Texts::gps_fix_type, gpsData.hasFix, Texts::ok, Texts::none);
+  report.number("satellites", Texts::gps_satellites, gpsData.satellites);
+  report.optionalDecimal("latitude", Texts::gps_latitude, gpsData.latitude, gpsData.hasFix, 6);
+  report.optionalDecimal("longitude", Texts::gps_longitude, gpsData.longitude, gpsData.hasFix, 6);
+  report.optionalDecimal("altitude", Texts::gps_altitude, gpsData.altitude, gpsData.hasFix, 1, "m");
+  report.optionalDecimal("speed", Texts::gps_speed, gpsData.speed, gpsData.hasFix, 2, "kn");
+  report.optionalDecimal("hdop", Texts::gps_hdop, gpsData.hdop, gpsData.hasFix, 2);
+  report.text("date_time", Texts::gps_date_time, dateTime);
+  report.endSection();
+
+  // Histogrammes complets : /api/jitter
+  report.beginSection("responsiveness", Texts::responsiveness);
+  report.number("loop_period_p50_us", {Texts::loop_period, "p50"}, jitterMonitor.loopPeriod().percentileUs(500),
+                "us");
+  report.number("loop_period_max_us", {Texts::loop_period, "max"}, jitterMonitor.loopPeriod().maxUs(), "us");
+  report.number("handler_p99_us", {Texts::handler_duration, "p99"}, jitterMonitor.handler().percentileUs(990), "us");
+  report.number("handler_max_us", {Texts::handler_duration, "max"}, jitterMonitor.handler().maxUs(), "us");
+  report.number("isr_latency_p99_us", {Texts::isr_loop_latency, "p99"}, jitterMonitor.isrLatency().percentileUs(990),
+                "us");
+  report.number("isr_latency_max_us", {Texts::isr_loop_latency, "max"}, jitterMonitor.isrLatency().maxUs(), "us");
+  static const char* const CORE_NAMES[JitterMonitor<JITTER_STALL_LOG>::MAX_CORES] = {"core 0", "core 1"};
+  static const char* const TICK_MAX_KEYS[JitterMonitor<JITTER_STALL_LOG>::MAX_CORES] = {"tick_max_us_core0",
+                                                                                         "tick_max_us_core1"};
+  static const char* const LATE_TICK_KEYS[JitterMonitor<JITTER_STALL_LOG>::MAX_CORES] = {"late_ticks_core0",
+                                                                                          "late_ticks_core1"};
+  for (uint8_t core = 0; core < jitterMonitor.cores(); ++core) {
+    report.number(TICK_MAX_KEYS[core], {Texts::tick_interval_max, CORE_NAMES[core]},
+                  jitterMonitor.ticks(core).maxUs(), "us");
+    report.number(LATE_TICK_KEYS[core], {Texts::late_ticks, CORE_NAMES[core]}, jitterMonitor.lateTicks(core));
+  }
+  report.number("stall_threshold_ms", Texts::stall_threshold, jitterMonitor.stallMs(), "ms");
+  report.number("stalls", Texts::stalls, jitterMonitor.stallCount());
+  const auto* stall = jitterMonitor.lastStall();
+  if (stall != nullptr) {
+    char lastStall[128];
+    snprintf(lastStall, sizeof(lastStall), "%lu ms %s, %s, jobs: %s (uptime %lu s)",
+             static_cast<unsigned long>(stall->durationUs / 1000), stall->starved ? "starved" : "busy",
+             stall->activity, stall->jobs[0] ? stall->jobs : "-", static_cast<unsigned long>(stall->uptimeMs / 1000));
+    report.text("last_stall", Texts::last_stall, lastStall);
+  }
+  report.endSection();
+
+  report.beginSection("system", Texts::system_section);
+  report.duration("uptime_ms", Texts::uptime, diagnosticData.uptime);
+  report.text("reset_reason", Texts::last_reset, getResetReason());
+  report.text("language", Texts::language_label, currentLanguage == LANG_FR ? "fr" : "en");
+  report.endSection();
 }
 
-void handleExportJSON() {
+void handleExportTXT() {
   collectDiagnosticInfo();
   collectDetailedMemory();
-  String stableUrl = getStableAccessURL();
-
-  String json;
-  json.reserve(3500);  // Reserve memory to avoid reallocations during export
-  json = "{";
-  json += "\"chip\":{";
-  json += "\"model\":\"" + diagnosticData.chipModel + "\",";
-  json += "\"revision\":\"" + diagnosticData.chipRevision + "\",";
-  json += "\"cores\":" + String(diagnosticData.cpuCores) + ",";
-  json += "\"freq_mhz\":" + String(diagnosticData.cpuFreqMHz) + ",";
-  json += "\"mac\":\"" + diagnosticData.macAddress + "\",";
-  json += "\"sdk\":\"" + diagnosticData.sdkVersion + "\",";
-  json += "\"idf\":\"" + diagnosticData.idfVersion + "\"";
-  if (diagnosticData.temperature != -999) {
-    json += ",\"temperature\":" + String(diagnosticData.temperature, 1);
-  }
-  json += "},";
-  
-  json += "\"memory\":{";
-  json += "\"flash_real_mb\":" + String(detailedMemory.flashSizeReal / 1048576.0, 2) + ",";
-  json += "\"flash_config_mb\":" + String(detailedMemory.flashSizeChip / 1048576.0, 2) + ",";
-  json += "\"flash_type\":\"" + getFlashType() + "\",";
-  json += "\"flash_speed\":\"" + getFlashSpeed() + "\",";
-  json += "\"psram_mb\":" + String(detailedMemory.psramTotal / 1048576.0, 2) + ",";
-  json += "\"psram_free_mb\":" + String(detailedMemory.psramFree / 1048576.0, 2) + ",";
-  json += "\"psram_available\":" + String(detailedMemory.psramAvailable ? "true" : "false") + ",";
-  json += "\"psram_supported\":" + String(detailedMemory.psramBoardSupported ? "true" : "false") + ",";
-  json += "\"psram_type\":\"" + String(detailedMemory.psramType ? detailedMemory.psramType : Texts::unknown.str()) + "\",";
-  json += "\"sram_kb\":" + String(detailedMemory.sramTotal / 1024.0, 2) + ",";
-  json += "\"sram_free_kb\":" + String(detailedMemory.sramFree / 1024.0, 2) + ",";
-  json += "\"fragmentation\":" + String(detailedMemory.fragmentationPercent, 1) + ",";
-  json += "\"status\":\"" + detailedMemory.memoryStatus + "\"";
-  json += "},";
-  
-  json += "\"wifi\":{";
-  json += "\"ssid\":\"" + diagnosticData.wifiSSID + "\",";
-  json += "\"rssi\":" + String(diagnosticData.wifiRSSI) + ",";
-  json += "\"quality\":\"" + getWiFiSignalQuality() + "\",";
-  json += "\"ip\":\"" + diagnosticData.ipAddress + "\",";
-  json += "\"mdns_ready\":" + String(diagnosticData.mdnsAvailable ? "true" : "false") + ",";
-  json += "\"stable_url\":\"" + jsonEscape(stableUrl.c_str()) + "\",";
-  json += "\"subnet\":\"" + WiFi.subnetMask().toString() + "\",";
-  json += "\"gateway\":\"" + WiFi.gatewayIP().toString() + "\",";
-  json += "\"dns\":\"" + WiFi.dnsIP().toString() + "\"";
-  json += "},";
-
-  json += "\"gpio\":{";
-  json += "\"total\":" + String(diagnosticData.totalGPIO) + ",";
-  json += "\"list\":\"" + diagnosticData.gpioList + "\"";
-  json += "},";
-  
-  json += "\"peripherals\":{";
-  json += "\"i2c_count\":" + String(diagnosticData.i2cCount) + ",";
-  json += "\"i2c_devices\":\"" + diagnosticData.i2cDevices + "\",";
-  json += "\"spi\":\"" + spiInfo + "\"";
-  json += "},";
-  
-  json += "\"hardware_tests\":{";
-  json += "\"builtin_led\":\"" + builtinLedTestResult + "\",";
-  json += "\"neopixel\":\"" + neopixelTestResult + "\",";
-  json += "\"oled\":\"" + oledTestResult + "\",";
-  json += "\"adc\":\"" + adcTestResult + "\",";
-  json += "\"pwm\":\"" + pwmTestResult + "\",";
-  json += "\"sd_card\":\"" + sdTestResult + "\",";
-  json += "\"rotary_encoder\":\"" + rotaryTestResult + "\"";
-  json += "},";
-  
-  json += "\"performance\":{";
-  if (diagnosticData.cpuBenchmark > 0) {
-    json += "\"cpu_us\":" + String(diagnosticData.cpuBenchmark) + ",";
-    json += "\"cpu_mflops\":" + String(100000.0 / diagnosticData.cpuBenchmark, 2) + ",";
-    json += "\"memory_us\":" + String(diagnosticData.memBenchmark);
-  } else {
-    json += "\"benchmarks\":\"not_run\"";
-  }
-  json += ",\"stress_test\":\"" + stressTestResult + "\"";
-  json += "},";
-  
-  // === ENVIRONNEMENT ===
-  json += ",\"environment\":{";
-  json += "\"aht20_available\":" + String(envData.aht20_available ? "true" : "false") + ",";
-  json += "\"temperature_aht20\":" + (envData.temperature_aht20 != -999.0 ? String(envData.temperature_aht20, 1) : "null") + ",";
-  json += "\"humidity\":" + (envData.humidity != -999.0 ? String(envData.humidity, 1) : "null") + ",";
-  json += "\"aht20_status\":\"" + jsonEscape(envData.aht20_status.c_str()) + "\",";
-  json += "\"bmp280_available\":" + String(envData.bmp280_available ? "true" : "false") + ",";
-  json += "\"temperature_bmp280\":" + (envData.temperature_bmp280 != -999.0 ? String(envData.temperature_bmp280, 1) : "null") + ",";
-  json += "\"pressure\":" + (envData.pressure != -999.0 ? String(envData.pressure, 1) : "null") + ",";
-  json += "\"altitude\":" + (envData.altitude != -999.0 ? String(envData.altitude, 1) : "null") + ",";
-  json += "\"bmp280_status\":\"" + jsonEscape(envData.bmp280_status.c_str()) + "\",";
-  json += "\"temperature_avg\":" + (envData.temperature_avg != -999.0 ? String(envData.temperature_avg, 1) : "null") + ",";
-  json += "\"combined_status\":\"" + jsonEscape(envData.combined_status.c_str()) + "\"";
-  json += "},";
-
-  // === GPS ===
-  json += "\"gps\":{";
-  json += "\"available\":" + String(gpsAvailable ? "true" : "false") + ",";
-  json += "\"status\":\"" + jsonEscape(gpsData.status_str.c_str()) + "\",";
-  json += "\"has_fix\":" + String(gpsData.hasFix ? "true" : "false") + ",";
-  json += "\"satellites\":" + String(gpsData.satellites) + ",";
-  json += "\"latitude\":" + (gpsData.hasFix ? String(gpsData.latitude, 6) : "null") + ",";
-  json += "\"longitude\":" + (gpsData.hasFix ? String(gpsData.longitude, 6) : "null") + ",";
-  json += "\"altitude\":" + (gpsData.hasFix ? String(gpsData.altitude, 1) : "null") + ",";
-  json += "\"speed\":" + (gpsData.hasFix ? String(gpsData.speed, 2) : "null") + ",";
-  json += "\"hdop\":" + (gpsData.hasFix ? String(gpsData.hdop, 2) : "null") + ",";
-  json += "\"date_time\":\"";
-  if (gpsData.hasTime && gpsData.hasDate) {
-    json += String(gpsData.day) + "/" + String(gpsData.month) + "/" + String(gpsData.year) + " ";
-    if (gpsData.hour < 10) json += "0";
-    json += String(gpsData.hour) + ":";
-    if (gpsData.minute < 10) json += "0";
-    json += String(gpsData.minute) + ":";
-    if (gpsData.second < 10) json += "0";
-    json += String(gpsData.second);
-  } else {
-    json += "N/A";
-  }
-  json += "\"";
-  json += "},";
 
-  // === SYSTEME ===
-  json += "\"system\":{";
-  json += "\"uptime_ms\":" + String(diagnosticData.uptime) + ",";
-  json += "\"reset_reason\":\"" + getResetReason() + "\",";
-  json += "\"language\":\"en\"";
-  json += "}";
+  server.sendHeader("Content-Disposition", "attachment; filename=esp32_diagnostic_v" + String(PROJECT_VERSION) + ".txt");
+  TextResponse response(200, "text/plain; charset=utf-8");
+  ReportSink& out = response.sink();
+  out.write("========================================\r\n");
+  out.write(Texts::title);
+  out.write(' ');
+  out.write(Texts::version);
+  out.write(PROJECT_VERSION "\r\n");
+  out.write("========================================\r\n\r\n");
 
-  json += "}";
+  TextReportRenderer renderer(out);
+  writeDiagnosticReport(renderer);
 
-  server.sendHeader("Content-Disposition", "attachment; filename=esp32_diagnostic_v" + String(PROJECT_VERSION) + ".json");
-  server.send(200, "application/json", json);
+  char generated[24];
+  snprintf(generated, sizeof(generated), " %lus ", static_cast<unsigned long>(millis() / 1000));
+  out.write("========================================\r\n");
+  out.write(Texts::export_generated);
+  out.write(generated);
+  out.write(Texts::export_after_boot);
+  out.write("\r\n========================================\r\n");
 }
 
-void handleExportCSV() {
+void handleExportJSON() {
   collectDiagnosticInfo();
   collectDetailedMemory();
 
-  String csv;
-  csv.reserve(4000);  // Reserve memory to avoid reallocations during export
-  csv = String(Texts::category) + "," + String(Texts::parameter) + "," + String(Texts::value) + "\r\n";
-  
-  csv += "Chip," + String(Texts::model) + "," + diagnosticData.chipModel + "\r\n";
-  csv += "Chip," + String(Texts::revision) + "," + diagnosticData.chipRevision + "\r\n";
-  csv += "Chip,CPU " + String(Texts::cores) + "," + String(diagnosticData.cpuCores) + "\r\n";
-  csv += "Chip," + String(Texts::frequency) + " MHz," + String(diagnosticData.cpuFreqMHz) + "\r\n";
-  csv += "Chip,MAC," + diagnosticData.macAddress + "\r\n";
-  if (diagnosticData.temperature != -999) {
-    csv += "Chip," + String(Texts::cpu_temp) + " C," + String(diagnosticData.temperature, 1) + "\r\n";
-  }
-  
-  csv += String(Texts::memory_details) + ",Flash MB (" + String(Texts::board) + ")," + String(detailedMemory.flashSizeReal / 1048576.0, 2) + "\r\n";
-  csv += String(Texts::memory_details) + ",Flash MB (config)," + String(detailedMemory.flashSizeChip / 1048576.0, 2) + "\r\n";
-  csv += String(Texts::memory_details) + "," + String(Texts::flash_type) + "," + getFlashType() + "\r\n";
-  csv += String(Texts::memory_details) + ",PSRAM MB," + String(detailedMemory.psramTotal / 1048576.0, 2) + "\r\n";
-  csv += String(Texts::memory_details) + ",PSRAM " + String(Texts::free) + " MB," + String(detailedMemory.psramFree / 1048576.0, 2) + "\r\n";
-  String psramStatus = detailedMemory.psramAvailable ? String(Texts::detected_active)
-                                                    : (detailedMemory.psramBoardSupported ? String(Texts::supported_not_enabled)
-                                                                                        : String(Texts::not_detected));
-  csv += String(Texts::memory_details) + ",PSRAM Statut,\"" + psramStatus + "\"\r\n";
-  if (!detailedMemory.psramAvailable && detailedMemory.psramBoardSupported) {
-    String psramHint = String(Texts::enable_psram_hint);
-    psramHint.replace("%TYPE%", detailedMemory.psramType ? detailedMemory.psramType : "PSRAM");
-    psramHint.replace("\"", "'");
-    csv += String(Texts::memory_details) + ",PSRAM Conseils,\"" + psramHint + "\"\r\n";
-  }
-  csv += String(Texts::memory_details) + ",SRAM KB," + String(detailedMemory.sramTotal / 1024.0, 2) + "\r\n";
-  csv += String(Texts::memory_details) + ",SRAM " + String(Texts::free) + " KB," + String(detailedMemory.sramFree / 1024.0, 2) + "\r\n";
-  csv += String(Texts::memory_details) + "," + String(Texts::memory_fragmentation) + " %," + String(detailedMemory.fragmentationPercent, 1) + "\r\n";
-  
-  csv += "WiFi,SSID," + diagnosticData.wifiSSID + "\r\n";
-  csv += "WiFi,RSSI dBm," + String(diagnosticData.wifiRSSI) + "\r\n";
-  csv += "WiFi,IP," + diagnosticData.ipAddress + "\r\n";
-  csv += "WiFi," + String(Texts::gateway) + "," + WiFi.gatewayIP().toString() + "\r\n";
-
-  csv += "GPIO," + String(Texts::total_gpio) + "," + String(diagnosticData.totalGPIO) + "\r\n";
-  
-  csv += String(Texts::i2c_peripherals) + "," + String(Texts::device_count) + "," + String(diagnosticData.i2cCount) + "\r\n";
-  csv += String(Texts::i2c_peripherals) + "," + String(Texts::devices) + "," + diagnosticData.i2cDevices + "\r\n";
-  
-  csv += String(Texts::test) + "," + String(Texts::builtin_led) + "," + builtinLedTestResult + "\r\n";
-  csv += String(Texts::test) + "," + String(Texts::neopixel) + "," + neopixelTestResult + "\r\n";
-  csv += String(Texts::test) + ",OLED," + oledTestResult + "\r\n";
-  csv += String(Texts::test) + ",ADC," + adcTestResult + "\r\n";
-  csv += String(Texts::test) + ",PWM," + pwmTestResult + "\r\n";
-  csv += String(Texts::test) + ",SD Card," + sdTestResult + "\r\n";
-  csv += String(Texts::test) + ",Rotary Encoder," + rotaryTestResult + "\r\n";
+  ApiResponse json(200);
+  char disposition[64];
+  snprintf(disposition, sizeof(disposition), "attachment; filename=esp32_diagnostic_v%s.%s",
+           PROJECT_VERSION, json.isCbor() ? "cbor" : "json");
+  server.sendHeader("Content-Disposition", disposition);
 
-  if (diagnosticData.cpuBenchmark > 0) {
-    csv += String(Texts::performance_bench) + ",CPU us," + String(diagnosticData.cpuBenchmark) + "\r\n";
-    csv += String(Texts::performance_bench) + "," + String(Texts::memory_benchmark) + " us," + String(diagnosticData.memBenchmark) + "\r\n";
-  }
-
-  // === ENVIRONNEMENT ===
-  csv += "Environnement,AHT20 disponible," + String(envData.aht20_available ? "Oui" : "Non") + "\r\n";
-  csv += "Environnement,Température (AHT20)," + (envData.temperature_aht20 != -999.0 ? String(envData.temperature_aht20, 1) : "N/A") + "\r\n";
-  csv += "Environnement,Humidité," + (envData.humidity != -999.0 ? String(envData.humidity, 1) : "N/A") + "\r\n";
-  csv += "Environnement,Statut AHT20," + envData.aht20_status + "\r\n";
-  csv += "Environnement,BMP280 disponible," + String(envData.bmp280_available ? "Oui" : "Non") + "\r\n";
-  csv += "Environnement,Température (BMP280)," + (envData.temperature_bmp280 != -999.0 ? String(envData.temperature_bmp280, 1) : "N/A") + "\r\n";
-  csv += "Environnement,Pression," + (envData.pressure != -999.0 ? String(envData.pressure, 1) : "N/A") + "\r\n";
-  csv += "Environnement,Altitude," + (envData.altitude != -999.0 ? String(envData.altitude, 1) : "N/A") + "\r\n";
-  csv += "Environnement,Statut BMP280," + envData.bmp280_status + "\r\n";
-  csv += "Environnement,Température moyenne," + (envData.temperature_avg != -999.0 ? String(envData.temperature_avg, 1) : "N/A") + "\r\n";
-  csv += "Environnement,Statut global," + envData.combined_status + "\r\n";
-
-  // === GPS ===
-  csv += "GPS,Module disponible," + String(gpsAvailable ? "Oui" : "Non") + "\r\n";
-  csv += "GPS,Statut," + gpsData.status_str + "\r\n";
-  csv += "GPS,Fix," + String(gpsData.hasFix ? "Oui" : "Non") + "\r\n";
-  csv += "GPS,Satellites," + String(gpsData.satellites) + "\r\n";
-  csv += "GPS,Latitude," + (gpsData.hasFix ? String(gpsData.latitude, 6) : "N/A") + "\r\n";
-  csv += "GPS,Longitude," + (gpsData.hasFix ? String(gpsData.longitude, 6) : "N/A") + "\r\n";
-  csv += "GPS,Altitude," + (gpsData.hasFix ? String(gpsData.altitude, 1) : "N/A") + "\r\n";
-  csv += "GPS,Vitesse," + (gpsData.hasFix ? String(gpsData.speed, 2) : "N/A") + "\r\n";
-  csv += "GPS,HDOP," + (gpsData.hasFix ? String(gpsData.hdop, 2) : "N/A") + "\r\n";
-  csv += "GPS,Date/Heure,";
-  if (gpsData.hasTime && gpsData.hasDate) {
-    csv += String(gpsData.day) + "/" + String(gpsData.month) + "/" + String(gpsData.year) + " ";
-    if (gpsData.hour < 10) csv += "0";
-    csv += String(gpsData.hour) + ":";
-    if (gpsData.minute < 10) csv += "0";
-    csv += String(gpsData.minute) + ":";
-    if (gpsData.second < 10) csv += "0";
-    csv += String(gpsData.second);
-  } else {
-    csv += "N/A";
-  }
-  csv += "\r\n";
+  json.beginObject();
+  DataReportRenderer renderer(json);
+  writeDiagnosticReport(renderer);
+  json.endObject();
+}
 
-  csv += "System," + String(Texts::uptime) + " ms," + String(diagnosticData.uptime) + "\r\n";
-  csv += "System," + String(Texts::last_reset) + "," + getResetReason() + "\r\n";
+void handleExportCSV() {
+  collectDiagnosticInfo();
+  collectDetailedMemory();
 
   server.sendHeader("Content-Disposition", "attachment; filename=esp32_diagnostic_v" + String(PROJECT_VERSION) + ".csv");
-  server.send(200, "text/csv; charset=utf-8", csv);
+  TextResponse response(200, "text/csv; charset=utf-8");
+  ReportSink& out = response.sink();
+  out.write('"');
+  out.write(Texts::category);
+  out.write("\",\"");
+  out.write(Texts::parameter);
+  out.write("\",\"");
+  out.write(Texts::value);
+  out.write("\"\r\n");
+
+  CsvReportRenderer renderer(out);
+  writeDiagnosticReport(renderer);
 }
 
 void handlePrintVersion() {
   collectDiagnosticInfo();
   collectDetailedMemory();
-  
-  // [OPT-007]: Buffer-based HTML title (1 vs 4 allocations)
-  char titleBuf[256];
-  snprintf(titleBuf, sizeof(titleBuf), "<!DOCTYPE html><html><head><meta charset='UTF-8'><title>%s %s%s</title>",
-           Texts::title.str().c_str(), Texts::version.str().c_str(), PROJECT_VERSION);
-  String html = String(titleBuf);
-  html += "<style>";
-  html += "@page{size:A4;margin:10mm}";
-  html += "body{font:11px Arial;margin:10px;color:#333}";
-  html += "h1{font-size:18px;margin:0 0 5px;border-bottom:3px solid #667eea;color:#667eea;padding-bottom:5px}";
-  html += "h2{font-size:14px;margin:15px 0 8px;color:#667eea;border-bottom:1px solid #ddd;padding-bottom:3px}";
-  html += ".section{margin-bottom:20px}";
-  html += ".grid{display:grid;grid-template-columns:1fr 1fr;gap:10px;margin:10px 0}";
-  html += ".row{display:flex;margin:3px 0;padding:5px;background:#f8f9fa;border-radius:3px}";
-  html += ".row b{min-width:150px;color:#667eea}";
-  html += ".badge{display:inline-block;padding:2px 8px;border-radius:10px;font-size:10px;font-weight:bold}";
-  html += ".badge-success{background:#d4edda;color:#155724}";
-  html += ".badge-warning{background:#fff3cd;color:#856404}";
-  html += ".badge-danger{background:#f8d7da;color:#721c24}";
-  html += "table{width:100%;border-collapse:collapse;margin:10px 0;font-size:10px}";
-  html += "th{background:#667eea;color:#fff;padding:5px;text-align:left}";
-  html += "td{border:1px solid #ddd;padding:4px}";
-  html += ".footer{margin-top:20px;padding-top:10px;border-top:1px solid #ddd;font-size:9px;color:#666;text-align:center}";
-  html += "</style></head>";
-  html += "<body onload='window.print()'>";
-  
-  // Header traduit
-  html += "<h1>" + String(Texts::title) + " " + String(Texts::version) + String(PROJECT_VERSION) + "</h1>";
-  html += "<div style='margin:10px 0;font-size:12px;color:#666'>";
-  html += String(Texts::export_generated) + " " + String(millis()/1000) + "s " + String(Texts::export_after_boot) + " | IP: " + diagnosticData.ipAddress;
-  html += "</div>";
-  
-  // Chip
-  html += "<div class='section'>";
-  html += "<h2>" + String(Texts::chip_info) + "</h2>";
-  html += "<div class='grid'>";
-  html += "<div class='row'><b>" + String(Texts::full_model) + ":</b><span>" + diagnosticData.chipModel + " Rev" + diagnosticData.chipRevision + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::cpu_cores) + ":</b><span>" + String(diagnosticData.cpuCores) + " " + String(Texts::cores) + " @ " + String(diagnosticData.cpuFreqMHz) + " MHz</span></div>";
-  html += "<div class='row'><b>" + String(Texts::mac_wifi) + ":</b><span>" + diagnosticData.macAddress + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::sdk_version) + ":</b><span>" + diagnosticData.sdkVersion + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::idf_version) + ":</b><span>" + diagnosticData.idfVersion + "</span></div>";
-  if (diagnosticData.temperature != -999) {
-    html += "<div class='row'><b>" + String(Texts::cpu_temp) + ":</b><span>" + String(diagnosticData.temperature, 1) + " °C</span></div>";
-  }
-
-  unsigned long seconds = diagnosticData.uptime / 1000;
-  unsigned long minutes = seconds / 60;
-  unsigned long hours = minutes / 60;
-  unsigned long days = hours / 24;
-  html += "<div class='row'><b>" + String(Texts::uptime) + ":</b><span>" + formatUptime(days, hours % 24, minutes % 60) + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::last_reset) + ":</b><span>" + getResetReason() + "</span></div>";
-  html += "</div></div>";
-
-
-  // Mémoire
-  html += "<div class='section'>";
-  html += "<h2>" + String(Texts::memory_details) + "</h2>";
-  html += "<table>";
-  html += "<tr><th>" + String(Texts::category) + "</th><th>" + String(Texts::total_size) + "</th><th>" + String(Texts::free) + "</th><th>" + String(Texts::used) + "</th><th>" + String(Texts::status) + "</th></tr>";
-  // ...existing code for memory table...
-  bool flashMatch = (detailedMemory.flashSizeReal == detailedMemory.flashSizeChip);
-  html += "<tr><td><b>" + String(Texts::flash_memory) + "</b></td>";
-  html += "<td>" + String(detailedMemory.flashSizeReal / 1048576.0, 1) + " MB</td>";
-  html += "<td>-</td><td>-</td>";
-  html += "<td><span class='badge " + String(flashMatch ? "badge-success'>" + String(Texts::ok) : "badge-warning'>" + String(Texts::ide_config)) + "</span></td></tr>";
-  // ...existing code for PSRAM and SRAM...
-  if (detailedMemory.psramAvailable) {
-    html += "<tr><td><b>" + String(Texts::psram_external) + "</b></td>";
-    html += "<td>" + String(detailedMemory.psramTotal / 1048576.0, 1) + " MB</td>";
-    html += "<td>" + String(detailedMemory.psramFree / 1048576.0, 1) + " MB</td>";
-    html += "<td>" + String(detailedMemory.psramUsed / 1048576.0, 1) + " MB</td>";
-    html += "<td><span class='badge badge-success'>" + String(Texts::detected_active) + "</span></td></tr>";
-  } else if (detailedMemory.psramBoardSupported) {
-    html += "<tr><td><b>" + String(Texts::psram_external) + "</b></td>";
-    html += "<td>" + String(detailedMemory.psramTotal / 1048576.0, 1) + " MB</td>";
-    html += "<td>-</td><td>-</td>";
-    String psramHint = String(Texts::enable_psram_hint);
-    psramHint.replace("%TYPE%", detailedMemory.psramType ? detailedMemory.psramType : "PSRAM");
-    html += "<td><span class='badge badge-warning'>" + String(Texts::supported_not_enabled) + "</span><br><small>" + psramHint + "</small></td></tr>";
-  } else {
-    html += "<tr><td><b>" + String(Texts::psram_external) + "</b></td>";
-    html += "<td>" + String(detailedMemory.psramTotal / 1048576.0, 1) + " MB</td>";
-    html += "<td>-</td><td>-</td>";
-    html += "<td><span class='badge badge-danger'>" + String(Texts::not_detected) + "</span></td></tr>";
-  }
-  html += "<tr><td><b>" + String(Texts::internal_sram) + "</b></td>";
-  html += "<td>" + String(detailedMemory.sramTotal / 1024.0, 1) + " KB</td>";
-  html += "<td>" + String(detailedMemory.sramFree / 1024.0, 1) + " KB</td>";
-  html += "<td>" + String(detailedMemory.sramUsed / 1024.0, 1) + " KB</td>";
-  html += "<td><span class='badge badge-success'>" + detailedMemory.memoryStatus + "</span></td></tr>";
-  html += "</table>";
-  html += "<div class='row'><b>" + String(Texts::memory_fragmentation) + ":</b><span>" + String(detailedMemory.fragmentationPercent, 1) + "% - " + detailedMemory.memoryStatus + "</span></div>";
-  html += "</div>";
-
-  // === ENVIRONNEMENT ===
-  html += "<div class='section'>";
-  html += "<h2>Environnement</h2>";
-  html += "<table>";
-  html += "<tr><th>Capteur</th><th>Paramètre</th><th>Valeur</th></tr>";
-  html += "<tr><td>AHT20</td><td>Disponible</td><td>" + String(envData.aht20_available ? "Oui" : "Non") + "</td></tr>";
-  html += "<tr><td>AHT20</td><td>Température</td><td>" + (envData.temperature_aht20 != -999.0 ? String(envData.temperature_aht20, 1) + " °C" : "N/A") + "</td></tr>";
-  html += "<tr><td>AHT20</td><td>Humidité</td><td>" + (envData.humidity != -999.0 ? String(envData.humidity, 1) + " %" : "N/A") + "</td></tr>";
-  html += "<tr><td>AHT20</td><td>Statut</td><td>" + envData.aht20_status + "</td></tr>";
-  html += "<tr><td>BMP280</td><td>Disponible</td><td>" + String(envData.bmp280_available ? "Oui" : "Non") + "</td></tr>";
-  html += "<tr><td>BMP280</td><td>Température</td><td>" + (envData.temperature_bmp280 != -999.0 ? String(envData.temperature_bmp280, 1) + " °C" : "N/A") + "</td></tr>";
-  html += "<tr><td>BMP280</td><td>Pression</td><td>" + (envData.pressure != -999.0 ? String(envData.pressure, 1) + " hPa" : "N/A") + "</td></tr>";
-  html += "<tr><td>BMP280</td><td>Altitude</td><td>" + (envData.altitude != -999.0 ? String(envData.altitude, 1) + " m" : "N/A") + "</td></tr>";
-  html += "<tr><td>BMP280</td><td>Statut</td><td>" + envData.bmp280_status + "</td></tr>";
-  html += "<tr><td colspan='2'>Température moyenne</td><td>" + (envData.temperature_avg != -999.0 ? String(envData.temperature_avg, 1) + " °C" : "N/A") + "</td></tr>";
-  html += "<tr><td colspan='2'>Statut global</td><td>" + envData.combined_status + "</td></tr>";
-  html += "</table></div>";
-
-  // === GPS ===
-  html += "<div class='section'>";
-  html += "<h2>GPS</h2>";
-  html += "<table>";
-  html += "<tr><th>Paramètre</th><th>Valeur</th></tr>";
-  html += "<tr><td>Module disponible</td><td>" + String(gpsAvailable ? "Oui" : "Non") + "</td></tr>";
-  html += "<tr><td>Statut</td><td>" + gpsData.status_str + "</td></tr>";
-  html += "<tr><td>Fix</td><td>" + String(gpsData.hasFix ? "Oui" : "Non") + "</td></tr>";
-  html += "<tr><td>Satellites</td><td>" + String(gpsData.satellites) + "</td></tr>";
-  html += "<tr><td>Latitude</td><td>" + (gpsData.hasFix ? String(gpsData.latitude, 6) : "N/A") + "</td></tr>";
-  html += "<tr><td>Longitude</td><td>" + (gpsData.hasFix ? String(gpsData.longitude, 6) : "N/A") + "</td></tr>";
-  html += "<tr><td>Altitude</td><td>" + (gpsData.hasFix ? String(gpsData.altitude, 1) + " m" : "N/A") + "</td></tr>";
-  html += "<tr><td>Vitesse</td><td>" + (gpsData.hasFix ? String(gpsData.speed, 2) + " noeuds" : "N/A") + "</td></tr>";
-  html += "<tr><td>HDOP</td><td>" + (gpsData.hasFix ? String(gpsData.hdop, 2) : "N/A") + "</td></tr>";
-  html += "<tr><td>Date/Heure</td><td>";
-  if (gpsData.hasTime && gpsData.hasDate) {
-    html += String(gpsData.day) + "/" + String(gpsData.month) + "/" + String(gpsData.year) + " ";
-    if (gpsData.hour < 10) html += "0";
-    html += String(gpsData.hour) + ":";
-    if (gpsData.minute < 10) html += "0";
-    html += String(gpsData.minute) + ":";
-    if (gpsData.second < 10) html += "0";
-    html += String(gpsData.second);
-  } else {
-    html += "N/A";
-  }
-  html += "</td></tr>";
-  html += "</table></div>";
 
-  // WiFi
-  html += "<div class='section'>";
-  html += "<h2>" + String(Texts::wifi_connection) + "</h2>";
-  html += "<div class='grid'>";
-  html += "<div class='row'><b>" + String(Texts::connected_ssid) + ":</b><span>" + diagnosticData.wifiSSID + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::signal_power) + ":</b><span>" + String(diagnosticData.wifiRSSI) + " dBm</span></div>";
-  html += "<div class='row'><b>" + String(Texts::signal_quality) + ":</b><span>" + getWiFiSignalQuality() + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::ip_address) + ":</b><span>" + diagnosticData.ipAddress + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::subnet_mask) + ":</b><span>" + WiFi.subnetMask().toString() + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::dns) + ":</b><span>" + WiFi.dnsIP().toString() + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::gateway) + ":</b><span>" + WiFi.gatewayIP().toString() + "</span></div>";
-  html += "</div></div>";
-
-  // GPIO et Périphériques
-  html += "<div class='section'>";
-  html += "<h2>" + String(Texts::gpio_interfaces) + "</h2>";
-  html += "<div class='grid'>";
-  html += "<div class='row'><b>" + String(Texts::total_gpio) + ":</b><span>" + String(diagnosticData.totalGPIO) + " " + String(Texts::pins) + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::i2c_peripherals) + ":</b><span>" + String(diagnosticData.i2cCount) + " " + String(Texts::devices) + " - " + diagnosticData.i2cDevices + "</span></div>";
-  html += "<div class='row'><b>" + String(Texts::spi_bus) + ":</b><span>" + spiInfo + "</span></div>";
-  html += "</div></div>";
-
-  // Tests Matériels
-  html += "<div class='section'>";
-  html += "<h2>" + String(Texts::nav_tests) + "</h2>";
-  html += "<table>";
-  html += "<tr><th>" + String(Texts::parameter) + "</th><th>" + String(Texts::status) + "</th></tr>";
-  html += "<tr><td>" + String(Texts::builtin_led) + "</td><td>" + builtinLedTestResult + "</td></tr>";
-  html += "<tr><td>" + String(Texts::neopixel) + "</td><td>" + neopixelTestResult + "</td></tr>";
-  html += "<tr><td>" + String(Texts::oled_screen) + "</td><td>" + oledTestResult + "</td></tr>";
-  html += "<tr><td>" + String(Texts::adc_test) + "</td><td>" + adcTestResult + "</td></tr>";
-  html += "<tr><td>" + String(Texts::pwm_test) + "</td><td>" + pwmTestResult + "</td></tr>";
-  html += "</table></div>";
-
-  // Performance
-  if (diagnosticData.cpuBenchmark > 0) {
-    html += "<div class='section'>";
-    html += "<h2>" + String(Texts::performance_bench) + "</h2>";
-    html += "<div class='grid'>";
-    html += "<div class='row'><b>" + String(Texts::cpu_benchmark) + ":</b><span>" + String(diagnosticData.cpuBenchmark) + " µs (" + String(100000.0 / diagnosticData.cpuBenchmark, 2) + " MFLOPS)</span></div>";
-    html += "<div class='row'><b>" + String(Texts::memory_benchmark) + ":</b><span>" + String(diagnosticData.memBenchmark) + " µs</span></div>";
-    html += "<div class='row'><b>" + String(Texts::memory_stress) + ":</b><span>" + stressTestResult + "</span></div>";
-    html += "</div></div>";
-  }
-  
-  // Footer
-  html += "<div class='footer'>";
-  html += String(PROJECT_NAME) + " v"+ String(PROJECT_VERSION) + " | " + diagnosticData.chipModel + " | MAC: " + diagnosticData.macAddress;
-  html += "</div>";
-  
-  html += "</body></html>";
-  
-  server.send(200, "text/html; charset=utf-8", html);
+  TextResponse response(200, "text/html; charset=utf-8");
+  ReportSink& out = response.sink();
+  out.write("<!DOCTYPE html><html><head><meta charset='UTF-8'><title>");
+  out.write(Texts::title);
+  out.write(' ');
+  out.write(Texts::version);
+  out.write(PROJECT_VERSION "</title><style>"
+            "@page{size:A4;margin:10mm}"
+            "body{font:11px Arial;margin:10px;color:#333}"
+            "h1{font-size:18px;margin:0 0 5px;border-bottom:3px solid #667eea;color:#667eea;padding-bottom:5px}"
+            "h2{font-size:14px;margin:15px 0 8px;color:#667eea;border-bottom:1px solid #ddd;padding-bottom:3px}"
+            ".section{margin-bottom:20px;break-inside:avoid}"
+            "table{width:100%;border-collapse:collapse;margin:10px 0;font-size:10px}"
+            "td{border:1px solid #ddd;padding:4px}"
+            "td b{color:#667eea}"
+            ".footer{margin-top:20px;padding-top:10px;border-top:1px solid #ddd;font-size:9px;color:#666;text-align:center}"
+            "</style></head><body onload='window.print()'><h1>");
+  out.write(Texts::title);
+  out.write(' ');
+  out.write(Texts::version);
+  out.write(PROJECT_VERSION "</h1><div style='margin:10px 0;font-size:12px;color:#666'>");
+  char generated[24];
+  snprintf(generated, sizeof(generated), " %lus ", static_cast<unsigned long>(millis() / 1000));
+  out.write(Texts::export_generated);
+  out.write(generated);
+  out.write(Texts::export_after_boot);
+  out.write(" | IP: ");
+  out.write(diagnosticData.ipAddress);
+  out.write("</div>");
+
+  HtmlReportRenderer renderer(out);
+  writeDiagnosticReport(renderer);
+
+  out.write("<div class='footer'>" PROJECT_NAME " v" PROJECT_VERSION " | ");
+  out.write(diagnosticData.chipModel);
+  out.write(" | MAC: ");
+  out.write(diagnosticData.macAddress);
+  out.write("</div></body></html>");
 }
 
 String htmlEscape(const String& raw) {
@@ -5598,72 +8129,74 @@ String jsonEscape(const char* raw) {
   return escaped;
 }
 
-static inline void appendJsonField(String& json, bool& first, const JsonFieldSpec& field) {
-  if (!first) {
-    json += ',';
-  }
-  first = false;
-  json += '"';
-  json += field.key;
-  json += '"';
-  json += ':';
-  if (field.raw) {
-    json += field.value;
-  } else {
-    json += '"';
-    json += jsonEscape(field.value.c_str());
-    json += '"';
+static inline void writeJsonField(ApiResponse& json, const JsonFieldSpec& field) {
+  switch (field.kind) {
+    case JsonFieldSpec::TEXT:
+      json.field(field.key, field.text);
+      break;
+    case JsonFieldSpec::FLASH_TEXT:
+      json.field(field.key, field.flashText);
+      break;
+    case JsonFieldSpec::BOOL:
+      json.field(field.key, field.boolean);
+      break;
+    case JsonFieldSpec::SIGNED:
+      json.field(field.key, field.signedValue);
+      break;
+    case JsonFieldSpec::UNSIGNED:
+      json.field(field.key, field.unsignedValue);
+      break;
+    case JsonFieldSpec::FLOAT:
+      json.fieldFloat(field.key, field.floatValue, field.decimals);
+      break;
   }
 }
 
-String buildJsonObject(std::initializer_list<JsonFieldSpec> fields) {
-  String json;
-  json.reserve(fields.size() * 50 + 10);  // Estimate size based on field count
-  json = "{";
-  bool first = true;
+inline void sendJsonResponse(int statusCode, std::initializer_list<JsonFieldSpec> fields) {
+  ApiResponse json(statusCode);
+  json.beginObject();
   for (const auto& field : fields) {
-    appendJsonField(json, first, field);
+    writeJsonField(json, field);
   }
-  json += '}';
-  return json;
-}
-
-inline void sendJsonResponse(int statusCode, std::initializer_list<JsonFieldSpec> fields) {
-  server.send(statusCode, "application/json", buildJsonObject(fields));
+  json.endObject();
 }
 
-static String buildActionResponseJson(bool success,
-                                      const String& message,
-                                      std::initializer_list<JsonFieldSpec> extraFields) {
-  String json;
-  json.reserve(extraFields.size() * 50 + message.length() + 50);  // Estimate size
-  json = "{";
-  bool first = true;
-  appendJsonField(json, first, jsonBoolField("success", success));
-  if (message.length() > 0) {
-    appendJsonField(json, first, jsonStringField("message", message));
+inline void sendActionFields(int statusCode,
+                             bool success,
+                             const JsonFieldSpec& message,
+                             std::initializer_list<JsonFieldSpec> extraFields) {
+  ApiResponse json(statusCode);
+  json.beginObject();
+  json.field("success", success);
+  const bool hasMessage = message.kind == JsonFieldSpec::FLASH_TEXT
+                              ? pgm_read_byte(reinterpret_cast<PGM_P>(message.flashText)) != 0
+                              : message.text[0] != '\0';
+  if (hasMessage) {
+    writeJsonField(json, message);
   }
   for (const auto& field : extraFields) {
-    appendJsonField(json, first, field);
+    writeJsonField(json, field);
   }
-  json += '}';
-  return json;
+  json.endObject();
 }
 
+template <typename Message>
 inline void sendActionResponse(int statusCode,
                                bool success,
-                               const String& message,
+                               const Message& message,
                                std::initializer_list<JsonFieldSpec> extraFields) {
-  server.send(statusCode, "application/json", buildActionResponseJson(success, message, extraFields));
+  sendActionFields(statusCode, success, jsonStringField("message", message), extraFields);
 }
 
-inline void sendOperationSuccess(const String& message,
+template <typename Message>
+inline void sendOperationSuccess(const Message& message,
                                  std::initializer_list<JsonFieldSpec> extraFields) {
   sendActionResponse(200, true, message, extraFields);
 }
 
+template <typename Message>
 inline void sendOperationError(int statusCode,
-                               const String& message,
+                               const Message& message,
                                std::initializer_list<JsonFieldSpec> extraFields) {
   sendActionResponse(statusCode, false, message, extraFields);
 }
@@ -5698,12 +8231,29 @@ static inline void appendInfoItem(String& chunk,
   chunk += F("</div></div>");
 }
 
-// Dynamic bilingual string export for the web interface
-String buildTranslationsJSON(Language lang) {
-  String json;
-  json.reserve(20000);
-  json += '{';
-  bool first = true;
+// ========== HTTP CACHE HELPERS ==========
+static bool clientAcceptsGzip() {
+  return server.header("Accept-Encoding").indexOf("gzip") >= 0;
+}
+
+static bool requestMatchesETag(const char* etag) {
+  return server.hasHeader("If-None-Match") && server.header("If-None-Match").indexOf(etag) >= 0;
+}
+
+// ========== TRANSLATION BLOBS ==========
+// [OPT-013]: Le JSON des traductions est constant pour un firmware donné :
+// il est sérialisé une seule fois par langue (PSRAM si disponible) puis servi
+// tel quel, avec un hash de version pour le cache navigateur.
+struct TranslationBlob {
+  char* data;
+  size_t length;
+  char version[9];  // FNV-1a 32 bits en hexadécimal
+};
+
+static TranslationBlob translationBlobs[2] = {};
+
+static void writeTranslationsJSON(DataWriter& json, Language lang) {
+  json.beginObject();
   size_t count = 0;
   const Texts::ResourceEntry* const entries = Texts::getResourceEntries(count);
   for (size_t i = 0; i < count; ++i) {
@@ -5711,23 +8261,64 @@ String buildTranslationsJSON(Language lang) {
     if (entry.field == nullptr) {
       continue;
     }
-    if (!first) {
-      json += ',';
-    }
-    first = false;
-    json += '"';
-    json += entry.key;
-    json += F("\":\"");
     const __FlashStringHelper* raw = entry.field->get(lang);
-    String fieldValue;
     if (raw != nullptr) {
-      fieldValue = String(raw);
+      json.field(entry.key, raw);
+    } else {
+      json.field(entry.key, "");
     }
-    json += jsonEscape(fieldValue.c_str());
-    json += '"';
   }
-  json += '}';
-  return json;
+  json.endObject();
+}
+
+static void countTranslationBytes(const char* data, size_t length, void* context) {
+  (void)data;
+  *static_cast<size_t*>(context) += length;
+}
+
+// Construit le blob à la première demande ; data reste nullptr si l'allocation échoue
+const TranslationBlob& getTranslationBlob(Language lang) {
+  TranslationBlob& blob = translationBlobs[lang == LANG_FR ? 1 : 0];
+  if (blob.data != nullptr) {
+    return blob;
+  }
+
+  // Passe 1 : taille exacte sans rien conserver
+  size_t total = 0;
+  char scratch[128];
+  JsonWriter counter(scratch, sizeof(scratch), countTranslationBytes, &total);
+  writeTranslationsJSON(counter, lang);
+  counter.flush();
+
+  char* data = nullptr;
+  if (ESP.getPsramSize() > 0) {
+    data = static_cast<char*>(heap_caps_malloc(total + 1, MALLOC_CAP_SPIRAM));
+  }
+  if (data == nullptr) {
+    data = static_cast<char*>(malloc(total + 1));
+  }
+  if (data == nullptr) {
+    Serial.printf("[I18N] Allocation du blob de traductions impossible (%u octets)\r\n", static_cast<unsigned>(total));
+    return blob;
+  }
+
+  // Passe 2 : écriture directe dans le tampon final (aucun flush nécessaire)
+  JsonWriter writer(data, total, nullptr, nullptr);
+  writeTranslationsJSON(writer, lang);
+  data[total] = '\0';
+
+  blob.data = data;
+  blob.length = total;
+  snprintf(blob.version, sizeof(blob.version), "%08lx", static_cast<unsigned long>(fnv1aHash(data, total)));
+  Serial.printf("[I18N] Traductions %s : %u octets, version %s\r\n",
+                lang == LANG_FR ? "fr" : "en", static_cast<unsigned>(total), blob.version);
+  return blob;
+}
+
+// Dynamic bilingual string export for the web interface (debug route only)
+String buildTranslationsJSON(Language lang) {
+  const TranslationBlob& blob = getTranslationBlob(lang);
+  return blob.data != nullptr ? String(blob.data) : String("{}");
 }
 
 String buildTranslationsJSON() {
@@ -5743,7 +8334,7 @@ void handleSetLanguage() {
   if (!server.hasArg("lang")) {
     sendJsonResponse(400, {
       jsonBoolField("success", false),
-      jsonStringField("error", String(Texts::language_switch_error))
+      jsonStringField("error", Texts::language_switch_error)
     });
     return;
   }
@@ -5758,7 +8349,7 @@ void handleSetLanguage() {
   } else {
     sendJsonResponse(400, {
       jsonBoolField("success", false),
-      jsonStringField("error", String(Texts::language_switch_error))
+      jsonStringField("error", Texts::language_switch_error)
     });
     return;
   }
@@ -5784,13 +8375,29 @@ void handleGetTranslations() {
     } else {
       sendJsonResponse(400, {
         jsonBoolField("success", false),
-        jsonStringField("error", String(Texts::language_switch_error))
+        jsonStringField("error", Texts::language_switch_error)
       });
       return;
     }
   }
 
-  server.send(200, "application/json; charset=utf-8", buildTranslationsJSON(target));
+  const TranslationBlob& blob = getTranslationBlob(target);
+  if (blob.data == nullptr) {
+    ApiResponse json(200, "application/json; charset=utf-8");
+    writeTranslationsJSON(json, target);
+    return;
+  }
+
+  char etag[16];
+  snprintf(etag, sizeof(etag), "\"%s\"", blob.version);
+  bool versioned = server.hasArg("v") && server.arg("v") == blob.version;
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", versioned ? "public, max-age=31536000, immutable" : "no-cache");
+  if (requestMatchesETag(etag)) {
+    server.send(304);
+    return;
+  }
+  server.send_P(200, "application/json; charset=utf-8", blob.data, blob.length);
 }
 
 // Log client connection with IP address
@@ -5803,18 +8410,90 @@ void logClientConnection(const char* endpoint) {
 
 // ========== INTERFACE WEB PRINCIPALE MULTILINGUE ==========
 // Unique JavaScript handler defined in sketch (handleJavaScriptRoute)
-void handleJavaScriptRoute() {
-  logClientConnection("JS Resource");
-  unsigned long startTime = millis();
+// ========== STATIC ASSETS ==========
+// [OPT-012]: CSS, JS et page d'accueil statiques servis depuis les blobs gzip
+// générés par tools/minify_web.py (web_assets_gz.h), avec ETag fort et réponse
+// 304, y compris pour la version non compressée.
+struct StaticAsset {
+  const char* contentType;
+  const uint8_t* gzipData;
+  size_t gzipLength;
+  const char* etag;
+  const char* plainData;  // PROGMEM, pour les clients sans gzip
+  const char* plainEtag;  // ETag distinct de la représentation non compressée
+  const char* hash;       // hash du contenu, seule valeur ?v= mise en cache permanent
+};
 
-  // Use chunked transfer to avoid memory issues
-  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-  server.send(200, "application/javascript; charset=utf-8", "");
+// Le squelette HTML embarque la version : régénérer après un changement de version
+static constexpr bool sameText(const char* a, const char* b) {
+  while (*a != '\0' && *a == *b) {
+    ++a;
+    ++b;
+  }
+  return *a == *b;
+}
+static_assert(sameText(WEB_ASSET_SHELL_VERSION, PROJECT_VERSION),
+              "web_assets_gz.h is stale: run python tools/minify_web.py --gzip-only");
 
-  // ===== LOGS DE DÉBOGAGE =====
-  Serial.println("\n========== JAVASCRIPT DEBUG (CHUNKED) ==========");
-  Serial.printf("Free heap at start: %d bytes\n", ESP.getFreeHeap());
+static const StaticAsset APP_CSS_ASSET = {
+  "text/css; charset=utf-8",
+  WEB_ASSET_APP_CSS_GZ, WEB_ASSET_APP_CSS_GZ_LEN, WEB_ASSET_APP_CSS_ETAG,
+  DIAGNOSTIC_CSS_STATIC, WEB_ASSET_APP_CSS_PLAIN_ETAG,
+  WEB_ASSET_APP_CSS_HASH
+};
+
+static const StaticAsset APP_JS_ASSET = {
+  "application/javascript; charset=utf-8",
+  WEB_ASSET_APP_JS_GZ, WEB_ASSET_APP_JS_GZ_LEN, WEB_ASSET_APP_JS_ETAG,
+  DIAGNOSTIC_JS_STATIC, WEB_ASSET_APP_JS_PLAIN_ETAG,
+  WEB_ASSET_APP_JS_HASH
+};
+
+static const StaticAsset APP_HTML_EN_ASSET = {
+  "text/html; charset=utf-8",
+  WEB_ASSET_APP_HTML_EN_GZ, WEB_ASSET_APP_HTML_EN_GZ_LEN, WEB_ASSET_APP_HTML_EN_ETAG,
+  WEB_ASSET_APP_HTML_EN_PLAIN, WEB_ASSET_APP_HTML_EN_PLAIN_ETAG,
+  WEB_ASSET_APP_HTML_EN_HASH
+};
 
+static const StaticAsset APP_HTML_FR_ASSET = {
+  "text/html; charset=utf-8",
+  WEB_ASSET_APP_HTML_FR_GZ, WEB_ASSET_APP_HTML_FR_GZ_LEN, WEB_ASSET_APP_HTML_FR_ETAG,
+  WEB_ASSET_APP_HTML_FR_PLAIN, WEB_ASSET_APP_HTML_FR_PLAIN_ETAG,
+  WEB_ASSET_APP_HTML_FR_HASH
+};
+
+void serveStaticAsset(const StaticAsset& asset) {
+  // URL versionnée par le hash courant : cache permanent ; tout autre ?v= (ancien
+  // hash, valeur arbitraire) ou absence de ?v= : revalidation par ETag
+  const bool versioned = server.hasArg("v") && server.arg("v") == asset.hash;
+  server.sendHeader("Cache-Control", versioned ? "public, max-age=31536000, immutable" : "no-cache");
+  server.sendHeader("Vary", "Accept-Encoding");
+  const bool gzip = clientAcceptsGzip();
+  const char* etag = gzip ? asset.etag : asset.plainEtag;
+  server.sendHeader("ETag", etag);
+  if (requestMatchesETag(etag)) {
+    server.send(304);
+    return;
+  }
+  if (!gzip) {
+    server.send_P(200, asset.contentType, asset.plainData);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, asset.contentType, reinterpret_cast<PGM_P>(asset.gzipData), asset.gzipLength);
+}
+
+void handleStylesheet() {
+  serveStaticAsset(APP_CSS_ASSET);
+}
+
+void handleStaticJavaScript() {
+  serveStaticAsset(APP_JS_ASSET);
+}
+
+// Préambule dynamique : langue, broches runtime et traductions
+static void sendJavaScriptPreamble() {
   // Send preamble
   String preamble = "console.log('";
   preamble += String(PROJECT_NAME) + " v";
@@ -5883,13 +8562,74 @@ void handleJavaScriptRoute() {
   Serial.printf("  TFT_MISO=%d\n", TFT_MISO);
   server.sendContent(pinVars);
 
-  // Send translations
-  String translations = "const DEFAULT_TRANSLATIONS=";
-  translations += buildTranslationsJSON();
-  translations += ";let translationsCache=DEFAULT_TRANSLATIONS;";
+  // Send translations straight from the cached blob (no per-request rebuild)
+  const TranslationBlob& enBlob = getTranslationBlob(LANG_EN);
+  const TranslationBlob& frBlob = getTranslationBlob(LANG_FR);
+  const TranslationBlob& blob = (currentLanguage == LANG_FR) ? frBlob : enBlob;
+  char versions[64];
+  snprintf(versions, sizeof(versions), "const TRANSLATIONS_VERSION={\"en\":\"%s\",\"fr\":\"%s\"};",
+           enBlob.version, frBlob.version);
+  server.sendContent(versions);
+  server.sendContent("const DEFAULT_TRANSLATIONS=");
+  if (blob.data != nullptr) {
+    server.sendContent(blob.data, blob.length);
+  } else {
+    server.sendContent("{}");
+  }
+  server.sendContent(";let translationsCache=DEFAULT_TRANSLATIONS;");
+
+  Serial.printf("Sending translations: %u bytes\n", static_cast<unsigned>(blob.length));
+}
+
+// Complète le squelette HTML statique (modèle de puce, IP, hôte mDNS) avant
+// l'exécution de /js/static.js
+static void sendShellFill() {
+  String chipModel;
+  String ipAddress;
+  {
+    TelemetryReader telemetry;
+    chipModel = telemetry.diag().chipModel;
+    ipAddress = telemetry.diag().ipAddress;
+  }
+  String fill = F("(function(){const s=(id,h,l)=>{const a=document.getElementById(id);if(!a||!h)return;"
+                  "const u=a.getAttribute('data-legacy')+h;a.href=u;a.setAttribute('data-access-host',h);"
+                  "a.setAttribute('data-access-label',h);a.setAttribute('data-legacy-label',u);"
+                  "a.setAttribute('aria-disabled','false');a.classList.remove('disabled');"
+                  "const t=document.getElementById(l);if(t)t.textContent=u;};s('mdnsLink',\"");
+  fill += jsonEscape(MDNS_HOSTNAME_STR);
+  fill += F(".local\",'mdnsAddressText');s('ipAddressLink',\"");
+  fill += jsonEscape(ipAddress.c_str());
+  fill += F("\",'ipAddressText');const c=document.getElementById('chipModel');if(c)c.textContent=\"");
+  fill += jsonEscape(chipModel.c_str());
+  fill += F("\";})();");
+  server.sendContent(fill);
+}
+
+// Préambule seul, chargé par le squelette HTML avec /js/static.js (mis en cache)
+void handleJavaScriptBoot() {
+  logClientConnection("JS Boot");
+  server.sendHeader("Cache-Control", "no-cache");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/javascript; charset=utf-8", "");
+  sendJavaScriptPreamble();
+  sendShellFill();
+  server.sendContent("");
+}
+
+// Script complet (préambule + code statique) conservé pour compatibilité
+void handleJavaScriptRoute() {
+  logClientConnection("JS Resource");
+  unsigned long startTime = millis();
+
+  // Use chunked transfer to avoid memory issues
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/javascript; charset=utf-8", "");
+
+  // ===== LOGS DE DÉBOGAGE =====
+  Serial.println("\n========== JAVASCRIPT DEBUG (CHUNKED) ==========");
+  Serial.printf("Free heap at start: %d bytes\n", ESP.getFreeHeap());
 
-  Serial.printf("Sending translations: %d bytes\n", translations.length());
-  server.sendContent(translations);
+  sendJavaScriptPreamble();
 
   // Send main JavaScript from PROGMEM without allocating a giant String
   // Stream in chunks to avoid heap exhaustion on ESP32 classic
@@ -5932,7 +8672,8 @@ void handleJavaScriptRoute() {
 // Modern web interface with dynamic tabs
 void handleRoot() {
   logClientConnection("Web Interface");
-  server.send(200, "text/html; charset=utf-8", generateHTML());
+  // Squelette statique par langue ; les valeurs runtime arrivent par /js/boot.js
+  serveStaticAsset(currentLanguage == LANG_FR ? APP_HTML_FR_ASSET : APP_HTML_EN_ASSET);
 }
 
 // ========== DEBUG ROUTES (Troubleshooting) ==========
@@ -5948,12 +8689,13 @@ void setupDebugRoutes() {
 
   // Debug status endpoint
   server.on("/debug/status", []() {
-    String json = "{";
-    json += "\"freeHeap\":" + String(ESP.getFreeHeap()) + ",";
-    json += "\"jsSize\":" + String(generateJavaScript().length()) + ",";
-    json += "\"version\":\"" + String(DIAGNOSTIC_VERSION_STR) + "\"";
-    json += "}";
-    server.send(200, "application/json", json);
+    size_t jsSize = generateJavaScript().length();
+    ApiResponse json(200);
+    json.beginObject();
+    json.field("freeHeap", ESP.getFreeHeap());
+    json.field("jsSize", jsSize);
+    json.field("version", DIAGNOSTIC_VERSION_STR);
+    json.endObject();
   });
 
   Serial.println("[DEBUG] Debug routes installed: /js/test.js, /debug/status");
@@ -6084,6 +8826,63 @@ void setup() {
   
   collectDiagnosticInfo();
   collectDetailedMemory();
+  scanI2C();
+#if ENABLE_STACK_PROFILE
+  stackProfile.load(stackProfileBuildId());
+#endif
+  sdBench.loadSaved();
+  stackProfile.setAllocated(STACK_LOOP, getArduinoLoopTaskStackSize(), false);
+  startTelemetrySampler();
+
+  // Workers répartis sur les deux coeurs : les tests sans ressource commune tournent en parallèle
+  const uint32_t workerStack = jobWorkerStackSize();
+#if CONFIG_FREERTOS_UNICORE
+  const uint8_t jobWorkers =
+      jobScheduler.begin(workerStack, HARDWARE_TEST_TASK_PRIORITY, tskNO_AFFINITY, 1, JOB_STACK_IN_PSRAM);
+#else
+  const uint8_t jobWorkers = jobScheduler.begin(workerStack, HARDWARE_TEST_TASK_PRIORITY, 0, 2, JOB_STACK_IN_PSRAM);
+#endif
+  stackProfile.setAllocated(STACK_WORKER, workerStack, jobScheduler.stacksInPsram());
+  loopCore = static_cast<int8_t>(xPortGetCoreID());
+  for (uint8_t i = 0; i < JOB_WORKER_COUNT; ++i) {
+    coreLoadMonitor.addJobTask(jobScheduler.workerHandle(i));
+  }
+  if (!coreLoadMonitor.begin(xTaskGetCurrentTaskHandle())) {
+    Serial.println("[CORES] Mesure de charge par coeur indisponible");
+  }
+  jobScheduler.setAllowedCores(corePlacement.update(coreLoads, coreLoadMonitor.cores(), jobScheduler.workerCores()));
+  Serial.printf("[CORES] loop sur coeur %d, placement %s, jobs sur coeur %s\r\n", static_cast<int>(loopCore),
+                corePlacementModeName(corePlacement.mode()), coreMaskName(jobScheduler.allowedCores()));
+  Serial.printf("[JOBS] %u/%u workers, pile %lu octets%s\r\n", static_cast<unsigned>(jobWorkers),
+                static_cast<unsigned>(JOB_WORKER_COUNT), static_cast<unsigned long>(workerStack),
+                jobScheduler.stacksInPsram() ? " (PSRAM)" : "");
+
+  // Sources de réveil de loop() ; les timers à usage unique sont armés à la demande
+  if (!loopEvents.begin(MAIN_LOOP_POLL_MS)) {
+    Serial.println("[LOOP] Groupe d'événements indisponible, boucle à 10 ms");
+  }
+  loopEvents.addTimer("LoopTick", LOOP_TICK, MAIN_LOOP_TICK_MS, true);
+  loopEvents.addTimer("LoopReport", LOOP_REPORT, MAIN_LOOP_REPORT_MS, true);
+#if ENABLE_BUTTONS
+  buttonTimer = loopEvents.addTimer("LoopButtons", LOOP_BUTTONS, debounceMs, false);
+#endif
+  networkTimer = loopEvents.addTimer("LoopNetwork", LOOP_NETWORK, 5000, false);
+  ledTimer = loopEvents.addTimer("LoopLeds", LOOP_LEDS, NEOPIXEL_HEARTBEAT_FRAME_MS, false);
+  streamTimer = loopEvents.addTimer("LoopStreams", LOOP_STREAMS, EVENT_STREAM_KEEPALIVE_MS, false);
+  jobScheduler.setFinishHook([] { loopEvents.signal(LOOP_JOBS); });
+  loopEvents.setLatencyObserver([](uint8_t source, uint32_t latencyUs) {
+    jitterMonitor.latency(LOOP_EVENT_NAMES[source], latencyUs);
+  });
+  server.onServed([](const char* uri, uint32_t elapsedUs) { jitterMonitor.request(uri, elapsedUs); });
+  jitterMonitor.setJobsDescriber(describeRunningJobs);
+  if (!jitterMonitor.beginTicks()) {
+    Serial.println("[JITTER] Histogramme des ticks indisponible");
+  }
+  WiFi.onEvent(onNetworkEvent);
+
+  // [OPT-013]: Sérialise les traductions une fois au démarrage
+  getTranslationBlob(LANG_EN);
+  getTranslationBlob(LANG_FR);
 
   // Initialize GPS module
   initGPS();
@@ -6094,6 +8893,9 @@ void setup() {
   // ========== ROUTES SERVEUR ==========
   server.on("/", handleRoot);
   server.on("/js/app.js", handleJavaScriptRoute);
+  server.on("/js/boot.js", handleJavaScriptBoot);
+  server.on("/js/static.js", handleStaticJavaScript);
+  server.on("/css/app.css", handleStylesheet);
 
   // **TRANSLATION API**
   server.on("/api/get-translations", handleGetTranslations);
@@ -6101,6 +8903,19 @@ void setup() {
 
   // Data endpoints
   server.on("/api/status", handleStatus);
+  server.on("/api/events", handleEventStream);
+  server.on("/api/batch", handleBatch);
+#if ENABLE_ROUTE_METRICS
+  server.on("/api/metrics", handleMetrics);
+#endif
+  server.on("/api/jobs", handleJobs);
+  server.on(UriBraces("/api/jobs/{}/cancel"), handleJobCancel);
+  server.on("/api/suite", handleSuite);
+  server.on("/api/stacks", handleStacks);
+  server.on("/api/cores", handleCores);
+  server.on("/api/loop", handleLoop);
+  server.on("/api/jitter", handleJitter);
+  server.on("/api/soak", handleSoak);
   server.on("/api/overview", handleOverview);
   server.on("/api/system-info", handleSystemInfo);
   server.on("/api/memory", handleMemory);
@@ -6113,6 +8928,10 @@ void setup() {
   server.on("/api/test-gpio", handleTestGPIO);
   server.on("/api/wifi-scan", handleWiFiScan);
   server.on("/api/i2c-scan", handleI2CScan);
+  server.on("/api/i2c-benchmark", handleI2CBenchmark);
+  server.on("/api/net", handleNet);
+  server.on("/api/net/download", HTTP_GET, handleNetDownload);
+  server.on("/api/net/upload", HTTP_POST, handleNetUpload, handleNetUploadBody);
 
   // LED intégrée
   server.on("/api/builtin-led-config", handleBuiltinLEDConfig);
@@ -6138,6 +8957,7 @@ void setup() {
   server.on("/api/tft-boot", handleTFTBoot);
   server.on("/api/tft-config", handleTFTConfig);
   server.on("/api/tft-brightness", handleTFTBrightness);  // v3.33.2: PWM brightness control
+  server.on("/api/display-benchmark", handleDisplayBenchmark);
 
   // Tests avancés
   server.on("/api/adc-test", handleADCTest);
@@ -6174,6 +8994,7 @@ void setup() {
   server.on("/api/sd-test-read", handleSDTestRead);
   server.on("/api/sd-test-write", handleSDTestWrite);
   server.on("/api/sd-format", handleSDFormat);
+  server.on("/api/sd-benchmark", handleSDBenchmark);
 
   // Rotary Encoder
   server.on("/api/rotary-config", handleRotaryConfig);
@@ -6203,7 +9024,23 @@ void setup() {
   server.on("/export/csv", handleExportCSV);
   server.on("/print", handlePrintVersion);
 
+  // En-têtes nécessaires au cache des assets statiques (ETag/304, gzip), au choix JSON/CBOR et au corps de /api/net/upload
+  const char* collectedHeaders[] = {"If-None-Match", "Accept-Encoding", "Accept", "Content-Type"};
+  server.collectHeaders(collectedHeaders, sizeof(collectedHeaders) / sizeof(collectedHeaders[0]));
+
   server.begin();
+  if (!loopEvents.polling()) {
+    const uint32_t watcherStack = stackProfile.recommended(STACK_HTTP_WATCHER, HTTP_WATCHER_STACK);
+    if (server.startWatcher([] { loopEvents.signal(LOOP_HTTP); }, watcherStack, WEB_SERVER_TASK_PRIORITY, loopCore)) {
+      stackProfile.setAllocated(STACK_HTTP_WATCHER, watcherStack, false);
+    } else {
+      loopEvents.setPollMs(10);
+      Serial.println("[LOOP] Tâche HttpWatcher non créée, retour à la boucle à 10 ms");
+    }
+  }
+  loopEvents.signal(LOOP_NETWORK | LOOP_LEDS);  // état initial du Wi-Fi et du battement
+  startNetEcho();
+  startNetDownload();
 
   // Install debug routes for troubleshooting
   setupDebugRoutes();
@@ -6232,53 +9069,76 @@ void setup() {
 }
 
 // ========== LOOP ==========
+// [OPT-026]: chaque passage ne traite que les sources signalées (voir loopEvents)
 void loop() {
-    // --- Earthbeat NeoPixel fade (animation continue) ---
-    if (strip != nullptr) {
-      static unsigned long neopixelHeartbeatPreviousMillis = 0;
-      static float phase = 0.0f;
-      static bool fadeUp = true;
-      unsigned long now = millis();
-      const unsigned long NEOPIXEL_HEARTBEAT_FADE_PERIOD_MS = 1200;
-      const uint8_t NEOPIXEL_HEARTBEAT_BRIGHTNESS_MIN = 10;
-      const uint8_t NEOPIXEL_HEARTBEAT_BRIGHTNESS_MAX = 60;
-      const float step = (float)(now - neopixelHeartbeatPreviousMillis) / (float)NEOPIXEL_HEARTBEAT_FADE_PERIOD_MS;
-      neopixelHeartbeatPreviousMillis = now;
-      if (fadeUp) {
-        phase += step;
-        if (phase >= 1.0f) { phase = 1.0f; fadeUp = false; }
-      } else {
-        phase -= step;
-        if (phase <= 0.0f) { phase = 0.0f; fadeUp = true; }
-      }
-      uint8_t brightness = (uint8_t)(NEOPIXEL_HEARTBEAT_BRIGHTNESS_MIN + (NEOPIXEL_HEARTBEAT_BRIGHTNESS_MAX - NEOPIXEL_HEARTBEAT_BRIGHTNESS_MIN) * phase);
-      bool connected = (WiFi.status() == WL_CONNECTED);
-      uint32_t color = connected ? strip->Color(0, brightness, 0) : strip->Color(brightness, 0, 0);
-      strip->setBrightness(brightness);
-      strip->setPixelColor(0, color);
-      strip->show();
+  const EventBits_t events = loopEvents.wait();
+  jitterMonitor.beginPass(esp_timer_get_time());
+
+  if (events & LOOP_HTTP) {
+    jitterMonitor.phase("http");
+    server.handleClient();
+    if (!loopEvents.polling()) {
+      server.rearm();
+    }
+  }
+  if (events & (LOOP_HTTP | LOOP_STREAMS | LOOP_JOBS)) {
+    jitterMonitor.phase("streams");
+    loopEvents.arm(streamTimer, serviceEventStreams());
+  }
+  if (events & LOOP_JOBS) {
+    jitterMonitor.phase("jobs");
+    refreshResultCaches();
+    refreshStackProfile();
+    serviceSoak();
+  }
+  if (events & LOOP_TICK) {
+    jitterMonitor.phase("tick");
+    jobScheduler.checkTimeouts();
+    refreshStackProfile();
+    refreshCorePlacement();
+    serviceSoak();
+    if (ledTimer != nullptr && xTimerIsTimerActive(ledTimer) == pdFALSE) {
+      loopEvents.signal(LOOP_LEDS);  // battement repris après une pause (test NeoPixel, connexion)
     }
-  server.handleClient();
-  maintainNetworkServices();
-  updateNeoPixelWifiStatus();
+  }
+  if (events & LOOP_NETWORK) {
+    jitterMonitor.phase("network");
+    loopEvents.arm(networkTimer, maintainNetworkServices());
+  }
+  if (events & (LOOP_LEDS | LOOP_NETWORK)) {
+    jitterMonitor.phase("leds");
+    loopEvents.arm(ledTimer, updateNeoPixelWifiStatus());
+  }
 
 #if ENABLE_BUTTONS
-  maintainButtons();
+  if (events & LOOP_BUTTONS) {
+    jitterMonitor.phase("buttons");
+    loopEvents.arm(buttonTimer, maintainButtons());
+  }
 #endif
 
-  static unsigned long lastUpdate = 0;
-  if (millis() - lastUpdate > 30000) {
-    lastUpdate = millis();
-    collectDiagnosticInfo();
-    
+  if (events & LOOP_REPORT) {
+    jitterMonitor.phase("report");
+    TelemetryReader telemetry;
+    const DiagnosticInfo& diag = telemetry.diag();
+
     Serial.println("\r\n=== UPDATE ===");
     Serial.printf("Heap: %.2f KB | Uptime: %.2f h\r\n", 
-                  diagnosticData.freeHeap / 1024.0, 
-                  diagnosticData.uptime / 3600000.0);
-    if (diagnosticData.temperature != -999) {
-      Serial.printf("Temp: %.1f°C\r\n", diagnosticData.temperature);
+                  diag.freeHeap / 1024.0, 
+                  diag.uptime / 3600000.0);
+    if (diag.temperature != -999) {
+      Serial.printf("Temp: %.1f°C\r\n", diag.temperature);
     }
   }
 
-  delay(10);
+  static uint32_t reportedStalls = 0;
+  jitterMonitor.endPass();
+  if (jitterMonitor.stallCount() > reportedStalls) {
+    const auto* stall = jitterMonitor.lastStall();
+    Serial.printf("[JITTER] loop() %s %lu ms (%s) jobs: %s\r\n", stall->starved ? "en attente du CPU" : "bloquée",
+                  static_cast<unsigned long>(stall->durationUs / 1000), stall->activity,
+                  stall->jobs[0] ? stall->jobs : "-");
+  }
+  reportedStalls = jitterMonitor.stallCount();  // aussi après ?action=reset
+  loopEvents.serviced();
 }
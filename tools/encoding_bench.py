@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""
+ESP32 Diagnostic - JSON vs CBOR Encoding Benchmark
+
+Requests the same endpoints once with "Accept: application/json" and once with
+"Accept: application/cbor", then compares payload size and response time.
+
+Usage:
+    python tools/encoding_bench.py 192.168.1.50
+    python tools/encoding_bench.py esp32-diagnostic.local --paths /api/overview,/export/json --repeat 50
+
+The response time is measured end to end (request sent -> last byte
+received), so it includes the on-device encoding time. The CBOR payload is
+also decoded and compared key by key with the JSON one: a mismatch means
+the two encoders disagree.
+
+Only the Python standard library is used (small built-in CBOR decoder).
+Without a device, "pio run -e native_encoding" compares the on-host encode
+time and payload size of the same documents (src/host/encoding_bench_host.cpp).
+"""
+
+import argparse
+import http.client
+import json
+import statistics
+import struct
+import sys
+import time
+
+ENCODINGS = (("json", "application/json"), ("cbor", "application/cbor"))
+
+
+class CborDecoder:
+    """Subset of RFC 8949 emitted by the firmware (maps, arrays, text, ints, floats, simple)"""
+
+    BREAK = object()
+
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def take(self, count):
+        chunk = self.data[self.pos:self.pos + count]
+        if len(chunk) != count:
+            raise ValueError("truncated CBOR")
+        self.pos += count
+        return chunk
+
+    def argument(self, info):
+        if info < 24:
+            return info
+        if info in (24, 25, 26, 27):
+            return int.from_bytes(self.take(1 << (info - 24)), "big")
+        if info == 31:
+            return None  # indefinite length
+        raise ValueError(f"unsupported additional info {info}")
+
+    def decode(self):
+        initial = self.take(1)[0]
+        major, info = initial >> 5, initial & 0x1F
+        if major == 7:
+            if info == 20:
+                return False
+            if info == 21:
+                return True
+            if info in (22, 23):
+                return None
+            if info == 25:
+                return struct.unpack(">e", self.take(2))[0]
+            if info == 26:
+                return struct.unpack(">f", self.take(4))[0]
+            if info == 27:
+                return struct.unpack(">d", self.take(8))[0]
+            if info == 31:
+                return self.BREAK
+            raise ValueError(f"unsupported simple value {info}")
+        length = self.argument(info)
+        if major == 0:
+            return length
+        if major == 1:
+            return -1 - length
+        if major in (2, 3):
+            raw = self.take(length)
+            return raw.decode("utf-8") if major == 3 else raw
+        if major == 4:
+            return self.items(length, lambda: self.decode())
+        if major == 5:
+            pairs = self.items(length, lambda: (self.decode(), self.decode()))
+            return dict(pairs)
+        raise ValueError(f"unsupported major type {major}")
+
+    def items(self, length, read):
+        result = []
+        if length is not None:
+            for _ in range(length):
+                result.append(read())
+            return result
+        while True:
+            if self.data[self.pos] == 0xFF:
+                self.pos += 1
+                return result
+            result.append(read())
+
+
+def same_document(a, b, path="$"):
+    """Structural comparison, floats within 1e-3 relative (float32 on the wire)"""
+    if isinstance(a, dict) and isinstance(b, dict):
+        if a.keys() != b.keys():
+            return f"{path}: keys differ"
+        for key in a:
+            diff = same_document(a[key], b[key], f"{path}.{key}")
+            if diff:
+                return diff
+        return None
+    if isinstance(a, list) and isinstance(b, list):
+        if len(a) != len(b):
+            return f"{path}: length {len(a)} != {len(b)}"
+        for i, (x, y) in enumerate(zip(a, b)):
+            diff = same_document(x, y, f"{path}[{i}]")
+            if diff:
+                return diff
+        return None
+    if isinstance(a, float) or isinstance(b, float):
+        if isinstance(a, bool) or isinstance(b, bool) or a is None or b is None:
+            return f"{path}: {a!r} != {b!r}"
+        if abs(a - b) <= 1e-3 * max(1.0, abs(a)):
+            return None
+        return f"{path}: {a!r} != {b!r}"
+    return None if a == b else f"{path}: {a!r} != {b!r}"
+
+
+def fetch(host, port, path, accept, timeout):
+    start = time.monotonic()
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    conn.request("GET", path, headers={"Accept": accept})
+    response = conn.getresponse()
+    body = response.read()
+    conn.close()
+    elapsed = time.monotonic() - start
+    return response.status, response.getheader("Content-Type", ""), body, elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare JSON and CBOR responses of the ESP32 Diagnostic API")
+    parser.add_argument("host", help="IP address or hostname of the board")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--paths", default="/api/overview,/api/batch?sections=system,wifi,memory,peripherals,/export/json",
+                        help="comma-separated GET paths; a path containing commas must be passed alone")
+    parser.add_argument("--repeat", type=int, default=20, help="requests per path and encoding (default: 20)")
+    parser.add_argument("--timeout", type=float, default=15.0, help="per-request timeout in seconds")
+    args = parser.parse_args()
+
+    # Split on ",/" so query strings like sections=a,b stay intact
+    paths = [p if p.startswith("/") else "/" + p for p in args.paths.split(",/") if p.strip()]
+
+    print(f"Target: http://{args.host}:{args.port}  repeat: {args.repeat}")
+    print()
+    print(f"{'path':<48} {'enc':>4} {'bytes':>7} {'median ms':>10} {'p90 ms':>8}")
+    failures = 0
+    for path in paths:
+        documents = {}
+        sizes = {}
+        for name, accept in ENCODINGS:
+            times = []
+            body = b""
+            for _ in range(args.repeat):
+                try:
+                    status, content_type, body, elapsed = fetch(args.host, args.port, path, accept, args.timeout)
+                except (OSError, http.client.HTTPException) as exc:
+                    print(f"  [ERROR] {path} ({name}): {exc}")
+                    failures += 1
+                    break
+                if status != 200 or accept not in content_type:
+                    print(f"  [ERROR] {path} ({name}): HTTP {status}, Content-Type '{content_type}'")
+                    failures += 1
+                    break
+                times.append(elapsed * 1000.0)
+            if not times:
+                continue
+            times.sort()
+            sizes[name] = len(body)
+            documents[name] = json.loads(body) if name == "json" else CborDecoder(body).decode()
+            p90 = times[min(len(times) - 1, int(len(times) * 0.9))]
+            print(f"{path[:48]:<48} {name:>4} {len(body):>7} {statistics.median(times):>10.1f} {p90:>8.1f}")
+        if len(documents) == 2:
+            diff = same_document(documents["json"], documents["cbor"])
+            ratio = 100.0 * sizes["cbor"] / sizes["json"] if sizes["json"] else 0.0
+            if diff:
+                failures += 1
+                print(f"  [MISMATCH] {diff}")
+            else:
+                print(f"  CBOR = {ratio:.0f}% of JSON, same content")
+    print()
+    print("Timestamps and live counters can differ between two requests; rerun if a mismatch is on such a field.")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
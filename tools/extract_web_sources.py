@@ -51,31 +51,12 @@ def write_file(filepath, content):
         f.write(content)
 
 def extract_css_from_header(header_content):
-    """Extract CSS from generateHTML() function in web_interface.h"""
-    # Find lines between <style> and </style>
-    lines = header_content.split('\n')
-    css_lines = []
-    in_css = False
-
-    for line in lines:
-        if 'html += "<style>";' in line:
-            in_css = True
-            continue
-        elif 'html += "</style>";' in line:
-            in_css = False
-            break
-        elif in_css and 'html +=' in line:
-            # Extract the CSS content from the line
-            match = re.search(r'html \+= "(.*?)";', line)
-            if match:
-                css_fragment = match.group(1)
-                # Unescape
-                css_fragment = css_fragment.replace('\\n', '\n')
-                css_fragment = css_fragment.replace('\\"', '"')
-                css_fragment = css_fragment.replace('\\\\', '\\')
-                css_lines.append(css_fragment)
-
-    return ''.join(css_lines)
+    """Extract CSS from the DIAGNOSTIC_CSS_STATIC constant in web_interface.h"""
+    pattern = r'static const char PROGMEM DIAGNOSTIC_CSS_STATIC\[\] = R"CSS\((.*?)\)CSS";'
+    match = re.search(pattern, header_content, re.DOTALL)
+    if match:
+        return match.group(1).strip('\n')
+    return ''
 
 def extract_js_from_header(header_content, is_lite=False):
     """Extract JavaScript from PROGMEM constant"""
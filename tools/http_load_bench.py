@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+"""
+ESP32 Diagnostic - HTTP Load Benchmark
+
+Measures how the web server behaves with several clients at once:
+requests/second and latency percentiles for 1, 4 and 8 concurrent clients.
+
+Usage:
+    python tools/http_load_bench.py 192.168.1.50
+    python tools/http_load_bench.py esp32-diagnostic.local --paths /api/status,/api/memory --duration 20
+    python tools/http_load_bench.py 192.168.1.50 --clients 1,2,4,8 --idle 2
+    python tools/http_load_bench.py 192.168.1.50 --load "/api/suite?action=run" --placement fixed,measured
+
+Each client opens a new connection per request (the firmware answers with
+"Connection: close"). With --idle N, N extra sockets are connected and never
+send a request. This reproduces the browser preconnects that used to stall
+the single-client WebServer for 5 s.
+
+With --load PATH, PATH is requested once per second during each level to
+keep the board busy (e.g. /api/suite?action=run restarts the full hardware
+suite whenever the previous one is over). With --placement, every level is
+run once per core placement mode (/api/cores?mode=...), which gives the HTTP
+latency under heavy tests before (fixed) and after (measured) side by side.
+The per-core load read from /api/cores at the end of each level is printed
+with it.
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import http.client
+import json
+import socket
+import sys
+import threading
+import time
+
+
+def percentile(sorted_values, pct):
+    """Nearest-rank percentile of an already sorted list"""
+    if not sorted_values:
+        return 0.0
+    rank = max(0, min(len(sorted_values) - 1, int(round(pct / 100.0 * len(sorted_values) + 0.5)) - 1))
+    return sorted_values[rank]
+
+
+class Worker(threading.Thread):
+    """Sends requests in a loop until the deadline and records latencies"""
+
+    def __init__(self, host, port, paths, deadline, timeout):
+        super().__init__(daemon=True)
+        self.host = host
+        self.port = port
+        self.paths = paths
+        self.deadline = deadline
+        self.timeout = timeout
+        self.latencies = []
+        self.errors = 0
+        self.rejected = 0
+
+    def run(self):
+        index = 0
+        while time.monotonic() < self.deadline:
+            path = self.paths[index % len(self.paths)]
+            index += 1
+            start = time.monotonic()
+            try:
+                conn = http.client.HTTPConnection(self.host, self.port, timeout=self.timeout)
+                conn.request("GET", path)
+                response = conn.getresponse()
+                response.read()
+                conn.close()
+            except (OSError, http.client.HTTPException):
+                self.errors += 1
+                continue
+            elapsed = time.monotonic() - start
+            if response.status == 503:
+                self.rejected += 1
+            elif response.status >= 400:
+                self.errors += 1
+            else:
+                self.latencies.append(elapsed)
+
+
+class LoadDriver(threading.Thread):
+    """Requests the load path every second until the deadline"""
+
+    def __init__(self, host, port, path, deadline, timeout):
+        super().__init__(daemon=True)
+        self.host = host
+        self.port = port
+        self.path = path
+        self.deadline = deadline
+        self.timeout = timeout
+        self.failures = 0
+
+    def run(self):
+        while time.monotonic() < self.deadline:
+            try:
+                status, _ = get_json(self.host, self.port, self.path, self.timeout)
+                self.failures += 0 if status < 400 else 1
+            except (OSError, http.client.HTTPException, ValueError):
+                self.failures += 1
+            time.sleep(1.0)
+
+
+def get_json(host, port, path, timeout):
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    conn.request("GET", path, headers={"Accept": "application/json"})
+    response = conn.getresponse()
+    body = response.read()
+    conn.close()
+    return response.status, json.loads(body) if body else {}
+
+
+def core_summary(args):
+    """'jobs on 0+1, core0 35% (loop 0 other 20 jobs 15) ...' from /api/cores"""
+    try:
+        status, cores = get_json(args.host, args.port, "/api/cores", args.timeout)
+    except (OSError, http.client.HTTPException, ValueError):
+        return "cores: n/a"
+    if status != 200:
+        return f"cores: HTTP {status}"
+    parts = [f"jobs on core {cores.get('job_cores', '?')}"]
+    for core in cores.get("cores", []):
+        parts.append(f"core{core['core']} {core['busy']}% (loop {core['loop']} other {core['other']} jobs {core['jobs']})")
+    return ", ".join(parts)
+
+
+def open_idle_sockets(host, port, count):
+    sockets = []
+    for _ in range(count):
+        try:
+            sockets.append(socket.create_connection((host, port), timeout=5))
+        except OSError as exc:
+            print(f"  [WARN] idle socket failed: {exc}")
+    return sockets
+
+
+def run_level(args, clients, paths):
+    idle = open_idle_sockets(args.host, args.port, args.idle)
+    deadline = time.monotonic() + args.duration
+    workers = [Worker(args.host, args.port, paths, deadline, args.timeout) for _ in range(clients)]
+    load = LoadDriver(args.host, args.port, args.load, deadline, args.timeout) if args.load else None
+    if load:
+        load.start()
+        time.sleep(min(1.0, args.duration / 4))  # let the load begin before measuring
+    started = time.monotonic()
+    for worker in workers:
+        worker.start()
+    for worker in workers:
+        worker.join()
+    wall = time.monotonic() - started
+    cores = core_summary(args) if args.load or args.placement else ""
+    if load:
+        load.join()
+    for sock in idle:
+        sock.close()
+
+    latencies = sorted(l for worker in workers for l in worker.latencies)
+    errors = sum(worker.errors for worker in workers)
+    rejected = sum(worker.rejected for worker in workers)
+    return {
+        "clients": clients,
+        "requests": len(latencies),
+        "rps": len(latencies) / wall if wall > 0 else 0.0,
+        "p50": percentile(latencies, 50) * 1000.0,
+        "p99": percentile(latencies, 99) * 1000.0,
+        "max": (latencies[-1] * 1000.0) if latencies else 0.0,
+        "errors": errors,
+        "rejected": rejected,
+        "load_failures": load.failures if load else 0,
+        "cores": cores,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description="HTTP load benchmark for the ESP32 Diagnostic web server")
+    parser.add_argument("host", help="IP address or hostname of the board")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--paths", default="/api/status",
+                        help="comma-separated list of GET paths, requested in rotation (default: /api/status)")
+    parser.add_argument("--clients", default="1,4,8",
+                        help="comma-separated concurrency levels (default: 1,4,8)")
+    parser.add_argument("--duration", type=float, default=10.0, help="seconds per level (default: 10)")
+    parser.add_argument("--timeout", type=float, default=15.0, help="per-request timeout in seconds")
+    parser.add_argument("--idle", type=int, default=0, help="extra connected sockets that never send a request")
+    parser.add_argument("--load", help="GET path requested every second during each level, e.g. /api/suite?action=run")
+    parser.add_argument("--placement", default="",
+                        help="comma-separated core placement modes to compare (fixed,measured); "
+                             "the board is left in the last one")
+    args = parser.parse_args()
+
+    paths = [p.strip() for p in args.paths.split(",") if p.strip()]
+    levels = [int(c) for c in args.clients.split(",") if c.strip()]
+    modes = [m.strip() for m in args.placement.split(",") if m.strip()]
+    if not paths or not levels:
+        print("ERROR: --paths and --clients must not be empty")
+        return 1
+    if any(m not in ("fixed", "measured") for m in modes):
+        print("ERROR: --placement modes are fixed and measured")
+        return 1
+
+    print(f"Target: http://{args.host}:{args.port}  paths: {', '.join(paths)}  "
+          f"duration: {args.duration:.0f}s/level  idle sockets: {args.idle}"
+          + (f"  load: {args.load}" if args.load else ""))
+    for mode in modes or [None]:
+        if mode:
+            try:
+                status, _ = get_json(args.host, args.port, f"/api/cores?mode={mode}", args.timeout)
+            except (OSError, http.client.HTTPException, ValueError) as exc:
+                print(f"ERROR: cannot select placement {mode}: {exc}")
+                return 1
+            if status != 200:
+                print(f"ERROR: /api/cores?mode={mode}: HTTP {status}")
+                return 1
+            print()
+            print(f"Placement: {mode}")
+        print()
+        print(f"{'clients':>7} {'requests':>9} {'req/s':>8} {'p50 ms':>8} {'p99 ms':>8} {'max ms':>8} {'503':>5} {'errors':>6}")
+        for clients in levels:
+            r = run_level(args, clients, paths)
+            print(f"{r['clients']:>7} {r['requests']:>9} {r['rps']:>8.1f} {r['p50']:>8.1f} {r['p99']:>8.1f} "
+                  f"{r['max']:>8.1f} {r['rejected']:>5} {r['errors']:>6}")
+            if r["cores"]:
+                print(f"{'':>7} {r['cores']}")
+            if r["load_failures"]:
+                print(f"{'':>7} [WARN] {r['load_failures']} load requests failed")
+    print()
+    print("503 = connection refused by the firmware because MAX_WEB_CLIENTS slots were busy")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+ESP32 Diagnostic - Main Loop Probe
+
+Measures what the main loop costs while the board has nothing to do, and how
+fast it answers when it does:
+
+  * idle window: /api/loop is reset, the script waits --idle seconds without
+    sending anything, then reads the loop wakes per second, the time spent
+    outside the wait and the idle share of each core (/api/cores);
+  * latency: --requests sequential GET /api/loop, one connection each.
+
+Usage:
+    python tools/loop_probe.py 192.168.1.50
+    python tools/loop_probe.py 192.168.1.50 --save before.json    # firmware built with MAIN_LOOP_POLL_MS 10
+    python tools/loop_probe.py 192.168.1.50 --compare before.json # event-driven firmware (MAIN_LOOP_POLL_MS 0)
+
+Core idle percentages come from the last CORE_PLACEMENT_INTERVAL_MS window,
+so keep --idle above that interval. The loop counters cover the whole idle
+window (the probe's own requests are made after it).
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import http.client
+import json
+import statistics
+import sys
+import time
+
+
+def get(host, port, path, timeout):
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    conn.request("GET", path, headers={"Accept": "application/json"})
+    response = conn.getresponse()
+    body = response.read()
+    conn.close()
+    return response.status, json.loads(body) if body else {}
+
+
+def percentile(values, fraction):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def probe(args):
+    get(args.host, args.port, "/api/loop?action=reset", args.timeout)
+    time.sleep(args.idle)
+    status, loop = get(args.host, args.port, "/api/loop", args.timeout)
+    if status != 200:
+        raise ValueError(f"/api/loop: HTTP {status}")
+    status, cores = get(args.host, args.port, "/api/cores", args.timeout)
+    idle = [core["idle"] for core in cores.get("cores", [])] if status == 200 else []
+
+    latencies = []
+    for _ in range(args.requests):
+        start = time.perf_counter()
+        get(args.host, args.port, "/api/loop", args.timeout)
+        latencies.append((time.perf_counter() - start) * 1000.0)
+
+    return {
+        "mode": loop["mode"],
+        "poll_ms": loop["poll_ms"],
+        "window_ms": loop["window_ms"],
+        "wakes_per_s": loop["wakes_per_s"],
+        "busy_percent": loop["busy_percent"],
+        "jitter_us_mean": loop["jitter_us"]["mean"],
+        "jitter_us_max": loop["jitter_us"]["max"],
+        "sources": loop["sources"],
+        "core_idle_percent": idle,
+        "latency_ms_p50": statistics.median(latencies) if latencies else 0.0,
+        "latency_ms_p95": percentile(latencies, 0.95) if latencies else 0.0,
+        "latency_ms_max": max(latencies) if latencies else 0.0,
+    }
+
+
+ROWS = [
+    ("wakes_per_s", "loop wakes/s", "{:.1f}"),
+    ("busy_percent", "loop busy %", "{:.2f}"),
+    ("jitter_us_mean", "timer jitter mean (us)", "{}"),
+    ("jitter_us_max", "timer jitter max (us)", "{}"),
+    ("latency_ms_p50", "HTTP latency p50 (ms)", "{:.1f}"),
+    ("latency_ms_p95", "HTTP latency p95 (ms)", "{:.1f}"),
+    ("latency_ms_max", "HTTP latency max (ms)", "{:.1f}"),
+]
+
+
+def print_report(result, baseline):
+    print()
+    print(f"Loop mode: {result['mode']}" + (f" ({result['poll_ms']} ms)" if result["poll_ms"] else "")
+          + f", idle window {result['window_ms'] / 1000.0:.1f} s")
+    header = f"{'':<24} {'now':>10}"
+    if baseline:
+        header += f" {'baseline':>10}"
+    print(header)
+    for key, label, fmt in ROWS:
+        line = f"{label:<24} {fmt.format(result[key]):>10}"
+        if baseline:
+            line += f" {fmt.format(baseline[key]):>10}"
+        print(line)
+    for core, idle in enumerate(result["core_idle_percent"]):
+        line = f"{f'core {core} idle %':<24} {idle:>10}"
+        if baseline and core < len(baseline["core_idle_percent"]):
+            line += f" {baseline['core_idle_percent'][core]:>10}"
+        print(line)
+    print()
+    print("Wakes by source: " + ", ".join(f"{name} {count}" for name, count in result["sources"].items()))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Measure idle cost and responsiveness of the main loop")
+    parser.add_argument("host", help="IP address or hostname of the board")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--idle", type=float, default=10.0, help="idle window in seconds (default: 10)")
+    parser.add_argument("--requests", type=int, default=50, help="sequential requests for the latency (default: 50)")
+    parser.add_argument("--save", help="write the result to this JSON file")
+    parser.add_argument("--compare", help="JSON file saved by a previous run, printed side by side")
+    parser.add_argument("--timeout", type=float, default=10.0, help="per-request timeout in seconds")
+    args = parser.parse_args()
+
+    baseline = None
+    if args.compare:
+        with open(args.compare, encoding="utf-8") as handle:
+            baseline = json.load(handle)
+
+    try:
+        result = probe(args)
+    except (OSError, http.client.HTTPException, ValueError, KeyError) as exc:
+        print(f"[ERROR] {exc}")
+        return 1
+
+    print_report(result, baseline)
+    if args.save:
+        with open(args.save, "w", encoding="utf-8") as handle:
+            json.dump(result, handle, indent=2)
+        print(f"Saved to {args.save}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -7,29 +7,38 @@ This script minifies CSS and JavaScript files and generates the web_interface.h
 
 Usage:
     python tools/minify_web.py
+    python tools/minify_web.py --gzip-only   # only rebuild include/web_assets_gz.h
 
 The script will:
 1. Read source files from web_src/
 2. Minify CSS and JavaScript
 3. Update include/web_interface.h with minified content
 4. Preserve the structure and comments of the header file
+5. Generate include/web_assets_gz.h (gzip blobs + content hash for ETag/304,
+   including the static EN/FR HTML shells rendered from languages.h)
 
 Requirements:
-    pip install csscompressor rjsmin
+    pip install -r tools/requirements.txt
+    (--gzip-only needs the standard library only)
 """
 
 import os
 import sys
 import re
+import gzip
+import hashlib
 from pathlib import Path
 
+GZIP_ONLY = "--gzip-only" in sys.argv
+
 try:
     import rcssmin
     import rjsmin
 except ImportError:
-    print("ERROR: Required modules not installed.")
-    print("Please install: pip install rcssmin rjsmin")
-    sys.exit(1)
+    if not GZIP_ONLY:
+        print("ERROR: Required modules not installed.")
+        print("Please install: pip install -r tools/requirements.txt")
+        sys.exit(1)
 
 # Paths
 SCRIPT_DIR = Path(__file__).parent
@@ -37,6 +46,9 @@ PROJECT_ROOT = SCRIPT_DIR.parent
 WEB_SRC_DIR = PROJECT_ROOT / "web_src"
 INCLUDE_DIR = PROJECT_ROOT / "include"
 WEB_INTERFACE_H = INCLUDE_DIR / "web_interface.h"
+WEB_ASSETS_GZ_H = INCLUDE_DIR / "web_assets_gz.h"
+LANGUAGES_H = INCLUDE_DIR / "languages.h"
+PLATFORMIO_INI = PROJECT_ROOT / "platformio.ini"
 
 # Source files
 CSS_FILE = WEB_SRC_DIR / "styles.css"
@@ -82,11 +94,11 @@ def escape_for_cpp_string(text):
     text = text.replace('\r', '')
     return text
 
+CSS_PATTERN = r'(static const char PROGMEM DIAGNOSTIC_CSS_STATIC\[\] = R"CSS\()(.*?)(\)CSS";)'
+
 def extract_css_from_header(header_content):
-    """Extract CSS section from web_interface.h"""
-    # Find the CSS section in generateHTML()
-    pattern = r'(html \+= "<style>";)(.*?)(html \+= "</style>";)'
-    match = re.search(pattern, header_content, re.DOTALL)
+    """Extract CSS constant from web_interface.h"""
+    match = re.search(CSS_PATTERN, header_content, re.DOTALL)
     if match:
         return match.group(2)
     return None
@@ -105,32 +117,8 @@ def extract_js_from_header(header_content, is_lite=False):
 
 def inject_css_into_header(header_content, minified_css):
     """Inject minified CSS into web_interface.h"""
-    # Escape for C++ string
-    escaped_css = escape_for_cpp_string(minified_css)
-
-    # Split into manageable chunks (to avoid too long lines)
-    max_line_length = 200
-    css_lines = []
-    current_line = ""
-
-    for char in escaped_css:
-        current_line += char
-        if len(current_line) >= max_line_length and char in [';', '}']:
-            css_lines.append('  html += "' + current_line + '";')
-            current_line = ""
-
-    if current_line:
-        css_lines.append('  html += "' + current_line + '";')
-
-    css_block = '\n'.join(css_lines)
-
-    # Replace CSS section - ensure </style> tag is preserved
-    pattern = r'(html \+= "<style>";)(.*?)(html \+= "</style>";)'
-
-    # Build replacement with explicit </style> tag
-    replacement = r'\1' + '\n' + css_block + '\n  html += "</style>";'
-
-    new_content = re.sub(pattern, replacement, header_content, flags=re.DOTALL)
+    replacement = r'\1' + '\n' + minified_css.replace('\\', '\\\\') + '\n' + r'\3'
+    new_content = re.sub(CSS_PATTERN, replacement, header_content, flags=re.DOTALL)
     return new_content
 
 def inject_js_into_header(header_content, minified_js, is_lite=False):
@@ -144,6 +132,173 @@ def inject_js_into_header(header_content, minified_js, is_lite=False):
     new_content = re.sub(pattern, replacement, header_content, flags=re.DOTALL)
     return new_content
 
+def format_byte_array(data, indent="  ", per_line=16):
+    """Format bytes as a C array initializer body"""
+    lines = []
+    for i in range(0, len(data), per_line):
+        chunk = data[i:i + per_line]
+        lines.append(indent + ",".join(f"0x{b:02x}" for b in chunk) + ",")
+    return "\n".join(lines)
+
+def build_gzip_asset(name, content):
+    """Compress one asset; returns (C declarations, raw size, gzip size)"""
+    raw = content.strip("\n").encode("utf-8")
+    # mtime=0 keeps the output byte-identical between runs
+    compressed = gzip.compress(raw, compresslevel=9, mtime=0)
+    digest = hashlib.sha256(raw).hexdigest()[:16]
+    decl = (
+        f"#define WEB_ASSET_{name}_HASH \"{digest}\"\n"
+        f"static const char WEB_ASSET_{name}_ETAG[] = \"\\\"{digest}\\\"\";\n"
+        # Distinct tag for the identity encoding (a strong ETag names one representation)
+        f"static const char WEB_ASSET_{name}_PLAIN_ETAG[] = \"\\\"{digest}-id\\\"\";\n"
+        f"static const size_t WEB_ASSET_{name}_GZ_LEN = {len(compressed)};\n"
+        f"static const uint8_t PROGMEM WEB_ASSET_{name}_GZ[] = {{\n"
+        f"{format_byte_array(compressed)}\n"
+        f"}};\n"
+    )
+    return decl, len(raw), len(compressed)
+
+TEXT_ENTRY_PATTERN = re.compile(
+    r'X\((\w+),\s*("(?:[^"\\]|\\.)*"|PROJECT_NAME),\s*("(?:[^"\\]|\\.)*"|PROJECT_NAME)\)')
+
+def read_build_define(name):
+    """Value of a -D NAME='"value"' build flag in platformio.ini"""
+    match = re.search(rf"-D {name}='\"(.*?)\"'", read_file(PLATFORMIO_INI))
+    return match.group(1) if match else ""
+
+def load_texts():
+    """(en, fr) dictionaries parsed from TEXT_RESOURCE_MAP in languages.h"""
+    project_name = read_build_define("PROJECT_NAME")
+
+    def decode(literal):
+        if literal == "PROJECT_NAME":
+            return project_name
+        return literal[1:-1].replace('\\"', '"').replace("\\\\", "\\")
+
+    en, fr = {}, {}
+    for key, en_value, fr_value in TEXT_ENTRY_PATTERN.findall(read_file(LANGUAGES_H)):
+        en[key] = decode(en_value)
+        fr[key] = decode(fr_value)
+    return en, fr
+
+def html_escape(text):
+    """Same mapping as htmlEscape() in main.cpp"""
+    for raw, entity in (("&", "&amp;"), ("<", "&lt;"), (">", "&gt;"), ('"', "&quot;"), ("'", "&#39;")):
+        text = text.replace(raw, entity)
+    return text
+
+NAV_TABS = (
+    ("overview", "nav_overview"),
+    ("display-signal", "nav_display_signal"),
+    ("sensors", "nav_sensors"),
+    ("input-devices", "nav_input_devices"),
+    ("memory", "nav_memory"),
+    ("hardware-tests", "nav_hardware_tests"),
+    ("wireless", "nav_wireless"),
+    ("benchmark", "nav_benchmark"),
+    ("export", "nav_export"),
+)
+
+def render_html_shell(lang, texts, version, css_hash, js_hash):
+    """Static page shell served on /: chip model, IP and mDNS host are filled by /js/boot.js"""
+    t = lambda key: html_escape(texts[key])
+    title = f"{t('title')} {t('version')}{version}"
+    active = lambda code: " active" if code == lang else ""
+    nav = "".join(
+        f"<button type='button' class='nav-btn{' active' if i == 0 else ''}' data-tab='{tab}' "
+        f"data-i18n='{key}' onclick=\"showTab('{tab}',this);\">{t(key)}</button>"
+        for i, (tab, key) in enumerate(NAV_TABS))
+    return (
+        f"<!DOCTYPE html><html lang='{lang}'><head><meta charset='UTF-8'>"
+        "<meta name='viewport' content='width=device-width, initial-scale=1.0'>"
+        f"<title>{title}</title>"
+        f"<link rel='stylesheet' href='/css/app.css?v={css_hash}'>"
+        "</head><body>"
+        f"<div class='update-indicator' id='updateIndicator' data-i18n='updating'>{t('updating')}</div>"
+        "<div class='container'><div class='header'><h1 id='main-title'>"
+        "<span class='status-indicator status-online' id='statusIndicator'></span>"
+        f"{title} - <span class='chip-type' id='chipModel'></span></h1>"
+        "<div class='access-row'>"
+        f"<span class='access-label' data-i18n='access' data-i18n-suffix=' :'>{t('access')}</span>"
+        "<a class='access-link' id='mdnsLink' href='#' data-access-host='' data-secure='https://' "
+        "data-legacy='http://' data-access-label='' data-legacy-label='' data-label-id='mdnsAddressText' "
+        "aria-disabled='false'><strong id='mdnsAddressText'></strong></a>"
+        "<span class='access-sep'>•</span>"
+        "<a id='ipAddressLink' class='access-link disabled' href='#' data-access-host='' "
+        "data-secure='https://' data-legacy='http://' data-access-label='' data-legacy-label='' "
+        "data-label-id='ipAddressText' aria-disabled='true'>"
+        f"<strong id='ipAddressText' data-placeholder='{t('ip_unavailable')}' "
+        f"data-placeholder-key='ip_unavailable'>{t('ip_unavailable')}</strong></a>"
+        f"<span class='lang-switch' role='group' aria-label='{t('language_label')}'>"
+        f"<span class='lang-label' data-i18n='language_label'>{t('language_label')}</span>"
+        f"<button type='button' class='lang-btn{active('fr')}' data-lang='fr' onclick=\"changeLang('fr',this);\">FR</button>"
+        f"<button type='button' class='lang-btn{active('en')}' data-lang='en' onclick=\"changeLang('en',this);\">EN</button>"
+        "</span></div>"
+        f"<div class='nav'>{nav}</div>"
+        "</div><div class='content'><div id='tabContainer'></div></div></div>"
+        "<script src='/js/boot.js'></script>"
+        f"<script src='/js/static.js?v={js_hash}'></script>"
+        "</body></html>"
+    )
+
+def build_plain_text(name, content):
+    """Uncompressed PROGMEM copy, for clients without gzip"""
+    return (
+        f"static const char PROGMEM WEB_ASSET_{name}_PLAIN[] =\n"
+        f"  \"{escape_for_cpp_string(content)}\";\n"
+    )
+
+def generate_gzip_assets(header_content):
+    """Write include/web_assets_gz.h from the assets embedded in web_interface.h"""
+    css = extract_css_from_header(header_content)
+    js_full = extract_js_from_header(header_content, is_lite=False)
+    js_lite = extract_js_from_header(header_content, is_lite=True)
+    if css is None or js_full is None:
+        print("ERROR: CSS or JS constant not found in web_interface.h")
+        return False
+
+    blocks = []
+    report = []
+    for name, content in (("APP_CSS", css), ("APP_JS", js_full)):
+        decl, raw_size, gz_size = build_gzip_asset(name, content)
+        blocks.append(decl)
+        report.append((name, raw_size, gz_size))
+
+    # Page shell: one static document per language, versioned with the firmware
+    version = read_build_define("PROJECT_VERSION")
+    css_hash = hashlib.sha256(css.strip("\n").encode("utf-8")).hexdigest()[:16]
+    js_hash = hashlib.sha256(js_full.strip("\n").encode("utf-8")).hexdigest()[:16]
+    texts_en, texts_fr = load_texts()
+    blocks.append(f"#define WEB_ASSET_SHELL_VERSION \"{version}\"\n")
+    for name, lang, texts in (("APP_HTML_EN", "en", texts_en), ("APP_HTML_FR", "fr", texts_fr)):
+        html = render_html_shell(lang, texts, version, css_hash, js_hash)
+        decl, raw_size, gz_size = build_gzip_asset(name, html)
+        blocks.append(decl + build_plain_text(name, html))
+        report.append((name, raw_size, gz_size))
+    if js_lite is not None:
+        # Lite UI: size report only (not served by the firmware)
+        _, raw_size, gz_size = build_gzip_asset("APP_LITE_JS", js_lite)
+        report.append(("APP_LITE_JS", raw_size, gz_size))
+
+    header = (
+        "/*\n"
+        " * WEB_ASSETS_GZ.H - Gzip-compressed static web assets\n"
+        " * Auto-generated by tools/minify_web.py - do not edit manually.\n"
+        " */\n\n"
+        "#ifndef WEB_ASSETS_GZ_H\n"
+        "#define WEB_ASSETS_GZ_H\n\n"
+        "#include <Arduino.h>\n"
+        "#include <pgmspace.h>\n\n"
+        + "\n".join(blocks)
+        + "\n#endif // WEB_ASSETS_GZ_H\n"
+    )
+    write_file(WEB_ASSETS_GZ_H, header)
+
+    print("  Bytes on wire per asset (plain -> gzip):")
+    for name, raw_size, gz_size in report:
+        print(f"    {name:<12} {raw_size:>7} -> {gz_size:>6} bytes ({100 * (1 - gz_size / raw_size):.1f}% saved)")
+    return True
+
 def update_web_interface_header():
     """Main function to update web_interface.h"""
     print("=" * 60)
@@ -196,6 +351,10 @@ def update_web_interface_header():
     print("\n6. Writing updated web_interface.h...")
     write_file(WEB_INTERFACE_H, header_content)
 
+    print("\n7. Generating gzip assets (web_assets_gz.h)...")
+    if not generate_gzip_assets(header_content):
+        return False
+
     print("\n" + "=" * 60)
     print("✅ Web interface header updated successfully!")
     print("=" * 60)
@@ -208,5 +367,9 @@ def update_web_interface_header():
     return True
 
 if __name__ == "__main__":
+    if GZIP_ONLY:
+        print("Generating gzip assets from current web_interface.h...")
+        success = generate_gzip_assets(read_file(WEB_INTERFACE_H))
+        sys.exit(0 if success else 1)
     success = update_web_interface_header()
     sys.exit(0 if success else 1)
@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""
+ESP32 Diagnostic - Network Throughput Benchmark
+
+Measures what the board can really move over Wi-Fi, beyond the RSSI:
+download and upload rates over HTTP, and TCP round-trip time percentiles.
+
+Usage:
+    python tools/net_bench.py 192.168.1.50
+    python tools/net_bench.py 192.168.1.50 --bytes 4M --repeat 5 --verify
+    python tools/net_bench.py 192.168.1.50 --echo-count 500 --payload 256 --json
+    python tools/net_bench.py 127.0.0.1 --port 8080     (native stand-in server)
+
+Steps:
+  download  GET /api/net/download?bytes=N. The board streams a fixed pattern
+            (byte n is n & 0xFF), which --verify checks.
+  upload    POST /api/net/upload with N bytes. The board drops the body and
+            returns the bytes it received and its own timing.
+  echo      TCP connection to the echo port (read from /api/net). Each message
+            of --payload bytes is timed until it has fully come back.
+
+Mbps are megabits per second, measured by this script from the first to the
+last byte. The upload also prints the rate timed by the board.
+The HTTP server of the board serves nothing else during a transfer.
+
+The native stand-in (src/host/net_server_host.cpp) answers the same
+endpoints, to check this script and the network path without a board.
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import http.client
+import json
+import socket
+import sys
+import time
+
+
+def percentile(sorted_values, pct):
+    """Nearest-rank percentile of an already sorted list"""
+    if not sorted_values:
+        return 0.0
+    rank = max(0, min(len(sorted_values) - 1, int(round(pct / 100.0 * len(sorted_values) + 0.5)) - 1))
+    return sorted_values[rank]
+
+
+def parse_size(text):
+    """'1048576', '512K', '4M' -> bytes"""
+    text = text.strip().upper()
+    factor = 1
+    if text and text[-1] in "KM":
+        factor = 1024 if text[-1] == "K" else 1024 * 1024
+        text = text[:-1]
+    return int(float(text) * factor)
+
+
+def mbps(size, seconds):
+    return size * 8 / seconds / 1e6 if seconds > 0 else 0.0
+
+
+PATTERN = bytes(range(256))
+
+
+def download(args):
+    conn = http.client.HTTPConnection(args.host, args.port, timeout=args.timeout)
+    start = time.monotonic()
+    conn.request("GET", f"/api/net/download?bytes={args.bytes}")
+    response = conn.getresponse()
+    if response.status != 200:
+        conn.close()
+        raise RuntimeError(f"download: HTTP {response.status}")
+    received = 0
+    mismatches = 0
+    while True:
+        block = response.read(65536)
+        if not block:
+            break
+        if args.verify:
+            offset = received % 256
+            expected = (PATTERN * (len(block) // 256 + 2))[offset:offset + len(block)]
+            mismatches += sum(1 for a, b in zip(block, expected) if a != b) if block != expected else 0
+        received += len(block)
+    elapsed = time.monotonic() - start
+    conn.close()
+    return {"bytes": received, "seconds": elapsed, "mbps": mbps(received, elapsed),
+            "complete": received == args.bytes, "mismatches": mismatches if args.verify else None}
+
+
+def upload(args):
+    def body(size, block=PATTERN * 64):
+        sent = 0
+        while sent < size:
+            part = block[:min(len(block), size - sent)]
+            sent += len(part)
+            yield part
+
+    conn = http.client.HTTPConnection(args.host, args.port, timeout=args.timeout)
+    start = time.monotonic()
+    conn.request("POST", "/api/net/upload", body=body(args.bytes),
+                 headers={"Content-Type": "application/octet-stream", "Content-Length": str(args.bytes),
+                          "Accept": "application/json"})
+    response = conn.getresponse()
+    payload = response.read()
+    elapsed = time.monotonic() - start
+    conn.close()
+    if response.status != 200:
+        raise RuntimeError(f"upload: HTTP {response.status}")
+    board = json.loads(payload)
+    return {"bytes": board.get("bytes", 0), "seconds": elapsed, "mbps": mbps(args.bytes, elapsed),
+            "board_mbps": board.get("mbps", 0.0), "complete": bool(board.get("complete"))}
+
+
+def echo(args, port):
+    payload = bytes((i * 7) & 0xFF for i in range(args.payload))
+    rtts = []
+    with socket.create_connection((args.host, port), timeout=args.timeout) as sock:
+        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        for _ in range(args.echo_count):
+            start = time.monotonic()
+            sock.sendall(payload)
+            received = bytearray()
+            while len(received) < len(payload):
+                block = sock.recv(len(payload) - len(received))
+                if not block:
+                    raise RuntimeError("echo: connection closed")
+                received.extend(block)
+            rtts.append((time.monotonic() - start) * 1000.0)
+            if bytes(received) != payload:
+                raise RuntimeError("echo: data mismatch")
+    ordered = sorted(rtts)
+    return {"count": len(rtts), "payload": args.payload, "min_ms": ordered[0],
+            "p50_ms": percentile(ordered, 50), "p90_ms": percentile(ordered, 90),
+            "p99_ms": percentile(ordered, 99), "max_ms": ordered[-1]}
+
+
+def board_status(args):
+    conn = http.client.HTTPConnection(args.host, args.port, timeout=args.timeout)
+    conn.request("GET", "/api/net", headers={"Accept": "application/json"})
+    response = conn.getresponse()
+    body = response.read()
+    conn.close()
+    return json.loads(body) if response.status == 200 and body else {}
+
+
+def summary(runs):
+    rates = sorted(run["mbps"] for run in runs)
+    return {"runs": runs, "min_mbps": rates[0], "median_mbps": percentile(rates, 50), "max_mbps": rates[-1]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Network throughput benchmark for the ESP32 Diagnostic board")
+    parser.add_argument("host", help="IP address or hostname of the board")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--echo-port", type=int, default=0, help="TCP echo port (default: echo_port of /api/net)")
+    parser.add_argument("--bytes", type=parse_size, default=parse_size("1M"),
+                        help="bytes per download and upload, K/M suffixes allowed (default: 1M)")
+    parser.add_argument("--repeat", type=int, default=3, help="downloads and uploads each (default: 3)")
+    parser.add_argument("--echo-count", type=int, default=200, help="echo round trips (default: 200, 0: skip)")
+    parser.add_argument("--payload", type=int, default=64, help="bytes per echo message (default: 64)")
+    parser.add_argument("--verify", action="store_true", help="check every downloaded byte against the pattern")
+    parser.add_argument("--skip", default="", help="comma-separated steps to skip: download,upload,echo")
+    parser.add_argument("--timeout", type=float, default=30.0, help="socket timeout in seconds")
+    parser.add_argument("--json", action="store_true", help="print the results as JSON")
+    args = parser.parse_args()
+
+    skip = {s.strip() for s in args.skip.split(",") if s.strip()}
+    if args.repeat < 1 or args.bytes < 1 or args.payload < 1:
+        print("ERROR: --repeat, --bytes and --payload must be positive")
+        return 1
+
+    results = {"host": args.host, "bytes": args.bytes}
+    try:
+        status = board_status(args)
+        if "download" not in skip:
+            results["download"] = summary([download(args) for _ in range(args.repeat)])
+        if "upload" not in skip:
+            results["upload"] = summary([upload(args) for _ in range(args.repeat)])
+        echo_port = args.echo_port or status.get("echo_port", 0)
+        if "echo" not in skip and args.echo_count > 0:
+            if not echo_port:
+                raise RuntimeError("echo: no port (echo service disabled on the board?)")
+            results["echo"] = echo(args, echo_port)
+    except (OSError, http.client.HTTPException, ValueError, RuntimeError) as exc:
+        print(f"ERROR: {exc}")
+        return 1
+    if "rssi" in status:
+        results["rssi"] = status["rssi"]
+
+    if args.json:
+        print(json.dumps(results, indent=2))
+        return 0
+
+    print(f"Target: http://{args.host}:{args.port}  {args.bytes} bytes x {args.repeat}"
+          + (f"  RSSI {results['rssi']} dBm" if "rssi" in results else ""))
+    for step in ("download", "upload"):
+        if step not in results:
+            continue
+        r = results[step]
+        line = f"{step:>9}: median {r['median_mbps']:.2f} Mbps (min {r['min_mbps']:.2f}, max {r['max_mbps']:.2f})"
+        if step == "upload":
+            line += f", board {percentile(sorted(run['board_mbps'] for run in r['runs']), 50):.2f} Mbps"
+        incomplete = sum(1 for run in r["runs"] if not run["complete"])
+        if incomplete:
+            line += f"  [WARN] {incomplete} incomplete"
+        mismatches = sum(run.get("mismatches") or 0 for run in r["runs"])
+        if mismatches:
+            line += f"  [WARN] {mismatches} corrupted bytes"
+        print(line)
+    if "echo" in results:
+        e = results["echo"]
+        print(f"{'echo':>9}: {e['count']} x {e['payload']} B  min {e['min_ms']:.2f}  p50 {e['p50_ms']:.2f}  "
+              f"p90 {e['p90_ms']:.2f}  p99 {e['p99_ms']:.2f}  max {e['max_ms']:.2f} ms")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+ESP32 Diagnostic - Heap Soak Test
+
+Starts /api/soak on the board: every functional test (benchmarks excluded) is
+run --runs times (one round submits all of them together). After each round the
+firmware records the free internal heap, its historical minimum and the largest
+free block. This script follows the run, then prints the checkpoints and the
+trend.
+
+Usage:
+    python tools/soak_test.py 192.168.1.50                 # 1000 rounds (a few hours)
+    python tools/soak_test.py esp32-diagnostic.local --runs 50 --poll 10
+    python tools/soak_test.py 192.168.1.50 --report-only    # last run, no new start
+
+A steady state means no drift: over the whole run, the free heap and the
+largest block must not lose more than --tolerance bytes (default 1024). The
+first round is the baseline, so one-time lazy allocations (driver init, first
+scan, ...) are not counted. Exit code 1 if either trend exceeds the tolerance.
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import http.client
+import json
+import sys
+import time
+
+
+def get(host, port, path, timeout):
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    conn.request("GET", path, headers={"Accept": "application/json"})
+    response = conn.getresponse()
+    body = response.read()
+    conn.close()
+    return response.status, json.loads(body) if body else {}
+
+
+def print_report(report, tolerance):
+    print()
+    print(f"Soak #{report['soak']}: {report['rounds']}/{report['runs']} rounds in {report['elapsed_ms'] / 60000.0:.1f} min")
+    print()
+    print(f"{'type':<12} {'passed':>7} {'failed':>7}")
+    for entry in report.get("types", []):
+        print(f"{entry['type']:<12} {entry['passed']:>7} {entry['failed']:>7}")
+    print()
+    print(f"{'round':>6} {'free heap':>10} {'min free':>10} {'largest':>10} {'free PSRAM':>11}")
+    for point in report.get("checkpoints", []):
+        print(f"{point['round']:>6} {point['free_heap']:>10} {point['min_free_heap']:>10} "
+              f"{point['largest_block']:>10} {point['free_psram']:>11}")
+    buffers = report.get("work_buffers", {})
+    if buffers:
+        print()
+        print(f"Work buffers: {buffers['count']} x {buffers['buffer_size']} bytes, high water {buffers['high_water']}, "
+              f"{buffers['acquired']} acquired, {buffers['misses']} misses")
+
+    trend = report.get("trend")
+    if not trend:
+        return True
+    rounds = max(1, report["rounds"] - 1)
+    drift_free = trend["free_heap_per_100_rounds"] * rounds / 100.0
+    drift_block = trend["largest_block_per_100_rounds"] * rounds / 100.0
+    print()
+    print(f"Free heap    : {trend['free_heap_delta']:+d} bytes since round 1, "
+          f"slope {trend['free_heap_per_100_rounds']:+.1f} B/100 rounds ({drift_free:+.0f} B over the run)")
+    print(f"Largest block: {trend['largest_block_delta']:+d} bytes since round 1, "
+          f"slope {trend['largest_block_per_100_rounds']:+.1f} B/100 rounds ({drift_block:+.0f} B over the run)")
+    ok = drift_free > -tolerance and drift_block > -tolerance
+    print("Steady state" if ok else f"[FAIL] heap drifts by more than {tolerance} bytes")
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run every diagnostic test repeatedly and check the heap trend")
+    parser.add_argument("host", help="IP address or hostname of the board")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--runs", type=int, default=1000, help="rounds, each runs every functional test once (default: 1000)")
+    parser.add_argument("--poll", type=float, default=30.0, help="progress poll interval in seconds")
+    parser.add_argument("--tolerance", type=int, default=1024, help="allowed heap loss over the run in bytes")
+    parser.add_argument("--report-only", action="store_true", help="print the last run without starting one")
+    parser.add_argument("--timeout", type=float, default=15.0, help="per-request timeout in seconds")
+    args = parser.parse_args()
+
+    try:
+        if not args.report_only:
+            status, report = get(args.host, args.port, f"/api/soak?action=start&runs={args.runs}", args.timeout)
+            if status not in (200, 202):
+                print(f"[ERROR] start: HTTP {status} {report}")
+                return 1
+            print(f"Soak #{report['soak']} started: {report['runs']} rounds")
+        while True:
+            status, report = get(args.host, args.port, "/api/soak", args.timeout)
+            if status != 200:
+                print(f"[ERROR] HTTP {status} {report}")
+                return 1
+            if report["state"] != "running" or args.report_only:
+                break
+            checkpoints = report.get("checkpoints", [])
+            last = checkpoints[-1] if checkpoints else None
+            heap = f", free heap {last['free_heap']}, largest {last['largest_block']}" if last else ""
+            print(f"  round {report['rounds']}/{report['runs']}{heap}")
+            time.sleep(args.poll)
+    except KeyboardInterrupt:
+        print("Interrupted: the soak keeps running on the board (/api/soak?action=stop to end it)")
+        return 1
+    except (OSError, http.client.HTTPException, ValueError) as exc:
+        print(f"[ERROR] {exc}")
+        return 1
+
+    return 0 if print_report(report, args.tolerance) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
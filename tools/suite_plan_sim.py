@@ -0,0 +1,286 @@
+#!/usr/bin/env python3
+"""
+ESP32 Diagnostic - Full Suite Plan Simulator
+
+Replays on the host the plan used by /api/suite?action=run. Each test is
+submitted as a job, in SUITE_TESTS order. Workers are pinned alternately to
+core 0 and core 1. A free worker takes the highest-priority queued job
+(FIFO within a priority) whose resources and GPIOs are not held by a running
+job. This mirrors JobScheduler::takeNext() in include/job_scheduler.h.
+
+The pins come from include/board_config.h for the selected target. The
+script prints the resulting schedule and checks it: every test runs once,
+and no two overlapping tests share a resource or a GPIO. It then compares
+the makespan with the serial time and a lower bound.
+
+Usage:
+    python tools/suite_plan_sim.py                       # both targets, firmware estimates
+    python tools/suite_plan_sim.py --target classic --workers 2
+    python tools/suite_plan_sim.py --report suite.json   # durations measured on the board
+    python tools/suite_plan_sim.py --jitter 0.3 --runs 500
+
+suite.json is a saved /api/suite response; its run_ms values replace the
+estimates. The tests, their order, estimates and resources are read from
+SUITE_TESTS and the JobType table in src/main.cpp; only the mapping from a
+JobType pins function to board_config.h macros (PIN_MACROS) lives here, and
+the script stops if a suite job uses a pins function it does not know.
+"""
+
+import argparse
+import json
+import random
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+BOARD_CONFIG = ROOT / "include" / "board_config.h"
+MAIN_CPP = ROOT / "src" / "main.cpp"
+
+TARGETS = {"s3": "TARGET_ESP32_S3", "classic": "TARGET_ESP32_CLASSIC"}
+
+# TestResource bits of src/main.cpp
+RESOURCE_NAMES = {
+    "RES_I2C_BUS": "i2c",
+    "RES_SPI_HOST": "spi",
+    "RES_LEDC_CH0": "ledc0",
+    "RES_UART1": "uart1",
+    "RES_RMT": "rmt",
+    "RES_WIFI_RADIO": "wifi",
+}
+
+# JobType pins function -> GPIO macros from board_config.h
+PIN_MACROS = {
+    "gpsPins": ["GPS_RXD", "GPS_TXD"],
+    "i2cPins": ["I2C_SDA", "I2C_SCL"],
+    "rotaryPins": ["ROTARY_CLK", "ROTARY_DT", "ROTARY_SW"],
+    "sdPins": ["SD_MISO", "SD_MOSI", "SD_SCLK", "SD_CS"],
+    "builtinLedPins": ["LED_BUILTIN"],
+    "buzzerPins": ["BUZZER"],
+    "neopixelPins": ["NEOPIXEL"],
+    "rgbLedPins": ["LED_RED", "LED_GREEN", "LED_BLUE"],
+    "pwmPins": ["PWM_TEST_PIN"],
+    "dhtPins": ["DHT"],
+    "distanceSensorPins": ["DISTANCE_TRIG", "DISTANCE_ECHO"],
+    "lightSensorPins": ["LIGHT_SENSOR"],
+    "motionSensorPins": ["MOTION_SENSOR"],
+}
+
+# Pins that do not come from board_config.h
+EXTRA_PINS = {
+    # ESP32-S3: LED_BUILTIN is the RGB LED on GPIO48, and testPWM() uses GPIO48
+    "s3": {"LED_BUILTIN": 48, "PWM_TEST_PIN": 48},
+    # Classic: testPWM() drives GPIO2 (LED_BUILTIN comes from board_config.h)
+    "classic": {"PWM_TEST_PIN": 2},
+}
+
+
+def parse_board_config(target):
+    """#define NAME value of one target block, aliases resolved"""
+    text = BOARD_CONFIG.read_text(encoding="utf-8", errors="replace")
+    blocks = re.split(r"^#(?:if|elif)\s+defined\((TARGET_\w+)\)", text, flags=re.M)
+    body = ""
+    for i in range(1, len(blocks) - 1, 2):
+        if blocks[i] == TARGETS[target]:
+            body = blocks[i + 1]
+    if not body:
+        raise SystemExit(f"target {target} not found in {BOARD_CONFIG}")
+    raw = dict(re.findall(r"^\s*#define\s+(\w+)\s+(-?\w+)", body, flags=re.M))
+    values = {}
+    for name in raw:
+        value, seen = raw[name], set()
+        while value in raw and value not in seen:
+            seen.add(value)
+            value = raw[value]
+        try:
+            values[name] = int(value, 0)
+        except ValueError:
+            pass
+    values.update(EXTRA_PINS[target])
+    return values
+
+
+def parse_suite_tests(target):
+    """[(name, estimate ms, resources, GPIO macros)] in SUITE_TESTS order"""
+    text = MAIN_CPP.read_text(encoding="utf-8", errors="replace")
+    job_types = {
+        var: (name, resources.strip(), pins)
+        for var, name, resources, pins in re.findall(
+            r'static const JobType (\w+) = \{"(\w+)", \w+, \d+, \d+, ([^,]+),\s*(\w+)\};', text)
+    }
+    # Resource constants that depend on the chip (#if defined(CONFIG_IDF_TARGET_ESP32S3) ... #else ...)
+    per_target = {
+        name: s3 if target == "s3" else other
+        for name, s3, other in re.findall(
+            r"#if defined\(CONFIG_IDF_TARGET_ESP32S3\)\s*static const uint32_t (\w+) = ([^;]+);\s*"
+            r"#else\s*static const uint32_t \1 = ([^;]+);", text)
+    }
+    suite = re.search(r"static const SuiteTest SUITE_TESTS\[\] = \{(.*?)\n\};", text, flags=re.S)
+    if suite is None:
+        raise SystemExit(f"SUITE_TESTS not found in {MAIN_CPP}")
+    tests = []
+    for var, estimate in re.findall(r"\{&(\w+), (\d+)\}", suite.group(1)):
+        if var not in job_types:
+            raise SystemExit(f"JobType {var} not found in {MAIN_CPP}")
+        name, expression, pins = job_types[var]
+        resources = set()
+        for token in (t.strip() for t in expression.split("|")):
+            token = per_target.get(token, token).strip()
+            if token == "0":
+                continue
+            if token not in RESOURCE_NAMES:
+                raise SystemExit(f"{name}: unknown resource {token}, add it to RESOURCE_NAMES")
+            resources.add(RESOURCE_NAMES[token])
+        if pins not in PIN_MACROS:
+            raise SystemExit(f"{name}: unknown pins function {pins}, add it to PIN_MACROS")
+        tests.append((name, int(estimate), resources, PIN_MACROS[pins]))
+    return tests
+
+
+def build_jobs(target, durations):
+    pins = parse_board_config(target)
+    jobs = []
+    for order, (name, estimate, resources, macros) in enumerate(parse_suite_tests(target)):
+        gpios = {pins[m] for m in macros if m in pins and pins[m] >= 0}
+        missing = [m for m in macros if m not in pins]
+        if missing:
+            print(f"  [WARN] {target}/{name}: no value for {', '.join(missing)}")
+        jobs.append({"name": name, "order": order, "duration": durations.get(name, estimate),
+                     "claims": {f"res:{r}" for r in resources} | {f"gpio:{g}" for g in gpios}})
+    return jobs
+
+
+def conflicts(a, b):
+    return bool(a["claims"] & b["claims"])
+
+
+def simulate(jobs, workers):
+    """Event-driven list scheduling identical to the firmware policy"""
+    queued = sorted(jobs, key=lambda j: j["order"])  # same priority: FIFO by submission
+    running = []  # (end, worker, job)
+    free = list(range(workers))
+    schedule = []
+    now = 0
+    while queued or running:
+        free.sort()
+        for worker in list(free):
+            busy = [job for _, _, job in running]
+            pick = next((j for j in queued if not any(conflicts(j, b) for b in busy)), None)
+            if pick is None:
+                break
+            queued.remove(pick)
+            free.remove(worker)
+            end = now + pick["duration"]
+            running.append((end, worker, pick))
+            schedule.append({"name": pick["name"], "worker": worker, "core": worker % 2,
+                             "start": now, "end": end, "job": pick})
+        if not running:
+            raise RuntimeError("deadlock: queued jobs but nothing runnable")
+        running.sort(key=lambda r: (r[0], r[1]))
+        now = running[0][0]
+        while running and running[0][0] == now:
+            _, worker, _ = running.pop(0)
+            free.append(worker)
+    return schedule
+
+
+def verify(schedule, jobs):
+    errors = []
+    names = [s["name"] for s in schedule]
+    for job in jobs:
+        if names.count(job["name"]) != 1:
+            errors.append(f"{job['name']} ran {names.count(job['name'])} times")
+    for i, a in enumerate(schedule):
+        for b in schedule[i + 1:]:
+            overlap = a["start"] < b["end"] and b["start"] < a["end"]
+            if overlap and conflicts(a["job"], b["job"]):
+                shared = ", ".join(sorted(a["job"]["claims"] & b["job"]["claims"]))
+                errors.append(f"{a['name']} and {b['name']} overlap while sharing {shared}")
+            if overlap and a["worker"] == b["worker"]:
+                errors.append(f"{a['name']} and {b['name']} overlap on worker {a['worker']}")
+    return errors
+
+
+def lower_bound(jobs, workers):
+    """max(total / workers, longest job, heaviest single claim)"""
+    total = sum(j["duration"] for j in jobs)
+    per_claim = {}
+    for job in jobs:
+        for claim in job["claims"]:
+            per_claim[claim] = per_claim.get(claim, 0) + job["duration"]
+    heaviest = max(per_claim.items(), key=lambda kv: kv[1], default=("-", 0))
+    bound = max(total / workers, max(j["duration"] for j in jobs), heaviest[1])
+    return bound, heaviest
+
+
+def conflict_edges(jobs):
+    return [(a["name"], b["name"], sorted(a["claims"] & b["claims"]))
+            for i, a in enumerate(jobs) for b in jobs[i + 1:] if conflicts(a, b)]
+
+
+def load_report(path):
+    report = json.loads(Path(path).read_text(encoding="utf-8"))
+    return {j["type"]: j["run_ms"] for j in report.get("jobs", []) if "run_ms" in j}
+
+
+def run_target(target, args, durations):
+    jobs = build_jobs(target, durations)
+    print(f"=== {target} ({TARGETS[target]}), {args.workers} workers ===")
+    edges = conflict_edges(jobs)
+    print(f"Conflict graph: {len(edges)} edges")
+    for a, b, shared in edges:
+        print(f"  {a:<12} -- {b:<12} {', '.join(shared)}")
+
+    schedule = simulate(jobs, args.workers)
+    errors = verify(schedule, jobs)
+    makespan = max(s["end"] for s in schedule)
+    serial = sum(j["duration"] for j in jobs)
+    bound, heaviest = lower_bound(jobs, args.workers)
+
+    print()
+    print(f"{'test':<12} {'worker':>6} {'core':>4} {'start ms':>9} {'end ms':>8}")
+    for s in sorted(schedule, key=lambda s: (s["start"], s["worker"])):
+        print(f"{s['name']:<12} {s['worker']:>6} {s['core']:>4} {s['start']:>9} {s['end']:>8}")
+    print()
+    print(f"Makespan   : {makespan} ms")
+    print(f"Serial     : {serial} ms (one test at a time), speed-up x{serial / makespan:.2f}")
+    print(f"Lower bound: {bound:.0f} ms (heaviest claim {heaviest[0]}: {heaviest[1]} ms), "
+          f"plan at {100.0 * makespan / bound:.0f}% of it")
+
+    if args.jitter > 0:
+        rng = random.Random(args.seed)
+        spans = []
+        for _ in range(args.runs):
+            jittered = [dict(j, duration=max(1, round(j["duration"] * rng.uniform(1 - args.jitter, 1 + args.jitter))))
+                        for j in jobs]
+            run = simulate(jittered, args.workers)
+            errors += verify(run, jittered)
+            spans.append(max(s["end"] for s in run))
+        spans.sort()
+        print(f"Jitter +/-{args.jitter:.0%} over {args.runs} runs: median {spans[len(spans) // 2]} ms, "
+              f"p95 {spans[min(len(spans) - 1, int(len(spans) * 0.95))]} ms, max {spans[-1]} ms")
+
+    for error in errors[:20]:
+        print(f"  [ERROR] {error}")
+    print()
+    return not errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Simulate the resource-aware full-suite schedule")
+    parser.add_argument("--target", choices=sorted(TARGETS) + ["all"], default="all")
+    parser.add_argument("--workers", type=int, default=4, help="JOB_WORKER_COUNT (default: 4)")
+    parser.add_argument("--report", help="saved /api/suite JSON whose run_ms replace the estimates")
+    parser.add_argument("--jitter", type=float, default=0.0, help="random duration spread, e.g. 0.3 for +/-30%%")
+    parser.add_argument("--runs", type=int, default=200, help="jitter iterations (default: 200)")
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    durations = load_report(args.report) if args.report else {}
+    targets = sorted(TARGETS) if args.target == "all" else [args.target]
+    ok = all([run_target(t, args, durations) for t in targets])
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -23,17 +23,55 @@ function setTranslationsCache(t) {
     }
 }
 
+const TRANSLATION_STORAGE_PREFIX = 'esp32diag_tr_';
+
+function readStoredTranslations(key) {
+    try {
+        const raw = window.localStorage.getItem(key);
+        return raw ? JSON.parse(raw) : null;
+    } catch (e) {
+        return null;
+    }
+}
+
+function storeTranslations(prefix, key, data) {
+    try {
+        const storage = window.localStorage;
+        for (let i = storage.length - 1; i >= 0; i--) {
+            const existing = storage.key(i);
+            if (existing && existing.indexOf(prefix) === 0 && existing !== key) storage.removeItem(existing);
+        }
+        storage.setItem(key, JSON.stringify(data));
+    } catch (e) {}
+}
+
 function fetchTranslations(lang) {
-    const params = ['ts=' + Date.now()];
-    if (lang) {
-        params.push('lang=' + encodeURIComponent(lang));
+    const target = lang || currentLang;
+    const version = (typeof TRANSLATIONS_VERSION === 'object' && TRANSLATIONS_VERSION) ? TRANSLATIONS_VERSION[target] : null;
+    if (!version) {
+        const params = ['ts=' + Date.now()];
+        if (lang) {
+            params.push('lang=' + encodeURIComponent(lang));
+        }
+        const endpoint = '/api/get-translations?' + params.join('&');
+        return fetch(endpoint, {
+            cache: 'no-store'
+        }).then(r => {
+            if (!r.ok) throw new Error('translation fetch failed');
+            return r.json();
+        });
     }
-    const endpoint = '/api/get-translations?' + params.join('&');
-    return fetch(endpoint, {
-        cache: 'no-store'
-    }).then(r => {
+    const prefix = TRANSLATION_STORAGE_PREFIX + target + '_';
+    const key = prefix + version;
+    const stored = readStoredTranslations(key);
+    if (stored) return Promise.resolve(stored);
+    const endpoint = '/api/get-translations?lang=' + encodeURIComponent(target) + '&v=' + encodeURIComponent(version);
+    return fetch(endpoint).then(r => {
         if (!r.ok) throw new Error('translation fetch failed');
         return r.json();
+    }).then(t => {
+        storeTranslations(prefix, key, t);
+        return t;
     });
 }
 
@@ -334,19 +372,128 @@ document.addEventListener('DOMContentLoaded', () => {
     initNavigation();
     applyAccessLinkScheme();
     loadAllData();
+    startLiveEvents();
     startAutoUpdate();
 });
 
 function startAutoUpdate() {
     if (updateTimer) clearInterval(updateTimer);
     updateTimer = setInterval(() => {
-        if (isConnected) updateLiveData();
+        if (isConnected && !liveStreamOpen) updateLiveData();
     }, UPDATE_INTERVAL);
 }
+// Server-Sent Events: /api/events pushes only changed fields, polling remains the fallback
+const LIVE_TOPICS = ['status', 'buttons', 'rotary'];
+const LIVE_RATE_MS = 100;
+const LIVE_RETRY_MS = 30000;
+let liveSource = null;
+let liveStreamOpen = false;
+const liveState = {};
+const liveListeners = {};
+
+function startLiveEvents() {
+    if (!window.EventSource || liveSource) return;
+    const source = new EventSource('/api/events?topics=' + LIVE_TOPICS.join(',') + ',jobs&rate=' + LIVE_RATE_MS);
+    liveSource = source;
+    source.onopen = () => {
+        liveStreamOpen = true;
+    };
+    source.onerror = () => {
+        liveStreamOpen = false;
+        if (source.readyState === EventSource.CLOSED) {
+            liveSource = null;
+            setTimeout(startLiveEvents, LIVE_RETRY_MS);
+        }
+    };
+    LIVE_TOPICS.forEach(topic => {
+        source.addEventListener(topic, e => {
+            let delta;
+            try {
+                delta = JSON.parse(e.data);
+            } catch (err) {
+                return;
+            }
+            const state = Object.assign(liveState[topic] || {}, delta);
+            liveState[topic] = state;
+            (liveListeners[topic] || []).forEach(fn => fn(state));
+        });
+    });
+    source.addEventListener('job', e => {
+        let job;
+        try {
+            job = JSON.parse(e.data);
+        } catch (err) {
+            return;
+        }
+        if (job.final && jobWaiters[job.id]) jobWaiters[job.id](job.state);
+    });
+}
+
+function onLiveTopic(topic, fn) {
+    const list = liveListeners[topic] || (liveListeners[topic] = []);
+    list.push(fn);
+    if (liveState[topic]) fn(liveState[topic]);
+    return () => {
+        const i = list.indexOf(fn);
+        if (i >= 0) list.splice(i, 1);
+    };
+}
+// Uses the event stream when it is up, interval polling otherwise; returns a stop function
+function startMonitor(topic, onLive, poll, intervalMs) {
+    if (liveStreamOpen) return onLiveTopic(topic, onLive);
+    const id = setInterval(() => {
+        poll().catch(err => console.error('Erreur:', err));
+    }, intervalMs);
+    return () => clearInterval(id);
+}
+// Slow tests answer 202 with a job: wait for it (SSE "job" event or polling), then read the cached result
+const JOB_POLL_MS = 500;
+const jobWaiters = {};
+
+function waitForJob(job) {
+    return new Promise(resolve => {
+        let timer = null;
+        const done = state => {
+            clearTimeout(timer);
+            delete jobWaiters[job.job_id];
+            resolve(state);
+        };
+        const poll = async () => {
+            try {
+                const r = await fetch(job.status_url);
+                const s = r.ok ? await r.json() : null;
+                if (!s || s.final) return done(s && s.state);
+            } catch (err) {
+                return done();
+            }
+            timer = setTimeout(poll, JOB_POLL_MS);
+        };
+        jobWaiters[job.job_id] = done;
+        timer = setTimeout(poll, JOB_POLL_MS);
+    });
+}
+
+async function fetchJobResult(url) {
+    const r = await fetch(url);
+    if (r.status !== 202) return r.json();
+    const job = await r.json();
+    // A cancelled job leaves no result: asking again would only queue a new one
+    if (await waitForJob(job) === 'cancelled') throw new Error('job ' + job.job_id + ' cancelled');
+    return fetchJobResult(job.result_url);
+}
+onLiveTopic('status', d => {
+    updateRealtimeValues(d);
+    isConnected = true;
+    updateStatusIndicator(true);
+});
 async function loadAllData() {
     showUpdateIndicator();
     try {
-        await Promise.all([updateSystemInfo(), updateMemoryInfo(), updateWiFiInfo(), updatePeripheralsInfo()]);
+        // One round-trip for the header data, projected to the fields actually rendered
+        const r = await fetch('/api/batch?sections=system&fields=chipModel,ipAddress');
+        if (!r.ok) throw new Error('batch fetch failed');
+        const d = await r.json();
+        updateSystemInfo(d.system || {});
         isConnected = true;
         updateStatusIndicator(true);
     } catch (error) {
@@ -369,9 +516,7 @@ async function updateLiveData() {
         updateStatusIndicator(false);
     }
 }
-async function updateSystemInfo() {
-    const r = await fetch('/api/system-info');
-    const d = await r.json();
+function updateSystemInfo(d) {
     const chipModelEl = document.getElementById('chipModel');
     if (chipModelEl) {
         chipModelEl.textContent = d.chipModel || '';
@@ -409,15 +554,6 @@ async function updateSystemInfo() {
     }
     applyAccessLinkScheme();
 }
-async function updateMemoryInfo() {
-    await fetch('/api/memory');
-}
-async function updateWiFiInfo() {
-    await fetch('/api/wifi-info');
-}
-async function updatePeripheralsInfo() {
-    await fetch('/api/peripherals');
-}
 
 function showTab(tabName, btn) {
     var contents = document.querySelectorAll('.tab-content');
@@ -508,11 +644,9 @@ async function loadTab(tabName) {
             const d = await r.json();
             tab.innerHTML = buildOverview(d);
         } else if (tabName === 'display-signal') {
-            const leds = await fetch('/api/leds-info');
-            const screens = await fetch('/api/screens-info');
-            const ld = await leds.json();
-            const sd = await screens.json();
-            tab.innerHTML = buildDisplaySignal(ld, sd);
+            const r = await fetch('/api/batch?sections=leds,screens');
+            const d = await r.json();
+            tab.innerHTML = buildDisplaySignal(d.leds, d.screens);
         } else if (tabName === 'sensors') {
             tab.innerHTML = buildSensors();
             loadEnvironmentalData();
@@ -1366,8 +1500,7 @@ async function testAllGPIO() {
     setStatus('gpio-status', {
         key: 'test_in_progress'
     }, null);
-    const r = await fetch('/api/test-gpio');
-    const d = await r.json();
+    const d = await fetchJobResult('/api/test-gpio');
     let h = '';
     d.results.forEach(g => {
         h += '<div class="gpio-item ' + (g.working ? 'gpio-ok' : 'gpio-fail') + '">GPIO ' + g.pin + '<br>' + (g.working ? '✅ OK' : '❌ FAIL') + '</div>';
@@ -1384,8 +1517,7 @@ async function scanWiFi() {
     setStatus('wifi-status', {
         key: 'wifi_scan_in_progress'
     }, null);
-    const r = await fetch('/api/wifi-scan');
-    const d = await r.json();
+    const d = await fetchJobResult('/api/wifi-scan');
     let h = '';
     d.networks.forEach(n => {
         const icon = n.rssi >= -60 ? '🟢' : n.rssi >= -70 ? '🟡' : '🔴';
@@ -1485,8 +1617,7 @@ async function testGPS() {
         key: 'test_in_progress'
     }, null);
     try {
-        const r = await fetch('/api/gps-test');
-        const d = await r.json();
+        const d = await fetchJobResult('/api/gps-test');
         setStatus('gps-test-status', {
             text: d.result || 'Test complete'
         }, d.success ? 'success' : 'error');
@@ -1584,8 +1715,7 @@ async function runBenchmarks() {
         key: 'test_in_progress'
     });
     try {
-        const r = await fetch('/api/benchmark');
-        const d = await r.json();
+        const d = await fetchJobResult('/api/benchmark');
         if (cpuNode) {
             if (typeof d.cpu === 'number' && isFinite(d.cpu)) {
                 clearTranslationAttributes(cpuNode);
@@ -1857,8 +1987,7 @@ async function testDHTSensor() {
         key: 'test_in_progress'
     }, null);
     document.getElementById('dht-results').innerHTML = '';
-    const r = await fetch('/api/dht-test');
-    const d = await r.json();
+    const d = await fetchJobResult('/api/dht-test');
     if (d.type !== undefined) {
         document.getElementById('dhtSensorType').value = String(d.type);
     }
@@ -2014,12 +2143,23 @@ async function testRotary() {
     const d = await r.json();
     setStatus('rotary-status', d.result, d.success ? 'success' : 'error');
 }
-let rotaryMonitorInterval = null;
+let rotaryMonitorStop = null;
+
+function renderRotaryState(d) {
+    const posEl = document.getElementById('rotary-position');
+    const btnEl = document.getElementById('rotary-button');
+    if (posEl) posEl.textContent = d.position;
+    if (btnEl) {
+        btnEl.textContent = d.button_pressed ? tr('button_pressed') : tr('button_released');
+        btnEl.style.color = d.button_pressed ? '#dc3545' : '#28a745';
+        btnEl.style.fontWeight = d.button_pressed ? 'bold' : 'normal';
+    }
+}
 async function toggleRotaryMonitoring() {
     const btn = document.getElementById('rotary-monitor-btn');
-    if (rotaryMonitorInterval) {
-        clearInterval(rotaryMonitorInterval);
-        rotaryMonitorInterval = null;
+    if (rotaryMonitorStop) {
+        rotaryMonitorStop();
+        rotaryMonitorStop = null;
         btn.textContent = '👁️ ' + tr('monitor_button');
         btn.className = 'btn btn-info';
         setStatus('rotary-status', tr('stop_monitoring'), null);
@@ -2028,17 +2168,9 @@ async function toggleRotaryMonitoring() {
     btn.textContent = '⏸️ ' + tr('stop_monitoring');
     btn.className = 'btn btn-danger';
     setStatus('rotary-status', tr('monitor_button') + '...', 'success');
-    rotaryMonitorInterval = setInterval(async () => {
+    rotaryMonitorStop = startMonitor('rotary', renderRotaryState, async () => {
         const r = await fetch('/api/rotary-position');
-        const d = await r.json();
-        const posEl = document.getElementById('rotary-position');
-        const btnEl = document.getElementById('rotary-button');
-        if (posEl) posEl.textContent = d.position;
-        if (btnEl) {
-            btnEl.textContent = d.button_pressed ? tr('button_pressed') : tr('button_released');
-            btnEl.style.color = d.button_pressed ? '#dc3545' : '#28a745';
-            btnEl.style.fontWeight = d.button_pressed ? 'bold' : 'normal';
-        }
+        renderRotaryState(await r.json());
     }, 100);
 }
 async function resetRotaryPosition() {
@@ -2048,74 +2180,63 @@ async function resetRotaryPosition() {
     const posEl = document.getElementById('rotary-position');
     if (posEl) posEl.textContent = '0';
 }
-let bootButtonMonitorInterval = null;
+function renderButtonState(elementId, pressed) {
+    const stateEl = document.getElementById(elementId);
+    if (stateEl) {
+        stateEl.textContent = pressed ? tr('button_pressed') : tr('button_released');
+        stateEl.style.color = pressed ? '#dc3545' : '#28a745';
+        stateEl.style.fontWeight = pressed ? 'bold' : 'normal';
+    }
+}
+
+function startButtonMonitor(button, key, elementId) {
+    return startMonitor('buttons', d => renderButtonState(elementId, d[key + '_pressed']), async () => {
+        const r = await fetch('/api/button-state?button=' + button);
+        const d = await r.json();
+        renderButtonState(elementId, d.pressed);
+    }, 100);
+}
+let bootButtonMonitorStop = null;
 async function toggleBootButtonMonitoring() {
     const btn = document.getElementById('boot-monitor-btn');
-    if (bootButtonMonitorInterval) {
-        clearInterval(bootButtonMonitorInterval);
-        bootButtonMonitorInterval = null;
+    if (bootButtonMonitorStop) {
+        bootButtonMonitorStop();
+        bootButtonMonitorStop = null;
         btn.textContent = '👁️ ' + tr('monitor_button');
         btn.className = 'btn btn-info';
         return;
     }
     btn.textContent = '⏸️ ' + tr('stop_monitoring');
     btn.className = 'btn btn-danger';
-    bootButtonMonitorInterval = setInterval(async () => {
-        const r = await fetch('/api/button-state?button=boot');
-        const d = await r.json();
-        const stateEl = document.getElementById('boot-button-state');
-        if (stateEl) {
-            stateEl.textContent = d.pressed ? tr('button_pressed') : tr('button_released');
-            stateEl.style.color = d.pressed ? '#dc3545' : '#28a745';
-            stateEl.style.fontWeight = d.pressed ? 'bold' : 'normal';
-        }
-    }, 100);
+    bootButtonMonitorStop = startButtonMonitor('boot', 'boot', 'boot-button-state');
 }
-let button1MonitorInterval = null;
+let button1MonitorStop = null;
 async function toggleButton1Monitoring() {
     const btn = document.getElementById('button1-monitor-btn');
-    if (button1MonitorInterval) {
-        clearInterval(button1MonitorInterval);
-        button1MonitorInterval = null;
+    if (button1MonitorStop) {
+        button1MonitorStop();
+        button1MonitorStop = null;
         btn.textContent = '👁️ ' + tr('monitor_button');
         btn.className = 'btn btn-info';
         return;
     }
     btn.textContent = '⏸️ ' + tr('stop_monitoring');
     btn.className = 'btn btn-danger';
-    button1MonitorInterval = setInterval(async () => {
-        const r = await fetch('/api/button-state?button=1');
-        const d = await r.json();
-        const stateEl = document.getElementById('button1-state');
-        if (stateEl) {
-            stateEl.textContent = d.pressed ? tr('button_pressed') : tr('button_released');
-            stateEl.style.color = d.pressed ? '#dc3545' : '#28a745';
-            stateEl.style.fontWeight = d.pressed ? 'bold' : 'normal';
-        }
-    }, 100);
+    button1MonitorStop = startButtonMonitor('1', 'button1', 'button1-state');
 }
-let button2MonitorInterval = null;
+let button2MonitorStop = null;
 async function toggleButton2Monitoring() {
     const btn = document.getElementById('button2-monitor-btn');
-    if (button2MonitorInterval) {
-        clearInterval(button2MonitorInterval);
-        button2MonitorInterval = null;
+    if (button2MonitorStop) {
+        button2MonitorStop();
+        button2MonitorStop = null;
         btn.textContent = '👁️ ' + tr('monitor_button');
         btn.className = 'btn btn-info';
         return;
     }
     btn.textContent = '⏸️ ' + tr('stop_monitoring');
     btn.className = 'btn btn-danger';
-    button2MonitorInterval = setInterval(async () => {
-        const r = await fetch('/api/button-state?button=2');
-        const d = await r.json();
-        const stateEl = document.getElementById('button2-state');
-        if (stateEl) {
-            stateEl.textContent = d.pressed ? tr('button_pressed') : tr('button_released');
-            stateEl.style.color = d.pressed ? '#dc3545' : '#28a745';
-            stateEl.style.fontWeight = d.pressed ? 'bold' : 'normal';
-        }
-    }, 100);
+    button2MonitorStop = startButtonMonitor('2', 'button2', 'button2-state');
 }
 async function applyButtonConfig(buttonId) {
     const pin = document.getElementById(buttonId + '-pin').value;